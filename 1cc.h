@@ -2,6 +2,7 @@
 #include <assert.h>
 #include <ctype.h>
 #include <errno.h>
+#include <limits.h>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdint.h>
@@ -18,6 +19,14 @@ typedef struct Node Node;
 typedef struct Member Member;
 typedef struct Relocation Relocation;
 
+//
+// main.c
+//
+
+extern bool opt_omit_frame_pointer;
+extern int opt_unroll;
+extern bool opt_vectorize;
+
 //
 // tokenize.c
 //
@@ -72,6 +81,7 @@ struct Obj {
 
   // ローカル変数用
   int offset;         // rbpからのオフセット
+  int reg;            // 割り当てられたレジスタの番号。スタック上なら-1
 
   // グローバル変数 / 関数用
   bool is_function;   // 関数かグローバル変数か
@@ -80,6 +90,7 @@ struct Obj {
   // グローバル変数
   char *init_data;    // 初期化のためのデータ
   Relocation *rel;
+  bool is_readonly;   // .rodataに置くか
 
   // 関数用
   Obj *params;        // 関数の仮引数
@@ -127,6 +138,7 @@ typedef enum {
   ND_RETURN,    // return
   ND_IF,        // if
   ND_WHILE,     // while
+  ND_DO,        // do while
   ND_FOR,       // for
   ND_SWITCH,    // switch
   ND_CASE,      // case
@@ -140,8 +152,20 @@ typedef enum {
   ND_NUM,       // 整数
   ND_CAST,      // 型キャスト
   ND_MEMZERO,   // スタック変数の0初期化
+  ND_VECTOR,    // SSE2で16バイトずつ処理するループ
 } NodeKind;
 
+// ND_VECTORでレーンごとに行う演算
+typedef enum {
+  VEC_ADD,
+  VEC_SUB,
+  VEC_AND,
+  VEC_OR,
+  VEC_XOR,
+  VEC_MIN,
+  VEC_MAX,
+} VecOp;
+
 struct Node {
   NodeKind kind;  // ノードの種類
   Node *next;     // 次のノード
@@ -183,11 +207,26 @@ struct Node {
   Node *case_next;
   Node *default_case;
 
+  // ND_MEMZERO
+  int zero_offset; // 0初期化を始める変数の先頭からの位置
+  int zero_size;   // 0初期化するバイト数
+
+  // ND_VECTOR
+  VecOp vec_op;    // レーンごとの演算
+  int vec_size;    // 配列の要素のバイト数
+  int lane_size;   // 演算するレーンのバイト数。要素を符号拡張して足すときは大きくなる
+
   Obj *var;       // ND_VARのとき使う。変数。
   int64_t val;    // ノードがND_NUMのときに使う。数値。
 };
 
+Node *new_node(NodeKind kind, Token *tok);
+Node *new_binary(NodeKind kind, Node *lhs, Node *rhs, Token *tok);
+Node *new_unary(NodeKind kind, Node *expr, Token *tok);
+Node *new_num(int64_t val, Token *tok);
+Node *new_var_node(Obj *var, Token *tok);
 Node *new_cast(Node *expr, Type *ty);
+int64_t eval(Node *node);
 Obj *parse(Token *tok);
 
 //
@@ -196,6 +235,20 @@ Obj *parse(Token *tok);
 
 void codegen(Obj *prog, FILE *out);
 int align_to(int n, int align);
+char *format(char *fmt, ...);
+
+//
+// peephole.c
+//
+
+void peephole(char *buf, FILE *out);
+
+//
+// optimize.c
+//
+
+Obj *optimize(Obj *prog);
+void dump_ast(Obj *prog, FILE *out);
 
 //
 // type.c
@@ -1,7 +1,22 @@
 #include "1cc.h"
 
-// 使ってるスタックの深さ。push/popごとに増減
+// 退避中の途中結果の数。push/popごとに増減
 static int depth;
+// この関数でdepthが最大でいくつになったか
+static int max_depth;
+// callee-savedレジスタ群。先頭からレジスタ変数に割り当て、残りは
+// 式の途中結果の退避に使う。関数呼び出しをまたいでも値が壊れない。
+// 途中結果用のレジスタが足りなくなったらスタックフレーム上の
+// 退避領域にスピルする。
+static char *calleereg32[] = {"ebx", "r12d", "r13d", "r14d", "r15d"};
+static char *calleereg64[] = {"rbx", "r12", "r13", "r14", "r15"};
+#define NUM_CALLEEREG (sizeof(calleereg64) / sizeof(*calleereg64))
+// レジスタ変数の最大数。少なくとも2つは途中結果用に残しておく。
+#define MAX_REGVARS 3
+// この関数でレジスタに割り当てた変数の数
+static int num_regvars;
+// ローカル変数の領域のサイズ。スピル領域はこの直後に置く。
+static int locals_size;
 // 関数呼び出し時に引数をセットするレジスタ群 
 static char *argreg8[] = {"dil", "sil", "dl", "cl", "r8b", "r9b"};
 static char *argreg16[] = {"di", "si", "dx", "cx", "r8w", "r9w"};
@@ -9,12 +24,27 @@ static char *argreg32[] = {"edi", "esi", "edx", "ecx", "r8d", "r9d"};
 static char *argreg64[] = {"rdi", "rsi", "rdx", "rcx", "r8", "r9"};
 // 現在処理している関数
 static Obj *current_fn;
+// ローカル変数のアドレスが取られていて、関数から出た後も
+// 参照されるかもしれないならtrue。末尾呼び出しを最適化できない。
+static bool frame_escapes;
+// 関数呼び出しを含むならtrue
+static bool has_call;
+// ローカル変数をアドレッシングするときのベースレジスタ。
+// フレームを作らない関数ではrspからレッドゾーンを使う。
+static char *frame_reg = "rbp";
+// 末尾呼び出しで呼ぶ関数。エピローグの後にジャンプ先を置く。
+static char *tail_callees[16];
+static int num_tail_callees;
+// 関数を呼ばない関数がrspより下に使ってよい領域の大きさ
+#define RED_ZONE_SIZE 128
 
 // 出力先ファイル
 static FILE *output_file;
 
 static void gen_expr(Node *node);
 static void gen_stmt(Node *node);
+static void gen_addr(Node *node);
+static void store_params(Obj *fn);
 
 // ラベル用カウンタ
 static int count(void) {
@@ -30,134 +60,1333 @@ static void println(char *fmt, ...) {
   fprintf(output_file, "\n");
 }
 
+// 途中結果の退避に使えるレジスタの数
+static int num_tmpreg(void) {
+  return NUM_CALLEEREG - num_regvars;
+}
+
+// depth番目の途中結果のスピル先のフレームベースからのオフセット
+static int spill_offset(int d) {
+  return locals_size + (d - num_tmpreg() + 1) * 8;
+}
+
+// printf形式で書式化した文字列を新しく確保して返す
+char *format(char *fmt, ...) {
+  char *buf;
+  size_t buflen;
+  FILE *out = open_memstream(&buf, &buflen);
+
+  va_list ap;
+  va_start(ap, fmt);
+  vfprintf(out, fmt, ap);
+  va_end(ap);
+  fclose(out);
+  return buf;
+}
+
 static void push(void) {
-  println("  push rax");
+  if (depth < num_tmpreg())
+    println("  mov %s, rax", calleereg64[num_regvars + depth]);
+  else
+    println("  mov [%s-%d], rax", frame_reg, spill_offset(depth));
+
   depth++;
+  max_depth = MAX(max_depth, depth);
+}
+
+static void pop(char *arg) {
+  depth--;
+
+  if (depth < num_tmpreg())
+    println("  mov %s, %s", arg, calleereg64[num_regvars + depth]);
+  else
+    println("  mov %s, [%s-%d]", arg, frame_reg, spill_offset(depth));
+}
+
+// nを`align`の最も近い倍数に丸める。
+// 例えば、align_to(5, 8)だと8に、align(11, 8)だと16になる。
+int align_to(int n, int align) {
+  return (n + align - 1) / align * align;
+}
+
+// sizeバイトのメモリオペランドに付けるサイズ指定
+static char *ptr_size(int size) {
+  switch (size) {
+    case 1: return "byte";
+    case 2: return "word";
+    case 4: return "dword";
+  }
+  return "qword";
+}
+
+// x86-64のメモリオペランド。[base+index*scale+disp]かsym+disp[rip]の形になる。
+// base_expr, index_exprはレジスタに値を計算してから使う式。
+typedef struct {
+  char *base;       // ベースレジスタ
+  Node *base_expr;  // ベースレジスタに置く式
+  bool base_addr;   // base_exprの値ではなくアドレスをベースにするか
+  char *sym;        // RIP相対で参照するグローバル変数
+  char *index;      // インデックスレジスタ
+  Node *index_expr; // インデックスレジスタに置く式
+  int scale;
+  int64_t disp;
+} Addr;
+
+static void match_ptr(Node *node, Addr *a);
+
+// 左辺値nodeのアドレスをaにあてはめる
+static void match_lvalue(Node *node, Addr *a) {
+  switch (node->kind) {
+    case ND_VAR:
+      if (node->var->reg >= 0)
+        break;
+
+      if (node->var->is_local) {
+        a->base = frame_reg;
+        a->disp -= node->var->offset;
+      } else {
+        a->sym = node->var->name;
+      }
+      return;
+    case ND_MEMBER:
+      a->disp += node->member->offset;
+      match_lvalue(node->lhs, a);
+      return;
+    case ND_DEREF:
+      match_ptr(node->lhs, a);
+      return;
+  }
+
+  a->base_expr = node;
+  a->base_addr = true;
+}
+
+// ディスプレースメントにvalを足せるならtrue
+static bool add_disp(Addr *a, int64_t val) {
+  if (a->disp + val != (int32_t)(a->disp + val))
+    return false;
+  a->disp += val;
+  return true;
+}
+
+// 式nodeがそのまま64ビットのインデックスレジスタとして使える
+// レジスタ変数ならそのレジスタを返す
+static char *index_reg(Node *node) {
+  if (node->kind == ND_CAST && node->ty->size == 8 && node->ty->kind != TY_BOOL)
+    node = node->lhs;
+
+  // int変数はレジスタ上で64ビットに符号拡張してある
+  if (node->kind == ND_VAR && node->var->reg >= 0 && node->ty->size >= 4 &&
+      (is_integer(node->ty) || node->ty->kind == TY_PTR))
+    return calleereg64[node->var->reg];
+  return NULL;
+}
+
+// ポインタの値を計算する式nodeをaにあてはめる
+static void match_ptr(Node *node, Addr *a) {
+  // 配列は先頭要素へのポインタになる
+  if (node->ty->kind == TY_ARRAY &&
+      (node->kind == ND_VAR || node->kind == ND_MEMBER || node->kind == ND_DEREF)) {
+    match_lvalue(node, a);
+    return;
+  }
+
+  switch (node->kind) {
+    case ND_VAR:
+      if (node->var->reg >= 0) {
+        a->base = calleereg64[node->var->reg];
+        return;
+      }
+      break;
+    case ND_ADDR:
+      match_lvalue(node->lhs, a);
+      return;
+    case ND_CAST:
+      if (node->lhs->ty->base) {
+        match_ptr(node->lhs, a);
+        return;
+      }
+      break;
+    case ND_ADD:
+    case ND_SUB: {
+      if (!node->lhs->ty->base)
+        break;
+
+      // longとポインタの間のキャストは値を変えない
+      Node *rhs = node->rhs;
+      while (rhs->kind == ND_CAST && rhs->ty->size == 8 && rhs->lhs->ty->size == 8)
+        rhs = rhs->lhs;
+
+      if (rhs->kind == ND_NUM) {
+        if (add_disp(a, node->kind == ND_ADD ? rhs->val : -rhs->val)) {
+          match_ptr(node->lhs, a);
+          return;
+        }
+        break;
+      }
+
+      if (node->kind == ND_SUB || a->index || a->index_expr)
+        break;
+
+      // p + i * sizeはインデックスとスケールにする
+      a->scale = 1;
+      if (rhs->kind == ND_MUL && (rhs->lhs->kind == ND_NUM || rhs->rhs->kind == ND_NUM)) {
+        Node *num = (rhs->lhs->kind == ND_NUM) ? rhs->lhs : rhs->rhs;
+        Node *idx = (rhs->lhs->kind == ND_NUM) ? rhs->rhs : rhs->lhs;
+        if (num->val == 1 || num->val == 2 || num->val == 4 || num->val == 8) {
+          a->scale = num->val;
+          rhs = idx;
+        }
+      }
+
+      a->index = index_reg(rhs);
+      if (!a->index)
+        a->index_expr = rhs;
+      match_ptr(node->lhs, a);
+      return;
+    }
+  }
+
+  a->base_expr = node;
+}
+
+// RIP相対アドレスにはインデックスを付けられないので、
+// その場合はシンボルのアドレスをレジスタに置く
+static bool needs_sym_base(Addr *a) {
+  return a->sym && (a->index || a->index_expr);
+}
+
+// 左辺値nodeのアドレスを、コードを出力せずにメモリオペランドに書けるならtrue
+static bool is_static_addr(Node *node) {
+  Addr a = {};
+  match_lvalue(node, &a);
+  return !a.base_expr && !a.index_expr && !needs_sym_base(&a);
+}
+
+static void gen_base(Addr *a) {
+  if (a->base_expr && a->base_addr)
+    gen_addr(a->base_expr);
+  else if (a->base_expr)
+    gen_expr(a->base_expr);
+  else
+    println("  lea rax, %s[rip]", a->sym);
+
+  a->base = "rax";
+  a->sym = NULL;
+}
+
+// 左辺値nodeを指すメモリオペランドの文字列を返す。
+// ベースやインデックスの計算が必要ならそのコードを出力し、rax, rdiを使う。
+static char *gen_mem(Node *node) {
+  Addr a = {};
+  match_lvalue(node, &a);
+
+  bool need_base = a.base_expr || needs_sym_base(&a);
+  if (a.index_expr && need_base) {
+    gen_expr(a.index_expr);
+    push();
+    gen_base(&a);
+    pop("rdi");
+    a.index = "rdi";
+  } else if (a.index_expr) {
+    gen_expr(a.index_expr);
+    a.index = "rax";
+  } else if (need_base) {
+    gen_base(&a);
+  }
+
+  if (a.sym) {
+    if (a.disp)
+      return format("%s%+ld[rip]", a.sym, a.disp);
+    return format("%s[rip]", a.sym);
+  }
+
+  char *idx = a.index ? format("+%s*%d", a.index, a.scale) : "";
+  if (a.disp)
+    return format("[%s%s%+ld]", a.base, idx, a.disp);
+  return format("[%s%s]", a.base, idx);
+}
+
+// 与えられたノードの絶対アドレスを計算する
+// ノードがメモリ内になければエラー
+static void gen_addr(Node *node) {
+  switch (node->kind) {
+    case ND_VAR:
+      if (node->var->reg >= 0)
+        break;
+      // fallthrough
+    case ND_DEREF:
+    case ND_MEMBER: {
+      char *mem = gen_mem(node);
+      if (strcmp(mem, "[rax]"))
+        println("  lea rax, %s", mem);
+      return;
+    }
+    case ND_COMMA:
+      gen_expr(node->lhs);
+      gen_addr(node->rhs);
+      return;
+  }
+
+  error_tok(node->tok, "左辺値ではありません");
+}
+
+// memが指すメモリからty型の値をraxに読み込む
+static void load_mem(Type *ty, char *mem) {
+  if (ty->size == 1)
+    println("  movsx eax, byte ptr %s", mem);
+  else if (ty->size == 2)
+    println("  movsx eax, word ptr %s", mem);
+  else if (ty->size == 4)
+    println("  movsxd rax, dword ptr %s", mem);
+  else
+    println("  mov rax, qword ptr %s", mem);
+}
+
+// これより大きい構造体はrep movsbでコピーする
+#define INLINE_COPY_MAX 128
+
+// [rax]から[rdi]にsizeバイトコピーする。raxは変更しない。
+// 小さければ16バイト、8バイト単位のmovを並べ、大きければrep movsbを使う。
+static void gen_copy(int size) {
+  if (size > INLINE_COPY_MAX) {
+    println("  mov rsi, rax");
+    println("  mov rcx, %d", size);
+    println("  rep movsb");
+    return;
+  }
+
+  int i = 0;
+  for (; i + 16 <= size; i += 16) {
+    println("  movdqu xmm0, [rax+%d]", i);
+    println("  movdqu [rdi+%d], xmm0", i);
+  }
+  for (; i + 8 <= size; i += 8) {
+    println("  mov r8, [rax+%d]", i);
+    println("  mov [rdi+%d], r8", i);
+  }
+  for (; i + 4 <= size; i += 4) {
+    println("  mov r8d, [rax+%d]", i);
+    println("  mov [rdi+%d], r8d", i);
+  }
+  for (; i + 2 <= size; i += 2) {
+    println("  mov r8w, [rax+%d]", i);
+    println("  mov [rdi+%d], r8w", i);
+  }
+  for (; i < size; i++) {
+    println("  mov r8b, [rax+%d]", i);
+    println("  mov [rdi+%d], r8b", i);
+  }
+}
+
+// これより大きい領域はrep stosqで0初期化する
+#define INLINE_ZERO_MAX 128
+
+// [フレームベース-offset]からsizeバイトを0で埋める。raxは壊れる。
+static void gen_zero(int offset, int size) {
+  int i = 0;
+
+  if (size > INLINE_ZERO_MAX) {
+    println("  lea rdi, [%s-%d]", frame_reg, offset);
+    println("  mov rcx, %d", size / 8);
+    println("  xor eax, eax");
+    println("  rep stosq");
+    i = size / 8 * 8;
+  } else if (size >= 16) {
+    println("  pxor xmm0, xmm0");
+    for (; i + 16 <= size; i += 16)
+      println("  movdqu [%s-%d], xmm0", frame_reg, offset - i);
+  }
+
+  for (; i + 8 <= size; i += 8)
+    println("  mov qword ptr [%s-%d], 0", frame_reg, offset - i);
+  for (; i + 4 <= size; i += 4)
+    println("  mov dword ptr [%s-%d], 0", frame_reg, offset - i);
+  for (; i + 2 <= size; i += 2)
+    println("  mov word ptr [%s-%d], 0", frame_reg, offset - i);
+  for (; i < size; i++)
+    println("  mov byte ptr [%s-%d], 0", frame_reg, offset - i);
+}
+
+static bool is_scalar_type(Type *ty) {
+  return ty->kind != TY_ARRAY && ty->kind != TY_STRUCT && ty->kind != TY_UNION;
+}
+
+// rax, rdxのsizeバイト部分のレジスタ名。regは"a"か"d"
+static char *sized_reg(char *reg, int size) {
+  switch (size) {
+    case 1: return format("%sl", reg);
+    case 2: return format("%sx", reg);
+    case 4: return format("e%sx", reg);
+  }
+  return format("r%sx", reg);
+}
+
+// rax(regが"a")かrdx(regが"d")のty型の値をmemが指すメモリに書き込む
+static void store_mem(Type *ty, char *mem, char *reg) {
+  println("  mov %s ptr %s, %s", ptr_size(ty->size), mem, sized_reg(reg, ty->size));
+}
+
+static void store(Type *ty) {
+  pop("rdi");
+
+  if (ty->kind == TY_STRUCT || ty->kind == TY_UNION || ty->kind == TY_ARRAY) {
+    gen_copy(ty->size);
+    return;
+  }
+
+  if (ty->size == 1)
+    println("  mov [rdi], al");
+  else if(ty->size == 2)
+    println("  mov [rdi], ax");
+  else if (ty->size == 4)
+    println("  mov [rdi], eax");
+  else
+    println("  mov [rdi], rax");
+}
+
+// raxの値をレジスタ変数に書き込む。
+// レジスタ上でもメモリからload_mem()したときと同じ形に符号拡張しておく。
+static void store_reg(Obj *var) {
+  int r = var->reg;
+
+  if (var->ty->size == 1)
+    println("  movsx %s, al", calleereg32[r]);
+  else if (var->ty->size == 2)
+    println("  movsx %s, ax", calleereg32[r]);
+  else if (var->ty->size == 4)
+    println("  movsxd %s, eax", calleereg64[r]);
+  else
+    println("  mov %s, rax", calleereg64[r]);
+}
+
+static void cmp_zero(Type *ty) {
+  if (is_integer(ty) && ty->size <= 4)
+    println("  test eax, eax");
+  else
+    println("  test rax, rax");
+}
+
+enum { I8, I16, I32, I64 };
+
+static int getTypeId(Type *ty) {
+  switch (ty->kind) {
+    case TY_CHAR:
+      return I8;
+    case TY_SHORT:
+      return I16;
+    case TY_INT:
+      return I32;
+  }
+
+  return I64;
+}
+
+static char i32i8[] = "movsx eax, al";
+static char i32i16[] = "movsx eax, ax";
+static char i32i64[] = "movsxd rax, eax";
+
+// 型キャスト用のテーブル
+static char *cast_table[][10] = {
+  {NULL, NULL, NULL, i32i64},    // i8
+  {i32i8, NULL, NULL, i32i64},   // i16
+  {i32i8, i32i16, NULL, i32i64}, // i32
+  {i32i8, i32i16, NULL, NULL},   // i64
+};
+
+static void cast(Type *from, Type *to) {
+  if (to->kind == TY_VOID)
+    return;
+
+  if (to->kind == TY_BOOL) {
+    cmp_zero(from);
+    println("  setne al");
+    println("  movzx eax, al");
+    return;
+  }
+
+  int t1 = getTypeId(from);
+  int t2 = getTypeId(to);
+  if (cast_table[t1][t2])
+    println("  %s", cast_table[t1][t2]);
+}
+
+static bool is_compare(Node *node) {
+  NodeKind k = node->kind;
+  return k == ND_EQ || k == ND_NE || k == ND_LT || k == ND_LE;
+}
+
+// 比較演算子に対応する条件コード。truthがfalseなら否定した条件を返す。
+static char *cond_code(NodeKind kind, bool truth) {
+  switch (kind) {
+    case ND_EQ: return truth ? "e" : "ne";
+    case ND_NE: return truth ? "ne" : "e";
+    case ND_LT: return truth ? "l" : "ge";
+    case ND_LE: return truth ? "le" : "g";
+  }
+  unreachable();
+}
+
+// 二項演算を何バイトで行うか
+static int op_size(Type *ty) {
+  return (ty->kind == TY_LONG || ty->base) ? 8 : 4;
+}
+
+// nodeがsizeバイトの即値オペランドとして書ける定数ならtrue
+static bool is_imm(Node *node, int size) {
+  return node->kind == ND_NUM && (size < 8 || node->val == (int32_t)node->val);
+}
+
+// sizeバイトの即値の値
+static int64_t imm_value(Node *node, int size) {
+  switch (size) {
+    case 1: return (int8_t)node->val;
+    case 2: return (int16_t)node->val;
+    case 4: return (int32_t)node->val;
+  }
+  return node->val;
+}
+
+// メモリからロードされる左辺値ならtrue
+static bool is_memory_lvalue(Node *node) {
+  switch (node->kind) {
+    case ND_VAR:
+      return node->var->reg < 0;
+    case ND_DEREF:
+    case ND_MEMBER:
+      return true;
+  }
+  return false;
+}
+
+// sizeバイトの演算のオペランドとして、式nodeを評価せずに
+// そのまま書けるならオペランドの文字列を返す。書けなければNULL。
+// 即値、レジスタ変数と、アドレスの計算がいらないメモリ上の値
+// (ローカル変数やグローバル変数、そのメンバや定数添字の要素)が対象。
+static char *src_operand(Node *node, int size) {
+  if (is_imm(node, size))
+    return format("%ld", imm_value(node, size));
+
+  // 同じサイズか切り詰めるキャストは、値の下位バイトをそのまま使える。
+  // int変数はレジスタ上で64ビットに符号拡張してあるので、
+  // longへのキャストもそのまま使える。
+  Node *var = node;
+  if (var->kind == ND_CAST && var->ty->kind != TY_BOOL &&
+      (is_integer(var->ty) || var->ty->kind == TY_PTR))
+    var = var->lhs;
+  Type *ty = var->ty;
+  if (!(is_integer(ty) && ty->kind != TY_BOOL) && ty->kind != TY_PTR)
+    return NULL;
+
+  if (var->kind == ND_VAR && var->var->reg >= 0) {
+    int r = var->var->reg;
+    if (size == 4)
+      return calleereg32[r];
+    if (ty->size >= 4)
+      return calleereg64[r];
+    return NULL;
+  }
+
+  if (!is_memory_lvalue(var) || ty->size < size || !is_static_addr(var))
+    return NULL;
+  return format("%s ptr %s", ptr_size(size), gen_mem(var));
+}
+
+
+// lhsとrhsを評価してcmp lhs, rhsを出力する
+static void gen_cmp_operands(Node *lhs, Node *rhs, int sz) {
+  char *ax = (sz == 8) ? "rax" : "eax";
+  char *di = (sz == 8) ? "rdi" : "edi";
+
+  if (is_imm(rhs, sz)) {
+    int64_t val = imm_value(rhs, sz);
+
+    // cmp ebx, 10やcmp dword ptr [rbp-8], 10
+    char *op = src_operand(lhs, sz);
+    if (op) {
+      println("  cmp %s, %ld", op, val);
+      return;
+    }
+
+    // 符号拡張される前のメモリ上の値を直接比較する。
+    // 例えばa[i] == 'x'ならcmp byte ptr [rax], 120
+    Node *mem = lhs;
+    if (mem->kind == ND_CAST && is_integer(mem->ty) && mem->ty->kind != TY_BOOL)
+      mem = mem->lhs;
+    if (is_memory_lvalue(mem) && is_integer(mem->ty) && mem->ty->kind != TY_BOOL) {
+      int msz = (mem->ty->size < sz) ? mem->ty->size : sz;
+      if (imm_value(rhs, msz) == val) {
+        println("  cmp %s ptr %s, %ld", ptr_size(msz), gen_mem(mem), val);
+        return;
+      }
+    }
+
+    gen_expr(lhs);
+    if (val == 0)
+      println("  test %s, %s", ax, ax);
+    else
+      println("  cmp %s, %ld", ax, val);
+    return;
+  }
+
+  char *op = src_operand(rhs, sz);
+  if (op) {
+    gen_expr(lhs);
+    println("  cmp %s, %s", ax, op);
+    return;
+  }
+
+  gen_expr(rhs);
+  push();
+  gen_expr(lhs);
+  pop("rdi");
+  println("  cmp %s, %s", ax, di);
+}
+
+// 比較演算子の両辺を評価してcmpを出力し、比較結果がtruthのときに
+// 成り立つ条件コードを返す。
+// 即値やオペランドに直接書ける式が右辺に来るように両辺を入れ替える。
+static char *gen_cmp(Node *node, bool truth) {
+  int sz = op_size(node->lhs->ty);
+  bool swap = (node->lhs->kind == ND_NUM && node->rhs->kind != ND_NUM) ||
+              (!src_operand(node->rhs, sz) && src_operand(node->lhs, sz));
+
+  if (!swap) {
+    gen_cmp_operands(node->lhs, node->rhs, sz);
+    return cond_code(node->kind, truth);
+  }
+
+  gen_cmp_operands(node->rhs, node->lhs, sz);
+  switch (node->kind) {
+    case ND_LT: return truth ? "g" : "le";
+    case ND_LE: return truth ? "ge" : "l";
+  }
+  return cond_code(node->kind, truth);
+}
+
+// 条件式nodeの真偽がjump_ifと一致すればlabelにジャンプする。
+// 比較や論理演算は0/1の値を作らずに、cmpと条件ジャンプに直接変換する。
+static void gen_branch(Node *node, bool jump_if, char *label) {
+  switch (node->kind) {
+    case ND_NUM:
+      if (!!node->val == jump_if)
+        println("  jmp %s", label);
+      return;
+    case ND_NOT:
+      gen_branch(node->lhs, !jump_if, label);
+      return;
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+      println("  j%s %s", gen_cmp(node, jump_if), label);
+      return;
+    case ND_LOGAND:
+    case ND_LOGOR: {
+      // &&の左辺が偽、||の左辺が真なら右辺を評価せずに結果が決まる
+      bool shortcut = (node->kind == ND_LOGOR);
+      if (shortcut == jump_if) {
+        gen_branch(node->lhs, jump_if, label);
+        gen_branch(node->rhs, jump_if, label);
+        return;
+      }
+
+      char *skip = format(".L.skip.%d", count());
+      gen_branch(node->lhs, shortcut, skip);
+      gen_branch(node->rhs, jump_if, label);
+      println("%s:", skip);
+      return;
+    }
+  }
+
+  gen_expr(node);
+  cmp_zero(node->ty);
+  println("  j%s %s", jump_if ? "ne" : "e", label);
+}
+
+// sizeバイト未満に切り詰めないキャストを取り除く
+static Node *strip_wide_cast(Node *node, int size) {
+  while (node->kind == ND_CAST && node->ty->kind != TY_BOOL && node->ty->size >= size)
+    node = node->lhs;
+  return node;
+}
+
+// 2つの左辺値が同じ場所を指す同じ形の式ならtrue
+static bool same_lvalue(Node *a, Node *b) {
+  if (a->kind != b->kind)
+    return false;
+
+  switch (a->kind) {
+    case ND_VAR:
+      return a->var == b->var;
+    case ND_NUM:
+      return a->val == b->val;
+    case ND_MEMBER:
+      return a->member == b->member && same_lvalue(a->lhs, b->lhs);
+    case ND_CAST:
+      if (a->ty->kind != b->ty->kind || a->ty->size != b->ty->size)
+        return false;
+      return same_lvalue(a->lhs, b->lhs);
+    case ND_DEREF:
+    case ND_ADDR:
+      return same_lvalue(a->lhs, b->lhs);
+    case ND_ADD:
+    case ND_SUB:
+    case ND_MUL:
+      return same_lvalue(a->lhs, b->lhs) && same_lvalue(a->rhs, b->rhs);
+  }
+  return false;
+}
+
+// nodeが`A = A op B`の形でAを直接書き換えられるなら、そのopのノードを返す
+static Node *rmw_op(Node *node) {
+  if (node->kind != ND_ASSIGN)
+    return NULL;
+
+  Node *lhs = node->lhs;
+  Type *ty = lhs->ty;
+  if (!(is_integer(ty) && ty->kind != TY_BOOL) && ty->kind != TY_PTR)
+    return NULL;
+
+  // レジスタ変数はchar, shortだと書き換えた後の符号拡張が面倒なので対象外
+  if (lhs->kind == ND_VAR && lhs->var->reg >= 0 && ty->size < 4)
+    return NULL;
+
+  Node *op = strip_wide_cast(node->rhs, ty->size);
+  switch (op->kind) {
+    case ND_ADD:
+    case ND_SUB:
+    case ND_BITAND:
+    case ND_BITOR:
+    case ND_BITXOR:
+      break;
+    default:
+      return NULL;
+  }
+
+  if (op->ty->size < ty->size)
+    return NULL;
+  if (!same_lvalue(strip_wide_cast(op->lhs, ty->size), lhs))
+    return NULL;
+  return op;
+}
+
+static char *rmw_insn(NodeKind kind) {
+  switch (kind) {
+    case ND_ADD: return "add";
+    case ND_SUB: return "sub";
+    case ND_BITAND: return "and";
+    case ND_BITOR: return "or";
+    case ND_BITXOR: return "xor";
+  }
+  unreachable();
+}
+
+// `A = A op B`をAへの直接のadd, sub, inc, decなどで実行する。
+// need_valueがtrueなら代入後のAの値をraxに置く。
+static void gen_rmw(Node *node, Node *op, bool need_value) {
+  Node *lhs = node->lhs;
+  int sz = lhs->ty->size;
+  char *insn = rmw_insn(op->kind);
+
+  if (lhs->kind == ND_VAR && lhs->var->reg >= 0) {
+    int r = lhs->var->reg;
+    char *reg = (sz == 8) ? calleereg64[r] : calleereg32[r];
+
+    if (is_imm(op->rhs, sz)) {
+      println("  %s %s, %ld", insn, reg, imm_value(op->rhs, sz));
+    } else {
+      gen_expr(op->rhs);
+      println("  %s %s, %s", insn, reg, (sz == 8) ? "rax" : "eax");
+    }
+
+    if (sz == 4)
+      println("  movsxd %s, %s", calleereg64[r], reg);
+    if (need_value)
+      println("  mov rax, %s", calleereg64[r]);
+    return;
+  }
+
+  char *mem;
+  if (is_imm(op->rhs, sz)) {
+    int64_t val = imm_value(op->rhs, sz);
+    mem = gen_mem(lhs);
+
+    if ((op->kind == ND_ADD && val == 1) || (op->kind == ND_SUB && val == -1))
+      println("  inc %s ptr %s", ptr_size(sz), mem);
+    else if ((op->kind == ND_ADD && val == -1) || (op->kind == ND_SUB && val == 1))
+      println("  dec %s ptr %s", ptr_size(sz), mem);
+    else
+      println("  %s %s ptr %s, %ld", insn, ptr_size(sz), mem, val);
+  } else {
+    char *src;
+
+    gen_expr(op->rhs);
+    if (is_static_addr(lhs)) {
+      mem = gen_mem(lhs);
+      src = sized_reg("a", sz);
+    } else {
+      push();
+      mem = gen_mem(lhs);
+      pop("rdx");
+      src = sized_reg("d", sz);
+    }
+    println("  %s %s ptr %s, %s", insn, ptr_size(sz), mem, src);
+  }
+
+  if (need_value)
+    load_mem(node->ty, mem);
+}
+
+// 代入式を評価する。need_valueがfalseなら代入した値をraxに残さなくてよい。
+static void gen_assign(Node *node, bool need_value) {
+  Node *op = rmw_op(node);
+  if (op) {
+    gen_rmw(node, op, need_value);
+    return;
+  }
+
+  if (node->lhs->kind == ND_VAR && node->lhs->var->reg >= 0) {
+    gen_expr(node->rhs);
+    store_reg(node->lhs->var);
+    return;
+  }
+
+  Type *ty = node->ty;
+  if (!is_scalar_type(ty)) {
+    gen_addr(node->lhs);
+    push();
+    gen_expr(node->rhs);
+    store(ty);
+    return;
+  }
+
+  // 定数は即値として直接書き込む
+  if (!need_value && is_imm(node->rhs, ty->size)) {
+    char *mem = gen_mem(node->lhs);
+    println("  mov %s ptr %s, %ld", ptr_size(ty->size), mem, imm_value(node->rhs, ty->size));
+    return;
+  }
+
+  // 左辺のアドレスの計算がいらなければ、右辺の値を直接書き込む
+  gen_expr(node->rhs);
+  if (is_static_addr(node->lhs)) {
+    store_mem(ty, gen_mem(node->lhs), "a");
+    return;
+  }
+
+  push();
+  char *mem = gen_mem(node->lhs);
+  pop("rdx");
+  store_mem(ty, mem, "d");
+  if (need_value)
+    println("  mov rax, rdx");
+}
+
+// 値を使わない式を評価する
+static void gen_void_expr(Node *node) {
+  if (node->kind == ND_ASSIGN)
+    gen_assign(node, false);
+  else
+    gen_expr(node);
+}
+
+// 2のべき乗ならその指数、そうでなければ-1を返す
+static int log2_exact(int64_t val) {
+  if (val <= 0 || (val & (val - 1)))
+    return -1;
+
+  int k = 0;
+  while ((1LL << k) < val)
+    k++;
+  return k;
+}
+
+// raxに定数valを掛ける。
+// 2のべき乗はシフトに、3, 5, 9はleaに置き換える。
+static void gen_mul_imm(int sz, int64_t val) {
+  char *ax = (sz == 8) ? "rax" : "eax";
+  int k = log2_exact(val);
+
+  if (val == 0)
+    println("  xor eax, eax");
+  else if (k >= 0)
+    println("  shl %s, %d", ax, k);
+  else if (val == 3 || val == 5 || val == 9)
+    println("  lea %s, [rax+rax*%ld]", ax, val - 1);
+  else
+    println("  imul %s, %s, %ld", ax, ax, val);
+}
+
+// 定数valでの割り算や剰余をidivを使わずに計算できるならtrue。
+// 2のべき乗はどちらのサイズでもシフトで、それ以外の定数は
+// intに限って逆数の掛け算で計算する。
+static bool can_div_imm(int sz, int64_t val) {
+  if (val == 0 || val == 1 || val == -1 || val == INT32_MIN)
+    return false;
+  return log2_exact(val < 0 ? -val : val) >= 1 || sz == 4;
+}
+
+// raxを定数valで割った商(kindがND_DIV)か余り(ND_MOD)を計算する。
+// 商は0方向に切り捨てる。
+static void gen_div_imm(NodeKind kind, int sz, int64_t val) {
+  char *ax = (sz == 8) ? "rax" : "eax";
+  char *dx = (sz == 8) ? "rdx" : "edx";
+  int64_t d = (val < 0) ? -val : val;
+  int k = log2_exact(d);
+
+  if (k >= 1) {
+    // 負の数は2^k-1を足してから算術シフトすると0方向に丸められる
+    println("  lea %s, [rax+%ld]", dx, d - 1);
+    println("  test %s, %s", ax, ax);
+
+    if (kind == ND_DIV) {
+      println("  cmovs %s, %s", ax, dx);
+      println("  sar %s, %d", ax, k);
+      if (val < 0)
+        println("  neg %s", ax);
+      return;
+    }
+
+    // x % 2^k = x - (x / 2^k) * 2^k
+    println("  cmovns %s, %s", dx, ax);
+    println("  and %s, %ld", dx, -d);
+    println("  sub %s, %s", ax, dx);
+    return;
+  }
+
+  // intの割り算は、xに2^(32+l-1)/d程度の定数を掛けて上位ビットを
+  // 取り出すことで計算できる(Granlund, Montgomery)。lはlog2(d)の切り上げ。
+  // 負のxは結果に1を足すと0方向の切り捨てになる。
+  int l = 0;
+  while ((1LL << l) < d)
+    l++;
+  int64_t m = (int64_t)(((uint64_t)1 << (31 + l)) / d) + 1;
+
+  println("  movsxd rdx, eax");
+  if (kind == ND_MOD)
+    println("  mov edi, eax");
+  println("  mov rcx, %ld", m);
+  println("  imul rcx, rdx");
+  println("  sar rcx, %d", 32 + l - 1);
+  println("  shr edx, 31");
+  println("  lea eax, [rcx+rdx]");
+
+  if (kind == ND_DIV) {
+    if (val < 0)
+      println("  neg eax");
+    return;
+  }
+
+  // x % d = x - (x / d) * d。除数の符号は余りに影響しない。
+  println("  imul eax, eax, %ld", d);
+  println("  sub edi, eax");
+  println("  mov eax, edi");
+}
+
+// オペランドにしたときに得をする順。小さいほど評価せずにオペランドにしたい。
+static int operand_rank(Node *node) {
+  if (node->kind == ND_NUM)
+    return 0;
+  if (node->kind == ND_CAST)
+    return 1;
+  return 2;
+}
+
+static bool is_commutative(NodeKind kind) {
+  return kind == ND_ADD || kind == ND_MUL || kind == ND_BITAND ||
+         kind == ND_BITOR || kind == ND_BITXOR;
+}
+
+// 右辺が即値やレジスタ変数、メモリ上の変数なら、右辺をraxに
+// 評価せずに直接オペランドに書く。例えばx + 1はadd eax, 1になる。
+// コードを出力したらtrueを返す。
+static bool gen_binary_operand(Node *node) {
+  int sz = op_size(node->lhs->ty);
+  char *ax = (sz == 8) ? "rax" : "eax";
+  Node *lhs = node->lhs;
+  Node *rhs = node->rhs;
+
+  // 両辺ともオペランドに書けるなら、即値やキャストをオペランドにする
+  if (is_commutative(node->kind) && src_operand(lhs, sz) &&
+      (!src_operand(rhs, sz) || operand_rank(lhs) < operand_rank(rhs))) {
+    lhs = node->rhs;
+    rhs = node->lhs;
+  }
+
+  char *op = src_operand(rhs, sz);
+  if (!op)
+    return false;
+
+  bool imm = (rhs->kind == ND_NUM);
+  int64_t val = imm ? imm_value(rhs, sz) : 0;
+
+  switch (node->kind) {
+    case ND_ADD:
+    case ND_SUB:
+    case ND_BITAND:
+    case ND_BITOR:
+    case ND_BITXOR: {
+      char *insn = node->kind == ND_ADD ? "add" : node->kind == ND_SUB ? "sub" :
+                   node->kind == ND_BITAND ? "and" : node->kind == ND_BITOR ? "or" : "xor";
+      gen_expr(lhs);
+      println("  %s %s, %s", insn, ax, op);
+      return true;
+    }
+    case ND_MUL:
+      gen_expr(lhs);
+      if (imm)
+        gen_mul_imm(sz, val);
+      else
+        println("  imul %s, %s", ax, op);
+      return true;
+    case ND_DIV:
+    case ND_MOD:
+      if (imm) {
+        // idivは即値をとれない
+        if (!can_div_imm(sz, val))
+          return false;
+        gen_expr(lhs);
+        gen_div_imm(node->kind, sz, val);
+        return true;
+      }
+
+      gen_expr(lhs);
+      println(sz == 8 ? "  cqo" : "  cdq");
+      println("  idiv %s", op);
+      if (node->kind == ND_MOD)
+        println("  mov rax, rdx");
+      return true;
+    case ND_SHL:
+    case ND_SHR:
+      if (!imm)
+        return false;
+      gen_expr(lhs);
+      println("  %s %s, %ld", node->kind == ND_SHL ? "shl" : "sar", ax, val & (sz * 8 - 1));
+      return true;
+  }
+  return false;
+}
+
+// 引数の値がコードを出力せずに求まるアドレスなら、そのメモリオペランドを返す
+static char *static_addr_arg(Node *node) {
+  if (node->kind == ND_CAST && node->ty->kind == TY_PTR && node->lhs->ty->base)
+    node = node->lhs;
+
+  if (node->kind == ND_ADDR && is_memory_lvalue(node->lhs) && is_static_addr(node->lhs))
+    return gen_mem(node->lhs);
+  if (node->ty->kind == TY_ARRAY && is_memory_lvalue(node) && is_static_addr(node))
+    return gen_mem(node);
+  return NULL;
+}
+
+// 評価せずに直接引数レジスタに置ける引数ならtrue
+static bool is_trivial_arg(Node *node) {
+  return src_operand(node, op_size(node->ty)) || static_addr_arg(node);
+}
+
+// 関数呼び出しの引数を引数レジスタに置く。
+// 評価が必要な引数を先に評価して退避し、最後に引数レジスタにまとめて移す。
+// 定数や変数、アドレスが決まっている引数は評価せずに直接引数レジスタに置く。
+// 引数レジスタは他の引数の評価で壊されない。
+static void gen_args(Node *node) {
+  Node *args[6];
+  int nargs = 0;
+  int last = -1;
+
+  for (Node *arg = node->args; arg; arg = arg->next) {
+    if (nargs == 6)
+      error_tok(node->tok, "引数が多すぎます");
+    if (!is_trivial_arg(arg))
+      last = nargs;
+    args[nargs++] = arg;
+  }
+
+  // 最後に評価する引数はraxから直接移せるので退避しない
+  for (int i = 0; i < nargs; i++) {
+    if (is_trivial_arg(args[i]))
+      continue;
+
+    gen_expr(args[i]);
+    if (i != last)
+      push();
+  }
+
+  if (last >= 0)
+    println("  mov %s, rax", argreg64[last]);
+
+  for (int i = last - 1; i >= 0; i--)
+    if (!is_trivial_arg(args[i]))
+      pop(argreg64[i]);
+
+  for (int i = 0; i < nargs; i++) {
+    if (!is_trivial_arg(args[i]))
+      continue;
+
+    char *mem = static_addr_arg(args[i]);
+    if (mem) {
+      println("  lea %s, %s", argreg64[i], mem);
+      continue;
+    }
+
+    int sz = op_size(args[i]->ty);
+    char *op = src_operand(args[i], sz);
+    if (!strcmp(op, "0"))
+      println("  xor %s, %s", argreg32[i], argreg32[i]);
+    else
+      println("  mov %s, %s", (sz == 8) ? argreg64[i] : argreg32[i], op);
+  }
+
+  // 可変長引数の関数はalに使用するベクタレジスタの数を受け取る。
+  // プロトタイプのない関数は可変長引数かもしれないので0にしておく。
+  if (!node->func_ty->params)
+    println("  xor eax, eax");
+}
+
+static void gen_funcall(Node *node) {
+  gen_args(node);
+
+  // 途中結果はレジスタかフレーム上にあり、rspは関数内で動かないので
+  // 呼び出し時のスタックは常に16バイトにアラインされている
+  println("  call %s", node->funcname);
+}
+
+// 2つの型の値がレジスタ上で同じ形ならtrue
+static bool same_reg_type(Type *a, Type *b) {
+  if (a->kind == TY_VOID || b->kind == TY_VOID)
+    return a->kind == b->kind;
+  if (a->kind == TY_PTR && b->kind == TY_PTR)
+    return true;
+  return is_integer(a) && a->kind == b->kind;
 }
 
-static void pop(char *arg) {
-  println("  pop %s", arg);
-  depth--;
+// return文の式が末尾呼び出しにできる関数呼び出しならそのノードを返す
+static Node *tail_call(Node *node) {
+  if (!node || frame_escapes)
+    return NULL;
+
+  Type *ret = current_fn->ty->return_ty;
+  if (node->kind == ND_CAST && same_reg_type(node->ty, node->lhs->ty))
+    node = node->lhs;
+
+  if (node->kind != ND_FUNCALL || !same_reg_type(node->ty, ret))
+    return NULL;
+  return node;
 }
 
-// nを`align`の最も近い倍数に丸める。
-// 例えば、align_to(5, 8)だと8に、align(11, 8)だと16になる。
-int align_to(int n, int align) {
-  return (n + align - 1) / align * align;
+// 自分自身への末尾呼び出しならtrue。仮引数を置き換えて本体の先頭に戻れる。
+static bool is_self_call(Node *node) {
+  if (strcmp(node->funcname, current_fn->name))
+    return false;
+
+  Node *arg = node->args;
+  Obj *param = current_fn->params;
+  for (; arg && param; arg = arg->next, param = param->next);
+  return !arg && !param;
 }
 
-// 与えられたノードの絶対アドレスを計算する
-// ノードがメモリ内になければエラー
-static void gen_addr(Node *node) {
-  switch (node->kind) {
-    case ND_VAR:
-      if (node->var->is_local)
-        println("  lea rax, [rbp-%d]", node->var->offset);
-      else
-        println("  lea rax, %s[rip]", node->var->name);
+// 末尾呼び出し。フレームを片付けてから呼び出し先にジャンプするので
+// 再帰が深くなってもスタックが伸びない。
+static void gen_tail_call(Node *node) {
+  gen_args(node);
 
+  if (is_self_call(node)) {
+    store_params(current_fn);
+    println("  jmp .L.body.%s", current_fn->name);
+    return;
+  }
+
+  int i = 0;
+  while (i < num_tail_callees && strcmp(tail_callees[i], node->funcname))
+    i++;
+
+  if (i == num_tail_callees) {
+    if (i == sizeof(tail_callees) / sizeof(*tail_callees)) {
+      gen_funcall(node);
+      println("  jmp .L.return.%s", current_fn->name);
       return;
-    case ND_DEREF:
-      gen_expr(node->lhs);
-      return;
-    case ND_COMMA:
-      gen_expr(node->lhs);
-      gen_addr(node->rhs);
-      return;
-    case ND_MEMBER:
-      gen_addr(node->lhs);
-      println("  add rax, %d", node->member->offset);
-      return;
+    }
+    tail_callees[num_tail_callees++] = node->funcname;
   }
 
-  error_tok(node->tok, "左辺値ではありません");
+  println("  jmp .L.tail.%s.%d", current_fn->name, i);
 }
 
-static void load(Type *ty) {
-  if (ty->kind == TY_ARRAY || ty->kind == TY_STRUCT || ty->kind == TY_UNION)
-    return;
-
-  if (ty->size == 1)
-    println("  movsbl eax, [rax]");
-  else if (ty->size == 2)
-    println("  movswl eax, [rax]");
-  else if (ty->size == 4)
-    println("  movsxd rax, [rax]");
-  else
-    println("  mov rax, [rax]");
+// SSE2の命令のレーンの幅を表す接尾辞
+static char *lane_suffix(int size) {
+  switch (size) {
+    case 1: return "b";
+    case 2: return "w";
+    case 4: return "d";
+  }
+  return "q";
 }
 
-static void store(Type *ty) {
-  pop("rdi");
+// sizeバイトのレーンをその倍の幅に広げるunpack命令の接尾辞
+static char *unpack_suffix(int size) {
+  switch (size) {
+    case 1: return "bw";
+    case 2: return "wd";
+    case 4: return "dq";
+  }
+  return "qdq";
+}
 
-  if (ty->kind == TY_STRUCT || ty->kind == TY_UNION) {
-    for (int i = 0; i < ty->size; i++) {
-      println("  mov r8b, [rax+%d]", i);
-      println("  mov [rdi+%d], r8b", i);
-    }
+// xmmレジスタdstとsrcのレーンごとにopを計算してdstに入れる。
+// srcとxmm4は壊れることがある。
+static void gen_vec_op(VecOp op, int size, char *dst, char *src) {
+  switch (op) {
+    case VEC_ADD:
+      println("  padd%s %s, %s", lane_suffix(size), dst, src);
+      return;
+    case VEC_SUB:
+      println("  psub%s %s, %s", lane_suffix(size), dst, src);
+      return;
+    case VEC_AND:
+      println("  pand %s, %s", dst, src);
+      return;
+    case VEC_OR:
+      println("  por %s, %s", dst, src);
+      return;
+    case VEC_XOR:
+      println("  pxor %s, %s", dst, src);
+      return;
+  }
 
+  // 16ビットには符号付きのmin/maxがある
+  if (size == 2) {
+    println("  p%ssw %s, %s", op == VEC_MIN ? "min" : "max", dst, src);
     return;
   }
 
-  if (ty->size == 1)
-    println("  mov [rdi], al");
-  else if(ty->size == 2)
-    println("  mov [rdi], ax");
-  else if (ty->size == 4)
-    println("  mov [rdi], eax");
-  else
-    println("  mov [rdi], rax");
+  // 8, 32ビットは比較したマスクでsrcを選ぶレーンを混ぜる
+  if (op == VEC_MIN) {
+    println("  movdqa xmm4, %s", dst);
+    println("  pcmpgt%s xmm4, %s", lane_suffix(size), src);
+  } else {
+    println("  movdqa xmm4, %s", src);
+    println("  pcmpgt%s xmm4, %s", lane_suffix(size), dst);
+  }
+  println("  pand %s, xmm4", src);
+  println("  pandn xmm4, %s", dst);
+  println("  por xmm4, %s", src);
+  println("  movdqa %s, xmm4", dst);
 }
 
-static void cmp_zero(Type *ty) {
-  if (is_integer(ty) && ty->size <= 4)
-    println("  cmp eax, 0");
-  else
-    println("  cmp rax, 0");
+// raxの下位sizeバイトをxmmレジスタregの全レーンにコピーする
+static void gen_broadcast(char *reg, int size) {
+  println("  movq %s, rax", reg);
+  if (size == 8) {
+    println("  punpcklqdq %s, %s", reg, reg);
+    return;
+  }
+  if (size == 1)
+    println("  punpcklbw %s, %s", reg, reg);
+  if (size <= 2)
+    println("  punpcklwd %s, %s", reg, reg);
+  println("  pshufd %s, %s, 0", reg, reg);
 }
 
-enum { I8, I16, I32, I64 };
-
-static int getTypeId(Type *ty) {
-  switch (ty->kind) {
-    case TY_CHAR:
-      return I8;
-    case TY_SHORT:
-      return I16;
-    case TY_INT:
-      return I32;
+// ND_VECTORのループを出力する。
+// 回数(16バイト単位)をrcx、読み込む配列をrsi, rdx、書き込む配列をrdiに置き、
+// xmm0で計算する。集約するならxmm0のレーンを1つにまとめてraxに返す。
+static void gen_vector(Node *node) {
+  int c = count();
+  int size = node->vec_size;
+  int lane = node->lane_size;
+  VecOp op = node->vec_op;
+
+  // 引数は変数か数値なので、評価してもrax以外は壊れない
+  gen_expr(node->cond);
+  println("  mov rcx, rax");
+
+  char *ptrs[] = {"rsi", "rdx"};
+  char *scalars[] = {"xmm1", "xmm2"};
+  Node *args[2] = {node->args, node->args->next};
+  for (int i = 0; i < 2 && args[i]; i++) {
+    gen_expr(args[i]);
+    if (args[i]->ty->kind == TY_PTR)
+      println("  mov %s, rax", ptrs[i]);
+    else
+      gen_broadcast(scalars[i], size);
   }
 
-  return I64;
-}
-
-static char i32i8[] = "movsbl eax, al";
-static char i32i16[] = "movswl eax, ax";
-static char i32i64[] = "movsxd rax, eax";
+  if (node->lhs) {
+    gen_expr(node->lhs);
+    println("  mov rdi, rax");
 
-// 型キャスト用のテーブル
-static char *cast_table[][10] = {
-  {NULL, NULL, NULL, i32i64},    // i8
-  {i32i8, NULL, NULL, i32i64},   // i16
-  {i32i8, i32i16, NULL, i32i64}, // i32
-  {i32i8, i32i16, NULL, NULL},   // i64
-};
+    println(".L.vector.%d:", c);
+    if (args[0]->ty->kind == TY_PTR)
+      println("  movdqu xmm0, [rsi]");
+    else
+      println("  movdqa xmm0, xmm1");
 
-static void cast(Type *from, Type *to) {
-  if (to->kind == TY_VOID)
+    if (args[1]->ty->kind == TY_PTR) {
+      println("  movdqu xmm3, [rdx]");
+      gen_vec_op(op, size, "xmm0", "xmm3");
+    } else {
+      gen_vec_op(op, size, "xmm0", "xmm2");
+    }
+    println("  movdqu [rdi], xmm0");
+
+    for (int i = 0; i < 2; i++)
+      if (args[i]->ty->kind == TY_PTR)
+        println("  add %s, %d", ptrs[i], 16);
+    println("  add rdi, 16");
+    println("  sub rcx, 1");
+    println("  jnz .L.vector.%d", c);
     return;
+  }
 
-  if (to->kind == TY_BOOL) {
-    cmp_zero(from);
-    println("  setne al");
-    println("  movzx eax, al");
-    return;
+  // 和と排他的論理和は0から、それ以外は最初の16バイトから始める
+  if (op == VEC_ADD || op == VEC_XOR)
+    println("  pxor xmm0, xmm0");
+  else
+    println("  movdqu xmm0, [rsi]");
+
+  println(".L.vector.%d:", c);
+  println("  movdqu xmm1, [rsi]");
+
+  // 符号拡張しながら隣り合うレーンを足して、レーンの幅を倍にしていく
+  for (int sz = size; sz < lane; sz *= 2) {
+    println("  pxor xmm3, xmm3");
+    println("  pcmpgt%s xmm3, xmm1", lane_suffix(sz));
+    println("  movdqa xmm2, xmm1");
+    println("  punpckl%s xmm1, xmm3", unpack_suffix(sz));
+    println("  punpckh%s xmm2, xmm3", unpack_suffix(sz));
+    println("  padd%s xmm1, xmm2", lane_suffix(sz * 2));
   }
 
-  int t1 = getTypeId(from);
-  int t2 = getTypeId(to);
-  if (cast_table[t1][t2])
-    println("  %s", cast_table[t1][t2]);
+  gen_vec_op(op, lane, "xmm0", "xmm1");
+  println("  add rsi, 16");
+  println("  sub rcx, 1");
+  println("  jnz .L.vector.%d", c);
+
+  // レーンを半分ずつ重ねてまとめる
+  println("  pshufd xmm1, xmm0, 0x4e");
+  gen_vec_op(op, lane, "xmm0", "xmm1");
+  if (lane <= 4) {
+    println("  pshufd xmm1, xmm0, 0xb1");
+    gen_vec_op(op, lane, "xmm0", "xmm1");
+  }
+  if (lane <= 2) {
+    println("  movdqa xmm1, xmm0");
+    println("  psrld xmm1, 16");
+    gen_vec_op(op, lane, "xmm0", "xmm1");
+  }
+  if (lane == 1) {
+    println("  movdqa xmm1, xmm0");
+    println("  psrlw xmm1, 8");
+    gen_vec_op(op, lane, "xmm0", "xmm1");
+  }
+
+  println("  movq rax, xmm0");
+  if (lane == 1)
+    println("  %s", i32i8);
+  else if (lane == 2)
+    println("  %s", i32i16);
+  else if (lane == 4)
+    println("  %s", i32i64);
 }
 
 static void gen_expr(Node *node) {
@@ -167,7 +1396,14 @@ static void gen_expr(Node *node) {
     case ND_NULL_EXPR:
       return;
     case ND_NUM:
-      println("  mov rax, %ld", node->val);
+      // intは下位32ビットだけが意味を持つので32ビットのmovで足りる。
+      // 32ビットレジスタへの書き込みは上位32ビットを0にする。
+      if (node->val == 0)
+        println("  xor eax, eax");
+      else if (op_size(node->ty) == 4 || node->val == (uint32_t)node->val)
+        println("  mov eax, %d", (int32_t)node->val);
+      else
+        println("  mov rax, %ld", node->val);
       return;
     case ND_NEG:
       gen_expr(node->lhs);
@@ -176,44 +1412,54 @@ static void gen_expr(Node *node) {
     case ND_ADDR:
       gen_addr(node->lhs);
       return;
-    case ND_DEREF:
-      gen_expr(node->lhs);
-      load(node->ty);
-      return;
     case ND_VAR:
-    case ND_MEMBER:
-      gen_addr(node);
-      load(node->ty);
+      if (node->var->reg >= 0) {
+        println("  mov rax, %s", calleereg64[node->var->reg]);
+        return;
+      }
+      // fallthrough
+    case ND_DEREF:
+    case ND_MEMBER: {
+      Type *ty = node->ty;
+      if (ty->kind == TY_ARRAY || ty->kind == TY_STRUCT || ty->kind == TY_UNION) {
+        gen_addr(node);
+        return;
+      }
+
+      load_mem(ty, gen_mem(node));
       return;
+    }
     case ND_ASSIGN:
-      gen_addr(node->lhs);
-      push();
-      gen_expr(node->rhs);
-      store(node->ty);
+      gen_assign(node, true);
       return;
     case ND_COMMA:
       gen_expr(node->lhs);
       gen_expr(node->rhs);
       return;
     case ND_STMT_EXPR:
-      for (Node *n = node->body; n; n = n->next)
-        gen_stmt(n);
+      // 最後の式文の値が文式の値になる
+      for (Node *n = node->body; n; n = n->next) {
+        if (!n->next && n->kind == ND_EXPR_STMT)
+          gen_expr(n->lhs);
+        else
+          gen_stmt(n);
+      }
       return;
     case ND_CAST:
       gen_expr(node->lhs);
       cast(node->lhs->ty, node->ty);
       return;
     case ND_MEMZERO:
-      println("  mov rcx, %d", node->var->ty->size);
-      println("  lea rdi, [rbp-%d]", node->var->offset);
-      println("  mov al, 0");
-      println("  rep stosb");
+      if (node->var->reg >= 0) {
+        println("  xor %s, %s", calleereg32[node->var->reg], calleereg32[node->var->reg]);
+        return;
+      }
+
+      gen_zero(node->var->offset - node->zero_offset, node->zero_size);
       return;
     case ND_COND: {
       int c = count();
-      gen_expr(node->cond);
-      println("  cmp rax, 0");
-      println("  je .L.else.%d", c);
+      gen_branch(node->cond, false, format(".L.else.%d", c));
       gen_expr(node->then);
       println("  jmp .L.end.%d", c);
       println(".L.else.%d:", c);
@@ -222,7 +1468,7 @@ static void gen_expr(Node *node) {
       return;
     } case ND_NOT:
       gen_expr(node->lhs);
-      println("  cmp rax, 0");
+      cmp_zero(node->lhs->ty);
       println("  sete al");
       println("  movzx rax, al");
       return;
@@ -232,12 +1478,9 @@ static void gen_expr(Node *node) {
       return;
     case ND_LOGAND: {
       int c = count();
-      gen_expr(node->lhs);
-      println("  cmp rax, 0");
-      println("  je .L.false.%d", c);
-      gen_expr(node->rhs);
-      println("  cmp rax, 0");
-      println("  je .L.false.%d", c);
+      char *label = format(".L.false.%d", c);
+      gen_branch(node->lhs, false, label);
+      gen_branch(node->rhs, false, label);
       println("  mov rax, 1");
       println("  jmp .L.end.%d", c);
       println(".L.false.%d:", c);
@@ -247,12 +1490,9 @@ static void gen_expr(Node *node) {
     }
     case ND_LOGOR: {
       int c = count();
-      gen_expr(node->lhs);
-      println("  cmp rax, 0");
-      println("  jne .L.true.%d", c);
-      gen_expr(node->rhs);
-      println("  cmp rax, 0");
-      println("  jne .L.true.%d", c);
+      char *label = format(".L.true.%d", c);
+      gen_branch(node->lhs, true, label);
+      gen_branch(node->rhs, true, label);
       println("  mov rax, 0");
       println("  jmp .L.end.%d", c);
       println(".L.true.%d:", c);
@@ -260,31 +1500,23 @@ static void gen_expr(Node *node) {
       println(".L.end.%d:", c);
       return;
     }
-    case ND_FUNCALL: {
-      int nargs = 0;
-      for (Node *arg = node->args; arg; arg = arg->next) {
-        gen_expr(arg);
-        push();
-        nargs++;
-      }
-
-      for (int i = nargs - 1; i >= 0; i--)
-        pop(argreg64[i]);
-
-      println("  mov rax, 0");
-
-      if (depth % 2 == 0) {
-        println("  call %s", node->funcname);
-      } else {
-        println("  sub rsp, 8");
-        println("  call %s", node->funcname);
-        println("  add rsp, 8");
-      }
-
+    case ND_FUNCALL:
+      gen_funcall(node);
+      return;
+    case ND_VECTOR:
+      gen_vector(node);
       return;
-    }
   }
 
+  if (is_compare(node)) {
+    println("  set%s al", gen_cmp(node, true));
+    println("  movzb rax, al");
+    return;
+  }
+
+  if (gen_binary_operand(node))
+    return;
+
   gen_expr(node->rhs);
   push();
   gen_expr(node->lhs);
@@ -329,23 +1561,6 @@ static void gen_expr(Node *node) {
     case ND_BITXOR:
       println("  xor rax, rdi");
       return;
-    case ND_EQ:
-    case ND_NE:
-    case ND_LT:
-    case ND_LE:
-      println("  cmp %s, %s", ax, di);
-      
-      if (node->kind == ND_EQ)
-        println("  sete al");
-      else if(node->kind == ND_NE)
-        println("  setne al");
-      else if(node->kind == ND_LT)
-        println("  setl al");
-      else if(node->kind == ND_LE)
-        println("  setle al");
-
-      println("  movzb rax, al");
-      return;
     case ND_SHL:
       println("  mov rcx, rdi");
       println("  shl %s, cl", ax);
@@ -359,6 +1574,132 @@ static void gen_expr(Node *node) {
   error_tok(node->tok, "不正な式です");
 }
 
+static int compare_case(const void *a, const void *b) {
+  int64_t x = (*(Node **)a)->val;
+  int64_t y = (*(Node **)b)->val;
+  return (x > y) - (x < y);
+}
+
+// caseの数がこれより少なければ比較を並べるだけにする
+#define SWITCH_LINEAR_MAX 4
+// caseの値の範囲がcaseの数のこの倍以下ならジャンプテーブルを使う
+#define SWITCH_TABLE_DENSITY 3
+
+// 値の昇順に並んだcases[lo..hi)を二分探索するコードを出力する
+static void gen_switch_bsearch(Node **cases, int lo, int hi, char *reg, char *dflt) {
+  if (hi - lo < SWITCH_LINEAR_MAX) {
+    for (int i = lo; i < hi; i++) {
+      println("  cmp %s, %ld", reg, cases[i]->val);
+      println("  je %s", cases[i]->label);
+    }
+    println("  jmp %s", dflt);
+    return;
+  }
+
+  int mid = (lo + hi) / 2;
+  int c = count();
+  println("  cmp %s, %ld", reg, cases[mid]->val);
+  println("  je %s", cases[mid]->label);
+  println("  jg .L.bsearch.%d", c);
+  gen_switch_bsearch(cases, lo, mid, reg, dflt);
+  println(".L.bsearch.%d:", c);
+  gen_switch_bsearch(cases, mid + 1, hi, reg, dflt);
+}
+
+// 値の昇順に並んだcasesに対するジャンプテーブルを出力する。
+// テーブルには位置独立にするためテーブル先頭からの相対アドレスを置く。
+static void gen_switch_table(Node **cases, int n, char *reg, char *dflt) {
+  int64_t min = cases[0]->val;
+  int64_t range = cases[n - 1]->val - min + 1;
+  int c = count();
+
+  // 32ビットの演算でraxの上位32ビットを0にしておく
+  if (min)
+    println("  sub %s, %ld", reg, min);
+  else if (!strcmp(reg, "eax"))
+    println("  mov eax, eax");
+
+  println("  cmp %s, %ld", reg, range - 1);
+  println("  ja %s", dflt);
+  println("  lea rdi, .L.jtab.%d[rip]", c);
+  println("  movsxd rax, dword ptr [rdi+rax*4]");
+  println("  add rax, rdi");
+  println("  jmp rax");
+
+  println("  .section .rodata");
+  println("  .align 4");
+  println(".L.jtab.%d:", c);
+  int i = 0;
+  for (int64_t v = min; v < min + range; v++) {
+    if (cases[i]->val != v) {
+      println("  .long %s-.L.jtab.%d", dflt, c);
+      continue;
+    }
+
+    println("  .long %s-.L.jtab.%d", cases[i]->label, c);
+    while (i < n - 1 && cases[i]->val == v)
+      i++;
+  }
+  println("  .text");
+}
+
+// switch文の条件の値(raxにある)に応じてcaseにジャンプするコードを出力する。
+// caseの数と値の密度に応じて、比較の列、ジャンプテーブル、二分探索を使い分ける。
+static void gen_switch(Node *node) {
+  char *reg = (node->cond->ty->size == 8) ? "rax" : "eax";
+  char *dflt = node->default_case ? node->default_case->label : node->brk_label;
+
+  int n = 0;
+  for (Node *c = node->case_next; c; c = c->case_next)
+    n++;
+
+  Node **cases = calloc(n, sizeof(Node *));
+  int i = n;
+  for (Node *c = node->case_next; c; c = c->case_next)
+    cases[--i] = c;
+
+  if (n < SWITCH_LINEAR_MAX) {
+    gen_switch_bsearch(cases, 0, n, reg, dflt);
+    free(cases);
+    return;
+  }
+
+  qsort(cases, n, sizeof(Node *), compare_case);
+
+  int64_t range = cases[n - 1]->val - cases[0]->val + 1;
+  if (range <= (int64_t)n * SWITCH_TABLE_DENSITY)
+    gen_switch_table(cases, n, reg, dflt);
+  else
+    gen_switch_bsearch(cases, 0, n, reg, dflt);
+
+  free(cases);
+}
+
+// 式の中に文式があればtrue。文式の中のラベルは2回出力できない。
+static bool has_stmt_expr(Node *node) {
+  if (!node)
+    return false;
+  if (node->kind == ND_STMT_EXPR)
+    return true;
+
+  if (has_stmt_expr(node->lhs) || has_stmt_expr(node->rhs) ||
+      has_stmt_expr(node->cond) || has_stmt_expr(node->then) ||
+      has_stmt_expr(node->els))
+    return true;
+  for (Node *n = node->args; n; n = n->next)
+    if (has_stmt_expr(n))
+      return true;
+  return false;
+}
+
+// ループの入口の条件判定。条件式を複製できなければ本体の後ろの判定に飛ぶ。
+static void gen_loop_entry(Node *cond, char *brk_label, int c) {
+  if (has_stmt_expr(cond))
+    println("  jmp .L.cond.%d", c);
+  else
+    gen_branch(cond, false, brk_label);
+}
+
 static void gen_stmt(Node *node) {
   println("  .loc 1 %d", node->tok->line_no);
 
@@ -370,12 +1711,19 @@ static void gen_stmt(Node *node) {
       println("%s:", node->unique_label);
       gen_stmt(node->lhs);
       return;
-    case ND_RETURN:
+    case ND_RETURN: {
+      Node *call = tail_call(node->lhs);
+      if (call) {
+        gen_tail_call(call);
+        return;
+      }
+
       gen_expr(node->lhs);
       println("  jmp .L.return.%s", current_fn->name);
       return;
+    }
     case ND_EXPR_STMT:
-      gen_expr(node->lhs);
+      gen_void_expr(node->lhs);
       return;
     case ND_BLOCK:
       for (Node *n = node->body; n; n = n->next)
@@ -384,9 +1732,7 @@ static void gen_stmt(Node *node) {
     case ND_IF: {
       int c = count();
 
-      gen_expr(node->cond);
-      println("  cmp rax, 0");
-      println("  je .L.else.%d", c);
+      gen_branch(node->cond, false, format(".L.else.%d", c));
 
       gen_stmt(node->then);
       println("  jmp .L.end.%d", c);
@@ -400,52 +1746,54 @@ static void gen_stmt(Node *node) {
       return;
     }
     case ND_WHILE: {
+      // 入口で1回条件を調べ、以降は本体の後ろで調べて先頭に戻る。
+      // 1回の繰り返しで実行する分岐は条件分岐1つになる。
+      int c = count();
+
+      gen_loop_entry(node->cond, node->brk_label, c);
+      println(".L.begin.%d:", c);
+      gen_stmt(node->then);
+      println("%s:", node->cont_label);
+      println(".L.cond.%d:", c);
+      gen_branch(node->cond, true, format(".L.begin.%d", c));
+      println("%s:", node->brk_label);
+      return;
+    }
+    case ND_DO: {
       int c = count();
 
       println(".L.begin.%d:", c);
-      gen_expr(node->cond);
-      println("  cmp rax, 0");
-      println("  je %s", node->brk_label);
       gen_stmt(node->then);
       println("%s:", node->cont_label);
-      println("  jmp .L.begin.%d", c);
+      gen_branch(node->cond, true, format(".L.begin.%d", c));
       println("%s:", node->brk_label);
       return;
     }
     case ND_FOR: {
       int c = count();
       gen_stmt(node->init);
+
+      if (node->cond)
+        gen_loop_entry(node->cond, node->brk_label, c);
       println(".L.begin.%d:", c);
-      
-      if (node->cond) {
-        gen_expr(node->cond);
-        println("  cmp rax, 0");
-        println("  je %s", node->brk_label);
-      }
 
       gen_stmt(node->then);
       println("%s:", node->cont_label);
 
       if (node->inc)
-        gen_expr(node->inc);
+        gen_void_expr(node->inc);
 
-      println("  jmp .L.begin.%d", c);
+      if (node->cond) {
+        println(".L.cond.%d:", c);
+        gen_branch(node->cond, true, format(".L.begin.%d", c));
+      } else
+        println("  jmp .L.begin.%d", c);
       println("%s:", node->brk_label);
       return;
     }
     case ND_SWITCH:
       gen_expr(node->cond);
-
-      for (Node *n = node->case_next; n; n = n->case_next) {
-        char *reg = (node->cond->ty->size == 8) ? "rax" : "eax";
-        println("  cmp %s, %ld", reg, n->val);
-        println("  je %s", n->label);
-      }
-
-      if (node->default_case)
-        println("  jmp %s", node->default_case->label);
-
-      println("  jmp %s", node->brk_label);
+      gen_switch(node);
       gen_stmt(node->then);
       println("%s:", node->brk_label);
       return;
@@ -458,15 +1806,136 @@ static void gen_stmt(Node *node) {
   error_tok(node->tok, "不正な文です");
 }
 
+// レジスタ割り当ての候補となる変数
+typedef struct {
+  Obj *var;
+  int weight;       // 使用回数をループの深さで重み付けしたもの
+  bool addr_taken;  // アドレスが取られていれば割り当てられない
+} RegCand;
+
+static RegCand *cands;
+static int num_cands;
+
+static RegCand *find_cand(Obj *var) {
+  for (int i = 0; i < num_cands; i++)
+    if (cands[i].var == var)
+      return &cands[i];
+  return NULL;
+}
+
+// &xのようにアドレスが必要とされる左辺値の変数に印をつける
+static void mark_addr_taken(Node *node) {
+  switch (node->kind) {
+    case ND_VAR: {
+      RegCand *c = find_cand(node->var);
+      if (c)
+        c->addr_taken = true;
+      return;
+    }
+    case ND_COMMA:
+      mark_addr_taken(node->rhs);
+      return;
+    case ND_MEMBER:
+      mark_addr_taken(node->lhs);
+      return;
+  }
+}
+
+static void count_uses(Node *node, int weight) {
+  if (!node)
+    return;
+
+  if (node->kind == ND_FUNCALL)
+    has_call = true;
+
+  if (node->kind == ND_VAR) {
+    RegCand *c = find_cand(node->var);
+    if (c)
+      c->weight += weight;
+  }
+
+  if (node->kind == ND_ADDR)
+    mark_addr_taken(node->lhs);
+  if (node->kind == ND_ASSIGN && node->lhs->kind != ND_VAR)
+    mark_addr_taken(node->lhs);
+
+  // ループ内の変数ほど優先してレジスタに置く
+  int w = weight;
+  if ((node->kind == ND_WHILE || node->kind == ND_DO || node->kind == ND_FOR) &&
+      w < 10000)
+    w *= 8;
+
+  count_uses(node->lhs, weight);
+  count_uses(node->rhs, weight);
+  count_uses(node->init, weight);
+  count_uses(node->cond, w);
+  count_uses(node->inc, w);
+  count_uses(node->then, w);
+  count_uses(node->els, weight);
+  for (Node *n = node->body; n; n = n->next)
+    count_uses(n, weight);
+  for (Node *n = node->args; n; n = n->next)
+    count_uses(n, weight);
+}
+
+// アドレスを取られないスカラ型のローカル変数と引数を、使用頻度の高い順に
+// callee-savedレジスタに割り当てる。割り当てた変数はスタック上に領域を持たない。
+static void assign_lvar_regs(Obj *fn) {
+  num_cands = 0;
+  for (Obj *var = fn->locals; var; var = var->next)
+    num_cands++;
+
+  cands = calloc(num_cands, sizeof(RegCand));
+  frame_escapes = false;
+  has_call = false;
+  int i = 0;
+  for (Obj *var = fn->locals; var; var = var->next) {
+    var->reg = -1;
+    if (is_integer(var->ty) || var->ty->kind == TY_PTR)
+      cands[i++].var = var;
+    else
+      frame_escapes = true;
+  }
+  num_cands = i;
+
+  count_uses(fn->body, 1);
+  for (int i = 0; i < num_cands; i++)
+    if (cands[i].addr_taken)
+      frame_escapes = true;
+
+  num_regvars = 0;
+  while (num_regvars < MAX_REGVARS) {
+    RegCand *best = NULL;
+    for (int i = 0; i < num_cands; i++) {
+      RegCand *c = &cands[i];
+      if (c->addr_taken || c->var->reg >= 0 || c->weight == 0)
+        continue;
+      if (!best || best->weight < c->weight)
+        best = c;
+    }
+
+    if (!best)
+      break;
+    best->var->reg = num_regvars++;
+  }
+
+  free(cands);
+}
+
 static void assign_lvar_offsets(Obj *fn) {
+  assign_lvar_regs(fn);
+
   int offset = 0;
   for (Obj *var = fn->locals; var; var = var->next) {
+    if (var->reg >= 0)
+      continue;
+
     offset += var->ty->size;
     offset = align_to(offset, var->ty->align);
     var->offset = offset;
   }
 
-  fn->stack_size = align_to(offset, 16);
+  locals_size = align_to(offset, 8);
 }
 
 static void emit_data(Obj *prog) {
@@ -474,10 +1943,16 @@ static void emit_data(Obj *prog) {
     if (var->is_function)
       continue;
 
-    println("  .globl %s", var->name);
+    if (var->is_static)
+      println("  .local %s", var->name);
+    else
+      println("  .globl %s", var->name);
 
     if (var->init_data) {
-      println("  .data");
+      if (var->is_readonly)
+        println("  .section .rodata");
+      else
+        println("  .data");
       println("%s:", var->name);
 
       Relocation *rel = var->rel;
@@ -501,6 +1976,33 @@ static void emit_data(Obj *prog) {
   }
 }
 
+// レジスタに置かれた引数をスタックかレジスタ変数にコピーする
+static void store_params(Obj *fn) {
+  int i = 0;
+  for (Obj *var = fn->params; var; var = var->next) {
+    if (var->reg >= 0) {
+      int r = var->reg;
+      if (var->ty->size == 1)
+        println("  movsx %s, %s", calleereg32[r], argreg8[i++]);
+      else if (var->ty->size == 2)
+        println("  movsx %s, %s", calleereg32[r], argreg16[i++]);
+      else if (var->ty->size == 4)
+        println("  movsxd %s, %s", calleereg64[r], argreg32[i++]);
+      else
+        println("  mov %s, %s", calleereg64[r], argreg64[i++]);
+    } else if (var->ty->size == 1)
+      println("  mov [%s-%d], %s", frame_reg, var->offset, argreg8[i++]);
+    else if (var->ty->size == 2)
+      println("  mov [%s-%d], %s", frame_reg, var->offset, argreg16[i++]);
+    else if (var->ty->size == 4)
+      println("  mov [%s-%d], %s", frame_reg, var->offset, argreg32[i++]);
+    else if (var->ty->size == 8)
+      println("  mov [%s-%d], %s", frame_reg, var->offset, argreg64[i++]);
+    else
+      unreachable();
+  }
+}
+
 static void emit_text(Obj *prog) {
   for (Obj *fn = prog; fn; fn = fn->next) {
     if (!fn->is_function || !fn->is_definition)
@@ -517,34 +2019,84 @@ static void emit_text(Obj *prog) {
     println("  .text");
     println("%s:", fn->name);
 
-    // プロローグ
-    println("  push rbp");
-    println("  mov rbp, rsp");
-    println("  sub rsp, %d", fn->stack_size);
+    // 関数を呼ばない関数はフレームを作らず、rspの下のレッドゾーンに
+    // ローカル変数を置く。レッドゾーンに収まらなければフレームを作り直す。
+    bool frameless = opt_omit_frame_pointer && !has_call &&
+                     locals_size <= RED_ZONE_SIZE;
+
+    // 使うcallee-savedレジスタやスピル領域の大きさは本体を生成するまで
+    // 分からないので、本体はいったんメモリに書き出しておく
+    FILE *out = output_file;
+    char *buf;
+    size_t buflen;
+    int nsaved, saved_offset;
+    for (;;) {
+      frame_reg = frameless ? "rsp" : "rbp";
+      output_file = open_memstream(&buf, &buflen);
+      max_depth = 0;
+      num_tail_callees = 0;
+
+      gen_stmt(fn->body);
+      assert(depth == 0);
+
+      fclose(output_file);
+      output_file = out;
+
+      // スタックフレームは[ローカル変数][スピル領域][レジスタ退避領域]の順
+      nsaved = num_regvars + MIN(max_depth, num_tmpreg());
+      saved_offset = locals_size + MAX(max_depth - num_tmpreg(), 0) * 8;
+      fn->stack_size = align_to(saved_offset + nsaved * 8, 16);
+
+      if (!frameless || saved_offset + nsaved * 8 <= RED_ZONE_SIZE)
+        break;
+      free(buf);
+      frameless = false;
+    }
 
-    // レジスタに置かれた引数をスタックにコピーしておく
-    int i = 0;
-    for (Obj *var = fn->params; var; var = var->next) {
-      if (var->ty->size == 1)
-        println("  mov [rbp-%d], %s", var->offset, argreg8[i++]);
-      else if (var->ty->size == 2)
-        println("  mov [rbp-%d], %s", var->offset, argreg16[i++]);
-      else if (var->ty->size == 4)
-        println("  mov [rbp-%d], %s", var->offset, argreg32[i++]);
-      else if (var->ty->size == 8)
-        println("  mov [rbp-%d], %s", var->offset, argreg64[i++]);
-      else
-        unreachable();
+    // プロローグからエピローグまでをまとめてのぞき穴最適化にかける
+    char *text;
+    size_t textlen;
+    output_file = open_memstream(&text, &textlen);
+
+    // プロローグ
+    if (!frameless) {
+      println("  push rbp");
+      println("  mov rbp, rsp");
+      println("  sub rsp, %d", fn->stack_size);
     }
+    for (int i = 0; i < nsaved; i++)
+      println("  mov [%s-%d], %s", frame_reg, saved_offset + (i + 1) * 8, calleereg64[i]);
+
+    store_params(fn);
+    println(".L.body.%s:", fn->name);
 
-    gen_stmt(fn->body);
-    assert(depth == 0);
+    fwrite(buf, 1, buflen, output_file);
+    free(buf);
 
     // エピローグ
     println(".L.return.%s:", fn->name);
-    println("  mov rsp, rbp");
-    println("  pop rbp");
+    for (int i = 0; i < nsaved; i++)
+      println("  mov %s, [%s-%d]", calleereg64[i], frame_reg, saved_offset + (i + 1) * 8);
+    if (!frameless) {
+      println("  mov rsp, rbp");
+      println("  pop rbp");
+    }
     println("  ret");
+
+    // 末尾呼び出しはエピローグを実行してから呼び出し先にジャンプする
+    for (int i = 0; i < num_tail_callees; i++) {
+      println(".L.tail.%s.%d:", fn->name, i);
+      for (int j = 0; j < nsaved; j++)
+        println("  mov %s, [rbp-%d]", calleereg64[j], saved_offset + (j + 1) * 8);
+      println("  mov rsp, rbp");
+      println("  pop rbp");
+      println("  jmp %s", tail_callees[i]);
+    }
+
+    fclose(output_file);
+    output_file = out;
+    peephole(text, out);
+    free(text);
   }
 
 }
@@ -1,10 +1,18 @@
 #include "1cc.h"
 
+// -funroll-loopsで展開する回数の既定値
+#define DEFAULT_UNROLL 4
+
+bool opt_omit_frame_pointer = true;
+int opt_unroll = DEFAULT_UNROLL;
+bool opt_vectorize = true;
+
 static char *opt_o;
+static bool opt_dump_ast;
 static char *input_path;
 
 static void usage(int status) {
-  fprintf(stderr, "1cc [ -o <path> ] <file>\n");
+  fprintf(stderr, "1cc [ -o <path> ] [ --dump-ast ] [ -f[no-]omit-frame-pointer ] [ -funroll-loops[=<n>] | -fno-unroll-loops ] [ -f[no-]tree-vectorize ] <file>\n");
   exit(status);
 }
 
@@ -21,6 +29,51 @@ static void parse_args(int argc, char **argv) {
       continue;
     }
 
+    if (!strcmp(argv[i], "--dump-ast")) {
+      opt_dump_ast = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fomit-frame-pointer")) {
+      opt_omit_frame_pointer = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fno-omit-frame-pointer")) {
+      opt_omit_frame_pointer = false;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-funroll-loops")) {
+      opt_unroll = DEFAULT_UNROLL;
+      continue;
+    }
+
+    // 2回未満の展開は意味がないので、数でない値と一緒にはじく
+    if (!strncmp(argv[i], "-funroll-loops=", 15)) {
+      char *end;
+      long n = strtol(argv[i] + 15, &end, 10);
+      if (end == argv[i] + 15 || *end || n < 2 || n > INT_MAX)
+        usage(1);
+      opt_unroll = n;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fno-unroll-loops")) {
+      opt_unroll = 0;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-ftree-vectorize")) {
+      opt_vectorize = true;
+      continue;
+    }
+
+    if (!strcmp(argv[i], "-fno-tree-vectorize")) {
+      opt_vectorize = false;
+      continue;
+    }
+
     // -oXXXのように-oとpathの間にスペースがない場合
     if (!strncmp(argv[i], "-o", 2)) {
       opt_o = argv[i] + 2;
@@ -54,8 +107,16 @@ int main(int argc, char **argv) {
   // トークナイズとパース
   Token *tok = tokenize_file(input_path);
   Obj *prog = parse(tok);
+  prog = optimize(prog);
 
   FILE *out = open_file(opt_o);
+
+  // --dump-astならアセンブリの代わりに最適化後のASTを出力する
+  if (opt_dump_ast) {
+    dump_ast(prog, out);
+    return 0;
+  }
+
   fprintf(out, ".file 1 \"%s\"\n", input_path);
   codegen(prog, out);
 
@@ -0,0 +1,2636 @@
+#include "1cc.h"
+
+// パースとコード生成の間で関数のASTを書き換えて最適化する。
+// 各パスはObjのリストを受け取り、関数のbodyをその場で変更する。
+
+static char *kind_name[] = {
+  [ND_NULL_EXPR] = "NULL_EXPR",
+  [ND_ADD] = "ADD",
+  [ND_SUB] = "SUB",
+  [ND_MUL] = "MUL",
+  [ND_DIV] = "DIV",
+  [ND_MOD] = "MOD",
+  [ND_BITAND] = "BITAND",
+  [ND_BITOR] = "BITOR",
+  [ND_BITXOR] = "BITXOR",
+  [ND_SHL] = "SHL",
+  [ND_SHR] = "SHR",
+  [ND_NEG] = "NEG",
+  [ND_ADDR] = "ADDR",
+  [ND_DEREF] = "DEREF",
+  [ND_NOT] = "NOT",
+  [ND_BITNOT] = "BITNOT",
+  [ND_LOGAND] = "LOGAND",
+  [ND_LOGOR] = "LOGOR",
+  [ND_EQ] = "EQ",
+  [ND_NE] = "NE",
+  [ND_LT] = "LT",
+  [ND_LE] = "LE",
+  [ND_ASSIGN] = "ASSIGN",
+  [ND_COND] = "COND",
+  [ND_COMMA] = "COMMA",
+  [ND_MEMBER] = "MEMBER",
+  [ND_RETURN] = "RETURN",
+  [ND_IF] = "IF",
+  [ND_WHILE] = "WHILE",
+  [ND_DO] = "DO",
+  [ND_FOR] = "FOR",
+  [ND_SWITCH] = "SWITCH",
+  [ND_CASE] = "CASE",
+  [ND_BLOCK] = "BLOCK",
+  [ND_GOTO] = "GOTO",
+  [ND_LABEL] = "LABEL",
+  [ND_FUNCALL] = "FUNCALL",
+  [ND_EXPR_STMT] = "EXPR_STMT",
+  [ND_STMT_EXPR] = "STMT_EXPR",
+  [ND_VAR] = "VAR",
+  [ND_NUM] = "NUM",
+  [ND_CAST] = "CAST",
+  [ND_MEMZERO] = "MEMZERO",
+  [ND_VECTOR] = "VECTOR",
+};
+
+static char *vec_op_name[] = {
+  [VEC_ADD] = "add", [VEC_SUB] = "sub", [VEC_AND] = "and", [VEC_OR] = "or",
+  [VEC_XOR] = "xor", [VEC_MIN] = "min", [VEC_MAX] = "max",
+};
+
+static FILE *dump_file;
+
+static void print_type(Type *ty) {
+  switch (ty->kind) {
+    case TY_VOID: fprintf(dump_file, "void"); return;
+    case TY_BOOL: fprintf(dump_file, "_Bool"); return;
+    case TY_CHAR: fprintf(dump_file, "char"); return;
+    case TY_SHORT: fprintf(dump_file, "short"); return;
+    case TY_INT: fprintf(dump_file, "int"); return;
+    case TY_LONG: fprintf(dump_file, "long"); return;
+    case TY_ENUM: fprintf(dump_file, "enum"); return;
+    case TY_STRUCT: fprintf(dump_file, "struct"); return;
+    case TY_UNION: fprintf(dump_file, "union"); return;
+    case TY_FUNC: fprintf(dump_file, "func"); return;
+    case TY_PTR:
+      print_type(ty->base);
+      fprintf(dump_file, "*");
+      return;
+    case TY_ARRAY:
+      print_type(ty->base);
+      fprintf(dump_file, "[%d]", ty->array_len);
+      return;
+  }
+}
+
+static void dump_node(Node *node, int indent);
+
+static void dump_list(Node *node, int indent) {
+  for (Node *n = node; n; n = n->next)
+    dump_node(n, indent);
+}
+
+static void dump_node(Node *node, int indent) {
+  if (!node)
+    return;
+
+  fprintf(dump_file, "%*s%s", indent * 2, "", kind_name[node->kind]);
+
+  switch (node->kind) {
+    case ND_NUM:
+      fprintf(dump_file, " %ld", node->val);
+      break;
+    case ND_VAR:
+      fprintf(dump_file, " %s", *node->var->name ? node->var->name : "(tmp)");
+      break;
+    case ND_MEMZERO:
+      fprintf(dump_file, " %s+%d,%d", *node->var->name ? node->var->name : "(tmp)",
+              node->zero_offset, node->zero_size);
+      break;
+    case ND_MEMBER:
+      fprintf(dump_file, " %.*s", node->member->name->len, node->member->name->loc);
+      break;
+    case ND_FUNCALL:
+      fprintf(dump_file, " %s", node->funcname);
+      break;
+    case ND_GOTO:
+    case ND_LABEL:
+      fprintf(dump_file, " %s", node->unique_label);
+      break;
+    case ND_CASE:
+      fprintf(dump_file, " %ld %s", node->val, node->label);
+      break;
+    case ND_SWITCH:
+      if (node->default_case)
+        fprintf(dump_file, " default=%s", node->default_case->label);
+      break;
+    case ND_VECTOR:
+      fprintf(dump_file, " %s%d", vec_op_name[node->vec_op], node->vec_size * 8);
+      if (node->lane_size != node->vec_size)
+        fprintf(dump_file, "->%d", node->lane_size * 8);
+      break;
+  }
+
+  if (node->ty) {
+    fprintf(dump_file, " : ");
+    print_type(node->ty);
+  }
+  fprintf(dump_file, "\n");
+
+  dump_node(node->init, indent + 1);
+  dump_node(node->cond, indent + 1);
+  dump_node(node->inc, indent + 1);
+  dump_node(node->then, indent + 1);
+  dump_node(node->els, indent + 1);
+  dump_node(node->lhs, indent + 1);
+  dump_node(node->rhs, indent + 1);
+  dump_list(node->body, indent + 1);
+  dump_list(node->args, indent + 1);
+}
+
+// 最適化後の関数のASTをテキストで出力する。デバッグ用。
+void dump_ast(Obj *prog, FILE *out) {
+  dump_file = out;
+
+  for (Obj *fn = prog; fn; fn = fn->next) {
+    if (!fn->is_function || !fn->is_definition)
+      continue;
+
+    fprintf(out, "%s %s\n", fn->is_static ? "static" : "function", fn->name);
+    for (Obj *var = fn->locals; var; var = var->next) {
+      fprintf(out, "  local %s : ", *var->name ? var->name : "(tmp)");
+      print_type(var->ty);
+      fprintf(out, "\n");
+    }
+    dump_node(fn->body, 1);
+  }
+}
+
+//
+// 定数畳み込みと代数的簡約
+//
+
+static bool is_scalar(Type *ty) {
+  return is_integer(ty) || ty->kind == TY_PTR;
+}
+
+static bool same_type(Type *a, Type *b) {
+  if (a->kind != b->kind || a->size != b->size)
+    return false;
+  if (a->kind == TY_PTR)
+    return a->base == b->base;
+  return is_integer(a);
+}
+
+static bool is_num(Node *node, int64_t val) {
+  return node->kind == ND_NUM && node->val == val;
+}
+
+// 代入や関数呼び出しのように、取り除くと動作が変わる式ならtrue
+static bool has_side_effects(Node *node) {
+  if (!node)
+    return false;
+
+  switch (node->kind) {
+    case ND_ASSIGN:
+    case ND_FUNCALL:
+    case ND_STMT_EXPR:
+    case ND_MEMZERO:
+    case ND_VECTOR:
+      return true;
+  }
+
+  return has_side_effects(node->lhs) || has_side_effects(node->rhs) ||
+         has_side_effects(node->cond) || has_side_effects(node->then) ||
+         has_side_effects(node->els);
+}
+
+// 値をty型に切り詰める。実行時の値の表現と合わせて符号拡張しておく。
+static int64_t normalize(int64_t val, Type *ty) {
+  if (ty->kind == TY_BOOL)
+    return !!val;
+
+  switch (ty->size) {
+    case 1: return (int8_t)val;
+    case 2: return (int16_t)val;
+    case 4: return (int32_t)val;
+  }
+  return val;
+}
+
+// origと同じ型を持つ定数ノードを作る
+static Node *num_like(int64_t val, Node *orig) {
+  Node *node = new_num(normalize(val, orig->ty), orig->tok);
+  node->ty = orig->ty;
+  return node;
+}
+
+// 畳み込むと実行時と結果が変わったり、コンパイラ自身が
+// 落ちたりする定数式ならtrue
+static bool is_unsafe_const_op(Node *node) {
+  int64_t r = node->rhs->val;
+
+  switch (node->kind) {
+    case ND_DIV:
+    case ND_MOD:
+      return r == 0 || r == -1;
+    case ND_SHL:
+    case ND_SHR:
+      return r < 0 || r >= node->ty->size * 8;
+  }
+  return false;
+}
+
+// 単位元や零元との演算を簡約する。簡約できなければNULL。
+static Node *simplify_binary(Node *node) {
+  Node *lhs = node->lhs;
+  Node *rhs = node->rhs;
+
+  // x op e => x
+  if (same_type(lhs->ty, node->ty)) {
+    switch (node->kind) {
+      case ND_ADD:
+      case ND_SUB:
+      case ND_BITOR:
+      case ND_BITXOR:
+      case ND_SHL:
+      case ND_SHR:
+        if (is_num(rhs, 0))
+          return lhs;
+        break;
+      case ND_MUL:
+      case ND_DIV:
+        if (is_num(rhs, 1))
+          return lhs;
+        break;
+      case ND_BITAND:
+        if (is_num(rhs, -1))
+          return lhs;
+        break;
+    }
+  }
+
+  // e op x => x
+  if (same_type(rhs->ty, node->ty)) {
+    switch (node->kind) {
+      case ND_ADD:
+      case ND_BITOR:
+      case ND_BITXOR:
+        if (is_num(lhs, 0))
+          return rhs;
+        break;
+      case ND_MUL:
+        if (is_num(lhs, 1))
+          return rhs;
+        break;
+      case ND_BITAND:
+        if (is_num(lhs, -1))
+          return rhs;
+        break;
+    }
+  }
+
+  // x * 0 => 0
+  if (node->kind == ND_MUL || node->kind == ND_BITAND)
+    if ((is_num(rhs, 0) && !has_side_effects(lhs)) ||
+        (is_num(lhs, 0) && !has_side_effects(rhs)))
+      return num_like(0, node);
+
+  if (node->kind == ND_MOD && is_num(rhs, 1) && !has_side_effects(lhs))
+    return num_like(0, node);
+
+  return NULL;
+}
+
+// 0か1を返す`x != 0`を作る
+static Node *to_bool(Node *node, Token *tok) {
+  Node *zero = new_num(0, tok);
+  Node *ne = new_binary(ND_NE, node, zero, tok);
+  add_type(ne);
+  return ne;
+}
+
+// (T2)(T1)xを(T2)xにまとめられるならtrue
+static bool can_merge_casts(Type *outer, Type *inner, Type *from) {
+  if (!is_scalar(outer) || !is_scalar(inner) || !is_scalar(from))
+    return false;
+  if (outer->kind == TY_BOOL || inner->kind == TY_BOOL || from->kind == TY_BOOL)
+    return false;
+
+  // 切り詰めてから切り詰める場合と、符号拡張してから符号拡張する場合
+  return outer->size <= inner->size || from->size <= inner->size;
+}
+
+static Node *fold_cast(Node *node) {
+  if (!is_scalar(node->ty))
+    return node;
+
+  Node *lhs = node->lhs;
+  if (lhs->kind == ND_NUM)
+    return num_like(lhs->val, node);
+
+  if (lhs->kind == ND_CAST && can_merge_casts(node->ty, lhs->ty, lhs->lhs->ty))
+    return fold_cast(new_cast(lhs->lhs, node->ty));
+
+  if (same_type(node->ty, lhs->ty))
+    return lhs;
+  return node;
+}
+
+static Node *fold(Node *node) {
+  if (!node)
+    return NULL;
+
+  node->lhs = fold(node->lhs);
+  node->rhs = fold(node->rhs);
+  node->cond = fold(node->cond);
+  node->then = fold(node->then);
+  node->els = fold(node->els);
+  node->init = fold(node->init);
+  node->inc = fold(node->inc);
+
+  for (Node **p = &node->body; *p; p = &(*p)->next) {
+    Node *next = (*p)->next;
+    *p = fold(*p);
+    (*p)->next = next;
+  }
+
+  for (Node **p = &node->args; *p; p = &(*p)->next) {
+    Node *next = (*p)->next;
+    *p = fold(*p);
+    (*p)->next = next;
+  }
+
+  switch (node->kind) {
+    case ND_ADD:
+    case ND_SUB:
+    case ND_MUL:
+    case ND_DIV:
+    case ND_MOD:
+    case ND_BITAND:
+    case ND_BITOR:
+    case ND_BITXOR:
+    case ND_SHL:
+    case ND_SHR:
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE: {
+      if (!is_scalar(node->ty))
+        return node;
+
+      if (node->lhs->kind == ND_NUM && node->rhs->kind == ND_NUM) {
+        if (is_unsafe_const_op(node))
+          return node;
+        return num_like(eval(node), node);
+      }
+
+      Node *n = simplify_binary(node);
+      return n ? n : node;
+    }
+    case ND_NEG:
+    case ND_BITNOT:
+    case ND_NOT:
+      if (node->lhs->kind == ND_NUM)
+        return num_like(eval(node), node);
+      return node;
+    case ND_CAST:
+      return fold_cast(node);
+    case ND_COND:
+      if (node->cond->kind == ND_NUM)
+        return node->cond->val ? node->then : node->els;
+      return node;
+    case ND_LOGAND:
+    case ND_LOGOR: {
+      // &&なら0、||なら1で結果が決まる
+      int64_t dominant = (node->kind == ND_LOGOR);
+
+      if (node->lhs->kind == ND_NUM) {
+        if (!!node->lhs->val == dominant)
+          return num_like(dominant, node);
+        if (node->rhs->kind == ND_NUM)
+          return num_like(!!node->rhs->val, node);
+        return to_bool(node->rhs, node->tok);
+      }
+
+      if (node->rhs->kind == ND_NUM) {
+        if (!!node->rhs->val != dominant)
+          return to_bool(node->lhs, node->tok);
+        if (!has_side_effects(node->lhs))
+          return num_like(dominant, node);
+      }
+      return node;
+    }
+    case ND_COMMA:
+      if (!has_side_effects(node->lhs))
+        return node->rhs;
+      return node;
+  }
+
+  return node;
+}
+
+// 値が使われない式から、値を計算するだけの外側の演算を取り除く。
+// 例えばi++は`(i = i + 1) - 1`のように変換されているので、
+// 文として使われているなら`i = i + 1`だけにする。
+static Node *drop_result(Node *node) {
+  for (;;) {
+    if (node->kind == ND_CAST) {
+      node = node->lhs;
+      continue;
+    }
+
+    if ((node->kind == ND_ADD || node->kind == ND_SUB) && node->rhs->kind == ND_NUM) {
+      node = node->lhs;
+      continue;
+    }
+
+    if (node->kind == ND_COMMA)
+      node->rhs = drop_result(node->rhs);
+    return node;
+  }
+}
+
+// 文をたどって、式文とforの更新式の値を捨てる
+static void drop_unused_results(Node *node) {
+  if (!node)
+    return;
+
+  switch (node->kind) {
+    case ND_EXPR_STMT:
+      node->lhs = drop_result(node->lhs);
+      return;
+    case ND_FOR:
+      if (node->inc)
+        node->inc = drop_result(node->inc);
+      break;
+    case ND_LABEL:
+    case ND_CASE:
+      drop_unused_results(node->lhs);
+      return;
+  }
+
+  drop_unused_results(node->init);
+  drop_unused_results(node->then);
+  drop_unused_results(node->els);
+  for (Node *n = node->body; n; n = n->next)
+    drop_unused_results(n);
+}
+
+//
+// 到達しないコードと使われない式の削除
+//
+
+static void eliminate_dead_exprs(Node *node);
+static Node *eliminate_dead_stmt(Node *node);
+
+// 文の中にgotoやswitchで飛び込めるラベルがあればtrue。
+// 入れ子のswitchのcaseはそのswitchからしか飛び込めない。
+// statement expressionの中には外から飛び込めないので式は見ない。
+static bool has_label(Node *node, bool cases) {
+  if (!node)
+    return false;
+
+  switch (node->kind) {
+    case ND_LABEL:
+      return true;
+    case ND_CASE:
+      return cases || has_label(node->lhs, cases);
+    case ND_SWITCH:
+      cases = false;
+      break;
+    case ND_EXPR_STMT:
+    case ND_RETURN:
+      return false;
+  }
+
+  if (has_label(node->then, cases) || has_label(node->els, cases) ||
+      has_label(node->init, cases))
+    return true;
+  for (Node *n = node->body; n; n = n->next)
+    if (has_label(n, cases))
+      return true;
+  return false;
+}
+
+// 実行が次の文に進まない文ならtrue
+static bool is_terminator(Node *node) {
+  switch (node->kind) {
+    case ND_RETURN:
+    case ND_GOTO:
+      return true;
+    case ND_LABEL:
+    case ND_CASE:
+      return is_terminator(node->lhs);
+    case ND_BLOCK: {
+      Node *last = node->body;
+      while (last && last->next)
+        last = last->next;
+      return last && is_terminator(last);
+    }
+    case ND_IF:
+      return node->els && is_terminator(node->then) && is_terminator(node->els);
+  }
+  return false;
+}
+
+// nodeの中にlabelへのgotoがあればtrue
+static bool jumps_to(Node *node, char *label) {
+  if (!node)
+    return false;
+  if (node->kind == ND_GOTO && !strcmp(node->unique_label, label))
+    return true;
+
+  if (jumps_to(node->lhs, label) || jumps_to(node->rhs, label) ||
+      jumps_to(node->cond, label) || jumps_to(node->then, label) ||
+      jumps_to(node->els, label) || jumps_to(node->init, label) ||
+      jumps_to(node->inc, label))
+    return true;
+  for (Node *n = node->body; n; n = n->next)
+    if (jumps_to(n, label))
+      return true;
+  for (Node *n = node->args; n; n = n->next)
+    if (jumps_to(n, label))
+      return true;
+  return false;
+}
+
+static bool is_empty_stmt(Node *node) {
+  return node->kind == ND_BLOCK && !node->body;
+}
+
+static Node *new_empty_stmt(Token *tok) {
+  return new_node(ND_BLOCK, tok);
+}
+
+// 文のリストから不要な文を取り除く。
+// statement expressionの最後の文は式の値になるので残す。
+static void eliminate_dead_list(Node **head, bool keep_last) {
+  for (Node **p = head; *p;) {
+    Node *next = (*p)->next;
+
+    if (keep_last && !next) {
+      if ((*p)->kind == ND_EXPR_STMT)
+        eliminate_dead_exprs((*p)->lhs);
+      else
+        *p = eliminate_dead_stmt(*p);
+      return;
+    }
+
+    Node *n = eliminate_dead_stmt(*p);
+    if (is_empty_stmt(n)) {
+      *p = next;
+      continue;
+    }
+
+    n->next = next;
+    *p = n;
+    p = &n->next;
+
+    // 制御が流れてこない後続の文はラベルを含まない限り捨てる
+    if (is_terminator(n))
+      while (*p && !has_label(*p, true) && !(keep_last && !(*p)->next))
+        *p = (*p)->next;
+  }
+}
+
+// 式の中のstatement expressionの文を整理する
+static void eliminate_dead_exprs(Node *node) {
+  if (!node)
+    return;
+
+  if (node->kind == ND_STMT_EXPR) {
+    eliminate_dead_list(&node->body, true);
+    return;
+  }
+
+  eliminate_dead_exprs(node->lhs);
+  eliminate_dead_exprs(node->rhs);
+  eliminate_dead_exprs(node->cond);
+  eliminate_dead_exprs(node->then);
+  eliminate_dead_exprs(node->els);
+  for (Node *n = node->args; n; n = n->next)
+    eliminate_dead_exprs(n);
+}
+
+// 文から到達しない部分と副作用のない式文を取り除く。
+// 取り除いた結果何も残らなければ空のブロックを返す。
+static Node *eliminate_dead_stmt(Node *node) {
+  switch (node->kind) {
+    case ND_EXPR_STMT:
+      if (!has_side_effects(node->lhs))
+        return new_empty_stmt(node->tok);
+      eliminate_dead_exprs(node->lhs);
+      return node;
+    case ND_RETURN:
+      eliminate_dead_exprs(node->lhs);
+      return node;
+    case ND_BLOCK:
+      eliminate_dead_list(&node->body, false);
+      return node;
+    case ND_LABEL:
+    case ND_CASE:
+      node->lhs = eliminate_dead_stmt(node->lhs);
+      return node;
+    case ND_IF: {
+      node->then = eliminate_dead_stmt(node->then);
+      if (node->els)
+        node->els = eliminate_dead_stmt(node->els);
+
+      if (node->cond->kind != ND_NUM) {
+        eliminate_dead_exprs(node->cond);
+        return node;
+      }
+
+      // 実行されない側にラベルがなければ条件に合う側だけ残す
+      Node *taken = node->cond->val ? node->then : node->els;
+      Node *skipped = node->cond->val ? node->els : node->then;
+      if (has_label(skipped, true))
+        return node;
+      return taken ? taken : new_empty_stmt(node->tok);
+    }
+    case ND_WHILE:
+      node->then = eliminate_dead_stmt(node->then);
+      if (is_num(node->cond, 0) && !has_label(node->then, true))
+        return new_empty_stmt(node->tok);
+      eliminate_dead_exprs(node->cond);
+      return node;
+    case ND_DO:
+      // do { ... } while (0)はbreakやcontinueがなければ本体だけにできる
+      node->then = eliminate_dead_stmt(node->then);
+      if (is_num(node->cond, 0) && !jumps_to(node->then, node->brk_label) &&
+          !jumps_to(node->then, node->cont_label))
+        return node->then;
+      eliminate_dead_exprs(node->cond);
+      return node;
+    case ND_FOR:
+      node->init = eliminate_dead_stmt(node->init);
+      node->then = eliminate_dead_stmt(node->then);
+      if (node->cond && is_num(node->cond, 0) && !has_label(node->then, true))
+        return node->init;
+      eliminate_dead_exprs(node->cond);
+      eliminate_dead_exprs(node->inc);
+      return node;
+    case ND_SWITCH:
+      node->then = eliminate_dead_stmt(node->then);
+      eliminate_dead_exprs(node->cond);
+      return node;
+  }
+  return node;
+}
+
+//
+// 関数のインライン展開
+//
+
+// 本体のノード数がこれ以下のstatic関数をインライン展開する
+#define INLINE_MAX_NODES 40
+// 展開した本体の中の呼び出しを、この深さまで続けて展開する
+#define INLINE_MAX_DEPTH 4
+
+// プログラム全体のObjのリスト
+static Obj *program;
+
+// 最適化中の関数
+static Obj *current_fn;
+
+// ポインタの対応表
+typedef struct {
+  void **from;
+  void **to;
+  int len;
+  int cap;
+} PtrMap;
+
+static void *map_get(PtrMap *map, void *key) {
+  for (int i = 0; i < map->len; i++)
+    if (map->from[i] == key)
+      return map->to[i];
+  return NULL;
+}
+
+static void map_put(PtrMap *map, void *key, void *val) {
+  if (map->len == map->cap) {
+    map->cap = map->cap ? map->cap * 2 : 16;
+    map->from = realloc(map->from, sizeof(void *) * map->cap);
+    map->to = realloc(map->to, sizeof(void *) * map->cap);
+  }
+  map->from[map->len] = key;
+  map->to[map->len] = val;
+  map->len++;
+}
+
+// 呼び出し元に展開するときの変数、ラベル、ノードの対応
+typedef struct {
+  PtrMap vars;
+  PtrMap labels;
+  PtrMap nodes;
+  Obj *ret_var;     // 返り値を受け取る変数。voidならNULL
+  char *join_label; // returnのジャンプ先
+  Token *tok;
+} Inliner;
+
+static int count_nodes(Node *node) {
+  if (!node)
+    return 0;
+
+  int n = 1 + count_nodes(node->lhs) + count_nodes(node->rhs) +
+          count_nodes(node->cond) + count_nodes(node->then) +
+          count_nodes(node->els) + count_nodes(node->init) +
+          count_nodes(node->inc);
+  for (Node *b = node->body; b; b = b->next)
+    n += count_nodes(b);
+  for (Node *a = node->args; a; a = a->next)
+    n += count_nodes(a);
+  return n;
+}
+
+// nodeの中にnameの関数の呼び出しや参照があればtrue
+static bool refers_to(Node *node, Obj *fn) {
+  if (!node)
+    return false;
+  if (node->kind == ND_FUNCALL && !strcmp(node->funcname, fn->name))
+    return true;
+  if (node->kind == ND_VAR && node->var == fn)
+    return true;
+
+  if (refers_to(node->lhs, fn) || refers_to(node->rhs, fn) ||
+      refers_to(node->cond, fn) || refers_to(node->then, fn) ||
+      refers_to(node->els, fn) || refers_to(node->init, fn) ||
+      refers_to(node->inc, fn))
+    return true;
+  for (Node *b = node->body; b; b = b->next)
+    if (refers_to(b, fn))
+      return true;
+  for (Node *a = node->args; a; a = a->next)
+    if (refers_to(a, fn))
+      return true;
+  return false;
+}
+
+static Obj *find_function(char *name) {
+  for (Obj *fn = program; fn; fn = fn->next)
+    if (fn->is_function && fn->is_definition && !strcmp(fn->name, name))
+      return fn;
+  return NULL;
+}
+
+static int count_params(Obj *fn) {
+  int n = 0;
+  for (Obj *p = fn->params; p; p = p->next)
+    n++;
+  return n;
+}
+
+// 呼び出しnodeの先がインライン展開できる関数ならその関数を返す
+static Obj *inline_target(Node *node) {
+  Obj *fn = find_function(node->funcname);
+  if (!fn || !fn->is_static || fn == current_fn)
+    return NULL;
+
+  Type *ret = fn->ty->return_ty;
+  if (ret->kind == TY_STRUCT || ret->kind == TY_UNION)
+    return NULL;
+
+  int nargs = 0;
+  for (Node *arg = node->args; arg; arg = arg->next)
+    nargs++;
+  if (nargs != count_params(fn))
+    return NULL;
+
+  if (count_nodes(fn->body) > INLINE_MAX_NODES || refers_to(fn->body, fn))
+    return NULL;
+  return fn;
+}
+
+// 最適化中の関数にローカル変数を追加する
+static Obj *new_lvar(char *name, Type *ty) {
+  Obj *var = calloc(1, sizeof(Obj));
+  var->name = name;
+  var->ty = ty;
+  var->is_local = true;
+  var->reg = -1;
+  var->next = current_fn->locals;
+  current_fn->locals = var;
+  return var;
+}
+
+static char *new_label(void) {
+  static int id = 0;
+  char *label = calloc(1, 24);
+  sprintf(label, ".L.opt.%d", id++);
+  return label;
+}
+
+static char *remap_label(Inliner *in, char *label) {
+  if (!label)
+    return NULL;
+
+  char *label2 = map_get(&in->labels, label);
+  if (!label2) {
+    label2 = new_label();
+    map_put(&in->labels, label, label2);
+  }
+  return label2;
+}
+
+// returnを返り値の変数への代入と合流点へのジャンプに置き換える
+static Node *inline_return(Node *node, Node *expr, Inliner *in) {
+  Node head = {};
+  Node *cur = &head;
+
+  if (expr && in->ret_var) {
+    Node *assign = new_binary(ND_ASSIGN, new_var_node(in->ret_var, node->tok), expr, node->tok);
+    cur = cur->next = new_unary(ND_EXPR_STMT, assign, node->tok);
+  } else if (expr) {
+    cur = cur->next = new_unary(ND_EXPR_STMT, expr, node->tok);
+  }
+
+  Node *jmp = new_node(ND_GOTO, node->tok);
+  jmp->unique_label = in->join_label;
+  cur = cur->next = jmp;
+
+  Node *blk = new_node(ND_BLOCK, node->tok);
+  blk->body = head.next;
+  add_type(blk);
+  return blk;
+}
+
+// switchのcaseのリストを複製したノードにつなぎ直す
+static void relink_cases(Inliner *in) {
+  for (int i = 0; i < in->nodes.len; i++) {
+    Node *n = in->nodes.to[i];
+    if (n->case_next)
+      n->case_next = map_get(&in->nodes, n->case_next);
+    if (n->default_case)
+      n->default_case = map_get(&in->nodes, n->default_case);
+  }
+}
+
+// 呼び出される関数の本体を、変数とラベルを付け替えて複製する。
+// 対応表にない変数とラベルはそのまま使う。
+// join_labelがなければreturnもそのまま複製する。
+static Node *clone_node(Node *node, Inliner *in) {
+  if (!node)
+    return NULL;
+
+  if (node->kind == ND_RETURN && in->join_label)
+    return inline_return(node, clone_node(node->lhs, in), in);
+
+  Node *n = calloc(1, sizeof(Node));
+  *n = *node;
+  n->next = NULL;
+  n->goto_next = NULL;
+  map_put(&in->nodes, node, n);
+
+  n->lhs = clone_node(node->lhs, in);
+  n->rhs = clone_node(node->rhs, in);
+  n->cond = clone_node(node->cond, in);
+  n->then = clone_node(node->then, in);
+  n->els = clone_node(node->els, in);
+  n->init = clone_node(node->init, in);
+  n->inc = clone_node(node->inc, in);
+
+  Node head = {};
+  Node *cur = &head;
+  for (Node *b = node->body; b; b = b->next)
+    cur = cur->next = clone_node(b, in);
+  n->body = head.next;
+
+  head.next = NULL;
+  cur = &head;
+  for (Node *a = node->args; a; a = a->next)
+    cur = cur->next = clone_node(a, in);
+  n->args = head.next;
+
+  if (n->var && n->var->is_local && map_get(&in->vars, n->var))
+    n->var = map_get(&in->vars, n->var);
+
+  n->unique_label = remap_label(in, node->unique_label);
+  n->brk_label = remap_label(in, node->brk_label);
+  n->cont_label = remap_label(in, node->cont_label);
+  if (node->kind == ND_CASE)
+    n->label = remap_label(in, node->label);
+  return n;
+}
+
+// 呼び出しnodeをfnの本体で置き換えた文式を返す。
+// ({ 仮引数 = 実引数; ...; 本体; 合流点: ; 返り値; })の形になる。
+static Node *inline_call(Node *node, Obj *fn) {
+  Inliner in = {};
+  in.tok = node->tok;
+  in.join_label = new_label();
+
+  for (Obj *var = fn->locals; var; var = var->next)
+    map_put(&in.vars, var, new_lvar(var->name, var->ty));
+
+  Type *ret = fn->ty->return_ty;
+  if (ret->kind != TY_VOID)
+    in.ret_var = new_lvar("", ret);
+
+  Node head = {};
+  Node *cur = &head;
+
+  Node *arg = node->args;
+  for (Obj *param = fn->params; param; param = param->next, arg = arg->next) {
+    Node *lhs = new_var_node(map_get(&in.vars, param), node->tok);
+    Node *assign = new_binary(ND_ASSIGN, lhs, arg, node->tok);
+    cur = cur->next = new_unary(ND_EXPR_STMT, assign, node->tok);
+    add_type(cur);
+  }
+
+  cur = cur->next = clone_node(fn->body, &in);
+  relink_cases(&in);
+
+  Node *join = new_node(ND_LABEL, node->tok);
+  join->unique_label = in.join_label;
+  join->lhs = new_node(ND_BLOCK, node->tok);
+  cur = cur->next = join;
+
+  if (in.ret_var) {
+    cur = cur->next = new_unary(ND_EXPR_STMT, new_var_node(in.ret_var, node->tok), node->tok);
+    add_type(cur);
+  }
+
+  Node *expr = new_node(ND_STMT_EXPR, node->tok);
+  expr->body = head.next;
+  expr->ty = ret;
+  return expr;
+}
+
+static Node *inline_calls(Node *node, int depth) {
+  if (!node)
+    return NULL;
+
+  node->lhs = inline_calls(node->lhs, depth);
+  node->rhs = inline_calls(node->rhs, depth);
+  node->cond = inline_calls(node->cond, depth);
+  node->then = inline_calls(node->then, depth);
+  node->els = inline_calls(node->els, depth);
+  node->init = inline_calls(node->init, depth);
+  node->inc = inline_calls(node->inc, depth);
+
+  for (Node **p = &node->body; *p; p = &(*p)->next) {
+    Node *next = (*p)->next;
+    *p = inline_calls(*p, depth);
+    (*p)->next = next;
+  }
+
+  for (Node **p = &node->args; *p; p = &(*p)->next) {
+    Node *next = (*p)->next;
+    *p = inline_calls(*p, depth);
+    (*p)->next = next;
+  }
+
+  if (node->kind != ND_FUNCALL || depth >= INLINE_MAX_DEPTH)
+    return node;
+
+  Obj *fn = inline_target(node);
+  if (!fn)
+    return node;
+
+  // 展開した本体の中の呼び出しも展開する
+  Node *expr = inline_call(node, fn);
+  for (Node *n = expr->body; n; n = n->next)
+    inline_calls(n, depth + 1);
+  return expr;
+}
+
+// 他の関数やグローバル変数の初期化子から参照されていればtrue
+static bool is_referenced(Obj *target) {
+  for (Obj *obj = program; obj; obj = obj->next) {
+    if (obj->is_function && obj->is_definition && obj != target &&
+        refers_to(obj->body, target))
+      return true;
+
+    for (Relocation *rel = obj->rel; rel; rel = rel->next)
+      if (!strcmp(rel->label, target->name))
+        return true;
+  }
+  return false;
+}
+
+// 使われなくなったstatic関数やstaticなグローバル変数を取り除く
+static Obj *remove_unused_objs(Obj *prog) {
+  for (bool changed = true; changed;) {
+    changed = false;
+
+    for (Obj **p = &prog; *p;) {
+      Obj *obj = *p;
+      if (obj->is_static && !is_referenced(obj)) {
+        *p = obj->next;
+        program = prog;
+        changed = true;
+        continue;
+      }
+      p = &obj->next;
+    }
+  }
+  return prog;
+}
+
+//
+// 基本ブロック内の共通部分式の削除
+//
+
+// 共通部分式として取り出す価値がある式の大きさ
+#define CSE_MIN_COST 2
+
+// アドレスが取られているスカラ型のローカル変数
+static PtrMap addr_taken;
+
+// 式のなかで値として評価される部分式
+typedef struct {
+  Node *node;
+  bool is_cond; // 条件によっては評価されないならtrue
+} Occur;
+
+static Occur *occurs;
+static int num_occurs;
+static int cap_occurs;
+
+static void mark_addr_taken(Node *node) {
+  if (!node)
+    return;
+
+  if (node->kind == ND_ADDR) {
+    Node *lhs = node->lhs;
+    while (lhs->kind == ND_COMMA)
+      lhs = lhs->rhs;
+    if (lhs->kind == ND_VAR)
+      map_put(&addr_taken, lhs->var, lhs->var);
+  }
+
+  mark_addr_taken(node->lhs);
+  mark_addr_taken(node->rhs);
+  mark_addr_taken(node->cond);
+  mark_addr_taken(node->then);
+  mark_addr_taken(node->els);
+  mark_addr_taken(node->init);
+  mark_addr_taken(node->inc);
+  for (Node *n = node->body; n; n = n->next)
+    mark_addr_taken(n);
+  for (Node *n = node->args; n; n = n->next)
+    mark_addr_taken(n);
+}
+
+// ポインタを通した書き込みや関数呼び出しで書き換わるかもしれない変数ならtrue
+static bool is_memory_var(Obj *var) {
+  return !var->is_local || !is_scalar(var->ty) || map_get(&addr_taken, var);
+}
+
+static bool reads_var(Node *node, Obj *var) {
+  if (!node)
+    return false;
+  if (node->kind == ND_VAR)
+    return node->var == var;
+  return reads_var(node->lhs, var) || reads_var(node->rhs, var) ||
+         reads_var(node->cond, var) || reads_var(node->then, var) ||
+         reads_var(node->els, var);
+}
+
+static bool reads_memory(Node *node) {
+  if (!node)
+    return false;
+
+  switch (node->kind) {
+    case ND_DEREF:
+    case ND_MEMBER:
+      return true;
+    case ND_VAR:
+      return is_memory_var(node->var);
+  }
+  return reads_memory(node->lhs) || reads_memory(node->rhs) ||
+         reads_memory(node->cond) || reads_memory(node->then) ||
+         reads_memory(node->els);
+}
+
+static bool may_trap(Node *node) {
+  if (!node)
+    return false;
+  if (node->kind == ND_DIV || node->kind == ND_MOD)
+    return true;
+  return may_trap(node->lhs) || may_trap(node->rhs) ||
+         may_trap(node->cond) || may_trap(node->then) || may_trap(node->els);
+}
+
+// nodeを実行するとexprの値が変わるかもしれないならtrue。
+// 関数呼び出しの前に0除算などが起きるようにもしない。
+static bool clobbers(Node *node, Node *expr) {
+  if (!node)
+    return false;
+
+  switch (node->kind) {
+    case ND_ASSIGN:
+      if (node->lhs->kind == ND_VAR) {
+        Obj *var = node->lhs->var;
+        if (reads_var(expr, var) || (is_memory_var(var) && reads_memory(expr)))
+          return true;
+      } else if (reads_memory(expr)) {
+        return true;
+      }
+      break;
+    case ND_FUNCALL:
+      if (reads_memory(expr) || may_trap(expr))
+        return true;
+      break;
+    case ND_MEMZERO:
+      if (reads_memory(expr) || reads_var(expr, node->var))
+        return true;
+      break;
+    case ND_VECTOR:
+      if (node->lhs && reads_memory(expr))
+        return true;
+      break;
+  }
+
+  if (clobbers(node->lhs, expr) || clobbers(node->rhs, expr) ||
+      clobbers(node->cond, expr) || clobbers(node->then, expr) ||
+      clobbers(node->els, expr) || clobbers(node->init, expr) ||
+      clobbers(node->inc, expr))
+    return true;
+  for (Node *n = node->body; n; n = n->next)
+    if (clobbers(n, expr))
+      return true;
+  for (Node *n = node->args; n; n = n->next)
+    if (clobbers(n, expr))
+      return true;
+  return false;
+}
+
+// 一度計算して使い回すと得になる式の大きさ。メモリからの読み込みは重く数える。
+static int cse_cost(Node *node) {
+  if (!node)
+    return 0;
+
+  switch (node->kind) {
+    case ND_VAR:
+    case ND_NUM:
+      return 0;
+    case ND_CAST:
+      return cse_cost(node->lhs);
+    case ND_DEREF:
+      return 2 + cse_cost(node->lhs);
+  }
+  return 1 + cse_cost(node->lhs) + cse_cost(node->rhs) +
+         cse_cost(node->cond) + cse_cost(node->then) + cse_cost(node->els);
+}
+
+static bool equal_expr(Node *a, Node *b) {
+  if (!a || !b)
+    return a == b;
+
+  if (a->kind != b->kind || !a->ty || !b->ty ||
+      a->ty->kind != b->ty->kind || a->ty->size != b->ty->size)
+    return false;
+
+  switch (a->kind) {
+    case ND_NUM:
+      return a->val == b->val;
+    case ND_VAR:
+      return a->var == b->var;
+    case ND_MEMBER:
+      if (a->member != b->member)
+        return false;
+      break;
+  }
+
+  return equal_expr(a->lhs, b->lhs) && equal_expr(a->rhs, b->rhs) &&
+         equal_expr(a->cond, b->cond) && equal_expr(a->then, b->then) &&
+         equal_expr(a->els, b->els);
+}
+
+static void add_occur(Node *node, bool is_cond) {
+  if (!node->ty || !is_scalar(node->ty) || node->kind == ND_ADDR ||
+      has_side_effects(node) || cse_cost(node) == 0)
+    return;
+
+  if (num_occurs == cap_occurs) {
+    cap_occurs = cap_occurs ? cap_occurs * 2 : 16;
+    occurs = realloc(occurs, sizeof(Occur) * cap_occurs);
+  }
+  occurs[num_occurs++] = (Occur){node, is_cond};
+}
+
+static void collect_exprs(Node *node, bool is_cond);
+
+// 左辺値のアドレスの計算に使われる式を集める
+static void collect_lvalue(Node *node, bool is_cond) {
+  switch (node->kind) {
+    case ND_DEREF:
+      collect_exprs(node->lhs, is_cond);
+      return;
+    case ND_MEMBER:
+      collect_lvalue(node->lhs, is_cond);
+      return;
+    case ND_COMMA:
+      collect_exprs(node->lhs, is_cond);
+      collect_lvalue(node->rhs, is_cond);
+      return;
+  }
+}
+
+// 式の中で値として評価される部分式をoccursに集める。
+// statement expressionの中は別の文のリストとして扱う。
+static void collect_exprs(Node *node, bool is_cond) {
+  if (!node)
+    return;
+
+  switch (node->kind) {
+    case ND_STMT_EXPR:
+      return;
+    case ND_ASSIGN:
+      collect_lvalue(node->lhs, is_cond);
+      collect_exprs(node->rhs, is_cond);
+      return;
+    case ND_ADDR:
+      collect_lvalue(node->lhs, is_cond);
+      return;
+    case ND_MEMBER:
+      collect_lvalue(node->lhs, is_cond);
+      add_occur(node, is_cond);
+      return;
+    case ND_FUNCALL:
+      for (Node *n = node->args; n; n = n->next)
+        collect_exprs(n, is_cond);
+      return;
+    case ND_LOGAND:
+    case ND_LOGOR:
+      collect_exprs(node->lhs, is_cond);
+      collect_exprs(node->rhs, true);
+      add_occur(node, is_cond);
+      return;
+    case ND_COND:
+      collect_exprs(node->cond, is_cond);
+      collect_exprs(node->then, true);
+      collect_exprs(node->els, true);
+      add_occur(node, is_cond);
+      return;
+  }
+
+  collect_exprs(node->lhs, is_cond);
+  collect_exprs(node->rhs, is_cond);
+  add_occur(node, is_cond);
+}
+
+// 共通部分式を探せる文ならその式を返す
+static Node *stmt_expr(Node *node) {
+  if (node->kind == ND_EXPR_STMT || node->kind == ND_RETURN)
+    return node->lhs;
+  return NULL;
+}
+
+// stmtsのi番目から、exprを書き換えない文が続く間のexprの出現を数える。
+// replがあればその出現をreplに置き換える。
+static int replace_common(Node **stmts, int n, int i, Node *expr, Node *repl) {
+  int cnt = 0;
+  for (int j = i; j < n; j++) {
+    if (j > i && clobbers(stmts[j], expr))
+      break;
+
+    num_occurs = 0;
+    collect_exprs(stmt_expr(stmts[j]), false);
+    for (int k = 0; k < num_occurs; k++) {
+      Node *node = occurs[k].node;
+      if (!equal_expr(node, expr))
+        continue;
+
+      cnt++;
+      if (repl) {
+        Node *next = node->next;
+        *node = *repl;
+        node->next = next;
+      }
+    }
+
+    if (stmts[j]->kind == ND_RETURN)
+      break;
+  }
+  return cnt;
+}
+
+// 文の並びstmts[0..n)で2回以上計算される式を一時変数に入れて使い回す。
+// 一時変数への代入を挿入した位置を返す。見つからなければ-1。
+static int eliminate_common_expr(Node **stmts, int n, Node **assign) {
+  Node *best = NULL;
+  int best_i = -1;
+  int best_cost = 0;
+
+  for (int i = 0; i < n; i++) {
+    num_occurs = 0;
+    collect_exprs(stmt_expr(stmts[i]), false);
+    int len = num_occurs;
+    Occur *cands = calloc(len, sizeof(Occur));
+    memcpy(cands, occurs, sizeof(Occur) * len);
+
+    for (int k = 0; k < len; k++) {
+      Node *node = cands[k].node;
+      int cost = cse_cost(node);
+      if (cands[k].is_cond || cost < CSE_MIN_COST || cost <= best_cost ||
+          clobbers(stmts[i], node))
+        continue;
+      if (replace_common(stmts, n, i, node, NULL) < 2)
+        continue;
+      best = node;
+      best_i = i;
+      best_cost = cost;
+    }
+    free(cands);
+  }
+
+  if (!best)
+    return -1;
+
+  // 最初に評価する前に一時変数に入れておく
+  Node *expr = calloc(1, sizeof(Node));
+  *expr = *best;
+  expr->next = NULL;
+
+  Obj *var = new_lvar("", best->ty);
+  Node *lhs = new_var_node(var, best->tok);
+  lhs->ty = best->ty;
+  Node *rhs = new_var_node(var, best->tok);
+  rhs->ty = best->ty;
+  replace_common(stmts, n, best_i, expr, rhs);
+
+  Node *node = new_binary(ND_ASSIGN, lhs, expr, best->tok);
+  node->ty = best->ty;
+  *assign = new_unary(ND_EXPR_STMT, node, best->tok);
+  return best_i;
+}
+
+static void eliminate_common_exprs(Node *node);
+
+// 入れ子になったブロックを外側の文のリストに展開する。
+// 変数のスコープはパース時に解決済みなので、ブロックをなくしても意味は変わらない。
+// statement expressionの値になる最後の文はそのままにしておく。
+static void flatten_blocks(Node **head, bool keep_last) {
+  for (Node **p = head; *p;) {
+    Node *node = *p;
+    if (node->kind != ND_BLOCK || (keep_last && !node->next)) {
+      p = &node->next;
+      continue;
+    }
+
+    Node **last = &node->body;
+    while (*last)
+      last = &(*last)->next;
+    *last = node->next;
+    *p = node->body;
+  }
+}
+
+// 文のリストを、式文とreturn文だけが続く区間ごとに最適化する
+static void eliminate_common_list(Node **head, bool keep_last) {
+  flatten_blocks(head, keep_last);
+
+  for (Node **p = head; *p;) {
+    if (!stmt_expr(*p)) {
+      eliminate_common_exprs(*p);
+      p = &(*p)->next;
+      continue;
+    }
+
+    int n = 0;
+    for (Node *s = *p; s && stmt_expr(s); s = s->next) {
+      n++;
+      if (s->kind == ND_RETURN)
+        break;
+    }
+
+    for (;;) {
+      Node **stmts = calloc(n, sizeof(Node *));
+      int k = 0;
+      for (Node *s = *p; k < n; s = s->next)
+        stmts[k++] = s;
+
+      Node *assign;
+      int i = eliminate_common_expr(stmts, n, &assign);
+      if (i < 0) {
+        free(stmts);
+        break;
+      }
+
+      Node **q = p;
+      for (int j = 0; j < i; j++)
+        q = &(*q)->next;
+      assign->next = *q;
+      *q = assign;
+      n++;
+      free(stmts);
+    }
+
+    for (int j = 0; j < n; j++) {
+      eliminate_common_exprs(*p);
+      p = &(*p)->next;
+    }
+  }
+}
+
+// 文や式をたどって、ブロックとstatement expressionの文のリストを最適化する
+static void eliminate_common_exprs(Node *node) {
+  if (!node)
+    return;
+
+  if (node->kind == ND_BLOCK || node->kind == ND_STMT_EXPR) {
+    eliminate_common_list(&node->body, node->kind == ND_STMT_EXPR);
+    return;
+  }
+
+  eliminate_common_exprs(node->lhs);
+  eliminate_common_exprs(node->rhs);
+  eliminate_common_exprs(node->cond);
+  eliminate_common_exprs(node->then);
+  eliminate_common_exprs(node->els);
+  eliminate_common_exprs(node->init);
+  eliminate_common_exprs(node->inc);
+  for (Node *n = node->args; n; n = n->next)
+    eliminate_common_exprs(n);
+}
+
+//
+// ループ不変式の移動
+//
+
+// 1つのループから取り出す式の数の上限
+#define LICM_MAX_HOISTS 4
+
+// 実行するとメモリアクセス違反や0除算で止まるかもしれない式ならtrue
+static bool may_fault(Node *node) {
+  if (!node)
+    return false;
+  if (node->kind == ND_DEREF || node->kind == ND_DIV || node->kind == ND_MOD)
+    return true;
+  return may_fault(node->lhs) || may_fault(node->rhs) ||
+         may_fault(node->cond) || may_fault(node->then) || may_fault(node->els);
+}
+
+// 文の中の式をoccursに集める
+static void collect_stmt_exprs(Node *node) {
+  if (!node)
+    return;
+
+  switch (node->kind) {
+    case ND_EXPR_STMT:
+    case ND_RETURN:
+      collect_exprs(node->lhs, true);
+      return;
+    case ND_IF:
+    case ND_WHILE:
+    case ND_DO:
+    case ND_FOR:
+    case ND_SWITCH:
+      collect_stmt_exprs(node->init);
+      collect_exprs(node->cond, true);
+      collect_stmt_exprs(node->then);
+      collect_stmt_exprs(node->els);
+      collect_exprs(node->inc, true);
+      return;
+    case ND_LABEL:
+    case ND_CASE:
+      collect_stmt_exprs(node->lhs);
+      return;
+  }
+
+  for (Node *n = node->body; n; n = n->next)
+    collect_stmt_exprs(n);
+}
+
+// ループの条件式、本体、更新式の式をoccursに集める。
+// whileとforの条件式は入ったときに必ず1回評価されるので、
+// そこでの出現は条件付きとしない。
+static void collect_loop_exprs(Node *loop) {
+  num_occurs = 0;
+  collect_exprs(loop->cond, loop->kind == ND_DO);
+  collect_stmt_exprs(loop->then);
+  collect_exprs(loop->inc, true);
+}
+
+static bool is_loop_invariant(Node *loop, Node *expr) {
+  return !clobbers(loop->cond, expr) && !clobbers(loop->then, expr) &&
+         !clobbers(loop->inc, expr);
+}
+
+// ループの中で値が変わらない式を1つ一時変数に入れて、その代入を返す。
+// ループに入る前に評価するので、必ず評価される条件式の中にあるもの以外は
+// メモリを読んだり0除算したりするかもしれない式は動かさない。
+static Node *hoist_invariant(Node *loop) {
+  collect_loop_exprs(loop);
+
+  Node *best = NULL;
+  int best_cost = 0;
+  for (int i = 0; i < num_occurs; i++) {
+    Node *node = occurs[i].node;
+    int cost = cse_cost(node);
+    if (cost <= best_cost || (occurs[i].is_cond && may_fault(node)))
+      continue;
+    if (!is_loop_invariant(loop, node))
+      continue;
+    best = node;
+    best_cost = cost;
+  }
+
+  if (!best)
+    return NULL;
+
+  Node *expr = calloc(1, sizeof(Node));
+  *expr = *best;
+  expr->next = NULL;
+
+  Obj *var = new_lvar("", best->ty);
+  Node *lhs = new_var_node(var, best->tok);
+  lhs->ty = best->ty;
+  Node *rhs = new_var_node(var, best->tok);
+  rhs->ty = best->ty;
+
+  // collect_loop_exprs()はoccursを上書きするので、先に置き換える対象を控える
+  int len = num_occurs;
+  Node **nodes = calloc(len, sizeof(Node *));
+  for (int i = 0; i < len; i++)
+    nodes[i] = occurs[i].node;
+
+  for (int i = 0; i < len; i++) {
+    if (!equal_expr(nodes[i], expr))
+      continue;
+    Node *next = nodes[i]->next;
+    *nodes[i] = *rhs;
+    nodes[i]->next = next;
+  }
+  free(nodes);
+
+  Node *node = new_binary(ND_ASSIGN, lhs, expr, best->tok);
+  node->ty = best->ty;
+  return new_unary(ND_EXPR_STMT, node, best->tok);
+}
+
+// ループから不変式を取り出して、ループの直前で計算する。
+// whileはブロックで包むので、ループ自体のノードを返す。
+static Node *hoist_from_loop(Node *node) {
+  // ループの外から本体に飛び込まれると取り出した式が計算されない
+  if (has_label(node->then, true))
+    return node;
+
+  Node head = {};
+  Node *cur = &head;
+  for (int i = 0; i < LICM_MAX_HOISTS; i++) {
+    Node *assign = hoist_invariant(node);
+    if (!assign)
+      break;
+    cur = cur->next = assign;
+  }
+
+  if (!head.next)
+    return node;
+
+  // forは初期化部の後で計算する
+  if (node->kind == ND_FOR) {
+    Node *init = new_node(ND_BLOCK, node->tok);
+    init->body = node->init;
+    node->init->next = head.next;
+    node->init = init;
+    return node;
+  }
+
+  // whileとdoはブロックで包んでループの前に置く
+  Node *loop = calloc(1, sizeof(Node));
+  *loop = *node;
+  loop->next = NULL;
+  cur->next = loop;
+
+  Node *next = node->next;
+  *node = (Node){0};
+  node->kind = ND_BLOCK;
+  node->tok = loop->tok;
+  node->body = head.next;
+  node->next = next;
+  return loop;
+}
+
+// 外側のループから順に不変式を取り出す。
+// 外側のループで変わらない式は内側のループの中の出現もまとめて置き換わる。
+static void hoist_loop_invariants(Node *node) {
+  if (!node)
+    return;
+
+  if (node->kind == ND_WHILE || node->kind == ND_DO || node->kind == ND_FOR)
+    node = hoist_from_loop(node);
+
+  hoist_loop_invariants(node->lhs);
+  hoist_loop_invariants(node->rhs);
+  hoist_loop_invariants(node->cond);
+  hoist_loop_invariants(node->then);
+  hoist_loop_invariants(node->els);
+  hoist_loop_invariants(node->init);
+  hoist_loop_invariants(node->inc);
+  for (Node *n = node->body; n; n = n->next)
+    hoist_loop_invariants(n);
+  for (Node *n = node->args; n; n = n->next)
+    hoist_loop_invariants(n);
+}
+
+//
+// ループ展開
+//
+
+// 展開したループの本体のノード数の上限
+#define UNROLL_MAX_NODES 200
+// 回数が定数でこれ以下のループは完全に展開する
+#define UNROLL_FULL_MAX 16
+
+static Node *strip_casts(Node *node) {
+  while (node->kind == ND_CAST)
+    node = node->lhs;
+  return node;
+}
+
+// 値を変えない拡張のキャストを外す
+static Node *strip_widening(Node *node) {
+  while (node->kind == ND_CAST && (is_integer(node->ty) || node->ty->kind == TY_PTR) &&
+         node->ty->size >= node->lhs->ty->size)
+    node = node->lhs;
+  return node;
+}
+
+// forの更新式のうち最初の代入。
+// 誘導変数の強度低減はポインタを進める代入をコンマでつなげる。
+static Node *counter_update(Node *inc) {
+  while (inc->kind == ND_COMMA)
+    inc = inc->lhs;
+  return inc;
+}
+
+// for (...; i < n; i = i + step)の形のループ
+typedef struct {
+  Node *var;    // 誘導変数iを参照するノード
+  Node *limit;  // n
+  int64_t step;
+} CountedLoop;
+
+// nodeが回数の決まったforならtrue。
+// 誘導変数はアドレスを取られないint以下のローカル変数かポインタで、本体では書き換えない。
+static bool match_counted_loop(Node *node, CountedLoop *loop) {
+  if (node->kind != ND_FOR || !node->cond || !node->inc)
+    return false;
+  if (node->cond->kind != ND_LT && node->cond->kind != ND_LE)
+    return false;
+
+  Node *var = strip_widening(node->cond->lhs);
+  if (var->kind != ND_VAR || !var->var->is_local || map_get(&addr_taken, var->var))
+    return false;
+  if (!(is_integer(var->ty) && var->ty->size <= 4) && var->ty->kind != TY_PTR)
+    return false;
+
+  Node *inc = counter_update(node->inc);
+  if (inc->kind != ND_ASSIGN || inc->lhs->kind != ND_VAR || inc->lhs->var != var->var)
+    return false;
+
+  Node *add = strip_casts(inc->rhs);
+  if (add->kind != ND_ADD || strip_casts(add->lhs)->kind != ND_VAR ||
+      strip_casts(add->lhs)->var != var->var || add->rhs->kind != ND_NUM ||
+      add->rhs->val <= 0)
+    return false;
+
+  Node *limit = node->cond->rhs;
+  if (has_side_effects(limit) || clobbers(node->then, limit) ||
+      clobbers(node->inc, limit) || clobbers(node->then, var))
+    return false;
+
+  loop->var = var;
+  loop->limit = limit;
+  loop->step = add->rhs->val;
+  return true;
+}
+
+// nodeが誘導変数に定数を代入する文ならtrue
+static bool is_const_store(Node *node, Node *var) {
+  if (node->kind != ND_EXPR_STMT)
+    return false;
+
+  Node *expr = node->lhs;
+  return expr->kind == ND_ASSIGN && expr->lhs->kind == ND_VAR &&
+         expr->lhs->var == var->var && strip_widening(expr->rhs)->kind == ND_NUM;
+}
+
+static bool find_init_value(Node *node, Node *var, int64_t *val, bool *found) {
+  if (node->kind == ND_BLOCK) {
+    for (Node *n = node->body; n; n = n->next)
+      if (!find_init_value(n, var, val, found))
+        return false;
+    return true;
+  }
+
+  if (is_const_store(node, var)) {
+    *val = strip_widening(node->lhs->rhs)->val;
+    *found = true;
+    return true;
+  }
+  return !clobbers(node, var);
+}
+
+// 初期化部を実行した後の誘導変数の値が定数ならtrue
+static bool init_value(Node *init, Node *var, int64_t *val) {
+  bool found = false;
+  return find_init_value(init, var, val, &found) && found;
+}
+
+static bool is_loop(Node *node) {
+  return node->kind == ND_WHILE || node->kind == ND_DO || node->kind == ND_FOR;
+}
+
+// 文の中にループがあればtrue。statement expressionの中も見る。
+static bool has_loop(Node *node) {
+  if (!node)
+    return false;
+  if (is_loop(node))
+    return true;
+
+  if (has_loop(node->lhs) || has_loop(node->rhs) || has_loop(node->cond) ||
+      has_loop(node->then) || has_loop(node->els) || has_loop(node->init))
+    return true;
+  for (Node *n = node->body; n; n = n->next)
+    if (has_loop(n))
+      return true;
+  for (Node *n = node->args; n; n = n->next)
+    if (has_loop(n))
+      return true;
+  return false;
+}
+
+// nodeの中でlabelへのジャンプ先が決まっていればtrue
+static bool defines_label(Node *node, char *label) {
+  if (!node)
+    return false;
+  if (node->kind == ND_LABEL && !strcmp(node->unique_label, label))
+    return true;
+  if ((node->brk_label && !strcmp(node->brk_label, label)) ||
+      (node->cont_label && !strcmp(node->cont_label, label)))
+    return true;
+
+  if (defines_label(node->lhs, label) || defines_label(node->rhs, label) ||
+      defines_label(node->cond, label) || defines_label(node->then, label) ||
+      defines_label(node->els, label) || defines_label(node->init, label) ||
+      defines_label(node->inc, label))
+    return true;
+  for (Node *n = node->body; n; n = n->next)
+    if (defines_label(n, label))
+      return true;
+  for (Node *n = node->args; n; n = n->next)
+    if (defines_label(n, label))
+      return true;
+  return false;
+}
+
+// bodyの外に出るgotoの飛び先は付け替えないようにする
+static void keep_outer_labels(Node *node, Node *body, Inliner *in) {
+  if (!node)
+    return;
+  if (node->kind == ND_GOTO && !defines_label(body, node->unique_label))
+    map_put(&in->labels, node->unique_label, node->unique_label);
+
+  keep_outer_labels(node->lhs, body, in);
+  keep_outer_labels(node->rhs, body, in);
+  keep_outer_labels(node->cond, body, in);
+  keep_outer_labels(node->then, body, in);
+  keep_outer_labels(node->els, body, in);
+  keep_outer_labels(node->init, body, in);
+  keep_outer_labels(node->inc, body, in);
+  for (Node *n = node->body; n; n = n->next)
+    keep_outer_labels(n, body, in);
+  for (Node *n = node->args; n; n = n->next)
+    keep_outer_labels(n, body, in);
+}
+
+// ループの本体をもう1つ作る。本体の中で定義されたラベルは付け替える。
+static Node *clone_body(Node *body) {
+  Inliner in = {};
+  keep_outer_labels(body, body, &in);
+  Node *node = clone_node(body, &in);
+  relink_cases(&in);
+  return node;
+}
+
+// 本体と更新式をn回並べた文のリストを作る。最後の更新式を含めるかはwith_incで決める。
+static Node *repeat_body(Node *loop, int n, bool with_inc) {
+  Node head = {};
+  Node *cur = &head;
+  for (int i = 0; i < n; i++) {
+    cur = cur->next = clone_body(loop->then);
+    if (i < n - 1 || with_inc)
+      cur = cur->next = new_unary(ND_EXPR_STMT, clone_body(loop->inc), loop->tok);
+  }
+
+  Node *blk = new_node(ND_BLOCK, loop->tok);
+  blk->body = head.next;
+  return blk;
+}
+
+// 誘導変数の型で表せる値ならtrue
+static bool fits_in(int64_t val, Type *ty) {
+  int bits = ty->size * 8;
+  return -(1LL << (bits - 1)) <= val && val < (1LL << (bits - 1));
+}
+
+// 回数が定数で少ないなら、本体を回数分並べたブロックを返す
+static Node *unroll_fully(Node *node, CountedLoop *loop) {
+  int64_t start, limit;
+  Node *lim = strip_widening(loop->limit);
+  if (!is_integer(loop->var->ty) || lim->kind != ND_NUM ||
+      !init_value(node->init, loop->var, &start))
+    return NULL;
+  limit = lim->val;
+
+  int64_t trips = 0;
+  if (node->cond->kind == ND_LT && start < limit)
+    trips = (limit - start + loop->step - 1) / loop->step;
+  else if (node->cond->kind == ND_LE && start <= limit)
+    trips = (limit - start) / loop->step + 1;
+
+  if (trips > UNROLL_FULL_MAX || !fits_in(start + trips * loop->step, loop->var->ty) ||
+      count_nodes(node->then) * trips > UNROLL_MAX_NODES ||
+      jumps_to(node->then, node->brk_label))
+    return NULL;
+
+  Node *blk = new_node(ND_BLOCK, node->tok);
+  blk->body = node->init;
+  node->init->next = trips ? repeat_body(node, trips, true) : NULL;
+  return blk;
+}
+
+// 本体をopt_unroll回並べたループと、残りの回数を回す元のループに分ける。
+// 展開したループの条件は、あとopt_unroll回回れることを確かめる。
+// オーバーフローしないようにlongで計算する。
+static Node *unroll_partially(Node *node, CountedLoop *loop) {
+  if (count_nodes(node->then) * opt_unroll > UNROLL_MAX_NODES)
+    return NULL;
+
+  Token *tok = node->tok;
+  Node *var = new_cast(clone_body(loop->var), ty_long);
+  Node *bytes = new_num(loop->step * (opt_unroll - 1), tok);
+  bytes->ty = ty_long;
+  Node *lhs = new_binary(ND_ADD, var, bytes, tok);
+  Node *rhs = new_cast(clone_body(loop->limit), ty_long);
+
+  Node *unrolled = new_node(ND_FOR, tok);
+  unrolled->init = new_node(ND_BLOCK, tok);
+  unrolled->cond = new_binary(node->cond->kind, lhs, rhs, tok);
+  unrolled->then = repeat_body(node, opt_unroll, false);
+  unrolled->inc = clone_body(node->inc);
+  unrolled->brk_label = new_label();
+  unrolled->cont_label = new_label();
+  add_type(unrolled->cond);
+
+  Node *rest = calloc(1, sizeof(Node));
+  *rest = *node;
+  rest->next = NULL;
+  rest->init = new_node(ND_BLOCK, tok);
+
+  Node *blk = new_node(ND_BLOCK, tok);
+  blk->body = node->init;
+  node->init->next = unrolled;
+  unrolled->next = rest;
+  return blk;
+}
+
+// 内側のループから順に、本体にループを含まない回数の決まったforを展開する
+static void unroll_loops(Node *node) {
+  if (!node)
+    return;
+
+  unroll_loops(node->lhs);
+  unroll_loops(node->rhs);
+  unroll_loops(node->cond);
+  unroll_loops(node->then);
+  unroll_loops(node->els);
+  unroll_loops(node->init);
+  unroll_loops(node->inc);
+  for (Node *n = node->body; n; n = n->next)
+    unroll_loops(n);
+  for (Node *n = node->args; n; n = n->next)
+    unroll_loops(n);
+
+  CountedLoop loop = {};
+  if (opt_unroll < 2 || !match_counted_loop(node, &loop) ||
+      has_loop(node->then) || has_label(node->then, true) ||
+      jumps_to(node->then, node->cont_label))
+    return;
+
+  Node *blk = unroll_fully(node, &loop);
+  if (!blk)
+    blk = unroll_partially(node, &loop);
+  if (!blk)
+    return;
+
+  blk->next = node->next;
+  *node = *blk;
+}
+
+//
+// 誘導変数の強度低減
+//
+
+// 1つのループで作るポインタの誘導変数の数の上限
+#define IV_MAX_PTRS 4
+
+// base + (i + offset) * sizeの形のアドレス
+typedef struct {
+  Node *base;
+  int64_t size;
+  int64_t offset;
+} Derived;
+
+// ループの中でbase + i * sizeを指し続けるポインタ
+typedef struct {
+  Node *base;
+  int64_t size;
+  Obj *var;
+} IndVar;
+
+static Node *iv_loop;    // 強度低減しているループ
+static Node *iv_counter; // ループの誘導変数iを参照するノード
+static IndVar ivs[IV_MAX_PTRS];
+static int num_ivs;
+
+static int count_refs(Node *node, Obj *var) {
+  if (!node)
+    return 0;
+
+  int cnt = (node->kind == ND_VAR && node->var == var);
+  cnt += count_refs(node->lhs, var) + count_refs(node->rhs, var) +
+         count_refs(node->cond, var) + count_refs(node->then, var) +
+         count_refs(node->els, var) + count_refs(node->init, var) +
+         count_refs(node->inc, var);
+  for (Node *n = node->body; n; n = n->next)
+    cnt += count_refs(n, var);
+  for (Node *n = node->args; n; n = n->next)
+    cnt += count_refs(n, var);
+  return cnt;
+}
+
+// 型を付けたノードを作る
+static Node *typed(Node *node, Type *ty) {
+  node->ty = ty;
+  return node;
+}
+
+static Node *new_long_num(int64_t val, Token *tok) {
+  return typed(new_num(val, tok), ty_long);
+}
+
+static Node *new_typed_var(Obj *var, Token *tok) {
+  return typed(new_var_node(var, tok), var->ty);
+}
+
+// ポインタにバイト数を足す。new_add()と違ってスケールしない。
+static Node *add_bytes(Node *ptr, Node *bytes, Type *ty) {
+  return typed(new_binary(ND_ADD, ptr, bytes, ptr->tok), ty);
+}
+
+// var = exprの式文
+static Node *new_store(Obj *var, Node *expr) {
+  Node *node = new_binary(ND_ASSIGN, new_typed_var(var, expr->tok), expr, expr->tok);
+  return new_unary(ND_EXPR_STMT, typed(node, var->ty), expr->tok);
+}
+
+// i = i + stepの形の代入ならtrue
+static bool match_step(Node *node, Obj *var, int64_t *step) {
+  if (node->kind != ND_ASSIGN || node->lhs->kind != ND_VAR || node->lhs->var != var)
+    return false;
+
+  Node *add = strip_casts(node->rhs);
+  if (add->kind != ND_ADD || strip_widening(add->lhs)->kind != ND_VAR ||
+      strip_widening(add->lhs)->var != var || add->rhs->kind != ND_NUM ||
+      add->rhs->val == 0)
+    return false;
+  *step = add->rhs->val;
+  return true;
+}
+
+// nodeがループの中で値の変わらないbaseと誘導変数から計算するアドレスならtrue
+static bool match_derived(Node *node, Derived *d) {
+  if (node->kind != ND_ADD || node->ty->kind != TY_PTR)
+    return false;
+
+  Node *idx = strip_widening(node->rhs);
+  d->size = 1;
+  if (idx->kind == ND_MUL && idx->rhs->kind == ND_NUM) {
+    d->size = idx->rhs->val;
+    idx = strip_widening(idx->lhs);
+  }
+
+  d->offset = 0;
+  if (idx->kind == ND_ADD && idx->rhs->kind == ND_NUM) {
+    d->offset = idx->rhs->val;
+    idx = strip_widening(idx->lhs);
+  }
+
+  d->base = node->lhs;
+  return idx->kind == ND_VAR && idx->var == iv_counter->var && d->size > 0 &&
+         !has_side_effects(d->base) && is_loop_invariant(iv_loop, d->base);
+}
+
+static IndVar *find_ind_var(Derived *d, Type *ty) {
+  for (int i = 0; i < num_ivs; i++)
+    if (ivs[i].size == d->size && equal_expr(ivs[i].base, d->base))
+      return &ivs[i];
+
+  if (num_ivs == IV_MAX_PTRS)
+    return NULL;
+
+  IndVar *iv = &ivs[num_ivs++];
+  iv->base = d->base;
+  iv->size = d->size;
+  iv->var = new_lvar("", ty);
+  return iv;
+}
+
+// 誘導変数から計算するアドレスを、ループと一緒に進めるポインタに置き換える。
+// ポインタはループの条件式を調べる前に用意するので、
+// 1回も回らないループで止まるかもしれないbaseは置き換えない。
+static void reduce_derived(Node *node) {
+  if (!node)
+    return;
+
+  Derived d;
+  IndVar *iv;
+  if (match_derived(node, &d) && !may_fault(d.base) && (iv = find_ind_var(&d, node->ty))) {
+    Node *repl = typed(new_var_node(iv->var, node->tok), node->ty);
+    if (d.offset)
+      repl = add_bytes(repl, new_long_num(d.offset * d.size, node->tok), node->ty);
+
+    Node *next = node->next;
+    *node = *repl;
+    node->next = next;
+    return;
+  }
+
+  reduce_derived(node->lhs);
+  reduce_derived(node->rhs);
+  reduce_derived(node->cond);
+  reduce_derived(node->then);
+  reduce_derived(node->els);
+  reduce_derived(node->init);
+  reduce_derived(node->inc);
+  for (Node *n = node->body; n; n = n->next)
+    reduce_derived(n);
+  for (Node *n = node->args; n; n = n->next)
+    reduce_derived(n);
+}
+
+// 初期化部の誘導変数への定数の代入を消す
+static void remove_const_stores(Node *node) {
+  if (node->kind == ND_BLOCK) {
+    for (Node *n = node->body; n; n = n->next)
+      remove_const_stores(n);
+    return;
+  }
+
+  if (is_const_store(node, iv_counter)) {
+    Node *next = node->next;
+    *node = *new_empty_stmt(node->tok);
+    node->next = next;
+  }
+}
+
+// 誘導変数がループの条件式と更新式でしか読まれていなければ、
+// 条件式をi < nからp < base + n * sizeに書き換えて、iを消す。
+// n * sizeが桁あふれしないよう、nは4バイト以下の値に限る。
+static bool replace_counter(Node *node, int64_t step, Node **pre) {
+  Node *cond = node->cond;
+  Obj *var = iv_counter->var;
+  if (!cond || (cond->kind != ND_LT && cond->kind != ND_LE) || step < 0 ||
+      strip_widening(cond->lhs)->kind != ND_VAR || strip_widening(cond->lhs)->var != var)
+    return false;
+
+  Node *limit = cond->rhs;
+  if (has_side_effects(limit) || !is_loop_invariant(node, limit))
+    return false;
+
+  Node *val = strip_widening(limit);
+  if (val->ty->size > 4 && !(val->kind == ND_NUM && fits_in(val->val, ty_int)))
+    return false;
+
+  if (count_refs(current_fn->body, var) !=
+      count_refs(node->init, var) + count_refs(cond, var) + count_refs(node->inc, var))
+    return false;
+
+  IndVar *iv = &ivs[0];
+  Token *tok = cond->tok;
+  Obj *end = new_lvar("", iv->var->ty);
+  Node *bytes = new_binary(ND_MUL, new_cast(limit, ty_long), new_long_num(iv->size, tok), tok);
+  *pre = new_store(end, add_bytes(clone_body(iv->base), typed(bytes, ty_long), end->ty));
+
+  Node *lhs = new_typed_var(iv->var, tok);
+  node->cond = typed(new_binary(cond->kind, lhs, new_typed_var(end, tok), tok), ty_int);
+  return true;
+}
+
+// for (...; i < n; i = i + step)の本体でa + i * sizeのようなアドレスを毎回計算する代わりに、
+// ポインタを用意してstep * sizeずつ進める。
+static void reduce_loop(Node *node) {
+  if (node->kind != ND_FOR || !node->inc || has_label(node->then, true))
+    return;
+
+  Node *inc = node->inc;
+  if (inc->kind != ND_ASSIGN || inc->lhs->kind != ND_VAR)
+    return;
+
+  Obj *var = inc->lhs->var;
+  int64_t step;
+  if (!var->is_local || !is_integer(var->ty) || var->ty->size < 4 ||
+      map_get(&addr_taken, var) || !match_step(inc, var, &step) ||
+      clobbers(node->then, inc->lhs) || clobbers(node->cond, inc->lhs))
+    return;
+
+  iv_loop = node;
+  iv_counter = inc->lhs;
+  num_ivs = 0;
+  reduce_derived(node->cond);
+  reduce_derived(node->then);
+  if (num_ivs == 0)
+    return;
+
+  // ループに入るときの誘導変数の値。定数ならiを読まずに済む。
+  Token *tok = node->tok;
+  int64_t start;
+  bool is_const = init_value(node->init, iv_counter, &start);
+
+  Node head = {};
+  Node *cur = &head;
+  Node *updates = NULL;
+  for (int i = 0; i < num_ivs; i++) {
+    IndVar *iv = &ivs[i];
+    Node *ptr;
+    if (is_const && start == 0) {
+      ptr = iv->base;
+    } else if (is_const) {
+      ptr = add_bytes(iv->base, new_long_num(start * iv->size, tok), iv->var->ty);
+    } else {
+      Node *idx = new_cast(new_typed_var(var, tok), ty_long);
+      Node *bytes = new_binary(ND_MUL, idx, new_long_num(iv->size, tok), tok);
+      ptr = add_bytes(iv->base, typed(bytes, ty_long), iv->var->ty);
+    }
+    cur = cur->next = new_store(iv->var, ptr);
+
+    Node *next = add_bytes(new_typed_var(iv->var, tok),
+                           new_long_num(step * iv->size, tok), iv->var->ty);
+    Node *update = new_store(iv->var, next)->lhs;
+    updates = updates ? typed(new_binary(ND_COMMA, updates, update, tok), update->ty) : update;
+  }
+
+  Node *pre = NULL;
+  if (replace_counter(node, step, &pre)) {
+    cur = cur->next = pre;
+    if (is_const)
+      remove_const_stores(node->init);
+    node->inc = updates;
+  } else {
+    node->inc = typed(new_binary(ND_COMMA, inc, updates, tok), updates->ty);
+  }
+
+  Node *init = new_node(ND_BLOCK, tok);
+  init->body = node->init;
+  node->init->next = head.next;
+  node->init = init;
+}
+
+// 内側のループから順に誘導変数を強度低減する
+static void reduce_induction_vars(Node *node) {
+  if (!node)
+    return;
+
+  reduce_induction_vars(node->lhs);
+  reduce_induction_vars(node->rhs);
+  reduce_induction_vars(node->cond);
+  reduce_induction_vars(node->then);
+  reduce_induction_vars(node->els);
+  reduce_induction_vars(node->init);
+  reduce_induction_vars(node->inc);
+  for (Node *n = node->body; n; n = n->next)
+    reduce_induction_vars(n);
+  for (Node *n = node->args; n; n = n->next)
+    reduce_induction_vars(n);
+
+  reduce_loop(node);
+}
+
+//
+// ベクトル化
+//
+
+// SSE2のレジスタのバイト数
+#define VEC_BYTES 16
+
+// ベクトル化するループの本体の式の1つの被演算子。
+// 配列の要素a[i]か、ループの中で値の変わらないスカラ値。
+typedef struct {
+  Node *addr;   // a[i]のアドレス。スカラ値ならNULL
+  Node *scalar; // スカラ値
+} VecOperand;
+
+static Type *int_type(int size) {
+  switch (size) {
+    case 1: return ty_char;
+    case 2: return ty_short;
+    case 4: return ty_int;
+  }
+  return ty_long;
+}
+
+static bool is_vec_elem(Type *ty) {
+  return is_integer(ty) && ty->kind != TY_BOOL;
+}
+
+// nodeがsizeバイトの要素a[i]ならtrue
+static bool match_elem(Node *node, int size, VecOperand *x) {
+  Derived d;
+  if (node->kind != ND_DEREF || !is_vec_elem(node->ty) || node->ty->size != size ||
+      !match_derived(node->lhs, &d) || d.size != size)
+    return false;
+  x->addr = node->lhs;
+  x->scalar = NULL;
+  return true;
+}
+
+// nodeがa[i]か、ループの中で変わらない数値かローカル変数ならtrue
+static bool match_operand(Node *node, int size, VecOperand *x) {
+  node = strip_widening(node);
+  if (match_elem(node, size, x))
+    return true;
+
+  if (node->kind == ND_NUM ||
+      (node->kind == ND_VAR && node->var->is_local && is_integer(node->ty) &&
+       !map_get(&addr_taken, node->var) && is_loop_invariant(iv_loop, node))) {
+    x->addr = NULL;
+    x->scalar = node;
+    return true;
+  }
+  return false;
+}
+
+static bool vec_op(NodeKind kind, VecOp *op) {
+  switch (kind) {
+    case ND_ADD: *op = VEC_ADD; return true;
+    case ND_SUB: *op = VEC_SUB; return true;
+    case ND_BITAND: *op = VEC_AND; return true;
+    case ND_BITOR: *op = VEC_OR; return true;
+    case ND_BITXOR: *op = VEC_XOR; return true;
+  }
+  return false;
+}
+
+// 誘導変数でもアドレスを取られてもいない整数のローカル変数ならtrue。
+// _Boolは1回ごとに0か1に丸めるので、まとめて計算すると結果が変わる。
+static bool is_accumulator(Node *node) {
+  return node->kind == ND_VAR && node->var->is_local && is_vec_elem(node->ty) &&
+         node->var != iv_counter->var && !map_get(&addr_taken, node->var);
+}
+
+// ベクトル化するループの本体の形
+typedef struct {
+  VecOp op;
+  int size;        // 要素のバイト数
+  int lane_size;   // 演算するレーンのバイト数
+  Node *dst;       // 書き込む配列の要素のアドレス。集約するならNULL
+  VecOperand x, y; // 被演算子。集約するならxだけ使う
+  Node *elem;      // 集約する配列の要素
+} VecLoop;
+
+// d[i] = x op yの形の文ならtrue
+static bool match_map(Node *node, VecLoop *v) {
+  Node *lhs = node->lhs;
+  if (lhs->kind != ND_DEREF || !is_vec_elem(lhs->ty))
+    return false;
+
+  Derived d;
+  v->size = v->lane_size = lhs->ty->size;
+  if (!match_derived(lhs->lhs, &d) || d.size != v->size)
+    return false;
+  v->dst = lhs->lhs;
+
+  // 要素の型に切り詰めるので、+-&|^はレーンの幅で計算しても同じ結果になる
+  Node *expr = strip_casts(node->rhs);
+  return vec_op(expr->kind, &v->op) && expr->ty->size >= v->size &&
+         match_operand(expr->lhs, v->size, &v->x) &&
+         match_operand(expr->rhs, v->size, &v->y) && (v->x.addr || v->y.addr);
+}
+
+// s = s op a[i]の形の文ならtrue
+static bool match_reduction(Node *node, VecLoop *v) {
+  Node *var = node->lhs;
+  Node *expr = strip_casts(node->rhs);
+  if (!is_accumulator(var) || !vec_op(expr->kind, &v->op) || v->op == VEC_SUB)
+    return false;
+
+  Node *lhs = strip_widening(expr->lhs);
+  Node *rhs = strip_widening(expr->rhs);
+  if (rhs->kind == ND_VAR && rhs->var == var->var) {
+    Node *tmp = lhs;
+    lhs = rhs;
+    rhs = tmp;
+  }
+
+  if (lhs->kind != ND_VAR || lhs->var != var->var || rhs->kind != ND_DEREF)
+    return false;
+
+  v->size = rhs->ty->size;
+  if (!match_elem(rhs, v->size, &v->x) || expr->ty->size < v->size)
+    return false;
+
+  // 和は桁あふれしないよう変数の幅まで符号拡張して足す
+  v->lane_size = (v->op == VEC_ADD) ? MAX(v->size, var->ty->size) : v->size;
+  v->elem = rhs;
+  return true;
+}
+
+// if (a[i] < s) s = a[i];の形の文ならtrue
+static bool match_min_max(Node *node, VecLoop *v) {
+  Node *cond = node->cond;
+  Node *then = node->then;
+  while (then->kind == ND_BLOCK && then->body && !then->body->next)
+    then = then->body;
+
+  if (node->els || (cond->kind != ND_LT && cond->kind != ND_LE) ||
+      then->kind != ND_EXPR_STMT || then->lhs->kind != ND_ASSIGN)
+    return false;
+
+  Node *var = then->lhs->lhs;
+  Node *elem = strip_widening(then->lhs->rhs);
+  Node *lhs = strip_widening(cond->lhs);
+  Node *rhs = strip_widening(cond->rhs);
+  if (!is_accumulator(var) || elem->kind != ND_DEREF)
+    return false;
+
+  if (equal_expr(lhs, elem) && rhs->kind == ND_VAR && rhs->var == var->var)
+    v->op = VEC_MIN;
+  else if (equal_expr(rhs, elem) && lhs->kind == ND_VAR && lhs->var == var->var)
+    v->op = VEC_MAX;
+  else
+    return false;
+
+  // SSE2には64ビットの符号付き比較がない
+  v->size = v->lane_size = elem->ty->size;
+  if (v->size == 8 || var->ty->size < v->size || !match_elem(elem, v->size, &v->x))
+    return false;
+  v->elem = elem;
+  return true;
+}
+
+// ループの本体がベクトル化できる1つの文ならtrue
+static bool match_vec_body(Node *node, VecLoop *v) {
+  while (node->kind == ND_BLOCK && node->body && !node->body->next)
+    node = node->body;
+
+  *v = (VecLoop){0};
+  if (node->kind == ND_IF)
+    return match_min_max(node, v);
+
+  if (node->kind != ND_EXPR_STMT || node->lhs->kind != ND_ASSIGN)
+    return false;
+  if (node->lhs->lhs->kind == ND_VAR)
+    return match_reduction(node->lhs, v);
+  return match_map(node->lhs, v);
+}
+
+// 集約した値を変数に入れて、本体のa[i]をその変数に置き換える
+static void replace_elem(Node *node, Node *elem, Obj *var) {
+  if (!node)
+    return;
+
+  if (node->kind == ND_DEREF && equal_expr(node, elem)) {
+    Node *next = node->next;
+    *node = *new_typed_var(var, node->tok);
+    node->next = next;
+    return;
+  }
+
+  replace_elem(node->lhs, elem, var);
+  replace_elem(node->rhs, elem, var);
+  replace_elem(node->cond, elem, var);
+  replace_elem(node->then, elem, var);
+  replace_elem(node->els, elem, var);
+  for (Node *n = node->body; n; n = n->next)
+    replace_elem(n, elem, var);
+}
+
+// 書き込み先の配列が読み込む配列と重ならない条件。
+// 要素ごとに同じ位置を読み書きするなら重なっていても構わない。
+static Node *no_overlap(Obj *dst, Obj *src, Obj *len, Token *tok) {
+  Node *eq = new_binary(ND_EQ, new_typed_var(dst, tok), new_typed_var(src, tok), tok);
+  Node *dst_end = add_bytes(new_typed_var(dst, tok), new_typed_var(len, tok), dst->ty);
+  Node *src_end = add_bytes(new_typed_var(src, tok), new_typed_var(len, tok), src->ty);
+  Node *before = new_binary(ND_LE, dst_end, new_typed_var(src, tok), tok);
+  Node *after = new_binary(ND_LE, src_end, new_typed_var(dst, tok), tok);
+
+  Node *node = new_binary(ND_LOGOR, eq, new_binary(ND_LOGOR, before, after, tok), tok);
+  add_type(node);
+  return node;
+}
+
+// 回数の決まったforの残りの回数のうち16バイト分ずつをSSE2で処理し、
+// 端数は元のループで処理する。
+//
+//   n = 残りの回数;
+//   if (n >= 1回に処理する要素数) {
+//     p = &a[i]; ...
+//     if (配列が重ならない) {
+//       ベクトル化したループ
+//       i = i + 処理した要素数;
+//     }
+//   }
+//   元のループ
+//
+// &a[i]のaはメモリを読むかもしれないので、元のループが1回以上回るときだけ計算する。
+static void vectorize_loop(Node *node) {
+  if (node->kind != ND_FOR || !node->cond || !node->inc || has_label(node->then, true))
+    return;
+
+  Node *inc = node->inc;
+  int64_t step;
+  if (inc->kind != ND_ASSIGN || inc->lhs->kind != ND_VAR)
+    return;
+
+  Obj *var = inc->lhs->var;
+  if (!var->is_local || !is_integer(var->ty) || var->ty->size < 4 ||
+      map_get(&addr_taken, var) || !match_step(inc, var, &step) || step != 1 ||
+      clobbers(node->then, inc->lhs))
+    return;
+
+  Node *cond = node->cond;
+  if ((cond->kind != ND_LT && cond->kind != ND_LE) ||
+      strip_widening(cond->lhs)->kind != ND_VAR || strip_widening(cond->lhs)->var != var)
+    return;
+
+  iv_loop = node;
+  iv_counter = inc->lhs;
+
+  Node *limit = cond->rhs;
+  VecLoop v;
+  if (has_side_effects(limit) || !is_loop_invariant(node, limit) ||
+      !match_vec_body(node->then, &v))
+    return;
+
+  Token *tok = node->tok;
+  int lanes = VEC_BYTES / v.size;
+  int shift = 0;
+  while ((1 << shift) < lanes)
+    shift++;
+
+  Node head = {};
+  Node *cur = &head;
+
+  // 残りの回数
+  Obj *n = new_lvar("", ty_long);
+  Node *rest = new_binary(ND_SUB, new_cast(clone_body(limit), ty_long),
+                          new_cast(new_typed_var(var, tok), ty_long), tok);
+  if (cond->kind == ND_LE)
+    rest = new_binary(ND_ADD, rest, new_long_num(1, tok), tok);
+  add_type(rest);
+  cur = cur->next = new_store(n, rest);
+
+  Node *guard = new_binary(ND_LT, new_long_num(lanes - 1, tok), new_typed_var(n, tok), tok);
+  add_type(guard);
+
+  // 配列の先頭のアドレスを一時変数に入れておく
+  Node setup = {};
+  Node *pre = &setup;
+  Node *overlap = NULL;
+  Obj *dst = NULL;
+  Obj *len = NULL;
+  if (v.dst) {
+    dst = new_lvar("", v.dst->ty);
+    pre = pre->next = new_store(dst, clone_body(v.dst));
+
+    Node *bytes = new_binary(ND_MUL, new_typed_var(n, tok), new_long_num(v.size, tok), tok);
+    len = new_lvar("", ty_long);
+    pre = pre->next = new_store(len, typed(bytes, ty_long));
+  }
+
+  Node arg_head = {};
+  Node *arg = &arg_head;
+  VecOperand *ops[] = {&v.x, &v.y};
+  for (int i = 0; i < (v.dst ? 2 : 1); i++) {
+    VecOperand *x = ops[i];
+    if (!x->addr) {
+      arg = arg->next = clone_body(x->scalar);
+      continue;
+    }
+
+    Obj *ptr = new_lvar("", x->addr->ty);
+    pre = pre->next = new_store(ptr, clone_body(x->addr));
+    arg = arg->next = new_typed_var(ptr, tok);
+    if (dst && !equal_expr(x->addr, v.dst)) {
+      Node *cond = no_overlap(dst, ptr, len, tok);
+      overlap = overlap ? new_binary(ND_LOGAND, overlap, cond, tok) : cond;
+    }
+  }
+  if (overlap)
+    add_type(overlap);
+
+  Node *vec = new_node(ND_VECTOR, tok);
+  vec->vec_op = v.op;
+  vec->vec_size = v.size;
+  vec->lane_size = v.lane_size;
+  vec->cond = typed(new_binary(ND_SHR, new_typed_var(n, tok), new_long_num(shift, tok), tok),
+                    ty_long);
+  vec->args = arg_head.next;
+
+  Node body = {};
+  Node *stmt = &body;
+  if (dst) {
+    vec->lhs = new_typed_var(dst, tok);
+    vec->ty = ty_void;
+    stmt = stmt->next = new_unary(ND_EXPR_STMT, vec, tok);
+  } else {
+    // 集約した値を元の文で変数に反映する
+    Obj *val = new_lvar("", int_type(v.lane_size));
+    vec->ty = val->ty;
+    stmt = stmt->next = new_store(val, vec);
+    stmt = stmt->next = clone_body(node->then);
+    replace_elem(stmt, v.elem, val);
+  }
+
+  // 処理した要素数だけ誘導変数を進める
+  Node *done = new_binary(ND_BITAND, new_typed_var(n, tok), new_long_num(-lanes, tok), tok);
+  Node *next = new_binary(ND_ADD, new_cast(new_typed_var(var, tok), ty_long), done, tok);
+  Node *update = new_binary(ND_ASSIGN, new_typed_var(var, tok), new_cast(next, var->ty), tok);
+  add_type(update);
+  stmt = stmt->next = new_unary(ND_EXPR_STMT, update, tok);
+
+  if (overlap) {
+    Node *then = new_node(ND_BLOCK, tok);
+    then->body = body.next;
+    pre = pre->next = new_node(ND_IF, tok);
+    pre->cond = overlap;
+    pre->then = then;
+  } else {
+    pre->next = body.next;
+  }
+
+  Node *then = new_node(ND_BLOCK, tok);
+  then->body = setup.next;
+  cur = cur->next = new_node(ND_IF, tok);
+  cur->cond = guard;
+  cur->then = then;
+
+  // 端数は元のループで処理する
+  Node *loop = calloc(1, sizeof(Node));
+  *loop = *node;
+  loop->next = NULL;
+  loop->init = new_node(ND_BLOCK, tok);
+  cur->next = loop;
+
+  Node *init = node->init;
+  init->next = head.next;
+  Node *next_stmt = node->next;
+  *node = (Node){0};
+  node->kind = ND_BLOCK;
+  node->tok = tok;
+  node->body = init;
+  node->next = next_stmt;
+}
+
+// 内側のループから順にベクトル化する
+static void vectorize_loops(Node *node) {
+  if (!node)
+    return;
+
+  vectorize_loops(node->lhs);
+  vectorize_loops(node->rhs);
+  vectorize_loops(node->cond);
+  vectorize_loops(node->then);
+  vectorize_loops(node->els);
+  vectorize_loops(node->init);
+  vectorize_loops(node->inc);
+  for (Node *n = node->body; n; n = n->next)
+    vectorize_loops(n);
+  for (Node *n = node->args; n; n = n->next)
+    vectorize_loops(n);
+
+  vectorize_loop(node);
+}
+
+static void optimize_fn(Obj *fn) {
+  current_fn = fn;
+  fn->body = inline_calls(fn->body, 0);
+  fn->body = fold(fn->body);
+  drop_unused_results(fn->body);
+  fn->body = eliminate_dead_stmt(fn->body);
+
+  addr_taken.len = 0;
+  mark_addr_taken(fn->body);
+  eliminate_common_exprs(fn->body);
+  hoist_loop_invariants(fn->body);
+  if (opt_vectorize)
+    vectorize_loops(fn->body);
+  reduce_induction_vars(fn->body);
+  unroll_loops(fn->body);
+}
+
+// 最適化パスを順番に適用する。
+// 関数が取り除かれることがあるので、新しいリストの先頭を返す。
+Obj *optimize(Obj *prog) {
+  program = prog;
+
+  for (Obj *fn = prog; fn; fn = fn->next)
+    if (fn->is_function && fn->is_definition)
+      optimize_fn(fn);
+
+  return remove_unused_objs(prog);
+}
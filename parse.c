@@ -95,11 +95,12 @@ static void initializer2(Token **rest, Token *tok, Initializer *init);
 static Initializer *initializer(Token **rest, Token *tok, Type *ty, Type **new_ty);
 static Node *lvar_initializer(Token **rest, Token *tok, Obj *var);
 static void gvar_initializer(Token **rest, Token *tok, Obj *var);
+static Relocation *write_gvar_data(Relocation *cur, Initializer *init, Type *ty, char *buf, int offset);
 static Node *compound_stmt(Token **rest, Token *tok);
 static Node *expr_stmt(Token **rest, Token *tok);
 static Node *expr(Token **rest, Token *tok);
-static int64_t eval(Node *node);
 static int64_t eval2(Node *node, char **label);
+static bool is_const_expr(Node *node);
 static int64_t eval_rval(Node *node, char **label);
 static Node *assign(Token **rest, Token *tok);
 static Node *logor(Token **rest, Token *tok);
@@ -172,7 +173,7 @@ static void push_tag_scope(Token *tok, Type *ty) {
 }
 
 // 新しいノードを作る。種類をセットするだけ。
-static Node *new_node(NodeKind kind, Token *tok) {
+Node *new_node(NodeKind kind, Token *tok) {
   Node *node = calloc(1, sizeof(Node));
   node->kind = kind;
   node->tok = tok;
@@ -180,7 +181,7 @@ static Node *new_node(NodeKind kind, Token *tok) {
 }
 
 // 新しい2分木ノードを作る。
-static Node *new_binary(NodeKind kind, Node *lhs, Node *rhs, Token *tok) {
+Node *new_binary(NodeKind kind, Node *lhs, Node *rhs, Token *tok) {
   Node *node = new_node(kind, tok);
   node->lhs = lhs;
   node->rhs = rhs;
@@ -188,14 +189,14 @@ static Node *new_binary(NodeKind kind, Node *lhs, Node *rhs, Token *tok) {
 }
 
 // 新しい単項ノードを作る。
-static Node *new_unary(NodeKind kind, Node *expr, Token *tok) {
+Node *new_unary(NodeKind kind, Node *expr, Token *tok) {
   Node *node = new_node(kind, tok);
   node->lhs = expr;
   return node;
 }
 
 // 新しい数値ノードを作る。
-static Node *new_num(int64_t val, Token *tok) {
+Node *new_num(int64_t val, Token *tok) {
   Node *node = new_node(ND_NUM, tok);
   node->val = val;
   return node;
@@ -209,7 +210,7 @@ static Node *new_long(int64_t val, Token *tok) {
 }
 
 // 新しい変数ノードを作る
-static Node *new_var_node(Obj *var, Token *tok) {
+Node *new_var_node(Obj *var, Token *tok) {
   Node *node = new_node(ND_VAR, tok);
   node->var = var;
   return node;
@@ -272,6 +273,7 @@ static Obj *new_var(char *name, Type *ty) {
   Obj *var = calloc(1, sizeof(Obj));
   var->name = name;
   var->ty = ty;
+  var->reg = -1;
   VarScope *sc = push_scope(name);
   sc->var = var;
   return var;
@@ -302,7 +304,9 @@ static char *new_unique_name(void) {
 }
 
 static Obj *new_anon_gvar(Type *ty) {
-  return new_gvar(new_unique_name(), ty);
+  Obj *var = new_gvar(new_unique_name(), ty);
+  var->is_static = true;
+  return var;
 }
 
 // 新しい文字列リテラルを作る
@@ -325,6 +329,7 @@ static char *get_ident(Token *tok) {
 //      | "case" const-expr ":" stmt
 //      | "default" ":" stmt
 //      | "while" "(" expr ")" stmt
+//      | "do" stmt "while" "(" expr ")" ";"
 //      | "for" "(" expr-stmt expr? ";" expr? ")" stmt
 //      | "goto" ident ";"
 //      | "break" ";"
@@ -421,6 +426,27 @@ static Node *stmt(Token **rest, Token *tok) {
     return node;
   }
 
+  if (equal(tok, "do")) {
+    Node *node = new_node(ND_DO, tok);
+
+    char *brk = brk_label;
+    char *cont = cont_label;
+    brk_label = node->brk_label = new_unique_name();
+    cont_label = node->cont_label = new_unique_name();
+
+    node->then = stmt(&tok, tok->next);
+
+    brk_label = brk;
+    cont_label = cont;
+
+    tok = skip(tok, "while");
+    tok = skip(tok, "(");
+    node->cond = expr(&tok, tok);
+    tok = skip(tok, ")");
+    *rest = skip(tok, ";");
+    return node;
+  }
+
   if (equal(tok, "for")) {
     tok = skip(tok->next, "(");
     Node *node = new_node(ND_FOR, tok);
@@ -1195,6 +1221,130 @@ static Node *create_lvar_init(Initializer *init, Type *ty, InitDesg *desg, Token
   return new_binary(ND_ASSIGN, lhs, rhs, tok);
 }
 
+// 初期化子によって値が書き込まれるバイトにcoveredで印をつける
+static void mark_initialized(Initializer *init, Type *ty, char *covered, int offset) {
+  if (ty->kind == TY_ARRAY) {
+    for (int i = 0; i < ty->array_len; i++)
+      mark_initialized(init->children[i], ty->base, covered, offset + ty->base->size * i);
+    return;
+  }
+
+  if (ty->kind == TY_STRUCT && !init->expr) {
+    for (Member *mem = ty->members; mem; mem = mem->next)
+      mark_initialized(init->children[mem->idx], mem->ty, covered, offset + mem->offset);
+    return;
+  }
+
+  if (ty->kind == TY_UNION) {
+    mark_initialized(init->children[0], ty->members->ty, covered, offset);
+    return;
+  }
+
+  if (init->expr)
+    memset(covered + offset, 1, ty->size);
+}
+
+// 変数varのoffsetからsizeバイトを0初期化するノードを作る
+static Node *new_memzero(Obj *var, int offset, int size, Token *tok) {
+  Node *node = new_node(ND_MEMZERO, tok);
+  node->var = var;
+  node->zero_offset = offset;
+  node->zero_size = size;
+  return node;
+}
+
+// 初期化子で値が書き込まれない部分を0初期化するノードを作る。
+// 間の初期化済みの部分が短ければ、まとめて0初期化したほうが速いので
+// 隣り合う隙間をつなげる。
+static Node *zero_uninitialized(Initializer *init, Obj *var, Token *tok) {
+  int size = var->ty->size;
+  char *covered = calloc(1, size);
+  mark_initialized(init, var->ty, covered, 0);
+
+  Node *node = new_node(ND_NULL_EXPR, tok);
+  int i = 0;
+  while (i < size) {
+    if (covered[i]) {
+      i++;
+      continue;
+    }
+
+    int start = i;
+    int end = i;
+    for (;;) {
+      while (end < size && !covered[end])
+        end++;
+
+      int next = end;
+      while (next < size && covered[next])
+        next++;
+
+      if (next == size || next - end >= 8)
+        break;
+      end = next;
+    }
+
+    node = new_binary(ND_COMMA, node, new_memzero(var, start, end - start, tok), tok);
+    i = end;
+  }
+
+  free(covered);
+  return node;
+}
+
+// これ以上の数の要素を定数で初期化するローカル変数は
+// .rodataに置いたひな形からまとめてコピーする
+#define RODATA_INIT_MIN 8
+
+// 初期化子に含まれる式の数を数える。
+// 定数式でない式が1つでもあれば-1を返す。
+static int count_const_inits(Initializer *init, Type *ty) {
+  int n = 0;
+
+  if (ty->kind == TY_ARRAY) {
+    for (int i = 0; i < ty->array_len && n >= 0; i++) {
+      int m = count_const_inits(init->children[i], ty->base);
+      n = (m < 0) ? -1 : n + m;
+    }
+    return n;
+  }
+
+  if (ty->kind == TY_STRUCT && !init->expr) {
+    for (Member *mem = ty->members; mem && n >= 0; mem = mem->next) {
+      int m = count_const_inits(init->children[mem->idx], mem->ty);
+      n = (m < 0) ? -1 : n + m;
+    }
+    return n;
+  }
+
+  if (ty->kind == TY_UNION)
+    return count_const_inits(init->children[0], ty->members->ty);
+
+  if (!init->expr)
+    return 0;
+  if (!is_integer(ty) && ty->kind != TY_PTR)
+    return -1;
+  return is_const_expr(init->expr) ? 1 : -1;
+}
+
+// 初期化子の値を.rodataのひな形に書き出し、
+// ローカル変数varにそれをコピーするノードを返す
+static Node *rodata_initializer(Initializer *init, Obj *var, Token *tok) {
+  Obj *tmpl = new_anon_gvar(var->ty);
+  tmpl->is_readonly = true;
+
+  Relocation head = {};
+  tmpl->init_data = calloc(1, var->ty->size);
+  write_gvar_data(&head, init, var->ty, tmpl->init_data, 0);
+
+  // 配列は代入できないので、add_type()を通さずに型を設定しておく
+  Node *node = new_binary(ND_ASSIGN, new_var_node(var, tok), new_var_node(tmpl, tok), tok);
+  add_type(node->lhs);
+  add_type(node->rhs);
+  node->ty = var->ty;
+  return node;
+}
+
 // 初期化子を持った変数定義は変数定義と代入の省略記法。
 // この関数は初期化子のための代入式を生成する。
 // 例えばint x[2][2] = {{6, 7}, {8, 9}}は
@@ -1207,11 +1357,12 @@ static Node *lvar_initializer(Token **rest, Token *tok, Obj *var) {
   Initializer *init = initializer(rest, tok, var->ty, &var->ty);
   InitDesg desg = { NULL, 0, NULL, var };
 
+  if (count_const_inits(init, var->ty) >= RODATA_INIT_MIN)
+    return rodata_initializer(init, var, tok);
+
   // 初期化子で指定されてない要素は0初期化する。
-  // ここでは、簡単のために変数のメモリ領域全体をあらかじめ
-  // 0初期化しておく。
-  Node *lhs = new_node(ND_MEMZERO, tok);
-  lhs->var = var;
+  // 0初期化は初期化子で値が書き込まれない隙間だけに行う。
+  Node *lhs = zero_uninitialized(init, var, tok);
 
   Node *rhs = create_lvar_init(init, var->ty, &desg, tok);
   return new_binary(ND_COMMA, lhs, rhs, tok);
@@ -1352,7 +1503,7 @@ static Node *expr(Token **rest, Token *tok) {
   return node;
 }
 
-static int64_t eval(Node *node) {
+int64_t eval(Node *node) {
   return eval2(node, NULL);
 }
 
@@ -1408,12 +1559,15 @@ static int64_t eval2(Node *node, char **label) {
     case ND_LOGOR:
       return eval(node->lhs) || eval(node->rhs);
     case ND_CAST: {
+      // 実行時のキャストと同じく符号拡張する
       int64_t val = eval2(node->lhs, label);
+      if (node->ty->kind == TY_BOOL)
+        return !!val;
       if (is_integer(node->ty)) {
         switch (node->ty->size) {
-          case 1: return (uint8_t)val;
-          case 2: return (uint16_t)val;
-          case 4: return (uint32_t)val;
+          case 1: return (int8_t)val;
+          case 2: return (int16_t)val;
+          case 4: return (int32_t)val;
         }
       }
       return val;
@@ -1440,6 +1594,47 @@ static int64_t eval2(Node *node, char **label) {
   error_tok(node->tok, "定数式ではありません");
 }
 
+// ノードがeval()で評価できる整数の定数式ならtrue
+static bool is_const_expr(Node *node) {
+  add_type(node);
+
+  switch (node->kind) {
+    case ND_DIV:
+    case ND_MOD:
+      return is_const_expr(node->lhs) && is_const_expr(node->rhs) && eval(node->rhs) != 0;
+    case ND_ADD:
+    case ND_SUB:
+    case ND_MUL:
+    case ND_BITAND:
+    case ND_BITOR:
+    case ND_BITXOR:
+    case ND_SHL:
+    case ND_SHR:
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+    case ND_LOGAND:
+    case ND_LOGOR:
+      return is_const_expr(node->lhs) && is_const_expr(node->rhs);
+    case ND_COND:
+      if (!is_const_expr(node->cond))
+        return false;
+      return is_const_expr(eval(node->cond) ? node->then : node->els);
+    case ND_COMMA:
+      return is_const_expr(node->lhs) && is_const_expr(node->rhs);
+    case ND_NEG:
+    case ND_NOT:
+    case ND_BITNOT:
+    case ND_CAST:
+      return is_const_expr(node->lhs);
+    case ND_NUM:
+      return true;
+  }
+
+  return false;
+}
+
 static int64_t eval_rval(Node *node, char **label) {
   switch (node->kind) {
     case ND_VAR:
@@ -1461,13 +1656,63 @@ static int64_t const_expr(Token **rest, Token *tok) {
   return eval(node);
 }
 
+// 副作用がなく、何度評価しても同じ値になる式ならtrue
+static bool is_pure_expr(Node *node) {
+  switch (node->kind) {
+    case ND_VAR:
+    case ND_NUM:
+      return true;
+    case ND_ADD:
+    case ND_SUB:
+    case ND_MUL:
+      return is_pure_expr(node->lhs) && is_pure_expr(node->rhs);
+    case ND_CAST:
+    case ND_DEREF:
+    case ND_ADDR:
+    case ND_MEMBER:
+      return is_pure_expr(node->lhs);
+  }
+  return false;
+}
+
+// 左辺値を評価するたびに同じ場所を指すならtrue
+static bool is_simple_lvalue(Node *node) {
+  switch (node->kind) {
+    case ND_VAR:
+      return true;
+    case ND_MEMBER:
+      return is_simple_lvalue(node->lhs);
+    case ND_DEREF:
+      return is_pure_expr(node->lhs);
+  }
+  return false;
+}
+
+// is_pure_expr()を満たす式を複製する
+static Node *copy_pure_expr(Node *node) {
+  if (!node)
+    return NULL;
+
+  Node *copy = calloc(1, sizeof(Node));
+  *copy = *node;
+  copy->lhs = copy_pure_expr(node->lhs);
+  copy->rhs = copy_pure_expr(node->rhs);
+  return copy;
+}
+
 // `A op= B`は`tmp = &A, *tmp = *tmp op B;に変換する。
 // これは単純にA = A op BとしてしまうとAが2回評価されるからである。
+// ただし、Aが変数やs.xやp->x、a[i]のように副作用がなく
+// 2回評価しても問題ない左辺値ならA = A op Bとする。
+// こうしておけばAのアドレスが取られず、Aをレジスタに置ける。
 static Node *to_assign(Node *binary) {
   add_type(binary->lhs);
   add_type(binary->rhs);
   Token *tok = binary->tok;
 
+  if (is_simple_lvalue(binary->lhs))
+    return new_binary(ND_ASSIGN, copy_pure_expr(binary->lhs), binary, tok);
+
   Obj *var = new_lvar("", pointer_to(binary->lhs->ty));
 
   Node *expr1 = new_binary(ND_ASSIGN, new_var_node(var, tok),
@@ -2045,7 +2290,7 @@ static Token *function(Token *tok, Type *basety, VarAttr *attr) {
 }
 
 // global-variable = declspec (declarator ("," declarator)*)? ";"
-static Token *global_variable(Token *tok, Type *basety) {
+static Token *global_variable(Token *tok, Type *basety, VarAttr *attr) {
   bool first = true;
   while (!equal(tok, ";")) {
     if (!first)
@@ -2054,6 +2299,7 @@ static Token *global_variable(Token *tok, Type *basety) {
     first = false;
     Type *ty = declarator(&tok, tok, basety);
     Obj *var = new_gvar(get_ident(ty->name), ty);
+    var->is_static = attr->is_static;
     if (equal(tok, "="))
       gvar_initializer(&tok, tok->next, var);
   }
@@ -2086,7 +2332,7 @@ Obj *parse(Token *tok) {
     if (is_function(tok))
       tok = function(tok, basety, &attr);
     else
-      tok = global_variable(tok, basety);
+      tok = global_variable(tok, basety, &attr);
   }
 
   return globals;
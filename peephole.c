@@ -0,0 +1,323 @@
+#include "1cc.h"
+
+// コード生成が出力した1関数分のアセンブリを行単位で見て、
+// 局所的に冗長な命令を消したり置き換えたりする。
+// 各規則は1行を起点にパターンを調べ、書き換えたらtrueを返す。
+// 消した行はNULLにしておき、最後にまとめて出力する。
+
+// 書き換えがなくなるまで規則を適用する回数の上限
+#define MAX_PASSES 8
+
+static char **lines;
+static int nlines;
+
+static char *reg64[] = {
+  "rax", "rbx", "rcx", "rdx", "rsi", "rdi", "rbp", "rsp",
+  "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15",
+};
+static char *reg32[] = {
+  "eax", "ebx", "ecx", "edx", "esi", "edi", "ebp", "esp",
+  "r8d", "r9d", "r10d", "r11d", "r12d", "r13d", "r14d", "r15d",
+};
+#define NUM_REGS (sizeof(reg64) / sizeof(*reg64))
+
+// 条件ジャンプとその条件を反転したもの
+static char *jcc[][2] = {
+  {"je", "jne"}, {"jne", "je"}, {"jl", "jge"}, {"jge", "jl"},
+  {"jle", "jg"}, {"jg", "jle"}, {"jb", "jae"}, {"jae", "jb"},
+  {"jbe", "ja"}, {"ja", "jbe"}, {"js", "jns"}, {"jns", "js"},
+};
+#define NUM_JCC (sizeof(jcc) / sizeof(*jcc))
+
+static bool is_label(char *s) {
+  return s[0] != ' ' && s[strlen(s) - 1] == ':';
+}
+
+static bool is_loc(char *s) {
+  return !strncmp(s, "  .loc ", 7);
+}
+
+// .section等の疑似命令でない命令ならtrue
+static bool is_insn(char *s) {
+  return !strncmp(s, "  ", 2) && s[2] != '.';
+}
+
+// sが命令opならそのオペランドを返す
+static char *operands(char *s, char *op) {
+  int len = strlen(op);
+  if (strncmp(s, "  ", 2) || strncmp(s + 2, op, len))
+    return NULL;
+  if (s[len + 2] == '\0')
+    return s + len + 2;
+  if (s[len + 2] != ' ')
+    return NULL;
+  return s + len + 3;
+}
+
+// ラベルの行sがlabelを定義しているならtrue
+static bool defines(char *s, char *label) {
+  int len = strlen(label);
+  return is_label(s) && !strncmp(s, label, len) && s[len] == ':';
+}
+
+// sがジャンプ命令ならその飛び先を返し、命令名をopに入れる
+static char *jump_target(char *s, char **op) {
+  char *target = operands(s, "jmp");
+  if (target) {
+    *op = "jmp";
+    return target;
+  }
+
+  for (int i = 0; i < NUM_JCC; i++) {
+    target = operands(s, jcc[i][0]);
+    if (target) {
+      *op = jcc[i][0];
+      return target;
+    }
+  }
+  return NULL;
+}
+
+static char *invert_jcc(char *op) {
+  for (int i = 0; i < NUM_JCC; i++)
+    if (!strcmp(jcc[i][0], op))
+      return jcc[i][1];
+  unreachable();
+}
+
+static int reg_index(char **regs, char *name, int len) {
+  for (int i = 0; i < NUM_REGS; i++)
+    if (strlen(regs[i]) == len && !strncmp(regs[i], name, len))
+      return i;
+  return -1;
+}
+
+// 消されていない次の行
+static int next(int i) {
+  for (i++; i < nlines && !lines[i]; i++);
+  return i;
+}
+
+// .locを読み飛ばした次の行
+static int next_stmt(int i) {
+  for (i = next(i); i < nlines && is_loc(lines[i]); i = next(i));
+  return i;
+}
+
+// labelを定義している行
+static int find_label(char *label) {
+  for (int i = 0; i < nlines; i++)
+    if (lines[i] && defines(lines[i], label))
+      return i;
+  return -1;
+}
+
+// 直後に実行される命令までの間にlabelが定義されていればtrue
+static bool falls_into(int i, char *label) {
+  for (i = next(i); i < nlines; i = next(i)) {
+    if (defines(lines[i], label))
+      return true;
+    if (!is_label(lines[i]) && !is_loc(lines[i]))
+      return false;
+  }
+  return false;
+}
+
+// .locが続いていれば前のものは意味がない
+static bool dup_loc(int i) {
+  int j = next(i);
+  if (!is_loc(lines[i]) || j == nlines || !is_loc(lines[j]))
+    return false;
+  lines[i] = NULL;
+  return true;
+}
+
+// mov rax, raxのような自分自身へのmov。
+// 32ビットレジスタへのmovは上位を0クリアするので消せない。
+static bool self_mov(int i) {
+  char *ops = operands(lines[i], "mov");
+  if (!ops)
+    return false;
+
+  char *comma = strchr(ops, ',');
+  if (!comma)
+    return false;
+
+  int len = comma - ops;
+  if (reg_index(reg64, ops, len) < 0 || strlen(comma + 2) != len ||
+      strncmp(ops, comma + 2, len))
+    return false;
+  lines[i] = NULL;
+  return true;
+}
+
+// sub rsp, 0
+static bool zero_rsp(int i) {
+  if (strcmp(lines[i], "  sub rsp, 0") && strcmp(lines[i], "  add rsp, 0"))
+    return false;
+  lines[i] = NULL;
+  return true;
+}
+
+// 直後のラベルへのジャンプ
+static bool jmp_next(int i) {
+  char *op;
+  char *target = jump_target(lines[i], &op);
+  if (!target || !falls_into(i, target))
+    return false;
+  lines[i] = NULL;
+  return true;
+}
+
+// je L1; jmp L2; L1: はjne L2にできる
+static bool jcc_over_jmp(int i) {
+  char *op;
+  char *target = jump_target(lines[i], &op);
+  if (!target || !strcmp(op, "jmp"))
+    return false;
+
+  int j = next_stmt(i);
+  char *op2;
+  char *target2 = j < nlines ? jump_target(lines[j], &op2) : NULL;
+  if (!target2 || strcmp(op2, "jmp") || !falls_into(j, target))
+    return false;
+
+  lines[i] = format("  %s %s", invert_jcc(op), target2);
+  lines[j] = NULL;
+  return true;
+}
+
+// 無条件ジャンプやretの後ろのラベルのない命令には到達しない
+static bool unreachable_code(int i) {
+  if (!operands(lines[i], "jmp") && !operands(lines[i], "ret"))
+    return false;
+
+  bool changed = false;
+  for (int j = next(i); j < nlines; j = next(j)) {
+    if (!is_insn(lines[j]) && !is_loc(lines[j]))
+      break;
+    lines[j] = NULL;
+    changed = true;
+  }
+  return changed;
+}
+
+// ジャンプ先がさらに無条件ジャンプならその先に直接飛ぶ
+static bool thread_jump(int i) {
+  char *op;
+  char *target = jump_target(lines[i], &op);
+  if (!target || strncmp(target, ".L", 2))
+    return false;
+
+  int t = find_label(target);
+  if (t < 0)
+    return false;
+
+  int j = t;
+  do {
+    j = next(j);
+  } while (j < nlines && (is_label(lines[j]) || is_loc(lines[j])));
+  if (j == nlines)
+    return false;
+
+  char *target2 = operands(lines[j], "jmp");
+  if (!target2 || strncmp(target2, ".L", 2) || !strcmp(target, target2))
+    return false;
+
+  lines[i] = format("  %s %s", op, target2);
+  return true;
+}
+
+// 格納した直後に同じ場所から読み直す命令は、レジスタ間の命令にできる
+static char *store_reload_rules[][3] = {
+  {"  mov qword ptr %s, rax", "  mov rax, qword ptr %s", NULL},
+  {"  mov dword ptr %s, eax", "  movsxd rax, dword ptr %s", "  movsxd rax, eax"},
+  {"  mov word ptr %s, ax", "  movsx eax, word ptr %s", "  movsx eax, ax"},
+  {"  mov byte ptr %s, al", "  movsx eax, byte ptr %s", "  movsx eax, al"},
+};
+
+static bool store_reload(int i) {
+  int j = next_stmt(i);
+  if (j == nlines)
+    return false;
+
+  for (int r = 0; r < sizeof(store_reload_rules) / sizeof(*store_reload_rules); r++) {
+    char *store = store_reload_rules[r][0];
+    int prefix = strchr(store, '%') - store;
+    int suffix = strlen(store) - prefix - 2;
+    int len = strlen(lines[i]);
+    if (len <= prefix + suffix || strncmp(lines[i], store, prefix) ||
+        strcmp(lines[i] + len - suffix, store + prefix + 2))
+      continue;
+
+    char *mem = strndup(lines[i] + prefix, len - prefix - suffix);
+    bool match = !strcmp(lines[j], format(store_reload_rules[r][1], mem));
+    free(mem);
+    if (!match)
+      continue;
+
+    char *repl = store_reload_rules[r][2];
+    lines[j] = repl ? repl : NULL;
+    return true;
+  }
+  return false;
+}
+
+// 符号拡張したばかりの値をもう一度符号拡張しない
+static bool dup_movsxd(int i) {
+  char *ops = operands(lines[i], "movsxd");
+  int j = next(i);
+  char *ops2 = j < nlines ? operands(lines[j], "movsxd") : NULL;
+  if (!ops || !ops2)
+    return false;
+
+  char *comma = strchr(ops2, ',');
+  int r = reg_index(reg64, ops2, comma - ops2);
+  if (r < 0 || strncmp(ops, ops2, comma - ops2 + 1) || strcmp(comma + 2, reg32[r]))
+    return false;
+  lines[j] = NULL;
+  return true;
+}
+
+static bool (*rules[])(int i) = {
+  dup_loc,
+  self_mov,
+  zero_rsp,
+  jmp_next,
+  jcc_over_jmp,
+  unreachable_code,
+  thread_jump,
+  store_reload,
+  dup_movsxd,
+};
+
+// bufに入っている1関数分のアセンブリを最適化してoutに書き出す
+void peephole(char *buf, FILE *out) {
+  nlines = 0;
+  for (char *p = buf; *p; p++)
+    if (*p == '\n')
+      nlines++;
+
+  lines = calloc(nlines, sizeof(char *));
+  char *p = buf;
+  for (int i = 0; i < nlines; i++) {
+    char *end = strchr(p, '\n');
+    *end = '\0';
+    lines[i] = p;
+    p = end + 1;
+  }
+
+  for (int pass = 0; pass < MAX_PASSES; pass++) {
+    bool changed = false;
+    for (int i = 0; i < nlines; i++)
+      for (int r = 0; r < sizeof(rules) / sizeof(*rules) && lines[i]; r++)
+        changed |= rules[r](i);
+    if (!changed)
+      break;
+  }
+
+  for (int i = 0; i < nlines; i++)
+    if (lines[i])
+      fprintf(out, "%s\n", lines[i]);
+  free(lines);
+}
@@ -132,6 +132,94 @@ int main() {
 
   1 ? -2 : (void)-1;
 
+  ASSERT(36, (((((((1+2)+3)+4)+5)+6)+7)+8));
+  ASSERT(8, (((((((1*2)*3)*4)*5)*6)*7)*8) / 5040);
+
+  ASSERT(1, (char)255 == -1);
+  ASSERT(-2147483648, 2147483647 + 1);
+  ASSERT(44, (long)(int)(char)300);
+  ASSERT(300, ({ long x=300; (long)(int)x; }));
+  ASSERT(44, ({ long x=300; (int)(char)(long)x; }));
+  ASSERT(5, ({ int x=5; x*1+0-0; }));
+  ASSERT(5, ({ int x=5; (x|0)^0; }));
+  ASSERT(5, ({ int x=5; (x&-1)<<0; }));
+  ASSERT(0, ({ int x=5; x*0; }));
+  ASSERT(6, ({ int x=5; x*0 + (x=6); }));
+  ASSERT(2, ({ int x=5; 3*4 + x - 15; }));
+  ASSERT(5, ({ int x=5; 0 ? 3 : x; }));
+  ASSERT(1, ({ int x=2; 1 && x; }));
+  ASSERT(0, ({ int x=0; 1 && x; }));
+  ASSERT(1, ({ int x=0; x || 1; }));
+  ASSERT(1, ({ int x=0; (x=1) && 0; x; }));
+  ASSERT(0, ({ int x=0; 0 && (x=1); x; }));
+  ASSERT(1, ({ int x=0; (x=1) || 1; x; }));
+  ASSERT(7, ({ int x=0; (x=7, 3); x; }));
+
+  ASSERT(8, ({ int a[3]={1,2,3}; a[1]+=6; a[1]; }));
+  ASSERT(8, ({ int a[3]={1,2,3}; int i=1; a[i]+=6; }));
+  ASSERT(3, ({ int a[3]={1,2,3}; int i=0; a[i]++; a[i]++; a[i]; }));
+  ASSERT(1, ({ int a[3]={1,2,3}; int i=0; a[i]++; }));
+  ASSERT(0, ({ int a[3]={1,2,3}; int i=0; --a[i]; }));
+  ASSERT(-128, ({ struct {char c; short s;} x={127,0}; x.c++; x.c; }));
+  ASSERT(-32768, ({ struct {char c; short s;} x={0,32767}; x.s+=1; }));
+  ASSERT(6, ({ struct {int a; long b;} x={7,12}, *p=&x; p->a&=6; p->b^=10; p->a; }));
+  ASSERT(6, ({ struct {int a; long b;} x={7,12}, *p=&x; p->a&=6; p->b^=10; p->b; }));
+  ASSERT(10, ({ gvar=3; gvar|=8; gvar-=1; gvar; }));
+  ASSERT(3, ({ int a[4]={0,1,2,3}; int *p=a; p+=2; p++; *p; }));
+  ASSERT(-1, ({ long x=4294967295; x-=4294967296; x; }));
+  ASSERT(2, ({ int a[3]={1,2,3}; int i=0; a[i++]+=1; i+a[0]-1; }));
+
+  ASSERT(0, ({ char c=200; c==200; }));
+  ASSERT(1, ({ char c=200; c<200; }));
+  ASSERT(1, ({ char s[3]="ax"; s[1]=='x'; }));
+  ASSERT(1, ({ char s[3]="a\xff"; s[1]==-1; }));
+  ASSERT(0, ({ short s[2]={1,-2}; s[1]==65534; }));
+  ASSERT(1, ({ long x=4294967296; x>4294967295; }));
+  ASSERT(1, ({ long x=-1; x<0; }));
+  ASSERT(1, ({ long x=-1; x+4294967296==4294967295; }));
+  ASSERT(1, ({ long x=4294967297; (int)x==1; }));
+  ASSERT(1, ({ int x=7; 10>x; }));
+  ASSERT(0, ({ int x=7; 7<x; }));
+  ASSERT(21, ({ int x=7; x*3; }));
+  ASSERT(-21, ({ long x=7; x*-3; }));
+  ASSERT(3, ({ gvar=2; int x=7; x/gvar; }));
+  ASSERT(1, ({ gvar=2; int x=7; x%gvar; }));
+  ASSERT(1, ({ long x=1; (x<<33)==8589934592; }));
+  ASSERT(-2, ({ long x=-8; x>>2; }));
+  ASSERT(5, ({ gvar=3; int x=2; gvar+x; }));
+
+  ASSERT(-45, ({ long x=-9; x*5; }));
+  ASSERT(-35, ({ int x=-7; x*5; }));
+  ASSERT(63, ({ int x=7; x*9; }));
+  ASSERT(56, ({ int x=7; 8*x; }));
+  ASSERT(-56, ({ int x=7; x*-8; }));
+  ASSERT(84, ({ int x=7; x*12; }));
+  ASSERT(1, ({ long x=3; x*1073741824==3221225472; }));
+  ASSERT(-3, ({ int x=-7; x/2; }));
+  ASSERT(-1, ({ int x=-7; x%2; }));
+  ASSERT(3, ({ int x=7; x/2; }));
+  ASSERT(-4, ({ int x=-39; x/8; }));
+  ASSERT(-7, ({ int x=-39; x%8; }));
+  ASSERT(4, ({ int x=-39; x/-8; }));
+  ASSERT(-7, ({ int x=-39; x%-8; }));
+  ASSERT(-13, ({ int x=-39; x/3; }));
+  ASSERT(0, ({ int x=-39; x%3; }));
+  ASSERT(-5, ({ int x=-39; x/7; }));
+  ASSERT(-4, ({ int x=-39; x%7; }));
+  ASSERT(5, ({ int x=-39; x/-7; }));
+  ASSERT(-4, ({ int x=-39; x%-7; }));
+  ASSERT(214748364, ({ int x=2147483647; x/10; }));
+  ASSERT(-214748364, ({ int x=-2147483647-1; x/10; }));
+  ASSERT(-8, ({ int x=-2147483647-1; x%10; }));
+  ASSERT(2147483, ({ int x=2147483647; x/1000; }));
+  ASSERT(647, ({ int x=2147483647; x%1000; }));
+  ASSERT(1, ({ int x=2147483647; x/2147483647; }));
+  ASSERT(-1, ({ long x=-4294967297; x/4294967296; }));
+  ASSERT(-1, ({ long x=-9; x/8; }));
+  ASSERT(-1, ({ long x=-9; x%8; }));
+  ASSERT(-3, ({ long x=-9; x/3; }));
+  ASSERT(-2, ({ long x=-9; x%7; }));
+
   printf("OK\n");
   return 0;
 }
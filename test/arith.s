@@ -0,0 +1,6916 @@
+.file 1 "-"
+.intel_syntax noprefix
+  .local .L..183
+  .data
+.L..183:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+  .local .L..182
+  .data
+.L..182:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 37
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..181
+  .data
+.L..181:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..180
+  .data
+.L..180:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 37
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..179
+  .data
+.L..179:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..178
+  .data
+.L..178:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..177
+  .data
+.L..177:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..176
+  .data
+.L..176:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 37
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..175
+  .data
+.L..175:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..174
+  .data
+.L..174:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 45
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 37
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..173
+  .data
+.L..173:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 45
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..172
+  .data
+.L..172:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..171
+  .data
+.L..171:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 51
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 37
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..170
+  .data
+.L..170:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 51
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..169
+  .data
+.L..169:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 51
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 37
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..168
+  .data
+.L..168:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 51
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..167
+  .data
+.L..167:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 51
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 37
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..166
+  .data
+.L..166:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 51
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..165
+  .data
+.L..165:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 51
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 37
+  .byte 45
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..164
+  .data
+.L..164:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 51
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 45
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..163
+  .data
+.L..163:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 51
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 37
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..162
+  .data
+.L..162:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 51
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..161
+  .data
+.L..161:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..160
+  .data
+.L..160:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 37
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..159
+  .data
+.L..159:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..158
+  .data
+.L..158:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 49
+  .byte 48
+  .byte 55
+  .byte 51
+  .byte 55
+  .byte 52
+  .byte 49
+  .byte 56
+  .byte 50
+  .byte 52
+  .byte 61
+  .byte 61
+  .byte 51
+  .byte 50
+  .byte 50
+  .byte 49
+  .byte 50
+  .byte 50
+  .byte 53
+  .byte 52
+  .byte 55
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..157
+  .data
+.L..157:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 49
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..156
+  .data
+.L..156:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 45
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..155
+  .data
+.L..155:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 56
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..154
+  .data
+.L..154:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..153
+  .data
+.L..153:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..152
+  .data
+.L..152:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..151
+  .data
+.L..151:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 118
+  .byte 97
+  .byte 114
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 118
+  .byte 97
+  .byte 114
+  .byte 43
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..150
+  .data
+.L..150:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 62
+  .byte 62
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..149
+  .data
+.L..149:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 60
+  .byte 60
+  .byte 51
+  .byte 51
+  .byte 41
+  .byte 61
+  .byte 61
+  .byte 56
+  .byte 53
+  .byte 56
+  .byte 57
+  .byte 57
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 57
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..148
+  .data
+.L..148:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 118
+  .byte 97
+  .byte 114
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 37
+  .byte 103
+  .byte 118
+  .byte 97
+  .byte 114
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..147
+  .data
+.L..147:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 118
+  .byte 97
+  .byte 114
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 47
+  .byte 103
+  .byte 118
+  .byte 97
+  .byte 114
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..146
+  .data
+.L..146:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 45
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..145
+  .data
+.L..145:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..144
+  .data
+.L..144:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 55
+  .byte 60
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..143
+  .data
+.L..143:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 62
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..142
+  .data
+.L..142:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 120
+  .byte 61
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..141
+  .data
+.L..141:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 43
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 54
+  .byte 61
+  .byte 61
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..140
+  .data
+.L..140:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 60
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..139
+  .data
+.L..139:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 62
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..138
+  .data
+.L..138:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 45
+  .byte 50
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 61
+  .byte 54
+  .byte 53
+  .byte 53
+  .byte 51
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..137
+  .data
+.L..137:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 115
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 92
+  .byte 120
+  .byte 102
+  .byte 102
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..136
+  .data
+.L..136:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 115
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 120
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 61
+  .byte 39
+  .byte 120
+  .byte 39
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..135
+  .data
+.L..135:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 61
+  .byte 50
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 60
+  .byte 50
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..134
+  .data
+.L..134:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 61
+  .byte 50
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 61
+  .byte 61
+  .byte 50
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..133
+  .data
+.L..133:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 93
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 45
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..132
+  .data
+.L..132:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 45
+  .byte 61
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..131
+  .data
+.L..131:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 43
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..130
+  .data
+.L..130:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 118
+  .byte 97
+  .byte 114
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 118
+  .byte 97
+  .byte 114
+  .byte 124
+  .byte 61
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 118
+  .byte 97
+  .byte 114
+  .byte 45
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 118
+  .byte 97
+  .byte 114
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..129
+  .data
+.L..129:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 55
+  .byte 44
+  .byte 49
+  .byte 50
+  .byte 125
+  .byte 44
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 45
+  .byte 62
+  .byte 97
+  .byte 38
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 45
+  .byte 62
+  .byte 98
+  .byte 94
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 45
+  .byte 62
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..128
+  .data
+.L..128:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 55
+  .byte 44
+  .byte 49
+  .byte 50
+  .byte 125
+  .byte 44
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 45
+  .byte 62
+  .byte 97
+  .byte 38
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 45
+  .byte 62
+  .byte 98
+  .byte 94
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 45
+  .byte 62
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..127
+  .data
+.L..127:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 51
+  .byte 50
+  .byte 55
+  .byte 54
+  .byte 55
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..126
+  .data
+.L..126:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 50
+  .byte 55
+  .byte 44
+  .byte 48
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..125
+  .data
+.L..125:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 45
+  .byte 45
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..124
+  .data
+.L..124:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..123
+  .data
+.L..123:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..122
+  .data
+.L..122:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 43
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..121
+  .data
+.L..121:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 43
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..120
+  .data
+.L..120:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 61
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..119
+  .data
+.L..119:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 124
+  .byte 124
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..118
+  .data
+.L..118:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 48
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..117
+  .data
+.L..117:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..116
+  .data
+.L..116:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 124
+  .byte 124
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..115
+  .data
+.L..115:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 49
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..114
+  .data
+.L..114:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 49
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..113
+  .data
+.L..113:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 48
+  .byte 32
+  .byte 63
+  .byte 32
+  .byte 51
+  .byte 32
+  .byte 58
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..112
+  .data
+.L..112:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 51
+  .byte 42
+  .byte 52
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 120
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 49
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..111
+  .data
+.L..111:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 48
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 61
+  .byte 54
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..110
+  .data
+.L..110:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..109
+  .data
+.L..109:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 38
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 60
+  .byte 60
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..108
+  .data
+.L..108:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 124
+  .byte 48
+  .byte 41
+  .byte 94
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..107
+  .data
+.L..107:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 42
+  .byte 49
+  .byte 43
+  .byte 48
+  .byte 45
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..106
+  .data
+.L..106:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..105
+  .data
+.L..105:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..104
+  .data
+.L..104:
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 0
+  .local .L..103
+  .data
+.L..103:
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 0
+  .local .L..102
+  .data
+.L..102:
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 50
+  .byte 53
+  .byte 53
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 45
+  .byte 49
+  .byte 0
+  .local .L..101
+  .data
+.L..101:
+  .byte 40
+  .byte 40
+  .byte 40
+  .byte 40
+  .byte 40
+  .byte 40
+  .byte 40
+  .byte 49
+  .byte 42
+  .byte 50
+  .byte 41
+  .byte 42
+  .byte 51
+  .byte 41
+  .byte 42
+  .byte 52
+  .byte 41
+  .byte 42
+  .byte 53
+  .byte 41
+  .byte 42
+  .byte 54
+  .byte 41
+  .byte 42
+  .byte 55
+  .byte 41
+  .byte 42
+  .byte 56
+  .byte 41
+  .byte 32
+  .byte 47
+  .byte 32
+  .byte 53
+  .byte 48
+  .byte 52
+  .byte 48
+  .byte 0
+  .local .L..100
+  .data
+.L..100:
+  .byte 40
+  .byte 40
+  .byte 40
+  .byte 40
+  .byte 40
+  .byte 40
+  .byte 40
+  .byte 49
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 43
+  .byte 51
+  .byte 41
+  .byte 43
+  .byte 52
+  .byte 41
+  .byte 43
+  .byte 53
+  .byte 41
+  .byte 43
+  .byte 54
+  .byte 41
+  .byte 43
+  .byte 55
+  .byte 41
+  .byte 43
+  .byte 56
+  .byte 41
+  .byte 0
+  .local .L..99
+  .data
+.L..99:
+  .byte 49
+  .byte 63
+  .byte 45
+  .byte 50
+  .byte 58
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 0
+  .local .L..98
+  .data
+.L..98:
+  .byte 49
+  .byte 63
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 50
+  .byte 58
+  .byte 45
+  .byte 49
+  .byte 0
+  .local .L..97
+  .data
+.L..97:
+  .byte 48
+  .byte 63
+  .byte 45
+  .byte 50
+  .byte 58
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 0
+  .local .L..96
+  .data
+.L..96:
+  .byte 48
+  .byte 63
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 50
+  .byte 58
+  .byte 45
+  .byte 49
+  .byte 0
+  .local .L..95
+  .data
+.L..95:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 63
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 49
+  .byte 58
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 50
+  .byte 41
+  .byte 0
+  .local .L..94
+  .data
+.L..94:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 63
+  .byte 49
+  .byte 58
+  .byte 50
+  .byte 41
+  .byte 0
+  .local .L..93
+  .data
+.L..93:
+  .byte 49
+  .byte 63
+  .byte 45
+  .byte 50
+  .byte 58
+  .byte 45
+  .byte 49
+  .byte 0
+  .local .L..92
+  .data
+.L..92:
+  .byte 48
+  .byte 63
+  .byte 45
+  .byte 50
+  .byte 58
+  .byte 45
+  .byte 49
+  .byte 0
+  .local .L..91
+  .data
+.L..91:
+  .byte 49
+  .byte 63
+  .byte 49
+  .byte 58
+  .byte 50
+  .byte 0
+  .local .L..90
+  .data
+.L..90:
+  .byte 48
+  .byte 63
+  .byte 49
+  .byte 58
+  .byte 50
+  .byte 0
+  .local .L..89
+  .data
+.L..89:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 62
+  .byte 62
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..88
+  .data
+.L..88:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..87
+  .data
+.L..87:
+  .byte 45
+  .byte 49
+  .byte 0
+  .local .L..86
+  .data
+.L..86:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 62
+  .byte 62
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..85
+  .data
+.L..85:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..84
+  .data
+.L..84:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 60
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..83
+  .data
+.L..83:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 60
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..82
+  .data
+.L..82:
+  .byte 45
+  .byte 49
+  .byte 62
+  .byte 62
+  .byte 49
+  .byte 0
+  .local .L..81
+  .data
+.L..81:
+  .byte 53
+  .byte 62
+  .byte 62
+  .byte 49
+  .byte 0
+  .local .L..80
+  .data
+.L..80:
+  .byte 53
+  .byte 60
+  .byte 60
+  .byte 49
+  .byte 0
+  .local .L..79
+  .data
+.L..79:
+  .byte 49
+  .byte 60
+  .byte 60
+  .byte 51
+  .byte 0
+  .local .L..78
+  .data
+.L..78:
+  .byte 49
+  .byte 60
+  .byte 60
+  .byte 48
+  .byte 0
+  .local .L..77
+  .data
+.L..77:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 94
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..76
+  .data
+.L..76:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 124
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..75
+  .data
+.L..75:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 38
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..74
+  .data
+.L..74:
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 94
+  .byte 48
+  .byte 98
+  .byte 48
+  .byte 48
+  .byte 49
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 0
+  .local .L..73
+  .data
+.L..73:
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 94
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 0
+  .local .L..72
+  .data
+.L..72:
+  .byte 48
+  .byte 94
+  .byte 48
+  .byte 0
+  .local .L..71
+  .data
+.L..71:
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 124
+  .byte 48
+  .byte 98
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 49
+  .byte 49
+  .byte 0
+  .local .L..70
+  .data
+.L..70:
+  .byte 48
+  .byte 124
+  .byte 49
+  .byte 0
+  .local .L..69
+  .data
+.L..69:
+  .byte 45
+  .byte 49
+  .byte 38
+  .byte 49
+  .byte 48
+  .byte 0
+  .local .L..68
+  .data
+.L..68:
+  .byte 55
+  .byte 38
+  .byte 51
+  .byte 0
+  .local .L..67
+  .data
+.L..67:
+  .byte 51
+  .byte 38
+  .byte 49
+  .byte 0
+  .local .L..66
+  .data
+.L..66:
+  .byte 48
+  .byte 38
+  .byte 49
+  .byte 0
+  .local .L..65
+  .data
+.L..65:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 37
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..64
+  .data
+.L..64:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 37
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..63
+  .data
+.L..63:
+  .byte 40
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 49
+  .byte 55
+  .byte 41
+  .byte 37
+  .byte 54
+  .byte 0
+  .local .L..62
+  .data
+.L..62:
+  .byte 49
+  .byte 55
+  .byte 37
+  .byte 54
+  .byte 0
+  .local .L..61
+  .data
+.L..61:
+  .byte 126
+  .byte 45
+  .byte 49
+  .byte 0
+  .local .L..60
+  .data
+.L..60:
+  .byte 126
+  .byte 48
+  .byte 0
+  .local .L..59
+  .data
+.L..59:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 33
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..58
+  .data
+.L..58:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 33
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..57
+  .data
+.L..57:
+  .byte 33
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 51
+  .byte 0
+  .local .L..56
+  .data
+.L..56:
+  .byte 33
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 48
+  .byte 0
+  .local .L..55
+  .data
+.L..55:
+  .byte 33
+  .byte 48
+  .byte 0
+  .local .L..54
+  .data
+.L..54:
+  .byte 33
+  .byte 50
+  .byte 0
+  .local .L..53
+  .data
+.L..53:
+  .byte 33
+  .byte 49
+  .byte 0
+  .local .L..52
+  .data
+.L..52:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..51
+  .data
+.L..51:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..50
+  .data
+.L..50:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..49
+  .data
+.L..49:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..48
+  .data
+.L..48:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 41
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..47
+  .data
+.L..47:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 41
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..46
+  .data
+.L..46:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 40
+  .byte 112
+  .byte 45
+  .byte 45
+  .byte 41
+  .byte 41
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..45
+  .data
+.L..45:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..44
+  .data
+.L..44:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..43
+  .data
+.L..43:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..42
+  .data
+.L..42:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..41
+  .data
+.L..41:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..40
+  .data
+.L..40:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 45
+  .byte 45
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..39
+  .data
+.L..39:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..38
+  .data
+.L..38:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 45
+  .byte 45
+  .byte 42
+  .byte 112
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..37
+  .data
+.L..37:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 43
+  .byte 43
+  .byte 42
+  .byte 112
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..36
+  .data
+.L..36:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 43
+  .byte 43
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..35
+  .data
+.L..35:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 42
+  .byte 99
+  .byte 97
+  .byte 108
+  .byte 99
+  .byte 95
+  .byte 97
+  .byte 110
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 115
+  .byte 115
+  .byte 105
+  .byte 103
+  .byte 110
+  .byte 40
+  .byte 41
+  .byte 32
+  .byte 43
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 118
+  .byte 97
+  .byte 114
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..34
+  .data
+.L..34:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 47
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..33
+  .data
+.L..33:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 47
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..32
+  .data
+.L..32:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 42
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..31
+  .data
+.L..31:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 42
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..30
+  .data
+.L..30:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 45
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..29
+  .data
+.L..29:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 45
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..28
+  .data
+.L..28:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..27
+  .data
+.L..27:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..26
+  .data
+.L..26:
+  .byte 49
+  .byte 48
+  .byte 55
+  .byte 51
+  .byte 55
+  .byte 52
+  .byte 49
+  .byte 56
+  .byte 50
+  .byte 52
+  .byte 32
+  .byte 42
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 32
+  .byte 47
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 0
+  .local .L..25
+  .data
+.L..25:
+  .byte 49
+  .byte 62
+  .byte 61
+  .byte 50
+  .byte 0
+  .local .L..24
+  .data
+.L..24:
+  .byte 49
+  .byte 62
+  .byte 61
+  .byte 49
+  .byte 0
+  .local .L..23
+  .data
+.L..23:
+  .byte 49
+  .byte 62
+  .byte 61
+  .byte 48
+  .byte 0
+  .local .L..22
+  .data
+.L..22:
+  .byte 49
+  .byte 62
+  .byte 50
+  .byte 0
+  .local .L..21
+  .data
+.L..21:
+  .byte 49
+  .byte 62
+  .byte 49
+  .byte 0
+  .local .L..20
+  .data
+.L..20:
+  .byte 49
+  .byte 62
+  .byte 48
+  .byte 0
+  .local .L..19
+  .data
+.L..19:
+  .byte 50
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 0
+  .local .L..18
+  .data
+.L..18:
+  .byte 49
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 0
+  .local .L..17
+  .data
+.L..17:
+  .byte 48
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 0
+  .local .L..16
+  .data
+.L..16:
+  .byte 50
+  .byte 60
+  .byte 49
+  .byte 0
+  .local .L..15
+  .data
+.L..15:
+  .byte 49
+  .byte 60
+  .byte 49
+  .byte 0
+  .local .L..14
+  .data
+.L..14:
+  .byte 48
+  .byte 60
+  .byte 49
+  .byte 0
+  .local .L..13
+  .data
+.L..13:
+  .byte 52
+  .byte 50
+  .byte 33
+  .byte 61
+  .byte 52
+  .byte 50
+  .byte 0
+  .local .L..12
+  .data
+.L..12:
+  .byte 48
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 0
+  .local .L..11
+  .data
+.L..11:
+  .byte 52
+  .byte 50
+  .byte 61
+  .byte 61
+  .byte 52
+  .byte 50
+  .byte 0
+  .local .L..10
+  .data
+.L..10:
+  .byte 48
+  .byte 61
+  .byte 61
+  .byte 49
+  .byte 0
+  .local .L..9
+  .data
+.L..9:
+  .byte 45
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 43
+  .byte 49
+  .byte 48
+  .byte 0
+  .local .L..8
+  .data
+.L..8:
+  .byte 45
+  .byte 32
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 0
+  .local .L..7
+  .data
+.L..7:
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 43
+  .byte 50
+  .byte 48
+  .byte 0
+  .local .L..6
+  .data
+.L..6:
+  .byte 40
+  .byte 51
+  .byte 43
+  .byte 53
+  .byte 41
+  .byte 47
+  .byte 50
+  .byte 0
+  .local .L..5
+  .data
+.L..5:
+  .byte 53
+  .byte 42
+  .byte 40
+  .byte 57
+  .byte 45
+  .byte 54
+  .byte 41
+  .byte 0
+  .local .L..4
+  .data
+.L..4:
+  .byte 53
+  .byte 43
+  .byte 54
+  .byte 42
+  .byte 55
+  .byte 0
+  .local .L..3
+  .data
+.L..3:
+  .byte 49
+  .byte 50
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 51
+  .byte 52
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 53
+  .byte 0
+  .local .L..2
+  .data
+.L..2:
+  .byte 53
+  .byte 43
+  .byte 50
+  .byte 48
+  .byte 45
+  .byte 52
+  .byte 0
+  .local .L..1
+  .data
+.L..1:
+  .byte 52
+  .byte 50
+  .byte 0
+  .local .L..0
+  .data
+.L..0:
+  .byte 48
+  .byte 0
+  .globl gvar2
+  .bss
+gvar2:
+  .zero 4
+  .globl gvar
+  .bss
+gvar:
+  .zero 4
+  .globl main
+  .text
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 992
+  mov [rbp-960], rbx
+  mov [rbp-968], r12
+  mov [rbp-976], r13
+  mov [rbp-984], r14
+.L.body.main:
+  .loc 1 47
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..0[rip]
+  call assert
+  .loc 1 48
+  mov edi, 42
+  mov esi, 42
+  lea rdx, .L..1[rip]
+  call assert
+  .loc 1 49
+  mov edi, 21
+  mov esi, 21
+  lea rdx, .L..2[rip]
+  call assert
+  .loc 1 50
+  mov edi, 41
+  mov esi, 41
+  lea rdx, .L..3[rip]
+  call assert
+  .loc 1 51
+  mov edi, 47
+  mov esi, 47
+  lea rdx, .L..4[rip]
+  call assert
+  .loc 1 52
+  mov edi, 15
+  mov esi, 15
+  lea rdx, .L..5[rip]
+  call assert
+  .loc 1 53
+  mov edi, 4
+  mov esi, 4
+  lea rdx, .L..6[rip]
+  call assert
+  .loc 1 54
+  mov edi, 10
+  mov esi, 10
+  lea rdx, .L..7[rip]
+  call assert
+  .loc 1 55
+  mov edi, 10
+  mov esi, 10
+  lea rdx, .L..8[rip]
+  call assert
+  .loc 1 56
+  mov edi, 10
+  mov esi, 10
+  lea rdx, .L..9[rip]
+  call assert
+  .loc 1 57
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..10[rip]
+  call assert
+  .loc 1 58
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..11[rip]
+  call assert
+  .loc 1 59
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..12[rip]
+  call assert
+  .loc 1 60
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..13[rip]
+  call assert
+  .loc 1 61
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..14[rip]
+  call assert
+  .loc 1 62
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..15[rip]
+  call assert
+  .loc 1 63
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..16[rip]
+  call assert
+  .loc 1 64
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..17[rip]
+  call assert
+  .loc 1 65
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..18[rip]
+  call assert
+  .loc 1 66
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..19[rip]
+  call assert
+  .loc 1 67
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..20[rip]
+  call assert
+  .loc 1 68
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..21[rip]
+  call assert
+  .loc 1 69
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..22[rip]
+  call assert
+  .loc 1 70
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..23[rip]
+  call assert
+  .loc 1 71
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..24[rip]
+  call assert
+  .loc 1 72
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..25[rip]
+  call assert
+  .loc 1 73
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..26[rip]
+  call assert
+  .loc 1 74
+  mov dword ptr [rbp-952], 2
+  .loc 1 74
+  add dword ptr [rbp-952], 5
+  .loc 1 74
+  movsxd rax, dword ptr [rbp-952]
+  mov rsi, rax
+  mov edi, 7
+  lea rdx, .L..27[rip]
+  call assert
+  .loc 1 75
+  mov dword ptr [rbp-948], 2
+  .loc 1 75
+  add dword ptr [rbp-948], 5
+  movsxd rax, dword ptr [rbp-948]
+  mov rsi, rax
+  mov edi, 7
+  lea rdx, .L..28[rip]
+  call assert
+  .loc 1 76
+  mov dword ptr [rbp-944], 5
+  .loc 1 76
+  sub dword ptr [rbp-944], 2
+  .loc 1 76
+  movsxd rax, dword ptr [rbp-944]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..29[rip]
+  call assert
+  .loc 1 77
+  mov dword ptr [rbp-940], 5
+  .loc 1 77
+  sub dword ptr [rbp-940], 2
+  movsxd rax, dword ptr [rbp-940]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..30[rip]
+  call assert
+  .loc 1 78
+  mov dword ptr [rbp-936], 3
+  .loc 1 78
+  movsxd rax, dword ptr [rbp-936]
+  shl eax, 1
+  mov dword ptr [rbp-936], eax
+  .loc 1 78
+  movsxd rax, eax
+  mov rsi, rax
+  mov edi, 6
+  lea rdx, .L..31[rip]
+  call assert
+  .loc 1 79
+  mov dword ptr [rbp-932], 3
+  .loc 1 79
+  movsxd rax, dword ptr [rbp-932]
+  shl eax, 1
+  mov dword ptr [rbp-932], eax
+  mov rsi, rax
+  mov edi, 6
+  lea rdx, .L..32[rip]
+  call assert
+  .loc 1 80
+  mov dword ptr [rbp-928], 6
+  .loc 1 80
+  movsxd rax, dword ptr [rbp-928]
+  lea edx, [rax+1]
+  test eax, eax
+  cmovs eax, edx
+  sar eax, 1
+  mov dword ptr [rbp-928], eax
+  .loc 1 80
+  movsxd rax, eax
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..33[rip]
+  call assert
+  .loc 1 81
+  mov dword ptr [rbp-924], 6
+  .loc 1 81
+  movsxd rax, dword ptr [rbp-924]
+  lea edx, [rax+1]
+  test eax, eax
+  cmovs eax, edx
+  sar eax, 1
+  mov dword ptr [rbp-924], eax
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..34[rip]
+  call assert
+  .loc 1 82
+  mov dword ptr gvar[rip], 0
+  .loc 1 83
+  xor eax, eax
+  call calc_and_assign
+  mov qword ptr [rbp-920], rax
+  .loc 1 83
+  add dword ptr [rax], 3
+  movsxd rax, dword ptr [rax]
+  .loc 1 83
+  movsxd rax, dword ptr gvar[rip]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..35[rip]
+  call assert
+  .loc 1 84
+  mov dword ptr [rbp-912], 2
+  .loc 1 84
+  inc dword ptr [rbp-912]
+  movsxd rax, dword ptr [rbp-912]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..36[rip]
+  call assert
+  .loc 1 85
+  mov dword ptr [rbp-908], 0
+  .loc 1 85
+  mov dword ptr [rbp-904], 1
+  .loc 1 85
+  mov dword ptr [rbp-900], 2
+  .loc 1 85
+  lea rax, [rbp-908]
+  add rax, 4
+  mov qword ptr [rbp-896], rax
+  .loc 1 85
+  inc dword ptr [rax]
+  movsxd rax, dword ptr [rax]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..37[rip]
+  call assert
+  .loc 1 86
+  mov dword ptr [rbp-884], 0
+  .loc 1 86
+  mov dword ptr [rbp-880], 1
+  .loc 1 86
+  mov dword ptr [rbp-876], 2
+  .loc 1 86
+  lea rax, [rbp-884]
+  add rax, 4
+  mov qword ptr [rbp-872], rax
+  .loc 1 86
+  dec dword ptr [rax]
+  movsxd rax, dword ptr [rax]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..38[rip]
+  call assert
+  .loc 1 87
+  mov dword ptr [rbp-860], 2
+  .loc 1 87
+  inc dword ptr [rbp-860]
+  movsxd rax, dword ptr [rbp-860]
+  add eax, -1
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..39[rip]
+  call assert
+  .loc 1 88
+  mov dword ptr [rbp-856], 2
+  .loc 1 88
+  dec dword ptr [rbp-856]
+  movsxd rax, dword ptr [rbp-856]
+  add eax, 1
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..40[rip]
+  call assert
+  .loc 1 89
+  mov dword ptr [rbp-852], 2
+  .loc 1 89
+  inc dword ptr [rbp-852]
+  movsxd rax, dword ptr [rbp-852]
+  add eax, -1
+  .loc 1 89
+  movsxd rax, dword ptr [rbp-852]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..41[rip]
+  call assert
+  .loc 1 90
+  mov dword ptr [rbp-848], 2
+  .loc 1 90
+  dec dword ptr [rbp-848]
+  movsxd rax, dword ptr [rbp-848]
+  add eax, 1
+  .loc 1 90
+  movsxd rax, dword ptr [rbp-848]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..42[rip]
+  call assert
+  .loc 1 91
+  mov dword ptr [rbp-844], 0
+  .loc 1 91
+  mov dword ptr [rbp-840], 1
+  .loc 1 91
+  mov dword ptr [rbp-836], 2
+  .loc 1 91
+  lea rax, [rbp-844]
+  add rax, 4
+  mov qword ptr [rbp-832], rax
+  .loc 1 91
+  add qword ptr [rbp-832], 4
+  mov rax, qword ptr [rbp-832]
+  movsxd rax, dword ptr [rax-4]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..43[rip]
+  call assert
+  .loc 1 92
+  mov dword ptr [rbp-820], 0
+  .loc 1 92
+  mov dword ptr [rbp-816], 1
+  .loc 1 92
+  mov dword ptr [rbp-812], 2
+  .loc 1 92
+  lea rax, [rbp-820]
+  add rax, 4
+  mov qword ptr [rbp-808], rax
+  .loc 1 92
+  add qword ptr [rbp-808], -4
+  mov rax, qword ptr [rbp-808]
+  movsxd rax, dword ptr [rax+4]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..44[rip]
+  call assert
+  .loc 1 93
+  mov dword ptr [rbp-796], 0
+  .loc 1 93
+  mov dword ptr [rbp-792], 1
+  .loc 1 93
+  mov dword ptr [rbp-788], 2
+  .loc 1 93
+  lea rax, [rbp-796]
+  add rax, 4
+  mov qword ptr [rbp-784], rax
+  .loc 1 93
+  add qword ptr [rbp-784], 4
+  mov rax, qword ptr [rbp-784]
+  lea rax, [rax-4]
+  mov qword ptr [rbp-776], rax
+  .loc 1 93
+  dec dword ptr [rax]
+  movsxd rax, dword ptr [rax]
+  add eax, 1
+  .loc 1 93
+  movsxd rax, dword ptr [rbp-796]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..45[rip]
+  call assert
+  .loc 1 94
+  mov dword ptr [rbp-764], 0
+  .loc 1 94
+  mov dword ptr [rbp-760], 1
+  .loc 1 94
+  mov dword ptr [rbp-756], 2
+  .loc 1 94
+  lea rax, [rbp-764]
+  add rax, 4
+  mov qword ptr [rbp-752], rax
+  .loc 1 94
+  add qword ptr [rbp-752], -4
+  mov rax, qword ptr [rbp-752]
+  lea rax, [rax+4]
+  mov qword ptr [rbp-744], rax
+  .loc 1 94
+  dec dword ptr [rax]
+  movsxd rax, dword ptr [rax]
+  add eax, 1
+  .loc 1 94
+  movsxd rax, dword ptr [rbp-760]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..46[rip]
+  call assert
+  .loc 1 95
+  mov dword ptr [rbp-732], 0
+  .loc 1 95
+  mov dword ptr [rbp-728], 1
+  .loc 1 95
+  mov dword ptr [rbp-724], 2
+  .loc 1 95
+  lea rax, [rbp-732]
+  add rax, 4
+  mov qword ptr [rbp-720], rax
+  .loc 1 95
+  dec dword ptr [rax]
+  movsxd rax, dword ptr [rax]
+  add eax, 1
+  .loc 1 95
+  movsxd rax, dword ptr [rbp-724]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..47[rip]
+  call assert
+  .loc 1 96
+  mov dword ptr [rbp-708], 0
+  .loc 1 96
+  mov dword ptr [rbp-704], 1
+  .loc 1 96
+  mov dword ptr [rbp-700], 2
+  .loc 1 96
+  lea rax, [rbp-708]
+  add rax, 4
+  mov qword ptr [rbp-696], rax
+  .loc 1 96
+  dec dword ptr [rax]
+  movsxd rax, dword ptr [rax]
+  add eax, 1
+  .loc 1 96
+  add qword ptr [rbp-696], 4
+  mov rax, qword ptr [rbp-696]
+  add rax, -4
+  .loc 1 96
+  mov rax, qword ptr [rbp-696]
+  movsxd rax, dword ptr [rax]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..48[rip]
+  call assert
+  .loc 1 97
+  mov dword ptr [rbp-684], 0
+  .loc 1 97
+  mov dword ptr [rbp-680], 1
+  .loc 1 97
+  mov dword ptr [rbp-676], 2
+  .loc 1 97
+  lea rax, [rbp-684]
+  add rax, 4
+  mov qword ptr [rbp-672], rax
+  .loc 1 97
+  add qword ptr [rbp-672], 4
+  mov rax, qword ptr [rbp-672]
+  lea rax, [rax-4]
+  mov qword ptr [rbp-664], rax
+  .loc 1 97
+  dec dword ptr [rax]
+  movsxd rax, dword ptr [rax]
+  add eax, 1
+  .loc 1 97
+  movsxd rax, dword ptr [rbp-684]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..49[rip]
+  call assert
+  .loc 1 98
+  mov dword ptr [rbp-652], 0
+  .loc 1 98
+  mov dword ptr [rbp-648], 1
+  .loc 1 98
+  mov dword ptr [rbp-644], 2
+  .loc 1 98
+  lea rax, [rbp-652]
+  add rax, 4
+  mov qword ptr [rbp-640], rax
+  .loc 1 98
+  add qword ptr [rbp-640], 4
+  mov rax, qword ptr [rbp-640]
+  lea rax, [rax-4]
+  mov qword ptr [rbp-632], rax
+  .loc 1 98
+  dec dword ptr [rax]
+  movsxd rax, dword ptr [rax]
+  add eax, 1
+  .loc 1 98
+  movsxd rax, dword ptr [rbp-648]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..50[rip]
+  call assert
+  .loc 1 99
+  mov dword ptr [rbp-620], 0
+  .loc 1 99
+  mov dword ptr [rbp-616], 1
+  .loc 1 99
+  mov dword ptr [rbp-612], 2
+  .loc 1 99
+  lea rax, [rbp-620]
+  add rax, 4
+  mov qword ptr [rbp-608], rax
+  .loc 1 99
+  add qword ptr [rbp-608], 4
+  mov rax, qword ptr [rbp-608]
+  lea rax, [rax-4]
+  mov qword ptr [rbp-600], rax
+  .loc 1 99
+  dec dword ptr [rax]
+  movsxd rax, dword ptr [rax]
+  add eax, 1
+  .loc 1 99
+  movsxd rax, dword ptr [rbp-612]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..51[rip]
+  call assert
+  .loc 1 100
+  mov dword ptr [rbp-588], 0
+  .loc 1 100
+  mov dword ptr [rbp-584], 1
+  .loc 1 100
+  mov dword ptr [rbp-580], 2
+  .loc 1 100
+  lea rax, [rbp-588]
+  add rax, 4
+  mov qword ptr [rbp-576], rax
+  .loc 1 100
+  add qword ptr [rbp-576], 4
+  mov rax, qword ptr [rbp-576]
+  lea rax, [rax-4]
+  mov qword ptr [rbp-568], rax
+  .loc 1 100
+  dec dword ptr [rax]
+  movsxd rax, dword ptr [rax]
+  add eax, 1
+  .loc 1 100
+  mov rax, qword ptr [rbp-576]
+  movsxd rax, dword ptr [rax]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..52[rip]
+  call assert
+  .loc 1 101
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..53[rip]
+  call assert
+  .loc 1 102
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..54[rip]
+  call assert
+  .loc 1 103
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..55[rip]
+  call assert
+  .loc 1 104
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..56[rip]
+  call assert
+  .loc 1 105
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..57[rip]
+  call assert
+  .loc 1 106
+  mov edi, 4
+  mov esi, 4
+  lea rdx, .L..58[rip]
+  call assert
+  .loc 1 107
+  mov edi, 4
+  mov esi, 4
+  lea rdx, .L..59[rip]
+  call assert
+  .loc 1 108
+  mov edi, -1
+  mov esi, -1
+  lea rdx, .L..60[rip]
+  call assert
+  .loc 1 109
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..61[rip]
+  call assert
+  .loc 1 110
+  mov edi, 5
+  mov esi, 5
+  lea rdx, .L..62[rip]
+  call assert
+  .loc 1 111
+  mov edi, 5
+  mov esi, 5
+  lea rdx, .L..63[rip]
+  call assert
+  .loc 1 112
+  mov dword ptr [rbp-556], 10
+  .loc 1 112
+  movsxd rax, dword ptr [rbp-556]
+  lea edx, [rax+3]
+  test eax, eax
+  cmovns edx, eax
+  and edx, -4
+  sub eax, edx
+  mov dword ptr [rbp-556], eax
+  .loc 1 112
+  movsxd rax, eax
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..64[rip]
+  call assert
+  .loc 1 113
+  mov qword ptr [rbp-552], 10
+  .loc 1 113
+  mov rax, qword ptr [rbp-552]
+  lea rdx, [rax+3]
+  test rax, rax
+  cmovns rdx, rax
+  and rdx, -4
+  sub rax, rdx
+  mov qword ptr [rbp-552], rax
+  .loc 1 113
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..65[rip]
+  call assert
+  .loc 1 114
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..66[rip]
+  call assert
+  .loc 1 115
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..67[rip]
+  call assert
+  .loc 1 116
+  mov edi, 3
+  mov esi, 3
+  lea rdx, .L..68[rip]
+  call assert
+  .loc 1 117
+  mov edi, 10
+  mov esi, 10
+  lea rdx, .L..69[rip]
+  call assert
+  .loc 1 118
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..70[rip]
+  call assert
+  .loc 1 119
+  mov edi, 19
+  mov esi, 19
+  lea rdx, .L..71[rip]
+  call assert
+  .loc 1 120
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..72[rip]
+  call assert
+  .loc 1 121
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..73[rip]
+  call assert
+  .loc 1 122
+  mov edi, 52
+  mov esi, 52
+  lea rdx, .L..74[rip]
+  call assert
+  .loc 1 123
+  mov dword ptr [rbp-540], 6
+  .loc 1 123
+  and dword ptr [rbp-540], 3
+  .loc 1 123
+  movsxd rax, dword ptr [rbp-540]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..75[rip]
+  call assert
+  .loc 1 124
+  mov dword ptr [rbp-536], 6
+  .loc 1 124
+  or dword ptr [rbp-536], 3
+  .loc 1 124
+  movsxd rax, dword ptr [rbp-536]
+  mov rsi, rax
+  mov edi, 7
+  lea rdx, .L..76[rip]
+  call assert
+  .loc 1 125
+  mov dword ptr [rbp-532], 15
+  .loc 1 125
+  xor dword ptr [rbp-532], 5
+  .loc 1 125
+  movsxd rax, dword ptr [rbp-532]
+  mov rsi, rax
+  mov edi, 10
+  lea rdx, .L..77[rip]
+  call assert
+  .loc 1 126
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..78[rip]
+  call assert
+  .loc 1 127
+  mov edi, 8
+  mov esi, 8
+  lea rdx, .L..79[rip]
+  call assert
+  .loc 1 128
+  mov edi, 10
+  mov esi, 10
+  lea rdx, .L..80[rip]
+  call assert
+  .loc 1 129
+  mov edi, 2
+  mov esi, 2
+  lea rdx, .L..81[rip]
+  call assert
+  .loc 1 130
+  mov edi, -1
+  mov esi, -1
+  lea rdx, .L..82[rip]
+  call assert
+  .loc 1 131
+  mov dword ptr [rbp-528], 1
+  .loc 1 131
+  movsxd rax, dword ptr [rbp-528]
+  mov dword ptr [rbp-528], eax
+  .loc 1 131
+  movsxd rax, eax
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..83[rip]
+  call assert
+  .loc 1 132
+  mov dword ptr [rbp-524], 1
+  .loc 1 132
+  movsxd rax, dword ptr [rbp-524]
+  shl eax, 3
+  mov dword ptr [rbp-524], eax
+  .loc 1 132
+  movsxd rax, eax
+  mov rsi, rax
+  mov edi, 8
+  lea rdx, .L..84[rip]
+  call assert
+  .loc 1 133
+  mov dword ptr [rbp-520], 5
+  .loc 1 133
+  movsxd rax, dword ptr [rbp-520]
+  shl eax, 1
+  mov dword ptr [rbp-520], eax
+  .loc 1 133
+  movsxd rax, eax
+  mov rsi, rax
+  mov edi, 10
+  lea rdx, .L..85[rip]
+  call assert
+  .loc 1 134
+  mov dword ptr [rbp-516], 5
+  .loc 1 134
+  movsxd rax, dword ptr [rbp-516]
+  sar eax, 1
+  mov dword ptr [rbp-516], eax
+  .loc 1 134
+  movsxd rax, eax
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..86[rip]
+  call assert
+  .loc 1 135
+  mov edi, -1
+  mov esi, -1
+  lea rdx, .L..87[rip]
+  call assert
+  .loc 1 136
+  mov dword ptr [rbp-512], -1
+  .loc 1 136
+  movsxd rax, dword ptr [rbp-512]
+  mov rsi, rax
+  mov edi, -1
+  lea rdx, .L..88[rip]
+  call assert
+  .loc 1 137
+  mov dword ptr [rbp-508], -1
+  .loc 1 137
+  movsxd rax, dword ptr [rbp-508]
+  sar eax, 1
+  mov dword ptr [rbp-508], eax
+  .loc 1 137
+  movsxd rax, eax
+  mov rsi, rax
+  mov edi, -1
+  lea rdx, .L..89[rip]
+  call assert
+  .loc 1 138
+  mov edi, 2
+  mov esi, 2
+  lea rdx, .L..90[rip]
+  call assert
+  .loc 1 139
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..91[rip]
+  call assert
+  .loc 1 140
+  mov edi, -1
+  mov esi, -1
+  lea rdx, .L..92[rip]
+  call assert
+  .loc 1 141
+  mov edi, -2
+  mov esi, -2
+  lea rdx, .L..93[rip]
+  call assert
+  .loc 1 142
+  mov edi, 4
+  mov esi, 4
+  lea rdx, .L..94[rip]
+  call assert
+  .loc 1 143
+  mov edi, 8
+  mov esi, 8
+  lea rdx, .L..95[rip]
+  call assert
+  .loc 1 144
+  mov edi, -1
+  mov esi, -1
+  lea rdx, .L..96[rip]
+  call assert
+  .loc 1 145
+  mov edi, -1
+  mov esi, -1
+  lea rdx, .L..97[rip]
+  call assert
+  .loc 1 146
+  mov edi, -2
+  mov esi, -2
+  lea rdx, .L..98[rip]
+  call assert
+  .loc 1 147
+  mov edi, -2
+  mov esi, -2
+  lea rdx, .L..99[rip]
+  call assert
+  .loc 1 149
+  mov edi, 36
+  mov esi, 36
+  lea rdx, .L..100[rip]
+  call assert
+  .loc 1 150
+  mov edi, 8
+  mov esi, 8
+  lea rdx, .L..101[rip]
+  call assert
+  .loc 1 151
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..102[rip]
+  call assert
+  .loc 1 152
+  mov edi, -2147483648
+  mov esi, -2147483648
+  lea rdx, .L..103[rip]
+  call assert
+  .loc 1 153
+  mov edi, 44
+  mov esi, 44
+  lea rdx, .L..104[rip]
+  call assert
+  .loc 1 154
+  mov qword ptr [rbp-504], 300
+  .loc 1 154
+  mov rax, qword ptr [rbp-504]
+  movsxd rax, eax
+  mov rsi, rax
+  mov edi, 300
+  lea rdx, .L..105[rip]
+  call assert
+  .loc 1 155
+  mov qword ptr [rbp-496], 300
+  .loc 1 155
+  mov rax, qword ptr [rbp-496]
+  movsx eax, al
+  mov rsi, rax
+  mov edi, 44
+  lea rdx, .L..106[rip]
+  call assert
+  .loc 1 156
+  mov dword ptr [rbp-484], 5
+  .loc 1 156
+  movsxd rax, dword ptr [rbp-484]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..107[rip]
+  call assert
+  .loc 1 157
+  mov dword ptr [rbp-480], 5
+  .loc 1 157
+  movsxd rax, dword ptr [rbp-480]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..108[rip]
+  call assert
+  .loc 1 158
+  mov dword ptr [rbp-476], 5
+  .loc 1 158
+  movsxd rax, dword ptr [rbp-476]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..109[rip]
+  call assert
+  .loc 1 159
+  mov dword ptr [rbp-472], 5
+  .loc 1 159
+  xor eax, eax
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..110[rip]
+  call assert
+  .loc 1 160
+  mov dword ptr [rbp-468], 5
+  .loc 1 160
+  mov eax, 6
+  mov dword ptr [rbp-468], eax
+  mov rsi, rax
+  mov edi, 6
+  lea rdx, .L..111[rip]
+  call assert
+  .loc 1 161
+  mov dword ptr [rbp-464], 5
+  .loc 1 161
+  movsxd rax, dword ptr [rbp-464]
+  add eax, 12
+  sub eax, 15
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..112[rip]
+  call assert
+  .loc 1 162
+  mov dword ptr [rbp-460], 5
+  .loc 1 162
+  movsxd rax, dword ptr [rbp-460]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..113[rip]
+  call assert
+  .loc 1 163
+  mov dword ptr [rbp-456], 2
+  .loc 1 163
+  xor eax, eax
+  cmp eax, dword ptr [rbp-456]
+  setne al
+  movzb rax, al
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..114[rip]
+  call assert
+  .loc 1 164
+  mov dword ptr [rbp-452], 0
+  .loc 1 164
+  xor eax, eax
+  cmp eax, dword ptr [rbp-452]
+  setne al
+  movzb rax, al
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..115[rip]
+  call assert
+  .loc 1 165
+  mov dword ptr [rbp-448], 0
+  .loc 1 165
+  mov eax, 1
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..116[rip]
+  call assert
+  .loc 1 166
+  mov dword ptr [rbp-444], 0
+  .loc 1 166
+  mov eax, 1
+  mov dword ptr [rbp-444], eax
+  test eax, eax
+.L.false.1:
+  mov rax, 0
+.L.end.1:
+  .loc 1 166
+  movsxd rax, dword ptr [rbp-444]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..117[rip]
+  call assert
+  .loc 1 167
+  mov dword ptr [rbp-440], 0
+  .loc 1 167
+  movsxd rax, dword ptr [rbp-440]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..118[rip]
+  call assert
+  .loc 1 168
+  mov dword ptr [rbp-436], 0
+  .loc 1 168
+  mov eax, 1
+  mov dword ptr [rbp-436], eax
+  test eax, eax
+.L.true.2:
+  mov rax, 1
+.L.end.2:
+  .loc 1 168
+  movsxd rax, dword ptr [rbp-436]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..119[rip]
+  call assert
+  .loc 1 169
+  mov dword ptr [rbp-432], 0
+  .loc 1 169
+  mov eax, 7
+  mov dword ptr [rbp-432], eax
+  .loc 1 169
+  mov eax, 3
+  .loc 1 169
+  movsxd rax, dword ptr [rbp-432]
+  mov rsi, rax
+  mov edi, 7
+  lea rdx, .L..120[rip]
+  call assert
+  .loc 1 170
+  mov eax, 1
+  mov dword ptr [rbp-428], eax
+  .loc 1 170
+  mov eax, 2
+  mov dword ptr [rbp-424], eax
+  .loc 1 170
+  mov eax, 3
+  mov dword ptr [rbp-420], eax
+  .loc 1 170
+  add dword ptr [rbp-424], 6
+  .loc 1 170
+  movsxd rax, dword ptr [rbp-424]
+  mov rsi, rax
+  mov edi, 8
+  lea rdx, .L..121[rip]
+  call assert
+  .loc 1 171
+  mov eax, 1
+  mov dword ptr [rbp-416], eax
+  .loc 1 171
+  mov eax, 2
+  mov dword ptr [rbp-412], eax
+  .loc 1 171
+  mov eax, 3
+  mov dword ptr [rbp-408], eax
+  .loc 1 171
+  mov dword ptr [rbp-404], 1
+  .loc 1 171
+  movsxd rax, dword ptr [rbp-404]
+  add dword ptr [rbp+rax*4-416], 6
+  movsxd rax, dword ptr [rbp+rax*4-416]
+  mov rsi, rax
+  mov edi, 8
+  lea rdx, .L..122[rip]
+  call assert
+  .loc 1 172
+  mov eax, 1
+  mov dword ptr [rbp-400], eax
+  .loc 1 172
+  mov eax, 2
+  mov dword ptr [rbp-396], eax
+  .loc 1 172
+  mov eax, 3
+  mov dword ptr [rbp-392], eax
+  .loc 1 172
+  mov dword ptr [rbp-388], 0
+  .loc 1 172
+  movsxd rax, dword ptr [rbp-388]
+  inc dword ptr [rbp+rax*4-400]
+  movsxd rax, dword ptr [rbp+rax*4-400]
+  add eax, -1
+  .loc 1 172
+  movsxd rax, dword ptr [rbp-388]
+  inc dword ptr [rbp+rax*4-400]
+  movsxd rax, dword ptr [rbp+rax*4-400]
+  add eax, -1
+  .loc 1 172
+  movsxd rax, dword ptr [rbp-388]
+  movsxd rax, dword ptr [rbp+rax*4-400]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..123[rip]
+  call assert
+  .loc 1 173
+  mov eax, 1
+  mov dword ptr [rbp-384], eax
+  .loc 1 173
+  mov eax, 2
+  mov dword ptr [rbp-380], eax
+  .loc 1 173
+  mov eax, 3
+  mov dword ptr [rbp-376], eax
+  .loc 1 173
+  mov dword ptr [rbp-372], 0
+  .loc 1 173
+  movsxd rax, dword ptr [rbp-372]
+  inc dword ptr [rbp+rax*4-384]
+  movsxd rax, dword ptr [rbp+rax*4-384]
+  add eax, -1
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..124[rip]
+  call assert
+  .loc 1 174
+  mov eax, 1
+  mov dword ptr [rbp-368], eax
+  .loc 1 174
+  mov eax, 2
+  mov dword ptr [rbp-364], eax
+  .loc 1 174
+  mov eax, 3
+  mov dword ptr [rbp-360], eax
+  .loc 1 174
+  mov dword ptr [rbp-356], 0
+  .loc 1 174
+  movsxd rax, dword ptr [rbp-356]
+  dec dword ptr [rbp+rax*4-368]
+  movsxd rax, dword ptr [rbp+rax*4-368]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..125[rip]
+  call assert
+  .loc 1 175
+  mov byte ptr [rbp-351], 0
+  .loc 1 175
+  mov eax, 127
+  mov byte ptr [rbp-352], al
+  .loc 1 175
+  xor eax, eax
+  mov word ptr [rbp-350], ax
+  .loc 1 175
+  inc byte ptr [rbp-352]
+  movsx eax, byte ptr [rbp-352]
+  add eax, -1
+  movsx eax, al
+  .loc 1 175
+  movsx eax, byte ptr [rbp-352]
+  mov rsi, rax
+  mov edi, -128
+  lea rdx, .L..126[rip]
+  call assert
+  .loc 1 176
+  mov byte ptr [rbp-347], 0
+  .loc 1 176
+  xor eax, eax
+  mov byte ptr [rbp-348], al
+  .loc 1 176
+  mov eax, 32767
+  mov word ptr [rbp-346], ax
+  .loc 1 176
+  inc word ptr [rbp-346]
+  movsx eax, word ptr [rbp-346]
+  mov rsi, rax
+  mov edi, -32768
+  lea rdx, .L..127[rip]
+  call assert
+  .loc 1 177
+  mov dword ptr [rbp-340], 0
+  .loc 1 177
+  mov eax, 7
+  mov dword ptr [rbp-344], eax
+  .loc 1 177
+  mov eax, 12
+  mov qword ptr [rbp-336], rax
+  .loc 1 177
+  lea rax, [rbp-344]
+  mov r13, rax
+  .loc 1 177
+  and dword ptr [r13], 6
+  .loc 1 177
+  xor qword ptr [r13+8], 10
+  .loc 1 177
+  movsxd rax, dword ptr [r13]
+  mov rsi, rax
+  mov edi, 6
+  lea rdx, .L..128[rip]
+  call assert
+  .loc 1 178
+  mov dword ptr [rbp-324], 0
+  .loc 1 178
+  mov eax, 7
+  mov dword ptr [rbp-328], eax
+  .loc 1 178
+  mov eax, 12
+  mov qword ptr [rbp-320], rax
+  .loc 1 178
+  lea rax, [rbp-328]
+  mov r12, rax
+  .loc 1 178
+  and dword ptr [r12], 6
+  .loc 1 178
+  xor qword ptr [r12+8], 10
+  .loc 1 178
+  mov rax, qword ptr [r12+8]
+  mov rsi, rax
+  mov edi, 6
+  lea rdx, .L..129[rip]
+  call assert
+  .loc 1 179
+  mov dword ptr gvar[rip], 3
+  .loc 1 179
+  or dword ptr gvar[rip], 8
+  .loc 1 179
+  dec dword ptr gvar[rip]
+  .loc 1 179
+  movsxd rax, dword ptr gvar[rip]
+  mov rsi, rax
+  mov edi, 10
+  lea rdx, .L..130[rip]
+  call assert
+  .loc 1 180
+  xor eax, eax
+  mov dword ptr [rbp-312], eax
+  .loc 1 180
+  mov eax, 1
+  mov dword ptr [rbp-308], eax
+  .loc 1 180
+  mov eax, 2
+  mov dword ptr [rbp-304], eax
+  .loc 1 180
+  mov eax, 3
+  mov dword ptr [rbp-300], eax
+  .loc 1 180
+  lea rax, [rbp-312]
+  mov rbx, rax
+  .loc 1 180
+  add rbx, 8
+  .loc 1 180
+  add rbx, 4
+  mov rax, rbx
+  add rax, -4
+  .loc 1 180
+  movsxd rax, dword ptr [rbx]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..131[rip]
+  call assert
+  .loc 1 181
+  mov eax, -1
+  mov qword ptr [rbp-296], rax
+  .loc 1 181
+  mov rax, 4294967296
+  sub qword ptr [rbp-296], rax
+  .loc 1 181
+  mov rax, qword ptr [rbp-296]
+  mov rsi, rax
+  mov edi, -1
+  lea rdx, .L..132[rip]
+  call assert
+  .loc 1 182
+  mov eax, 1
+  mov dword ptr [rbp-288], eax
+  .loc 1 182
+  mov eax, 2
+  mov dword ptr [rbp-284], eax
+  .loc 1 182
+  mov eax, 3
+  mov dword ptr [rbp-280], eax
+  .loc 1 182
+  mov dword ptr [rbp-276], 0
+  .loc 1 182
+  inc dword ptr [rbp-276]
+  movsxd rax, dword ptr [rbp-276]
+  add eax, -1
+  movsxd rax, eax
+  lea rax, [rbp+rax*4-288]
+  mov qword ptr [rbp-272], rax
+  .loc 1 182
+  inc dword ptr [rax]
+  movsxd rax, dword ptr [rax]
+  .loc 1 182
+  movsxd rax, dword ptr [rbp-276]
+  add eax, dword ptr [rbp-288]
+  sub eax, 1
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..133[rip]
+  call assert
+  .loc 1 183
+  mov byte ptr [rbp-260], -56
+  .loc 1 183
+  movsx eax, byte ptr [rbp-260]
+  cmp eax, 200
+  sete al
+  movzb rax, al
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..134[rip]
+  call assert
+  .loc 1 184
+  mov byte ptr [rbp-259], -56
+  .loc 1 184
+  movsx eax, byte ptr [rbp-259]
+  cmp eax, 200
+  setl al
+  movzb rax, al
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..135[rip]
+  call assert
+  .loc 1 185
+  mov eax, 97
+  mov byte ptr [rbp-258], al
+  .loc 1 185
+  mov eax, 120
+  mov byte ptr [rbp-257], al
+  .loc 1 185
+  xor eax, eax
+  mov byte ptr [rbp-256], al
+  .loc 1 185
+  cmp byte ptr [rbp-257], 120
+  sete al
+  movzb rax, al
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..136[rip]
+  call assert
+  .loc 1 186
+  mov eax, 97
+  mov byte ptr [rbp-255], al
+  .loc 1 186
+  mov eax, -1
+  mov byte ptr [rbp-254], al
+  .loc 1 186
+  xor eax, eax
+  mov byte ptr [rbp-253], al
+  .loc 1 186
+  cmp byte ptr [rbp-254], -1
+  sete al
+  movzb rax, al
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..137[rip]
+  call assert
+  .loc 1 187
+  mov eax, 1
+  mov word ptr [rbp-252], ax
+  .loc 1 187
+  mov eax, -2
+  mov word ptr [rbp-250], ax
+  .loc 1 187
+  movsx eax, ax
+  cmp eax, 65534
+  sete al
+  movzb rax, al
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..138[rip]
+  call assert
+  .loc 1 188
+  mov rax, 4294967296
+  mov qword ptr [rbp-248], rax
+  .loc 1 188
+  mov eax, -1
+  mov r14, rax
+  .loc 1 188
+  mov rax, qword ptr [rbp-248]
+  mov rdi, r14
+  cmp rax, rdi
+  setg al
+  movzb rax, al
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..139[rip]
+  call assert
+  .loc 1 189
+  mov qword ptr [rbp-240], -1
+  .loc 1 189
+  cmp qword ptr [rbp-240], 0
+  setl al
+  movzb rax, al
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..140[rip]
+  call assert
+  .loc 1 190
+  mov qword ptr [rbp-232], -1
+  .loc 1 190
+  mov eax, -1
+  mov r14, rax
+  .loc 1 190
+  mov rax, 4294967296
+  add rax, qword ptr [rbp-232]
+  mov rdi, r14
+  cmp rax, rdi
+  sete al
+  movzb rax, al
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..141[rip]
+  call assert
+  .loc 1 191
+  mov rax, 4294967297
+  mov qword ptr [rbp-224], rax
+  .loc 1 191
+  cmp dword ptr [rbp-224], 1
+  sete al
+  movzb rax, al
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..142[rip]
+  call assert
+  .loc 1 192
+  mov dword ptr [rbp-212], 7
+  .loc 1 192
+  cmp dword ptr [rbp-212], 10
+  setl al
+  movzb rax, al
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..143[rip]
+  call assert
+  .loc 1 193
+  mov dword ptr [rbp-208], 7
+  .loc 1 193
+  cmp dword ptr [rbp-208], 7
+  setg al
+  movzb rax, al
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..144[rip]
+  call assert
+  .loc 1 194
+  mov dword ptr [rbp-204], 7
+  .loc 1 194
+  movsxd rax, dword ptr [rbp-204]
+  lea eax, [rax+rax*2]
+  mov rsi, rax
+  mov edi, 21
+  lea rdx, .L..145[rip]
+  call assert
+  .loc 1 195
+  mov qword ptr [rbp-200], 7
+  .loc 1 195
+  mov rax, qword ptr [rbp-200]
+  imul rax, rax, -3
+  mov rsi, rax
+  mov edi, -21
+  lea rdx, .L..146[rip]
+  call assert
+  .loc 1 196
+  mov dword ptr gvar[rip], 2
+  .loc 1 196
+  mov dword ptr [rbp-192], 7
+  .loc 1 196
+  movsxd rax, dword ptr [rbp-192]
+  cdq
+  idiv dword ptr gvar[rip]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..147[rip]
+  call assert
+  .loc 1 197
+  mov dword ptr gvar[rip], 2
+  .loc 1 197
+  mov dword ptr [rbp-188], 7
+  .loc 1 197
+  movsxd rax, dword ptr [rbp-188]
+  cdq
+  idiv dword ptr gvar[rip]
+  mov rax, rdx
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..148[rip]
+  call assert
+  .loc 1 198
+  mov qword ptr [rbp-184], 1
+  .loc 1 198
+  mov rax, 8589934592
+  mov r14, rax
+  .loc 1 198
+  mov rax, qword ptr [rbp-184]
+  shl rax, 33
+  mov rdi, r14
+  cmp rax, rdi
+  sete al
+  movzb rax, al
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..149[rip]
+  call assert
+  .loc 1 199
+  mov qword ptr [rbp-176], -8
+  .loc 1 199
+  mov rax, qword ptr [rbp-176]
+  sar rax, 2
+  mov rsi, rax
+  mov edi, -2
+  lea rdx, .L..150[rip]
+  call assert
+  .loc 1 200
+  mov dword ptr gvar[rip], 3
+  .loc 1 200
+  mov dword ptr [rbp-164], 2
+  .loc 1 200
+  movsxd rax, dword ptr gvar[rip]
+  add eax, dword ptr [rbp-164]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..151[rip]
+  call assert
+  .loc 1 201
+  mov qword ptr [rbp-160], -9
+  .loc 1 201
+  mov rax, qword ptr [rbp-160]
+  lea rax, [rax+rax*4]
+  mov rsi, rax
+  mov edi, -45
+  lea rdx, .L..152[rip]
+  call assert
+  .loc 1 202
+  mov dword ptr [rbp-148], -7
+  .loc 1 202
+  movsxd rax, dword ptr [rbp-148]
+  lea eax, [rax+rax*4]
+  mov rsi, rax
+  mov edi, -35
+  lea rdx, .L..153[rip]
+  call assert
+  .loc 1 203
+  mov dword ptr [rbp-144], 7
+  .loc 1 203
+  movsxd rax, dword ptr [rbp-144]
+  lea eax, [rax+rax*8]
+  mov rsi, rax
+  mov edi, 63
+  lea rdx, .L..154[rip]
+  call assert
+  .loc 1 204
+  mov dword ptr [rbp-140], 7
+  .loc 1 204
+  movsxd rax, dword ptr [rbp-140]
+  shl eax, 3
+  mov rsi, rax
+  mov edi, 56
+  lea rdx, .L..155[rip]
+  call assert
+  .loc 1 205
+  mov dword ptr [rbp-136], 7
+  .loc 1 205
+  movsxd rax, dword ptr [rbp-136]
+  imul eax, eax, -8
+  mov rsi, rax
+  mov edi, -56
+  lea rdx, .L..156[rip]
+  call assert
+  .loc 1 206
+  mov dword ptr [rbp-132], 7
+  .loc 1 206
+  movsxd rax, dword ptr [rbp-132]
+  imul eax, eax, 12
+  mov rsi, rax
+  mov edi, 84
+  lea rdx, .L..157[rip]
+  call assert
+  .loc 1 207
+  mov qword ptr [rbp-128], 3
+  .loc 1 207
+  mov eax, -1073741824
+  mov r14, rax
+  .loc 1 207
+  mov rax, qword ptr [rbp-128]
+  shl rax, 30
+  mov rdi, r14
+  cmp rax, rdi
+  sete al
+  movzb rax, al
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..158[rip]
+  call assert
+  .loc 1 208
+  mov dword ptr [rbp-116], -7
+  .loc 1 208
+  movsxd rax, dword ptr [rbp-116]
+  lea edx, [rax+1]
+  test eax, eax
+  cmovs eax, edx
+  sar eax, 1
+  mov rsi, rax
+  mov edi, -3
+  lea rdx, .L..159[rip]
+  call assert
+  .loc 1 209
+  mov dword ptr [rbp-112], -7
+  .loc 1 209
+  movsxd rax, dword ptr [rbp-112]
+  lea edx, [rax+1]
+  test eax, eax
+  cmovns edx, eax
+  and edx, -2
+  sub eax, edx
+  mov rsi, rax
+  mov edi, -1
+  lea rdx, .L..160[rip]
+  call assert
+  .loc 1 210
+  mov dword ptr [rbp-108], 7
+  .loc 1 210
+  movsxd rax, dword ptr [rbp-108]
+  lea edx, [rax+1]
+  test eax, eax
+  cmovs eax, edx
+  sar eax, 1
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..161[rip]
+  call assert
+  .loc 1 211
+  mov dword ptr [rbp-104], -39
+  .loc 1 211
+  movsxd rax, dword ptr [rbp-104]
+  lea edx, [rax+7]
+  test eax, eax
+  cmovs eax, edx
+  sar eax, 3
+  mov rsi, rax
+  mov edi, -4
+  lea rdx, .L..162[rip]
+  call assert
+  .loc 1 212
+  mov dword ptr [rbp-100], -39
+  .loc 1 212
+  movsxd rax, dword ptr [rbp-100]
+  lea edx, [rax+7]
+  test eax, eax
+  cmovns edx, eax
+  and edx, -8
+  sub eax, edx
+  mov rsi, rax
+  mov edi, -7
+  lea rdx, .L..163[rip]
+  call assert
+  .loc 1 213
+  mov dword ptr [rbp-96], -39
+  .loc 1 213
+  movsxd rax, dword ptr [rbp-96]
+  lea edx, [rax+7]
+  test eax, eax
+  cmovs eax, edx
+  sar eax, 3
+  neg eax
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..164[rip]
+  call assert
+  .loc 1 214
+  mov dword ptr [rbp-92], -39
+  .loc 1 214
+  movsxd rax, dword ptr [rbp-92]
+  lea edx, [rax+7]
+  test eax, eax
+  cmovns edx, eax
+  and edx, -8
+  sub eax, edx
+  mov rsi, rax
+  mov edi, -7
+  lea rdx, .L..165[rip]
+  call assert
+  .loc 1 215
+  mov dword ptr [rbp-88], -39
+  .loc 1 215
+  movsxd rax, dword ptr [rbp-88]
+  movsxd rdx, eax
+  mov rcx, 2863311531
+  imul rcx, rdx
+  sar rcx, 33
+  shr edx, 31
+  lea eax, [rcx+rdx]
+  mov rsi, rax
+  mov edi, -13
+  lea rdx, .L..166[rip]
+  call assert
+  .loc 1 216
+  mov dword ptr [rbp-84], -39
+  .loc 1 216
+  movsxd rax, dword ptr [rbp-84]
+  movsxd rdx, eax
+  mov edi, eax
+  mov rcx, 2863311531
+  imul rcx, rdx
+  sar rcx, 33
+  shr edx, 31
+  lea eax, [rcx+rdx]
+  imul eax, eax, 3
+  sub edi, eax
+  mov eax, edi
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..167[rip]
+  call assert
+  .loc 1 217
+  mov dword ptr [rbp-80], -39
+  .loc 1 217
+  movsxd rax, dword ptr [rbp-80]
+  movsxd rdx, eax
+  mov rcx, 2454267027
+  imul rcx, rdx
+  sar rcx, 34
+  shr edx, 31
+  lea eax, [rcx+rdx]
+  mov rsi, rax
+  mov edi, -5
+  lea rdx, .L..168[rip]
+  call assert
+  .loc 1 218
+  mov dword ptr [rbp-76], -39
+  .loc 1 218
+  movsxd rax, dword ptr [rbp-76]
+  movsxd rdx, eax
+  mov edi, eax
+  mov rcx, 2454267027
+  imul rcx, rdx
+  sar rcx, 34
+  shr edx, 31
+  lea eax, [rcx+rdx]
+  imul eax, eax, 7
+  sub edi, eax
+  mov eax, edi
+  mov rsi, rax
+  mov edi, -4
+  lea rdx, .L..169[rip]
+  call assert
+  .loc 1 219
+  mov dword ptr [rbp-72], -39
+  .loc 1 219
+  movsxd rax, dword ptr [rbp-72]
+  movsxd rdx, eax
+  mov rcx, 2454267027
+  imul rcx, rdx
+  sar rcx, 34
+  shr edx, 31
+  lea eax, [rcx+rdx]
+  neg eax
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..170[rip]
+  call assert
+  .loc 1 220
+  mov dword ptr [rbp-68], -39
+  .loc 1 220
+  movsxd rax, dword ptr [rbp-68]
+  movsxd rdx, eax
+  mov edi, eax
+  mov rcx, 2454267027
+  imul rcx, rdx
+  sar rcx, 34
+  shr edx, 31
+  lea eax, [rcx+rdx]
+  imul eax, eax, 7
+  sub edi, eax
+  mov eax, edi
+  mov rsi, rax
+  mov edi, -4
+  lea rdx, .L..171[rip]
+  call assert
+  .loc 1 221
+  mov dword ptr [rbp-64], 2147483647
+  .loc 1 221
+  movsxd rax, dword ptr [rbp-64]
+  movsxd rdx, eax
+  mov rcx, 3435973837
+  imul rcx, rdx
+  sar rcx, 35
+  shr edx, 31
+  lea eax, [rcx+rdx]
+  mov rsi, rax
+  mov edi, 214748364
+  lea rdx, .L..172[rip]
+  call assert
+  .loc 1 222
+  mov dword ptr [rbp-60], -2147483648
+  .loc 1 222
+  movsxd rax, dword ptr [rbp-60]
+  movsxd rdx, eax
+  mov rcx, 3435973837
+  imul rcx, rdx
+  sar rcx, 35
+  shr edx, 31
+  lea eax, [rcx+rdx]
+  mov rsi, rax
+  mov edi, -214748364
+  lea rdx, .L..173[rip]
+  call assert
+  .loc 1 223
+  mov dword ptr [rbp-56], -2147483648
+  .loc 1 223
+  movsxd rax, dword ptr [rbp-56]
+  movsxd rdx, eax
+  mov edi, eax
+  mov rcx, 3435973837
+  imul rcx, rdx
+  sar rcx, 35
+  shr edx, 31
+  lea eax, [rcx+rdx]
+  imul eax, eax, 10
+  sub edi, eax
+  mov eax, edi
+  mov rsi, rax
+  mov edi, -8
+  lea rdx, .L..174[rip]
+  call assert
+  .loc 1 224
+  mov dword ptr [rbp-52], 2147483647
+  .loc 1 224
+  movsxd rax, dword ptr [rbp-52]
+  movsxd rdx, eax
+  mov rcx, 2199023256
+  imul rcx, rdx
+  sar rcx, 41
+  shr edx, 31
+  lea eax, [rcx+rdx]
+  mov rsi, rax
+  mov edi, 2147483
+  lea rdx, .L..175[rip]
+  call assert
+  .loc 1 225
+  mov dword ptr [rbp-48], 2147483647
+  .loc 1 225
+  movsxd rax, dword ptr [rbp-48]
+  movsxd rdx, eax
+  mov edi, eax
+  mov rcx, 2199023256
+  imul rcx, rdx
+  sar rcx, 41
+  shr edx, 31
+  lea eax, [rcx+rdx]
+  imul eax, eax, 1000
+  sub edi, eax
+  mov eax, edi
+  mov rsi, rax
+  mov edi, 647
+  lea rdx, .L..176[rip]
+  call assert
+  .loc 1 226
+  mov dword ptr [rbp-44], 2147483647
+  .loc 1 226
+  movsxd rax, dword ptr [rbp-44]
+  movsxd rdx, eax
+  mov rcx, 2147483650
+  imul rcx, rdx
+  sar rcx, 62
+  shr edx, 31
+  lea eax, [rcx+rdx]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..177[rip]
+  call assert
+  .loc 1 227
+  mov rax, -4294967297
+  mov qword ptr [rbp-40], rax
+  .loc 1 227
+  mov rax, 4294967296
+  mov r14, rax
+  .loc 1 227
+  mov rax, qword ptr [rbp-40]
+  mov rdi, r14
+  cqo
+  idiv rdi
+  mov rsi, rax
+  mov edi, -1
+  lea rdx, .L..178[rip]
+  call assert
+  .loc 1 228
+  mov qword ptr [rbp-32], -9
+  .loc 1 228
+  mov rax, qword ptr [rbp-32]
+  lea rdx, [rax+7]
+  test rax, rax
+  cmovs rax, rdx
+  sar rax, 3
+  mov rsi, rax
+  mov edi, -1
+  lea rdx, .L..179[rip]
+  call assert
+  .loc 1 229
+  mov qword ptr [rbp-24], -9
+  .loc 1 229
+  mov rax, qword ptr [rbp-24]
+  lea rdx, [rax+7]
+  test rax, rax
+  cmovns rdx, rax
+  and rdx, -8
+  sub rax, rdx
+  mov rsi, rax
+  mov edi, -1
+  lea rdx, .L..180[rip]
+  call assert
+  .loc 1 230
+  mov qword ptr [rbp-16], -9
+  .loc 1 230
+  mov eax, 3
+  mov r14, rax
+  .loc 1 230
+  mov rax, qword ptr [rbp-16]
+  mov rdi, r14
+  cqo
+  idiv rdi
+  mov rsi, rax
+  mov edi, -3
+  lea rdx, .L..181[rip]
+  call assert
+  .loc 1 231
+  mov qword ptr [rbp-8], -9
+  .loc 1 231
+  mov eax, 7
+  mov r14, rax
+  .loc 1 231
+  mov rax, qword ptr [rbp-8]
+  mov rdi, r14
+  cqo
+  idiv rdi
+  mov rax, rdx
+  mov rsi, rax
+  mov edi, -2
+  lea rdx, .L..182[rip]
+  call assert
+  .loc 1 232
+  lea rdi, .L..183[rip]
+  xor eax, eax
+  call printf
+  .loc 1 233
+  xor eax, eax
+.L.return.main:
+  mov rbx, [rbp-960]
+  mov r12, [rbp-968]
+  mov r13, [rbp-976]
+  mov r14, [rbp-984]
+  mov rsp, rbp
+  pop rbp
+  ret
+  .globl calc_and_assign
+  .text
+calc_and_assign:
+.L.body.calc_and_assign:
+  .loc 1 43
+  inc dword ptr gvar[rip]
+  .loc 1 44
+  lea rax, gvar2[rip]
+.L.return.calc_and_assign:
+  ret
@@ -0,0 +1,250 @@
+.file 1 "-"
+.intel_syntax noprefix
+  .local .L..7
+  .data
+.L..7:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+  .local .L..6
+  .data
+.L..6:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 42
+  .byte 41
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..5
+  .data
+.L..5:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 49
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 38
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..4
+  .data
+.L..4:
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 38
+  .byte 42
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 48
+  .byte 0
+  .local .L..3
+  .data
+.L..3:
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 49
+  .byte 0
+  .local .L..2
+  .data
+.L..2:
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 56
+  .byte 53
+  .byte 57
+  .byte 48
+  .byte 48
+  .byte 54
+  .byte 54
+  .byte 49
+  .byte 55
+  .byte 55
+  .byte 0
+  .local .L..1
+  .data
+.L..1:
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 56
+  .byte 53
+  .byte 57
+  .byte 48
+  .byte 48
+  .byte 54
+  .byte 54
+  .byte 49
+  .byte 55
+  .byte 55
+  .byte 0
+  .local .L..0
+  .data
+.L..0:
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 56
+  .byte 53
+  .byte 57
+  .byte 48
+  .byte 48
+  .byte 54
+  .byte 54
+  .byte 49
+  .byte 55
+  .byte 55
+  .byte 0
+  .globl main
+  .text
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rbx
+.L.body.main:
+  .loc 1 41
+  mov edi, 131585
+  mov esi, 131585
+  lea rdx, .L..0[rip]
+  call assert
+  .loc 1 42
+  mov edi, 513
+  mov esi, 513
+  lea rdx, .L..1[rip]
+  call assert
+  .loc 1 43
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..2[rip]
+  call assert
+  .loc 1 44
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..3[rip]
+  call assert
+  .loc 1 45
+  xor eax, eax
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..4[rip]
+  call assert
+  .loc 1 46
+  mov dword ptr [rbp-8], 512
+  .loc 1 46
+  mov byte ptr [rbp-8], 1
+  .loc 1 46
+  movsxd rax, dword ptr [rbp-8]
+  mov rsi, rax
+  mov edi, 513
+  lea rdx, .L..5[rip]
+  call assert
+  .loc 1 47
+  mov dword ptr [rbp-4], 5
+  .loc 1 47
+  lea rax, [rbp-4]
+  mov rbx, rax
+  .loc 1 47
+  mov rax, rbx
+  movsxd rax, dword ptr [rax]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..6[rip]
+  call assert
+  .loc 1 49
+  lea rdi, .L..7[rip]
+  xor eax, eax
+  call printf
+  .loc 1 50
+  xor eax, eax
+.L.return.main:
+  mov rbx, [rbp-16]
+  mov rsp, rbp
+  pop rbp
+  ret
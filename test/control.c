@@ -4,6 +4,142 @@
  * This is a block comment.
  */
 
+int switch_dense(int x) {
+  switch (x) {
+    case -2: return 10;
+    case -1: return 11;
+    case 0: return 12;
+    case 1: return 13;
+    case 3: return 15;
+    case 4:
+    case 5: return 17;
+    case 7: return 19;
+    default: return -1;
+  }
+}
+
+int switch_sparse(long x) {
+  int r = 0;
+  switch (x) {
+    case -7: r = 1; break;
+    case 1: r = 2; break;
+    case 100: r = 3; break;
+    case 1000: r = 4;
+    case 5000: r = r + 5; break;
+    case 77777: r = 6; break;
+    case 123456: r = 7; break;
+  }
+  return r;
+}
+
+int dead_after_return(int x) {
+  if (x)
+    goto live;
+  return 1;
+  x = 5;
+live:
+  return x + 1;
+  return 100;
+}
+
+int dead_if(int x) {
+  int r = 0;
+  if (0) { r = 10; }
+  if (1) r = r + 1; else r = 20;
+  if (0) {
+  inside:
+    return r + 100;
+  }
+  while (0) r = 30;
+  for (r = r + 2; 0; r++) r = 40;
+  if (x)
+    goto inside;
+  return r;
+}
+
+int dead_switch(int x) {
+  switch (x) {
+    case 0:
+      return 5;
+      x = 9;
+    case 1:
+      x = x + 1;
+      break;
+      x = 10;
+  }
+  return x;
+}
+
+static int loop_lt(int a, int b) {
+  if (a < b)
+    return 1;
+  return 0;
+}
+
+int loop_call_cond(int n) {
+  int i = 0;
+  while (loop_lt(i, n))
+    i++;
+  int j = 0;
+  for (; loop_lt(j, n + 2); j++);
+  return i * 10 + j;
+}
+
+int unroll_sum(int n) {
+  int s = 0;
+  for (int i = 0; i < n; i++)
+    s = s + i;
+  return s;
+}
+
+int unroll_step(int n) {
+  int s = 0;
+  for (int i = 1; i <= n; i = i + 3)
+    s = s * 2 + i;
+  return s;
+}
+
+int unroll_break(int n, int stop) {
+  int i;
+  for (i = 0; i < n; i++)
+    if (i == stop)
+      break;
+  return i;
+}
+
+int unroll_return(int n, int stop) {
+  for (int i = 0; i < n; i++)
+    if (i == stop)
+      return i * 10;
+  return -1;
+}
+
+int unroll_char(int n) {
+  int s = 0;
+  for (char i = 0; i < n; i++)
+    s = s + i;
+  return s;
+}
+
+int unroll_long(long n) {
+  int s = 0;
+  for (int i = 0; i < n; i++)
+    s++;
+  return s;
+}
+
+int unroll_goto(int n) {
+  int s = 0;
+  for (int i = 0; i < n; i++) {
+    if (i == 7)
+      goto out;
+    s = s + 1;
+  }
+  return s;
+out:
+  return s + 100;
+}
+
 int main() {
   ASSERT(3, ({ int x; if (0) x=2; else x=3; x; }));
   ASSERT(3, ({ int x; if (1-1) x=2; else x=3; x; }));
@@ -65,6 +201,93 @@ int main() {
 
   ASSERT(3, ({ int i=0; switch(-1) { case 0xffffffff: i=3; break; } i; }));
 
+  ASSERT(3, ({ int a=1, b=0, c=1, x=0; if (!(a && b) && c) x=3; x; }));
+  ASSERT(0, ({ int a=1, b=1, c=1, x=0; if (!(a && b) && c) x=3; x; }));
+  ASSERT(4, ({ int a=0, b=0, c=1, x=0; if (a || b || c) x=4; x; }));
+  ASSERT(0, ({ int a=0, b=0, c=0, x=0; if (a || b || c) x=4; x; }));
+  ASSERT(5, ({ int a=2, b=3, x=0; if ((a < b && b <= 3) || a == b) x=5; x; }));
+  ASSERT(6, ({ int a=2, b=3, x=0; if (!(a < b) || !(b == 3)) x=1; else x=6; x; }));
+  ASSERT(1, ({ int a=0, x=0; while (!a) { a=1; x++; } x; }));
+  ASSERT(10, ({ int i=0, j=0; for (; i < 10 && j >= 0; i++) j++; j; }));
+  ASSERT(1, ({ long x=4294967296; int y=x; !y; }));
+  ASSERT(2, ({ long x=4294967296; int y=x; y ? 1 : 2; }));
+  ASSERT(1, ({ int a=1, b=2; (a < b) && (b < 3); }));
+  ASSERT(0, ({ int a=1, b=2; (a > b) || (b > 3); }));
+
+  ASSERT(10, switch_dense(-2));
+  ASSERT(11, switch_dense(-1));
+  ASSERT(12, switch_dense(0));
+  ASSERT(13, switch_dense(1));
+  ASSERT(-1, switch_dense(2));
+  ASSERT(15, switch_dense(3));
+  ASSERT(17, switch_dense(4));
+  ASSERT(17, switch_dense(5));
+  ASSERT(-1, switch_dense(6));
+  ASSERT(19, switch_dense(7));
+  ASSERT(-1, switch_dense(8));
+  ASSERT(-1, switch_dense(-3));
+  ASSERT(-1, switch_dense(-2147483647));
+  ASSERT(1, switch_sparse(-7));
+  ASSERT(2, switch_sparse(1));
+  ASSERT(3, switch_sparse(100));
+  ASSERT(9, switch_sparse(1000));
+  ASSERT(5, switch_sparse(5000));
+  ASSERT(6, switch_sparse(77777));
+  ASSERT(7, switch_sparse(123456));
+  ASSERT(0, switch_sparse(2));
+  ASSERT(0, switch_sparse(4294967297));
+
+  ASSERT(7, ({ int i=0; do { i++; } while (i<7); i; }));
+  ASSERT(1, ({ int i=0; do i++; while (0); i; }));
+  ASSERT(4, ({ int i=0, j=0; do { j++; if (j==2) continue; if (j==4) break; i++; } while (j<10); j; }));
+  ASSERT(2, ({ int i=0; do { i++; break; } while (0); i+1; }));
+  ASSERT(3, ({ int i=0; do { if (i==5) break; i++; continue; } while (i<3); i; }));
+  ASSERT(3, ({ int i=0, j=0; do { do { j++; } while (j<2); i++; } while (i<2); j+i-2; }));
+  ASSERT(0, ({ int i=0; while (i>0) i++; i; }));
+  ASSERT(57, loop_call_cond(5));
+  ASSERT(2, loop_call_cond(0));
+  ASSERT(3, ({ int i=0; for (; ({ int k=0; for (int j=0; j<i; j++) k++; k < 3; }); i++); i; }));
+  ASSERT(0, ({ int i=0, n=0; for (; i<n; i++) n=5; n; }));
+  ASSERT(10, ({ int i=0; for (;;) { if (++i == 10) break; } i; }));
+
+  ASSERT(1, dead_after_return(0));
+  ASSERT(4, dead_after_return(3));
+  ASSERT(3, dead_if(0));
+  ASSERT(103, dead_if(1));
+  ASSERT(5, dead_switch(0));
+  ASSERT(2, dead_switch(1));
+  ASSERT(7, dead_switch(7));
+  ASSERT(3, ({ int x=3; x; 1; x; }));
+  ASSERT(2, ({ int x=2; if (0) x=4; x; }));
+
+  ASSERT(10, ({ int s=0; for (int i=0; i<5; i++) s=s+i; s; }));
+  ASSERT(15, ({ int s=0; for (int i=1; i<=5; i++) s=s+i; s; }));
+  ASSERT(0, ({ int s=0; for (int i=5; i<5; i++) s=s+i; s; }));
+  ASSERT(3, ({ int i; for (i=0; i<3; i++); i; }));
+  ASSERT(0, unroll_sum(0));
+  ASSERT(0, unroll_sum(1));
+  ASSERT(1, unroll_sum(2));
+  ASSERT(3, unroll_sum(3));
+  ASSERT(6, unroll_sum(4));
+  ASSERT(10, unroll_sum(5));
+  ASSERT(45, unroll_sum(10));
+  ASSERT(4950, unroll_sum(100));
+  ASSERT(0, unroll_step(0));
+  ASSERT(1, unroll_step(1));
+  ASSERT(6, unroll_step(4));
+  ASSERT(19, unroll_step(7));
+  ASSERT(48, unroll_step(10));
+  ASSERT(5, unroll_break(9, 5));
+  ASSERT(9, unroll_break(9, 20));
+  ASSERT(0, unroll_break(9, 0));
+  ASSERT(60, unroll_return(9, 6));
+  ASSERT(-1, unroll_return(6, 6));
+  ASSERT(45, unroll_char(10));
+  ASSERT(7, unroll_long(7));
+  ASSERT(0, unroll_long(-3));
+  ASSERT(5, unroll_goto(5));
+  ASSERT(107, unroll_goto(9));
+
   printf("OK\n");
   return 0;
 }
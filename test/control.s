@@ -0,0 +1,8204 @@
+.file 1 "-"
+.intel_syntax noprefix
+  .local .L..291
+  .data
+.L..291:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+  .local .L..290
+  .data
+.L..290:
+  .byte 117
+  .byte 110
+  .byte 114
+  .byte 111
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 40
+  .byte 57
+  .byte 41
+  .byte 0
+  .local .L..289
+  .data
+.L..289:
+  .byte 117
+  .byte 110
+  .byte 114
+  .byte 111
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 40
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..288
+  .data
+.L..288:
+  .byte 117
+  .byte 110
+  .byte 114
+  .byte 111
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 40
+  .byte 45
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..287
+  .data
+.L..287:
+  .byte 117
+  .byte 110
+  .byte 114
+  .byte 111
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 40
+  .byte 55
+  .byte 41
+  .byte 0
+  .local .L..286
+  .data
+.L..286:
+  .byte 117
+  .byte 110
+  .byte 114
+  .byte 111
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 40
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..285
+  .data
+.L..285:
+  .byte 117
+  .byte 110
+  .byte 114
+  .byte 111
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 114
+  .byte 101
+  .byte 116
+  .byte 117
+  .byte 114
+  .byte 110
+  .byte 40
+  .byte 54
+  .byte 44
+  .byte 32
+  .byte 54
+  .byte 41
+  .byte 0
+  .local .L..284
+  .data
+.L..284:
+  .byte 117
+  .byte 110
+  .byte 114
+  .byte 111
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 114
+  .byte 101
+  .byte 116
+  .byte 117
+  .byte 114
+  .byte 110
+  .byte 40
+  .byte 57
+  .byte 44
+  .byte 32
+  .byte 54
+  .byte 41
+  .byte 0
+  .local .L..283
+  .data
+.L..283:
+  .byte 117
+  .byte 110
+  .byte 114
+  .byte 111
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 40
+  .byte 57
+  .byte 44
+  .byte 32
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..282
+  .data
+.L..282:
+  .byte 117
+  .byte 110
+  .byte 114
+  .byte 111
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 40
+  .byte 57
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..281
+  .data
+.L..281:
+  .byte 117
+  .byte 110
+  .byte 114
+  .byte 111
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 40
+  .byte 57
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..280
+  .data
+.L..280:
+  .byte 117
+  .byte 110
+  .byte 114
+  .byte 111
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 115
+  .byte 116
+  .byte 101
+  .byte 112
+  .byte 40
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..279
+  .data
+.L..279:
+  .byte 117
+  .byte 110
+  .byte 114
+  .byte 111
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 115
+  .byte 116
+  .byte 101
+  .byte 112
+  .byte 40
+  .byte 55
+  .byte 41
+  .byte 0
+  .local .L..278
+  .data
+.L..278:
+  .byte 117
+  .byte 110
+  .byte 114
+  .byte 111
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 115
+  .byte 116
+  .byte 101
+  .byte 112
+  .byte 40
+  .byte 52
+  .byte 41
+  .byte 0
+  .local .L..277
+  .data
+.L..277:
+  .byte 117
+  .byte 110
+  .byte 114
+  .byte 111
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 115
+  .byte 116
+  .byte 101
+  .byte 112
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 0
+  .local .L..276
+  .data
+.L..276:
+  .byte 117
+  .byte 110
+  .byte 114
+  .byte 111
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 115
+  .byte 116
+  .byte 101
+  .byte 112
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..275
+  .data
+.L..275:
+  .byte 117
+  .byte 110
+  .byte 114
+  .byte 111
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 40
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..274
+  .data
+.L..274:
+  .byte 117
+  .byte 110
+  .byte 114
+  .byte 111
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 40
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..273
+  .data
+.L..273:
+  .byte 117
+  .byte 110
+  .byte 114
+  .byte 111
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 40
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..272
+  .data
+.L..272:
+  .byte 117
+  .byte 110
+  .byte 114
+  .byte 111
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 40
+  .byte 52
+  .byte 41
+  .byte 0
+  .local .L..271
+  .data
+.L..271:
+  .byte 117
+  .byte 110
+  .byte 114
+  .byte 111
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..270
+  .data
+.L..270:
+  .byte 117
+  .byte 110
+  .byte 114
+  .byte 111
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 40
+  .byte 50
+  .byte 41
+  .byte 0
+  .local .L..269
+  .data
+.L..269:
+  .byte 117
+  .byte 110
+  .byte 114
+  .byte 111
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 0
+  .local .L..268
+  .data
+.L..268:
+  .byte 117
+  .byte 110
+  .byte 114
+  .byte 111
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..267
+  .data
+.L..267:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..264
+  .data
+.L..264:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 115
+  .byte 43
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..261
+  .data
+.L..261:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 115
+  .byte 43
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..258
+  .data
+.L..258:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 115
+  .byte 43
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..255
+  .data
+.L..255:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..254
+  .data
+.L..254:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..253
+  .data
+.L..253:
+  .byte 100
+  .byte 101
+  .byte 97
+  .byte 100
+  .byte 95
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 55
+  .byte 41
+  .byte 0
+  .local .L..252
+  .data
+.L..252:
+  .byte 100
+  .byte 101
+  .byte 97
+  .byte 100
+  .byte 95
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 0
+  .local .L..251
+  .data
+.L..251:
+  .byte 100
+  .byte 101
+  .byte 97
+  .byte 100
+  .byte 95
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..250
+  .data
+.L..250:
+  .byte 100
+  .byte 101
+  .byte 97
+  .byte 100
+  .byte 95
+  .byte 105
+  .byte 102
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 0
+  .local .L..249
+  .data
+.L..249:
+  .byte 100
+  .byte 101
+  .byte 97
+  .byte 100
+  .byte 95
+  .byte 105
+  .byte 102
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..248
+  .data
+.L..248:
+  .byte 100
+  .byte 101
+  .byte 97
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 102
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 95
+  .byte 114
+  .byte 101
+  .byte 116
+  .byte 117
+  .byte 114
+  .byte 110
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..247
+  .data
+.L..247:
+  .byte 100
+  .byte 101
+  .byte 97
+  .byte 100
+  .byte 95
+  .byte 97
+  .byte 102
+  .byte 116
+  .byte 101
+  .byte 114
+  .byte 95
+  .byte 114
+  .byte 101
+  .byte 116
+  .byte 117
+  .byte 114
+  .byte 110
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..246
+  .data
+.L..246:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 59
+  .byte 59
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 43
+  .byte 43
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..243
+  .data
+.L..243:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 110
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 110
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 110
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 110
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..240
+  .data
+.L..240:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 107
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 60
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 107
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 107
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..235
+  .data
+.L..235:
+  .byte 108
+  .byte 111
+  .byte 111
+  .byte 112
+  .byte 95
+  .byte 99
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 100
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..234
+  .data
+.L..234:
+  .byte 108
+  .byte 111
+  .byte 111
+  .byte 112
+  .byte 95
+  .byte 99
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 95
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 100
+  .byte 40
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..233
+  .data
+.L..233:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..230
+  .data
+.L..230:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 111
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 100
+  .byte 111
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 106
+  .byte 60
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 105
+  .byte 45
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..225
+  .data
+.L..225:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 111
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 61
+  .byte 61
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 51
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..222
+  .data
+.L..222:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 111
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..219
+  .data
+.L..219:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 111
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 106
+  .byte 61
+  .byte 61
+  .byte 50
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 106
+  .byte 61
+  .byte 61
+  .byte 52
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 106
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..216
+  .data
+.L..216:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 111
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..213
+  .data
+.L..213:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 111
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 55
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..210
+  .data
+.L..210:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 115
+  .byte 112
+  .byte 97
+  .byte 114
+  .byte 115
+  .byte 101
+  .byte 40
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 55
+  .byte 41
+  .byte 0
+  .local .L..209
+  .data
+.L..209:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 115
+  .byte 112
+  .byte 97
+  .byte 114
+  .byte 115
+  .byte 101
+  .byte 40
+  .byte 50
+  .byte 41
+  .byte 0
+  .local .L..208
+  .data
+.L..208:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 115
+  .byte 112
+  .byte 97
+  .byte 114
+  .byte 115
+  .byte 101
+  .byte 40
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 52
+  .byte 53
+  .byte 54
+  .byte 41
+  .byte 0
+  .local .L..207
+  .data
+.L..207:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 115
+  .byte 112
+  .byte 97
+  .byte 114
+  .byte 115
+  .byte 101
+  .byte 40
+  .byte 55
+  .byte 55
+  .byte 55
+  .byte 55
+  .byte 55
+  .byte 41
+  .byte 0
+  .local .L..206
+  .data
+.L..206:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 115
+  .byte 112
+  .byte 97
+  .byte 114
+  .byte 115
+  .byte 101
+  .byte 40
+  .byte 53
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..205
+  .data
+.L..205:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 115
+  .byte 112
+  .byte 97
+  .byte 114
+  .byte 115
+  .byte 101
+  .byte 40
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..204
+  .data
+.L..204:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 115
+  .byte 112
+  .byte 97
+  .byte 114
+  .byte 115
+  .byte 101
+  .byte 40
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..203
+  .data
+.L..203:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 115
+  .byte 112
+  .byte 97
+  .byte 114
+  .byte 115
+  .byte 101
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 0
+  .local .L..202
+  .data
+.L..202:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 115
+  .byte 112
+  .byte 97
+  .byte 114
+  .byte 115
+  .byte 101
+  .byte 40
+  .byte 45
+  .byte 55
+  .byte 41
+  .byte 0
+  .local .L..201
+  .data
+.L..201:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 110
+  .byte 115
+  .byte 101
+  .byte 40
+  .byte 45
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 41
+  .byte 0
+  .local .L..200
+  .data
+.L..200:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 110
+  .byte 115
+  .byte 101
+  .byte 40
+  .byte 45
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..199
+  .data
+.L..199:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 110
+  .byte 115
+  .byte 101
+  .byte 40
+  .byte 56
+  .byte 41
+  .byte 0
+  .local .L..198
+  .data
+.L..198:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 110
+  .byte 115
+  .byte 101
+  .byte 40
+  .byte 55
+  .byte 41
+  .byte 0
+  .local .L..197
+  .data
+.L..197:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 110
+  .byte 115
+  .byte 101
+  .byte 40
+  .byte 54
+  .byte 41
+  .byte 0
+  .local .L..196
+  .data
+.L..196:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 110
+  .byte 115
+  .byte 101
+  .byte 40
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..195
+  .data
+.L..195:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 110
+  .byte 115
+  .byte 101
+  .byte 40
+  .byte 52
+  .byte 41
+  .byte 0
+  .local .L..194
+  .data
+.L..194:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 110
+  .byte 115
+  .byte 101
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..193
+  .data
+.L..193:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 110
+  .byte 115
+  .byte 101
+  .byte 40
+  .byte 50
+  .byte 41
+  .byte 0
+  .local .L..192
+  .data
+.L..192:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 110
+  .byte 115
+  .byte 101
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 0
+  .local .L..191
+  .data
+.L..191:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 110
+  .byte 115
+  .byte 101
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..190
+  .data
+.L..190:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 110
+  .byte 115
+  .byte 101
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 0
+  .local .L..189
+  .data
+.L..189:
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 110
+  .byte 115
+  .byte 101
+  .byte 40
+  .byte 45
+  .byte 50
+  .byte 41
+  .byte 0
+  .local .L..188
+  .data
+.L..188:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 97
+  .byte 32
+  .byte 62
+  .byte 32
+  .byte 98
+  .byte 41
+  .byte 32
+  .byte 124
+  .byte 124
+  .byte 32
+  .byte 40
+  .byte 98
+  .byte 32
+  .byte 62
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..187
+  .data
+.L..187:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 97
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 98
+  .byte 41
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 40
+  .byte 98
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..186
+  .data
+.L..186:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 32
+  .byte 63
+  .byte 32
+  .byte 49
+  .byte 32
+  .byte 58
+  .byte 32
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..185
+  .data
+.L..185:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 33
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..184
+  .data
+.L..184:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 106
+  .byte 32
+  .byte 62
+  .byte 61
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..181
+  .data
+.L..181:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 33
+  .byte 97
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..178
+  .data
+.L..178:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 33
+  .byte 40
+  .byte 97
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 98
+  .byte 41
+  .byte 32
+  .byte 124
+  .byte 124
+  .byte 32
+  .byte 33
+  .byte 40
+  .byte 98
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..177
+  .data
+.L..177:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 40
+  .byte 97
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 98
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 98
+  .byte 32
+  .byte 60
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 124
+  .byte 124
+  .byte 32
+  .byte 97
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 98
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..176
+  .data
+.L..176:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 99
+  .byte 61
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 97
+  .byte 32
+  .byte 124
+  .byte 124
+  .byte 32
+  .byte 98
+  .byte 32
+  .byte 124
+  .byte 124
+  .byte 32
+  .byte 99
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..175
+  .data
+.L..175:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 99
+  .byte 61
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 97
+  .byte 32
+  .byte 124
+  .byte 124
+  .byte 32
+  .byte 98
+  .byte 32
+  .byte 124
+  .byte 124
+  .byte 32
+  .byte 99
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..174
+  .data
+.L..174:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 99
+  .byte 61
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 33
+  .byte 40
+  .byte 97
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 98
+  .byte 41
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 99
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..173
+  .data
+.L..173:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 99
+  .byte 61
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 33
+  .byte 40
+  .byte 97
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 98
+  .byte 41
+  .byte 32
+  .byte 38
+  .byte 38
+  .byte 32
+  .byte 99
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..172
+  .data
+.L..172:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 120
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 102
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..169
+  .data
+.L..169:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..164
+  .data
+.L..164:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..159
+  .data
+.L..159:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..155
+  .data
+.L..155:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..151
+  .data
+.L..151:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..146
+  .data
+.L..146:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 50
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..141
+  .data
+.L..141:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..136
+  .data
+.L..136:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 48
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 49
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 97
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 50
+  .byte 58
+  .byte 105
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..131
+  .data
+.L..131:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 33
+  .byte 105
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..126
+  .data
+.L..126:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..123
+  .data
+.L..123:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..120
+  .data
+.L..120:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 40
+  .byte 59
+  .byte 33
+  .byte 105
+  .byte 59
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 59
+  .byte 106
+  .byte 33
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..115
+  .data
+.L..115:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 59
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..112
+  .data
+.L..112:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 59
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 62
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..109
+  .data
+.L..109:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..104
+  .data
+.L..104:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 40
+  .byte 59
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 59
+  .byte 59
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..99
+  .data
+.L..99:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 32
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..96
+  .data
+.L..96:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 40
+  .byte 59
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 32
+  .byte 98
+  .byte 114
+  .byte 101
+  .byte 97
+  .byte 107
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..93
+  .data
+.L..93:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 58
+  .byte 59
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..91
+  .data
+.L..91:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 104
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..87
+  .data
+.L..87:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..83
+  .data
+.L..83:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 58
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..79
+  .data
+.L..79:
+  .byte 49
+  .byte 38
+  .byte 38
+  .byte 53
+  .byte 0
+  .local .L..78
+  .data
+.L..78:
+  .byte 40
+  .byte 50
+  .byte 45
+  .byte 50
+  .byte 41
+  .byte 38
+  .byte 38
+  .byte 53
+  .byte 0
+  .local .L..77
+  .data
+.L..77:
+  .byte 48
+  .byte 38
+  .byte 38
+  .byte 49
+  .byte 0
+  .local .L..76
+  .data
+.L..76:
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 40
+  .byte 50
+  .byte 45
+  .byte 50
+  .byte 41
+  .byte 0
+  .local .L..75
+  .data
+.L..75:
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 48
+  .byte 0
+  .local .L..74
+  .data
+.L..74:
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 40
+  .byte 50
+  .byte 45
+  .byte 50
+  .byte 41
+  .byte 124
+  .byte 124
+  .byte 53
+  .byte 0
+  .local .L..73
+  .data
+.L..73:
+  .byte 48
+  .byte 124
+  .byte 124
+  .byte 49
+  .byte 0
+  .local .L..72
+  .data
+.L..72:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 106
+  .byte 43
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..69
+  .data
+.L..69:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 106
+  .byte 43
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..66
+  .data
+.L..66:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 106
+  .byte 41
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..65
+  .data
+.L..65:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 106
+  .byte 41
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..64
+  .data
+.L..64:
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..63
+  .data
+.L..63:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 123
+  .byte 106
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..60
+  .data
+.L..60:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..57
+  .data
+.L..57:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 59
+  .byte 59
+  .byte 59
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..56
+  .data
+.L..56:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 50
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..55
+  .data
+.L..55:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 119
+  .byte 104
+  .byte 105
+  .byte 108
+  .byte 101
+  .byte 40
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..52
+  .data
+.L..52:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 61
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 105
+  .byte 43
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 106
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..49
+  .data
+.L..49:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 50
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..48
+  .data
+.L..48:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..47
+  .data
+.L..47:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 49
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..46
+  .data
+.L..46:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 102
+  .byte 32
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 108
+  .byte 115
+  .byte 101
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .globl main
+  .text
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 464
+  mov [rbp-440], rbx
+  mov [rbp-448], r12
+  mov [rbp-456], r13
+.L.body.main:
+  .loc 1 166
+  mov dword ptr [rbp-432], 3
+  .loc 1 166
+  movsxd rax, dword ptr [rbp-432]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..46[rip]
+  call assert
+  .loc 1 167
+  mov dword ptr [rbp-428], 3
+  .loc 1 167
+  movsxd rax, dword ptr [rbp-428]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..47[rip]
+  call assert
+  .loc 1 168
+  mov dword ptr [rbp-424], 2
+  .loc 1 168
+  movsxd rax, dword ptr [rbp-424]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..48[rip]
+  call assert
+  .loc 1 169
+  mov dword ptr [rbp-420], 2
+  .loc 1 169
+  movsxd rax, dword ptr [rbp-420]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..49[rip]
+  call assert
+  .loc 1 170
+  mov dword ptr [rbp-416], 0
+  .loc 1 170
+  mov dword ptr [rbp-412], 0
+  .loc 1 170
+  mov dword ptr [rbp-416], 0
+  .loc 1 170
+  movsxd rax, dword ptr [rbp-416]
+  add eax, dword ptr [rbp-412]
+  mov dword ptr [rbp-412], eax
+  .loc 1 170
+  inc dword ptr [rbp-416]
+  .loc 1 170
+  movsxd rax, dword ptr [rbp-416]
+  add eax, dword ptr [rbp-412]
+  mov dword ptr [rbp-412], eax
+  .loc 1 170
+  inc dword ptr [rbp-416]
+  .loc 1 170
+  movsxd rax, dword ptr [rbp-416]
+  add eax, dword ptr [rbp-412]
+  mov dword ptr [rbp-412], eax
+  .loc 1 170
+  inc dword ptr [rbp-416]
+  .loc 1 170
+  movsxd rax, dword ptr [rbp-416]
+  add eax, dword ptr [rbp-412]
+  mov dword ptr [rbp-412], eax
+  .loc 1 170
+  inc dword ptr [rbp-416]
+  .loc 1 170
+  movsxd rax, dword ptr [rbp-416]
+  add eax, dword ptr [rbp-412]
+  mov dword ptr [rbp-412], eax
+  .loc 1 170
+  inc dword ptr [rbp-416]
+  .loc 1 170
+  movsxd rax, dword ptr [rbp-416]
+  add eax, dword ptr [rbp-412]
+  mov dword ptr [rbp-412], eax
+  .loc 1 170
+  inc dword ptr [rbp-416]
+  .loc 1 170
+  movsxd rax, dword ptr [rbp-416]
+  add eax, dword ptr [rbp-412]
+  mov dword ptr [rbp-412], eax
+  .loc 1 170
+  inc dword ptr [rbp-416]
+  .loc 1 170
+  movsxd rax, dword ptr [rbp-416]
+  add eax, dword ptr [rbp-412]
+  mov dword ptr [rbp-412], eax
+  .loc 1 170
+  inc dword ptr [rbp-416]
+  .loc 1 170
+  movsxd rax, dword ptr [rbp-416]
+  add eax, dword ptr [rbp-412]
+  mov dword ptr [rbp-412], eax
+  .loc 1 170
+  inc dword ptr [rbp-416]
+  .loc 1 170
+  movsxd rax, dword ptr [rbp-416]
+  add eax, dword ptr [rbp-412]
+  mov dword ptr [rbp-412], eax
+  .loc 1 170
+  inc dword ptr [rbp-416]
+  .loc 1 170
+  movsxd rax, dword ptr [rbp-416]
+  add eax, dword ptr [rbp-412]
+  mov dword ptr [rbp-412], eax
+  .loc 1 170
+  inc dword ptr [rbp-416]
+  .loc 1 170
+  movsxd rax, dword ptr [rbp-412]
+  mov rsi, rax
+  mov edi, 55
+  lea rdx, .L..52[rip]
+  call assert
+  .loc 1 171
+  mov dword ptr [rbp-408], 0
+  .loc 1 171
+  cmp dword ptr [rbp-408], 10
+  jge .L..53
+.L.begin.1:
+  .loc 1 171
+  inc dword ptr [rbp-408]
+.L..54:
+.L.cond.1:
+  cmp dword ptr [rbp-408], 10
+  jl .L.begin.1
+.L..53:
+  .loc 1 171
+  movsxd rax, dword ptr [rbp-408]
+  mov rsi, rax
+  mov edi, 10
+  lea rdx, .L..55[rip]
+  call assert
+  .loc 1 172
+  mov eax, 3
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..56[rip]
+  call assert
+  .loc 1 173
+  mov eax, 5
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..57[rip]
+  call assert
+  .loc 1 174
+  mov dword ptr [rbp-404], 0
+  .loc 1 174
+  cmp dword ptr [rbp-404], 10
+  jge .L..58
+.L.begin.2:
+  .loc 1 174
+  inc dword ptr [rbp-404]
+.L..59:
+.L.cond.2:
+  cmp dword ptr [rbp-404], 10
+  jl .L.begin.2
+.L..58:
+  .loc 1 174
+  movsxd rax, dword ptr [rbp-404]
+  mov rsi, rax
+  mov edi, 10
+  lea rdx, .L..60[rip]
+  call assert
+  .loc 1 175
+  mov dword ptr [rbp-400], 0
+  .loc 1 175
+  mov dword ptr [rbp-396], 0
+  .loc 1 175
+  cmp dword ptr [rbp-400], 10
+  jg .L..61
+.L.begin.3:
+  .loc 1 175
+  movsxd rax, dword ptr [rbp-400]
+  add eax, dword ptr [rbp-396]
+  mov dword ptr [rbp-396], eax
+  .loc 1 175
+  inc dword ptr [rbp-400]
+.L..62:
+.L.cond.3:
+  cmp dword ptr [rbp-400], 10
+  jle .L.begin.3
+.L..61:
+  .loc 1 175
+  movsxd rax, dword ptr [rbp-396]
+  mov rsi, rax
+  mov edi, 55
+  lea rdx, .L..63[rip]
+  call assert
+  .loc 1 176
+  mov edi, 3
+  mov esi, 3
+  lea rdx, .L..64[rip]
+  call assert
+  .loc 1 177
+  mov dword ptr [rbp-392], 2
+  .loc 1 177
+  mov dword ptr [rbp-388], 3
+  .loc 1 177
+  mov eax, 5
+  mov dword ptr [rbp-392], eax
+  lea rax, [rbp-388]
+  mov dword ptr [rax], 6
+  .loc 1 177
+  movsxd rax, dword ptr [rbp-392]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..65[rip]
+  call assert
+  .loc 1 178
+  mov dword ptr [rbp-384], 2
+  .loc 1 178
+  mov dword ptr [rbp-380], 3
+  .loc 1 178
+  mov eax, 5
+  mov dword ptr [rbp-384], eax
+  lea rax, [rbp-380]
+  mov dword ptr [rax], 6
+  .loc 1 178
+  movsxd rax, dword ptr [rbp-380]
+  mov rsi, rax
+  mov edi, 6
+  lea rdx, .L..66[rip]
+  call assert
+  .loc 1 179
+  mov dword ptr [rbp-376], 0
+  .loc 1 179
+  mov dword ptr [rbp-372], 0
+  .loc 1 179
+  movsxd rax, dword ptr [rbp-372]
+  add dword ptr [rbp-376], eax
+  .loc 1 179
+  inc dword ptr [rbp-372]
+  .loc 1 179
+  movsxd rax, dword ptr [rbp-372]
+  add dword ptr [rbp-376], eax
+  .loc 1 179
+  inc dword ptr [rbp-372]
+  .loc 1 179
+  movsxd rax, dword ptr [rbp-372]
+  add dword ptr [rbp-376], eax
+  .loc 1 179
+  inc dword ptr [rbp-372]
+  .loc 1 179
+  movsxd rax, dword ptr [rbp-372]
+  add dword ptr [rbp-376], eax
+  .loc 1 179
+  inc dword ptr [rbp-372]
+  .loc 1 179
+  movsxd rax, dword ptr [rbp-372]
+  add dword ptr [rbp-376], eax
+  .loc 1 179
+  inc dword ptr [rbp-372]
+  .loc 1 179
+  movsxd rax, dword ptr [rbp-372]
+  add dword ptr [rbp-376], eax
+  .loc 1 179
+  inc dword ptr [rbp-372]
+  .loc 1 179
+  movsxd rax, dword ptr [rbp-372]
+  add dword ptr [rbp-376], eax
+  .loc 1 179
+  inc dword ptr [rbp-372]
+  .loc 1 179
+  movsxd rax, dword ptr [rbp-372]
+  add dword ptr [rbp-376], eax
+  .loc 1 179
+  inc dword ptr [rbp-372]
+  .loc 1 179
+  movsxd rax, dword ptr [rbp-372]
+  add dword ptr [rbp-376], eax
+  .loc 1 179
+  inc dword ptr [rbp-372]
+  .loc 1 179
+  movsxd rax, dword ptr [rbp-372]
+  add dword ptr [rbp-376], eax
+  .loc 1 179
+  inc dword ptr [rbp-372]
+  .loc 1 179
+  movsxd rax, dword ptr [rbp-372]
+  add dword ptr [rbp-376], eax
+  .loc 1 179
+  inc dword ptr [rbp-372]
+  .loc 1 179
+  movsxd rax, dword ptr [rbp-376]
+  mov rsi, rax
+  mov edi, 55
+  lea rdx, .L..69[rip]
+  call assert
+  .loc 1 180
+  mov dword ptr [rbp-368], 3
+  .loc 1 180
+  mov dword ptr [rbp-364], 0
+  .loc 1 180
+  mov dword ptr [rbp-360], 0
+  .loc 1 180
+  movsxd rax, dword ptr [rbp-360]
+  add dword ptr [rbp-364], eax
+  .loc 1 180
+  inc dword ptr [rbp-360]
+  .loc 1 180
+  movsxd rax, dword ptr [rbp-360]
+  add dword ptr [rbp-364], eax
+  .loc 1 180
+  inc dword ptr [rbp-360]
+  .loc 1 180
+  movsxd rax, dword ptr [rbp-360]
+  add dword ptr [rbp-364], eax
+  .loc 1 180
+  inc dword ptr [rbp-360]
+  .loc 1 180
+  movsxd rax, dword ptr [rbp-360]
+  add dword ptr [rbp-364], eax
+  .loc 1 180
+  inc dword ptr [rbp-360]
+  .loc 1 180
+  movsxd rax, dword ptr [rbp-360]
+  add dword ptr [rbp-364], eax
+  .loc 1 180
+  inc dword ptr [rbp-360]
+  .loc 1 180
+  movsxd rax, dword ptr [rbp-360]
+  add dword ptr [rbp-364], eax
+  .loc 1 180
+  inc dword ptr [rbp-360]
+  .loc 1 180
+  movsxd rax, dword ptr [rbp-360]
+  add dword ptr [rbp-364], eax
+  .loc 1 180
+  inc dword ptr [rbp-360]
+  .loc 1 180
+  movsxd rax, dword ptr [rbp-360]
+  add dword ptr [rbp-364], eax
+  .loc 1 180
+  inc dword ptr [rbp-360]
+  .loc 1 180
+  movsxd rax, dword ptr [rbp-360]
+  add dword ptr [rbp-364], eax
+  .loc 1 180
+  inc dword ptr [rbp-360]
+  .loc 1 180
+  movsxd rax, dword ptr [rbp-360]
+  add dword ptr [rbp-364], eax
+  .loc 1 180
+  inc dword ptr [rbp-360]
+  .loc 1 180
+  movsxd rax, dword ptr [rbp-360]
+  add dword ptr [rbp-364], eax
+  .loc 1 180
+  inc dword ptr [rbp-360]
+  .loc 1 180
+  movsxd rax, dword ptr [rbp-368]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..72[rip]
+  call assert
+  .loc 1 181
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..73[rip]
+  call assert
+  .loc 1 182
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..74[rip]
+  call assert
+  .loc 1 183
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..75[rip]
+  call assert
+  .loc 1 184
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..76[rip]
+  call assert
+  .loc 1 185
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..77[rip]
+  call assert
+  .loc 1 186
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..78[rip]
+  call assert
+  .loc 1 187
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..79[rip]
+  call assert
+  .loc 1 188
+  mov dword ptr [rbp-356], 0
+  .loc 1 188
+.L..80:
+  .loc 1 188
+  inc dword ptr [rbp-356]
+  movsxd rax, dword ptr [rbp-356]
+  add eax, -1
+  .loc 1 188
+.L..81:
+  .loc 1 188
+  inc dword ptr [rbp-356]
+  movsxd rax, dword ptr [rbp-356]
+  add eax, -1
+  .loc 1 188
+.L..82:
+  .loc 1 188
+  inc dword ptr [rbp-356]
+  movsxd rax, dword ptr [rbp-356]
+  add eax, -1
+  .loc 1 188
+  movsxd rax, dword ptr [rbp-356]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..83[rip]
+  call assert
+  .loc 1 189
+  mov dword ptr [rbp-352], 0
+  .loc 1 189
+  jmp .L..85
+.L..84:
+  .loc 1 189
+  inc dword ptr [rbp-352]
+  movsxd rax, dword ptr [rbp-352]
+  add eax, -1
+  .loc 1 189
+.L..85:
+  .loc 1 189
+  inc dword ptr [rbp-352]
+  movsxd rax, dword ptr [rbp-352]
+  add eax, -1
+  .loc 1 189
+.L..86:
+  .loc 1 189
+  inc dword ptr [rbp-352]
+  movsxd rax, dword ptr [rbp-352]
+  add eax, -1
+  .loc 1 189
+  movsxd rax, dword ptr [rbp-352]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..87[rip]
+  call assert
+  .loc 1 190
+  mov dword ptr [rbp-348], 0
+  .loc 1 190
+  jmp .L..90
+.L..88:
+  .loc 1 190
+  inc dword ptr [rbp-348]
+  movsxd rax, dword ptr [rbp-348]
+  add eax, -1
+  .loc 1 190
+.L..89:
+  .loc 1 190
+  inc dword ptr [rbp-348]
+  movsxd rax, dword ptr [rbp-348]
+  add eax, -1
+  .loc 1 190
+.L..90:
+  .loc 1 190
+  inc dword ptr [rbp-348]
+  movsxd rax, dword ptr [rbp-348]
+  add eax, -1
+  .loc 1 190
+  movsxd rax, dword ptr [rbp-348]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..91[rip]
+  call assert
+  .loc 1 191
+.L..92:
+  .loc 1 191
+  mov eax, 1
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..93[rip]
+  call assert
+  .loc 1 192
+  mov dword ptr [rbp-344], 0
+  .loc 1 192
+  cmp dword ptr [rbp-344], 10
+  jge .L..94
+.L.begin.4:
+  .loc 1 192
+  cmp dword ptr [rbp-344], 3
+  je .L..94
+  .loc 1 192
+.L.else.5:
+.L.end.5:
+.L..95:
+  .loc 1 192
+  inc dword ptr [rbp-344]
+  movsxd rax, dword ptr [rbp-344]
+  add eax, -1
+.L.cond.4:
+  cmp dword ptr [rbp-344], 10
+  jl .L.begin.4
+.L..94:
+  .loc 1 192
+  movsxd rax, dword ptr [rbp-344]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..96[rip]
+  call assert
+  .loc 1 193
+  mov dword ptr [rbp-340], 0
+  .loc 1 193
+.L.begin.6:
+  .loc 1 193
+  inc dword ptr [rbp-340]
+  movsxd rax, dword ptr [rbp-340]
+  add eax, -1
+  cmp eax, 3
+  jne .L.begin.6
+  .loc 1 193
+  jmp .L..97
+.L.else.7:
+.L.end.7:
+.L..98:
+.L.cond.6:
+  jmp .L.begin.6
+.L..97:
+  .loc 1 193
+  movsxd rax, dword ptr [rbp-340]
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..99[rip]
+  call assert
+  .loc 1 194
+  mov dword ptr [rbp-336], 0
+  .loc 1 194
+  cmp dword ptr [rbp-336], 10
+  jge .L..100
+.L.begin.8:
+  .loc 1 194
+.L.begin.9:
+  .loc 1 194
+.L..103:
+.L..102:
+  .loc 1 194
+  cmp dword ptr [rbp-336], 3
+  je .L..100
+  .loc 1 194
+.L.else.10:
+.L.end.10:
+.L..101:
+  .loc 1 194
+  inc dword ptr [rbp-336]
+  movsxd rax, dword ptr [rbp-336]
+  add eax, -1
+.L.cond.8:
+  cmp dword ptr [rbp-336], 10
+  jl .L..102
+.L..100:
+  .loc 1 194
+  movsxd rax, dword ptr [rbp-336]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..104[rip]
+  call assert
+  .loc 1 195
+  mov dword ptr [rbp-332], 0
+  .loc 1 195
+.L.begin.11:
+  .loc 1 195
+.L.begin.12:
+  .loc 1 195
+.L..108:
+.L.cond.12:
+.L..107:
+  .loc 1 195
+  inc dword ptr [rbp-332]
+  movsxd rax, dword ptr [rbp-332]
+  add eax, -1
+  cmp eax, 3
+  jne .L..107
+  .loc 1 195
+  jmp .L..105
+.L.else.13:
+.L.end.13:
+.L..106:
+.L.cond.11:
+  jmp .L..107
+.L..105:
+  .loc 1 195
+  movsxd rax, dword ptr [rbp-332]
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..109[rip]
+  call assert
+  .loc 1 196
+  mov dword ptr [rbp-328], 0
+  .loc 1 196
+  mov dword ptr [rbp-324], 0
+  .loc 1 196
+  cmp dword ptr [rbp-328], 10
+  jge .L..110
+.L.begin.14:
+  .loc 1 196
+  cmp dword ptr [rbp-328], 5
+  jg .L..111
+  .loc 1 196
+.L.else.15:
+.L.end.15:
+  .loc 1 196
+  inc dword ptr [rbp-324]
+  movsxd rax, dword ptr [rbp-324]
+  add eax, -1
+.L..111:
+  .loc 1 196
+  inc dword ptr [rbp-328]
+  movsxd rax, dword ptr [rbp-328]
+  add eax, -1
+.L.cond.14:
+  cmp dword ptr [rbp-328], 10
+  jl .L.begin.14
+.L..110:
+  .loc 1 196
+  movsxd rax, dword ptr [rbp-328]
+  mov rsi, rax
+  mov edi, 10
+  lea rdx, .L..112[rip]
+  call assert
+  .loc 1 197
+  mov dword ptr [rbp-320], 0
+  .loc 1 197
+  mov dword ptr [rbp-316], 0
+  .loc 1 197
+  cmp dword ptr [rbp-320], 10
+  jge .L..113
+.L.begin.16:
+  .loc 1 197
+  cmp dword ptr [rbp-320], 5
+  jg .L..114
+  .loc 1 197
+.L.else.17:
+.L.end.17:
+  .loc 1 197
+  inc dword ptr [rbp-316]
+  movsxd rax, dword ptr [rbp-316]
+  add eax, -1
+.L..114:
+  .loc 1 197
+  inc dword ptr [rbp-320]
+  movsxd rax, dword ptr [rbp-320]
+  add eax, -1
+.L.cond.16:
+  cmp dword ptr [rbp-320], 10
+  jl .L.begin.16
+.L..113:
+  .loc 1 197
+  movsxd rax, dword ptr [rbp-316]
+  mov rsi, rax
+  mov edi, 6
+  lea rdx, .L..115[rip]
+  call assert
+  .loc 1 198
+  mov dword ptr [rbp-312], 0
+  .loc 1 198
+  xor eax, eax
+  movsxd r13, eax
+  .loc 1 198
+  movsxd rax, dword ptr [rbp-312]
+  test eax, eax
+  sete al
+  movzx rax, al
+  mov dword ptr [rbp-8], eax
+  .loc 1 198
+  movsxd rax, eax
+  test eax, eax
+  je .L..116
+.L.begin.18:
+  .loc 1 198
+  cmp r13d, 10
+  je .L..116
+.L.begin.19:
+  .loc 1 198
+.L..119:
+  .loc 1 198
+  add r13d, 1
+  movsxd r13, r13d
+  mov rax, r13
+  add eax, -1
+.L.cond.19:
+  cmp r13d, 10
+  jne .L.begin.19
+.L..118:
+  .loc 1 198
+  jmp .L..116
+.L..117:
+.L.cond.18:
+  .loc 1 198
+  movsxd rax, dword ptr [rbp-8]
+  test eax, eax
+  jne .L.begin.18
+.L..116:
+  .loc 1 198
+  mov rax, r13
+  mov rsi, rax
+  mov edi, 10
+  lea rdx, .L..120[rip]
+  call assert
+  .loc 1 199
+  mov dword ptr [rbp-308], 0
+  .loc 1 199
+  mov dword ptr [rbp-304], 0
+  .loc 1 199
+  inc dword ptr [rbp-308]
+  movsxd rax, dword ptr [rbp-308]
+  add eax, -1
+  cmp eax, 10
+  jge .L..121
+.L.begin.20:
+  .loc 1 199
+  cmp dword ptr [rbp-308], 5
+  jg .L..122
+  .loc 1 199
+.L.else.21:
+.L.end.21:
+  .loc 1 199
+  inc dword ptr [rbp-304]
+  movsxd rax, dword ptr [rbp-304]
+  add eax, -1
+.L..122:
+.L.cond.20:
+  .loc 1 199
+  inc dword ptr [rbp-308]
+  movsxd rax, dword ptr [rbp-308]
+  add eax, -1
+  cmp eax, 10
+  jl .L.begin.20
+.L..121:
+  .loc 1 199
+  movsxd rax, dword ptr [rbp-308]
+  mov rsi, rax
+  mov edi, 11
+  lea rdx, .L..123[rip]
+  call assert
+  .loc 1 200
+  mov dword ptr [rbp-300], 0
+  .loc 1 200
+  mov dword ptr [rbp-296], 0
+  .loc 1 200
+  inc dword ptr [rbp-300]
+  movsxd rax, dword ptr [rbp-300]
+  add eax, -1
+  cmp eax, 10
+  jge .L..124
+.L.begin.22:
+  .loc 1 200
+  cmp dword ptr [rbp-300], 5
+  jg .L..125
+  .loc 1 200
+.L.else.23:
+.L.end.23:
+  .loc 1 200
+  inc dword ptr [rbp-296]
+  movsxd rax, dword ptr [rbp-296]
+  add eax, -1
+.L..125:
+.L.cond.22:
+  .loc 1 200
+  inc dword ptr [rbp-300]
+  movsxd rax, dword ptr [rbp-300]
+  add eax, -1
+  cmp eax, 10
+  jl .L.begin.22
+.L..124:
+  .loc 1 200
+  movsxd rax, dword ptr [rbp-296]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..126[rip]
+  call assert
+  .loc 1 201
+  mov dword ptr [rbp-292], 0
+  .loc 1 201
+  mov dword ptr [rbp-288], 0
+  .loc 1 201
+  movsxd rax, dword ptr [rbp-292]
+  test eax, eax
+  sete al
+  movzx rax, al
+  mov dword ptr [rbp-4], eax
+  .loc 1 201
+  movsxd rax, eax
+  test eax, eax
+  je .L..127
+.L.begin.24:
+  .loc 1 201
+  inc dword ptr [rbp-288]
+  movsxd rax, dword ptr [rbp-288]
+  add eax, -1
+  cmp eax, 10
+  je .L..127
+.L.begin.25:
+  .loc 1 201
+.L..130:
+.L.cond.25:
+  .loc 1 201
+  inc dword ptr [rbp-288]
+  movsxd rax, dword ptr [rbp-288]
+  add eax, -1
+  cmp eax, 10
+  jne .L.begin.25
+.L..129:
+  .loc 1 201
+  jmp .L..127
+.L..128:
+.L.cond.24:
+  .loc 1 201
+  movsxd rax, dword ptr [rbp-4]
+  test eax, eax
+  jne .L.begin.24
+.L..127:
+  .loc 1 201
+  movsxd rax, dword ptr [rbp-288]
+  mov rsi, rax
+  mov edi, 11
+  lea rdx, .L..131[rip]
+  call assert
+  .loc 1 202
+  mov dword ptr [rbp-284], 0
+  .loc 1 202
+  xor eax, eax
+  cmp eax, 0
+  je .L..133
+  cmp eax, 1
+  je .L..134
+  cmp eax, 2
+  je .L..135
+  jmp .L..132
+.L..133:
+  .loc 1 202
+  mov dword ptr [rbp-284], 5
+  .loc 1 202
+  jmp .L..132
+.L..134:
+  .loc 1 202
+  mov dword ptr [rbp-284], 6
+  .loc 1 202
+  jmp .L..132
+.L..135:
+  .loc 1 202
+  mov dword ptr [rbp-284], 7
+  .loc 1 202
+.L..132:
+  .loc 1 202
+  movsxd rax, dword ptr [rbp-284]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..136[rip]
+  call assert
+  .loc 1 203
+  mov dword ptr [rbp-280], 0
+  .loc 1 203
+  mov eax, 1
+  cmp eax, 0
+  je .L..138
+  cmp eax, 1
+  je .L..139
+  cmp eax, 2
+  je .L..140
+  jmp .L..137
+.L..138:
+  .loc 1 203
+  mov dword ptr [rbp-280], 5
+  .loc 1 203
+  jmp .L..137
+.L..139:
+  .loc 1 203
+  mov dword ptr [rbp-280], 6
+  .loc 1 203
+  jmp .L..137
+.L..140:
+  .loc 1 203
+  mov dword ptr [rbp-280], 7
+  .loc 1 203
+.L..137:
+  .loc 1 203
+  movsxd rax, dword ptr [rbp-280]
+  mov rsi, rax
+  mov edi, 6
+  lea rdx, .L..141[rip]
+  call assert
+  .loc 1 204
+  mov dword ptr [rbp-276], 0
+  .loc 1 204
+  mov eax, 2
+  cmp eax, 0
+  je .L..143
+  cmp eax, 1
+  je .L..144
+  cmp eax, 2
+  je .L..145
+  jmp .L..142
+.L..143:
+  .loc 1 204
+  mov dword ptr [rbp-276], 5
+  .loc 1 204
+  jmp .L..142
+.L..144:
+  .loc 1 204
+  mov dword ptr [rbp-276], 6
+  .loc 1 204
+  jmp .L..142
+.L..145:
+  .loc 1 204
+  mov dword ptr [rbp-276], 7
+  .loc 1 204
+.L..142:
+  .loc 1 204
+  movsxd rax, dword ptr [rbp-276]
+  mov rsi, rax
+  mov edi, 7
+  lea rdx, .L..146[rip]
+  call assert
+  .loc 1 205
+  mov dword ptr [rbp-272], 0
+  .loc 1 205
+  mov eax, 3
+  cmp eax, 0
+  je .L..148
+  cmp eax, 1
+  je .L..149
+  cmp eax, 2
+  je .L..150
+  jmp .L..147
+.L..148:
+  .loc 1 205
+  mov dword ptr [rbp-272], 5
+  .loc 1 205
+  jmp .L..147
+.L..149:
+  .loc 1 205
+  mov dword ptr [rbp-272], 6
+  .loc 1 205
+  jmp .L..147
+.L..150:
+  .loc 1 205
+  mov dword ptr [rbp-272], 7
+  .loc 1 205
+.L..147:
+  .loc 1 205
+  movsxd rax, dword ptr [rbp-272]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..151[rip]
+  call assert
+  .loc 1 206
+  mov dword ptr [rbp-268], 0
+  .loc 1 206
+  xor eax, eax
+  cmp eax, 0
+  jne .L..154
+  .loc 1 206
+.L..153:
+  .loc 1 206
+  mov dword ptr [rbp-268], 5
+  .loc 1 206
+  jmp .L..152
+.L..154:
+  .loc 1 206
+  mov dword ptr [rbp-268], 7
+.L..152:
+  .loc 1 206
+  movsxd rax, dword ptr [rbp-268]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..155[rip]
+  call assert
+  .loc 1 207
+  mov dword ptr [rbp-264], 0
+  .loc 1 207
+  mov eax, 1
+  cmp eax, 0
+  jne .L..158
+  .loc 1 207
+.L..157:
+  .loc 1 207
+  mov dword ptr [rbp-264], 5
+  .loc 1 207
+  jmp .L..156
+.L..158:
+  .loc 1 207
+  mov dword ptr [rbp-264], 7
+.L..156:
+  .loc 1 207
+  movsxd rax, dword ptr [rbp-264]
+  mov rsi, rax
+  mov edi, 7
+  lea rdx, .L..159[rip]
+  call assert
+  .loc 1 208
+  mov dword ptr [rbp-260], 0
+  .loc 1 208
+  mov eax, 1
+  cmp eax, 0
+  je .L..161
+  cmp eax, 1
+  je .L..162
+  cmp eax, 2
+  jne .L..160
+  .loc 1 208
+.L..161:
+  .loc 1 208
+.L..162:
+  .loc 1 208
+.L..163:
+  .loc 1 208
+  mov dword ptr [rbp-260], 2
+.L..160:
+  .loc 1 208
+  movsxd rax, dword ptr [rbp-260]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..164[rip]
+  call assert
+  .loc 1 209
+  mov dword ptr [rbp-256], 0
+  .loc 1 209
+  mov eax, 3
+  cmp eax, 0
+  je .L..166
+  cmp eax, 1
+  je .L..167
+  cmp eax, 2
+  jne .L..165
+  .loc 1 209
+.L..166:
+  .loc 1 209
+.L..167:
+  .loc 1 209
+.L..168:
+  .loc 1 209
+  mov dword ptr [rbp-256], 2
+.L..165:
+  .loc 1 209
+  movsxd rax, dword ptr [rbp-256]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..169[rip]
+  call assert
+  .loc 1 210
+  mov dword ptr [rbp-252], 0
+  .loc 1 210
+  mov eax, -1
+  cmp eax, -1
+  jne .L..170
+  .loc 1 210
+.L..171:
+  .loc 1 210
+  mov dword ptr [rbp-252], 3
+  .loc 1 210
+.L..170:
+  .loc 1 210
+  movsxd rax, dword ptr [rbp-252]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..172[rip]
+  call assert
+  .loc 1 211
+  mov dword ptr [rbp-248], 1
+  .loc 1 211
+  mov dword ptr [rbp-244], 0
+  .loc 1 211
+  mov dword ptr [rbp-240], 1
+  .loc 1 211
+  mov dword ptr [rbp-236], 0
+  .loc 1 211
+  movsxd rax, dword ptr [rbp-248]
+  test eax, eax
+  je .L.skip.27
+  .loc 1 211
+  movsxd rax, dword ptr [rbp-244]
+  test eax, eax
+  jne .L.else.26
+.L.skip.27:
+  .loc 1 211
+  movsxd rax, dword ptr [rbp-240]
+  test eax, eax
+  je .L.else.26
+  .loc 1 211
+  mov dword ptr [rbp-236], 3
+.L.else.26:
+.L.end.26:
+  .loc 1 211
+  movsxd rax, dword ptr [rbp-236]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..173[rip]
+  call assert
+  .loc 1 212
+  mov dword ptr [rbp-232], 1
+  .loc 1 212
+  mov dword ptr [rbp-228], 1
+  .loc 1 212
+  mov dword ptr [rbp-224], 1
+  .loc 1 212
+  mov dword ptr [rbp-220], 0
+  .loc 1 212
+  movsxd rax, dword ptr [rbp-232]
+  test eax, eax
+  je .L.skip.29
+  .loc 1 212
+  movsxd rax, dword ptr [rbp-228]
+  test eax, eax
+  jne .L.else.28
+.L.skip.29:
+  .loc 1 212
+  movsxd rax, dword ptr [rbp-224]
+  test eax, eax
+  je .L.else.28
+  .loc 1 212
+  mov dword ptr [rbp-220], 3
+.L.else.28:
+.L.end.28:
+  .loc 1 212
+  movsxd rax, dword ptr [rbp-220]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..174[rip]
+  call assert
+  .loc 1 213
+  mov dword ptr [rbp-216], 0
+  .loc 1 213
+  mov dword ptr [rbp-212], 0
+  .loc 1 213
+  mov dword ptr [rbp-208], 1
+  .loc 1 213
+  mov dword ptr [rbp-204], 0
+  .loc 1 213
+  movsxd rax, dword ptr [rbp-216]
+  test eax, eax
+  jne .L.skip.31
+  .loc 1 213
+  movsxd rax, dword ptr [rbp-212]
+  test eax, eax
+  jne .L.skip.31
+  .loc 1 213
+  movsxd rax, dword ptr [rbp-208]
+  test eax, eax
+  je .L.else.30
+.L.skip.31:
+  .loc 1 213
+  mov dword ptr [rbp-204], 4
+.L.else.30:
+.L.end.30:
+  .loc 1 213
+  movsxd rax, dword ptr [rbp-204]
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..175[rip]
+  call assert
+  .loc 1 214
+  mov dword ptr [rbp-200], 0
+  .loc 1 214
+  mov dword ptr [rbp-196], 0
+  .loc 1 214
+  mov dword ptr [rbp-192], 0
+  .loc 1 214
+  mov dword ptr [rbp-188], 0
+  .loc 1 214
+  movsxd rax, dword ptr [rbp-200]
+  test eax, eax
+  jne .L.skip.33
+  .loc 1 214
+  movsxd rax, dword ptr [rbp-196]
+  test eax, eax
+  jne .L.skip.33
+  .loc 1 214
+  movsxd rax, dword ptr [rbp-192]
+  test eax, eax
+  je .L.else.32
+.L.skip.33:
+  .loc 1 214
+  mov dword ptr [rbp-188], 4
+.L.else.32:
+.L.end.32:
+  .loc 1 214
+  movsxd rax, dword ptr [rbp-188]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..176[rip]
+  call assert
+  .loc 1 215
+  mov dword ptr [rbp-184], 2
+  .loc 1 215
+  mov dword ptr [rbp-180], 3
+  .loc 1 215
+  mov dword ptr [rbp-176], 0
+  .loc 1 215
+  movsxd rax, dword ptr [rbp-184]
+  cmp eax, dword ptr [rbp-180]
+  jge .L.skip.36
+  cmp dword ptr [rbp-180], 3
+  jle .L.skip.35
+.L.skip.36:
+  .loc 1 215
+  movsxd rax, dword ptr [rbp-184]
+  cmp eax, dword ptr [rbp-180]
+  jne .L.else.34
+.L.skip.35:
+  .loc 1 215
+  mov dword ptr [rbp-176], 5
+.L.else.34:
+.L.end.34:
+  .loc 1 215
+  movsxd rax, dword ptr [rbp-176]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..177[rip]
+  call assert
+  .loc 1 216
+  mov dword ptr [rbp-172], 2
+  .loc 1 216
+  mov dword ptr [rbp-168], 3
+  .loc 1 216
+  mov dword ptr [rbp-164], 0
+  .loc 1 216
+  movsxd rax, dword ptr [rbp-172]
+  cmp eax, dword ptr [rbp-168]
+  jge .L.skip.38
+  cmp dword ptr [rbp-168], 3
+  je .L.else.37
+.L.skip.38:
+  .loc 1 216
+  mov dword ptr [rbp-164], 1
+  jmp .L.end.37
+.L.else.37:
+  .loc 1 216
+  mov dword ptr [rbp-164], 6
+.L.end.37:
+  .loc 1 216
+  movsxd rax, dword ptr [rbp-164]
+  mov rsi, rax
+  mov edi, 6
+  lea rdx, .L..178[rip]
+  call assert
+  .loc 1 217
+  mov dword ptr [rbp-160], 0
+  .loc 1 217
+  mov dword ptr [rbp-156], 0
+  .loc 1 217
+  movsxd rax, dword ptr [rbp-160]
+  test eax, eax
+  jne .L..179
+.L.begin.39:
+  .loc 1 217
+  mov dword ptr [rbp-160], 1
+  .loc 1 217
+  inc dword ptr [rbp-156]
+  movsxd rax, dword ptr [rbp-156]
+  add eax, -1
+.L..180:
+.L.cond.39:
+  .loc 1 217
+  movsxd rax, dword ptr [rbp-160]
+  test eax, eax
+  je .L.begin.39
+.L..179:
+  .loc 1 217
+  movsxd rax, dword ptr [rbp-156]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..181[rip]
+  call assert
+  .loc 1 218
+  mov dword ptr [rbp-152], 0
+  .loc 1 218
+  mov dword ptr [rbp-148], 0
+  .loc 1 218
+  cmp dword ptr [rbp-152], 10
+  jge .L..182
+  cmp dword ptr [rbp-148], 0
+  jl .L..182
+.L.begin.40:
+  .loc 1 218
+  inc dword ptr [rbp-148]
+  movsxd rax, dword ptr [rbp-148]
+  add eax, -1
+.L..183:
+  .loc 1 218
+  inc dword ptr [rbp-152]
+  movsxd rax, dword ptr [rbp-152]
+  add eax, -1
+.L.cond.40:
+  cmp dword ptr [rbp-152], 10
+  jge .L.skip.41
+  cmp dword ptr [rbp-148], 0
+  jge .L.begin.40
+.L.skip.41:
+.L..182:
+  .loc 1 218
+  movsxd rax, dword ptr [rbp-148]
+  mov rsi, rax
+  mov edi, 10
+  lea rdx, .L..184[rip]
+  call assert
+  .loc 1 219
+  mov rax, 4294967296
+  mov qword ptr [rbp-144], rax
+  .loc 1 219
+  mov dword ptr [rbp-132], eax
+  .loc 1 219
+  movsxd rax, eax
+  test eax, eax
+  sete al
+  movzx rax, al
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..185[rip]
+  call assert
+  .loc 1 220
+  mov rax, 4294967296
+  mov qword ptr [rbp-128], rax
+  .loc 1 220
+  mov dword ptr [rbp-116], eax
+  .loc 1 220
+  movsxd rax, eax
+  test eax, eax
+  je .L.else.42
+  .loc 1 220
+  mov eax, 1
+  jmp .L.end.42
+.L.else.42:
+  .loc 1 220
+  mov eax, 2
+.L.end.42:
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..186[rip]
+  call assert
+  .loc 1 221
+  mov dword ptr [rbp-112], 1
+  .loc 1 221
+  mov dword ptr [rbp-108], 2
+  .loc 1 221
+  movsxd rax, dword ptr [rbp-112]
+  cmp eax, dword ptr [rbp-108]
+  jge .L.false.43
+  cmp dword ptr [rbp-108], 3
+  jge .L.false.43
+  mov rax, 1
+  jmp .L.end.43
+.L.false.43:
+  mov rax, 0
+.L.end.43:
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..187[rip]
+  call assert
+  .loc 1 222
+  mov dword ptr [rbp-104], 1
+  .loc 1 222
+  mov dword ptr [rbp-100], 2
+  .loc 1 222
+  movsxd rax, dword ptr [rbp-100]
+  cmp eax, dword ptr [rbp-104]
+  jl .L.true.44
+  cmp dword ptr [rbp-100], 3
+  jg .L.true.44
+  mov rax, 0
+  jmp .L.end.44
+.L.true.44:
+  mov rax, 1
+.L.end.44:
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..188[rip]
+  call assert
+  .loc 1 223
+  mov edi, -2
+  call switch_dense
+  mov rsi, rax
+  mov edi, 10
+  lea rdx, .L..189[rip]
+  call assert
+  .loc 1 224
+  mov edi, -1
+  call switch_dense
+  mov rsi, rax
+  mov edi, 11
+  lea rdx, .L..190[rip]
+  call assert
+  .loc 1 225
+  xor edi, edi
+  call switch_dense
+  mov rsi, rax
+  mov edi, 12
+  lea rdx, .L..191[rip]
+  call assert
+  .loc 1 226
+  mov edi, 1
+  call switch_dense
+  mov rsi, rax
+  mov edi, 13
+  lea rdx, .L..192[rip]
+  call assert
+  .loc 1 227
+  mov edi, 2
+  call switch_dense
+  mov rsi, rax
+  mov edi, -1
+  lea rdx, .L..193[rip]
+  call assert
+  .loc 1 228
+  mov edi, 3
+  call switch_dense
+  mov rsi, rax
+  mov edi, 15
+  lea rdx, .L..194[rip]
+  call assert
+  .loc 1 229
+  mov edi, 4
+  call switch_dense
+  mov rsi, rax
+  mov edi, 17
+  lea rdx, .L..195[rip]
+  call assert
+  .loc 1 230
+  mov edi, 5
+  call switch_dense
+  mov rsi, rax
+  mov edi, 17
+  lea rdx, .L..196[rip]
+  call assert
+  .loc 1 231
+  mov edi, 6
+  call switch_dense
+  mov rsi, rax
+  mov edi, -1
+  lea rdx, .L..197[rip]
+  call assert
+  .loc 1 232
+  mov edi, 7
+  call switch_dense
+  mov rsi, rax
+  mov edi, 19
+  lea rdx, .L..198[rip]
+  call assert
+  .loc 1 233
+  mov edi, 8
+  call switch_dense
+  mov rsi, rax
+  mov edi, -1
+  lea rdx, .L..199[rip]
+  call assert
+  .loc 1 234
+  mov edi, -3
+  call switch_dense
+  mov rsi, rax
+  mov edi, -1
+  lea rdx, .L..200[rip]
+  call assert
+  .loc 1 235
+  mov edi, -2147483647
+  call switch_dense
+  mov rsi, rax
+  mov edi, -1
+  lea rdx, .L..201[rip]
+  call assert
+  .loc 1 236
+  mov rdi, -7
+  call switch_sparse
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..202[rip]
+  call assert
+  .loc 1 237
+  mov rdi, 1
+  call switch_sparse
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..203[rip]
+  call assert
+  .loc 1 238
+  mov rdi, 100
+  call switch_sparse
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..204[rip]
+  call assert
+  .loc 1 239
+  mov rdi, 1000
+  call switch_sparse
+  mov rsi, rax
+  mov edi, 9
+  lea rdx, .L..205[rip]
+  call assert
+  .loc 1 240
+  mov rdi, 5000
+  call switch_sparse
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..206[rip]
+  call assert
+  .loc 1 241
+  mov rdi, 77777
+  call switch_sparse
+  mov rsi, rax
+  mov edi, 6
+  lea rdx, .L..207[rip]
+  call assert
+  .loc 1 242
+  mov rdi, 123456
+  call switch_sparse
+  mov rsi, rax
+  mov edi, 7
+  lea rdx, .L..208[rip]
+  call assert
+  .loc 1 243
+  mov rdi, 2
+  call switch_sparse
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..209[rip]
+  call assert
+  .loc 1 244
+  mov rax, 4294967297
+  mov rdi, rax
+  call switch_sparse
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..210[rip]
+  call assert
+  .loc 1 245
+  mov dword ptr [rbp-96], 0
+  .loc 1 245
+.L.begin.45:
+  .loc 1 245
+  inc dword ptr [rbp-96]
+  movsxd rax, dword ptr [rbp-96]
+  add eax, -1
+.L..212:
+  cmp dword ptr [rbp-96], 7
+  jl .L.begin.45
+.L..211:
+  .loc 1 245
+  movsxd rax, dword ptr [rbp-96]
+  mov rsi, rax
+  mov edi, 7
+  lea rdx, .L..213[rip]
+  call assert
+  .loc 1 246
+  mov dword ptr [rbp-92], 0
+  .loc 1 246
+  inc dword ptr [rbp-92]
+  movsxd rax, dword ptr [rbp-92]
+  add eax, -1
+  .loc 1 246
+  movsxd rax, dword ptr [rbp-92]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..216[rip]
+  call assert
+  .loc 1 247
+  mov dword ptr [rbp-88], 0
+  .loc 1 247
+  mov dword ptr [rbp-84], 0
+  .loc 1 247
+.L.begin.46:
+  .loc 1 247
+  inc dword ptr [rbp-84]
+  movsxd rax, dword ptr [rbp-84]
+  add eax, -1
+  .loc 1 247
+  cmp dword ptr [rbp-84], 2
+  je .L..218
+  .loc 1 247
+.L.else.47:
+.L.end.47:
+  .loc 1 247
+  cmp dword ptr [rbp-84], 4
+  je .L..217
+  .loc 1 247
+.L.else.48:
+.L.end.48:
+  .loc 1 247
+  inc dword ptr [rbp-88]
+  movsxd rax, dword ptr [rbp-88]
+  add eax, -1
+.L..218:
+  cmp dword ptr [rbp-84], 10
+  jl .L.begin.46
+.L..217:
+  .loc 1 247
+  movsxd rax, dword ptr [rbp-84]
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..219[rip]
+  call assert
+  .loc 1 248
+  mov dword ptr [rbp-80], 0
+  .loc 1 248
+.L.begin.49:
+  .loc 1 248
+  inc dword ptr [rbp-80]
+  movsxd rax, dword ptr [rbp-80]
+  add eax, -1
+  .loc 1 248
+.L..221:
+.L..220:
+  .loc 1 248
+  movsxd rax, dword ptr [rbp-80]
+  add eax, 1
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..222[rip]
+  call assert
+  .loc 1 249
+  mov dword ptr [rbp-76], 0
+  .loc 1 249
+.L.begin.50:
+  .loc 1 249
+  cmp dword ptr [rbp-76], 5
+  je .L..223
+  .loc 1 249
+.L.else.51:
+.L.end.51:
+  .loc 1 249
+  inc dword ptr [rbp-76]
+  movsxd rax, dword ptr [rbp-76]
+  add eax, -1
+  .loc 1 249
+.L..224:
+  cmp dword ptr [rbp-76], 3
+  jl .L.begin.50
+.L..223:
+  .loc 1 249
+  movsxd rax, dword ptr [rbp-76]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..225[rip]
+  call assert
+  .loc 1 250
+  mov dword ptr [rbp-72], 0
+  .loc 1 250
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 250
+.L.begin.52:
+  .loc 1 250
+.L.begin.53:
+  .loc 1 250
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  add eax, -1
+.L..229:
+  cmp r12d, 2
+  jl .L.begin.53
+.L..228:
+  .loc 1 250
+  inc dword ptr [rbp-72]
+  movsxd rax, dword ptr [rbp-72]
+  add eax, -1
+.L..227:
+  cmp dword ptr [rbp-72], 2
+  jl .L.begin.52
+.L..226:
+  .loc 1 250
+  mov rax, r12
+  add eax, dword ptr [rbp-72]
+  sub eax, 2
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..230[rip]
+  call assert
+  .loc 1 251
+  mov dword ptr [rbp-68], 0
+  .loc 1 251
+  cmp dword ptr [rbp-68], 0
+  jle .L..231
+.L.begin.54:
+  .loc 1 251
+  inc dword ptr [rbp-68]
+  movsxd rax, dword ptr [rbp-68]
+  add eax, -1
+.L..232:
+.L.cond.54:
+  cmp dword ptr [rbp-68], 0
+  jg .L.begin.54
+.L..231:
+  .loc 1 251
+  movsxd rax, dword ptr [rbp-68]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..233[rip]
+  call assert
+  .loc 1 252
+  mov edi, 5
+  call loop_call_cond
+  mov rsi, rax
+  mov edi, 57
+  lea rdx, .L..234[rip]
+  call assert
+  .loc 1 253
+  xor edi, edi
+  call loop_call_cond
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..235[rip]
+  call assert
+  .loc 1 254
+  mov dword ptr [rbp-64], 0
+  .loc 1 254
+  jmp .L.cond.55
+.L.begin.55:
+  .loc 1 254
+.L..237:
+  .loc 1 254
+  inc dword ptr [rbp-64]
+  movsxd rax, dword ptr [rbp-64]
+  add eax, -1
+.L.cond.55:
+  .loc 1 254
+  mov dword ptr [rbp-60], 0
+  .loc 1 254
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 254
+  mov rax, rbx
+  cmp eax, dword ptr [rbp-64]
+  jge .L..238
+.L.begin.56:
+  .loc 1 254
+  inc dword ptr [rbp-60]
+  movsxd rax, dword ptr [rbp-60]
+  add eax, -1
+.L..239:
+  .loc 1 254
+  add ebx, 1
+  movsxd rbx, ebx
+  mov rax, rbx
+  add eax, -1
+.L.cond.56:
+  .loc 1 254
+  mov rax, rbx
+  cmp eax, dword ptr [rbp-64]
+  jl .L.begin.56
+.L..238:
+  .loc 1 254
+  cmp dword ptr [rbp-60], 3
+  setl al
+  movzb rax, al
+  test eax, eax
+  jne .L.begin.55
+.L..236:
+  .loc 1 254
+  movsxd rax, dword ptr [rbp-64]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..240[rip]
+  call assert
+  .loc 1 255
+  mov dword ptr [rbp-56], 0
+  .loc 1 255
+  mov dword ptr [rbp-52], 0
+  .loc 1 255
+  movsxd rax, dword ptr [rbp-56]
+  cmp eax, dword ptr [rbp-52]
+  jge .L..241
+.L.begin.57:
+  .loc 1 255
+  mov dword ptr [rbp-52], 5
+.L..242:
+  .loc 1 255
+  inc dword ptr [rbp-56]
+  movsxd rax, dword ptr [rbp-56]
+  add eax, -1
+.L.cond.57:
+  .loc 1 255
+  movsxd rax, dword ptr [rbp-56]
+  cmp eax, dword ptr [rbp-52]
+  jl .L.begin.57
+.L..241:
+  .loc 1 255
+  movsxd rax, dword ptr [rbp-52]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..243[rip]
+  call assert
+  .loc 1 256
+  mov dword ptr [rbp-48], 0
+  .loc 1 256
+.L.begin.58:
+  .loc 1 256
+  inc dword ptr [rbp-48]
+  movsxd rax, dword ptr [rbp-48]
+  cmp eax, 10
+  jne .L.begin.58
+  .loc 1 256
+  jmp .L..244
+.L.else.59:
+.L.end.59:
+.L..245:
+  jmp .L.begin.58
+.L..244:
+  .loc 1 256
+  movsxd rax, dword ptr [rbp-48]
+  mov rsi, rax
+  mov edi, 10
+  lea rdx, .L..246[rip]
+  call assert
+  .loc 1 257
+  xor edi, edi
+  call dead_after_return
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..247[rip]
+  call assert
+  .loc 1 258
+  mov edi, 3
+  call dead_after_return
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..248[rip]
+  call assert
+  .loc 1 259
+  xor edi, edi
+  call dead_if
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..249[rip]
+  call assert
+  .loc 1 260
+  mov edi, 1
+  call dead_if
+  mov rsi, rax
+  mov edi, 103
+  lea rdx, .L..250[rip]
+  call assert
+  .loc 1 261
+  xor edi, edi
+  call dead_switch
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..251[rip]
+  call assert
+  .loc 1 262
+  mov edi, 1
+  call dead_switch
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..252[rip]
+  call assert
+  .loc 1 263
+  mov edi, 7
+  call dead_switch
+  mov rsi, rax
+  mov edi, 7
+  lea rdx, .L..253[rip]
+  call assert
+  .loc 1 264
+  mov dword ptr [rbp-44], 3
+  .loc 1 264
+  movsxd rax, dword ptr [rbp-44]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..254[rip]
+  call assert
+  .loc 1 265
+  mov dword ptr [rbp-40], 2
+  .loc 1 265
+  movsxd rax, dword ptr [rbp-40]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..255[rip]
+  call assert
+  .loc 1 266
+  mov dword ptr [rbp-36], 0
+  .loc 1 266
+  mov dword ptr [rbp-32], 0
+  cmp dword ptr [rbp-32], 5
+  jge .L..256
+.L.begin.60:
+  .loc 1 266
+  movsxd rax, dword ptr [rbp-32]
+  add dword ptr [rbp-36], eax
+.L..257:
+  .loc 1 266
+  inc dword ptr [rbp-32]
+  movsxd rax, dword ptr [rbp-32]
+  add eax, -1
+.L.cond.60:
+  cmp dword ptr [rbp-32], 5
+  jl .L.begin.60
+.L..256:
+  .loc 1 266
+  movsxd rax, dword ptr [rbp-36]
+  mov rsi, rax
+  mov edi, 10
+  lea rdx, .L..258[rip]
+  call assert
+  .loc 1 267
+  mov dword ptr [rbp-28], 0
+  .loc 1 267
+  mov dword ptr [rbp-24], 1
+  cmp dword ptr [rbp-24], 5
+  jg .L..259
+.L.begin.61:
+  .loc 1 267
+  movsxd rax, dword ptr [rbp-24]
+  add dword ptr [rbp-28], eax
+.L..260:
+  .loc 1 267
+  inc dword ptr [rbp-24]
+  movsxd rax, dword ptr [rbp-24]
+  add eax, -1
+.L.cond.61:
+  cmp dword ptr [rbp-24], 5
+  jle .L.begin.61
+.L..259:
+  .loc 1 267
+  movsxd rax, dword ptr [rbp-28]
+  mov rsi, rax
+  mov edi, 15
+  lea rdx, .L..261[rip]
+  call assert
+  .loc 1 268
+  mov dword ptr [rbp-20], 0
+  .loc 1 268
+  mov dword ptr [rbp-16], 5
+  cmp dword ptr [rbp-16], 5
+  jge .L..262
+.L.begin.62:
+  .loc 1 268
+  movsxd rax, dword ptr [rbp-16]
+  add dword ptr [rbp-20], eax
+.L..263:
+  .loc 1 268
+  inc dword ptr [rbp-16]
+  movsxd rax, dword ptr [rbp-16]
+  add eax, -1
+.L.cond.62:
+  cmp dword ptr [rbp-16], 5
+  jl .L.begin.62
+.L..262:
+  .loc 1 268
+  movsxd rax, dword ptr [rbp-20]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..264[rip]
+  call assert
+  .loc 1 269
+  mov dword ptr [rbp-12], 0
+  cmp dword ptr [rbp-12], 3
+  jge .L..265
+.L.begin.63:
+  .loc 1 269
+.L..266:
+  .loc 1 269
+  inc dword ptr [rbp-12]
+  movsxd rax, dword ptr [rbp-12]
+  add eax, -1
+.L.cond.63:
+  cmp dword ptr [rbp-12], 3
+  jl .L.begin.63
+.L..265:
+  .loc 1 269
+  movsxd rax, dword ptr [rbp-12]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..267[rip]
+  call assert
+  .loc 1 270
+  xor edi, edi
+  call unroll_sum
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..268[rip]
+  call assert
+  .loc 1 271
+  mov edi, 1
+  call unroll_sum
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..269[rip]
+  call assert
+  .loc 1 272
+  mov edi, 2
+  call unroll_sum
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..270[rip]
+  call assert
+  .loc 1 273
+  mov edi, 3
+  call unroll_sum
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..271[rip]
+  call assert
+  .loc 1 274
+  mov edi, 4
+  call unroll_sum
+  mov rsi, rax
+  mov edi, 6
+  lea rdx, .L..272[rip]
+  call assert
+  .loc 1 275
+  mov edi, 5
+  call unroll_sum
+  mov rsi, rax
+  mov edi, 10
+  lea rdx, .L..273[rip]
+  call assert
+  .loc 1 276
+  mov edi, 10
+  call unroll_sum
+  mov rsi, rax
+  mov edi, 45
+  lea rdx, .L..274[rip]
+  call assert
+  .loc 1 277
+  mov edi, 100
+  call unroll_sum
+  mov rsi, rax
+  mov edi, 4950
+  lea rdx, .L..275[rip]
+  call assert
+  .loc 1 278
+  xor edi, edi
+  call unroll_step
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..276[rip]
+  call assert
+  .loc 1 279
+  mov edi, 1
+  call unroll_step
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..277[rip]
+  call assert
+  .loc 1 280
+  mov edi, 4
+  call unroll_step
+  mov rsi, rax
+  mov edi, 6
+  lea rdx, .L..278[rip]
+  call assert
+  .loc 1 281
+  mov edi, 7
+  call unroll_step
+  mov rsi, rax
+  mov edi, 19
+  lea rdx, .L..279[rip]
+  call assert
+  .loc 1 282
+  mov edi, 10
+  call unroll_step
+  mov rsi, rax
+  mov edi, 48
+  lea rdx, .L..280[rip]
+  call assert
+  .loc 1 283
+  mov edi, 9
+  mov esi, 5
+  call unroll_break
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..281[rip]
+  call assert
+  .loc 1 284
+  mov edi, 9
+  mov esi, 20
+  call unroll_break
+  mov rsi, rax
+  mov edi, 9
+  lea rdx, .L..282[rip]
+  call assert
+  .loc 1 285
+  mov edi, 9
+  xor esi, esi
+  call unroll_break
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..283[rip]
+  call assert
+  .loc 1 286
+  mov edi, 9
+  mov esi, 6
+  call unroll_return
+  mov rsi, rax
+  mov edi, 60
+  lea rdx, .L..284[rip]
+  call assert
+  .loc 1 287
+  mov edi, 6
+  mov esi, 6
+  call unroll_return
+  mov rsi, rax
+  mov edi, -1
+  lea rdx, .L..285[rip]
+  call assert
+  .loc 1 288
+  mov edi, 10
+  call unroll_char
+  mov rsi, rax
+  mov edi, 45
+  lea rdx, .L..286[rip]
+  call assert
+  .loc 1 289
+  mov rdi, 7
+  call unroll_long
+  mov rsi, rax
+  mov edi, 7
+  lea rdx, .L..287[rip]
+  call assert
+  .loc 1 290
+  mov rdi, -3
+  call unroll_long
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..288[rip]
+  call assert
+  .loc 1 291
+  mov edi, 5
+  call unroll_goto
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..289[rip]
+  call assert
+  .loc 1 292
+  mov edi, 9
+  call unroll_goto
+  mov rsi, rax
+  mov edi, 107
+  lea rdx, .L..290[rip]
+  call assert
+  .loc 1 293
+  lea rdi, .L..291[rip]
+  xor eax, eax
+  call printf
+  .loc 1 294
+  xor eax, eax
+.L.return.main:
+  mov rbx, [rbp-440]
+  mov r12, [rbp-448]
+  mov r13, [rbp-456]
+  mov rsp, rbp
+  pop rbp
+  ret
+  .globl unroll_goto
+  .text
+unroll_goto:
+  mov [rsp-8], rbx
+  mov [rsp-16], r12
+  mov [rsp-24], r13
+  mov [rsp-32], r14
+  mov [rsp-40], r15
+  movsxd r13, edi
+.L.body.unroll_goto:
+  .loc 1 155
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 156
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 156
+  mov rax, r13
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 156
+  mov eax, 3
+  mov r15, rax
+  .loc 1 156
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.0
+.L.begin.64:
+  .loc 1 157
+  cmp ebx, 7
+  je .L..45
+  .loc 1 158
+.L.else.65:
+.L.end.65:
+  .loc 1 159
+  add r12d, 1
+  movsxd r12, r12d
+  .loc 1 156
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 157
+  cmp ebx, 7
+  je .L..45
+  .loc 1 158
+.L.else.66:
+.L.end.66:
+  .loc 1 159
+  add r12d, 1
+  movsxd r12, r12d
+  .loc 1 156
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 157
+  cmp ebx, 7
+  je .L..45
+  .loc 1 158
+.L.else.67:
+.L.end.67:
+  .loc 1 159
+  add r12d, 1
+  movsxd r12, r12d
+  .loc 1 156
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 157
+  cmp ebx, 7
+  je .L..45
+  .loc 1 158
+.L.else.68:
+.L.end.68:
+  .loc 1 159
+  add r12d, 1
+  movsxd r12, r12d
+.L.opt.1:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.64:
+  .loc 1 156
+  mov rax, r13
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 156
+  mov eax, 3
+  mov r15, rax
+  .loc 1 156
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.64
+.L.opt.0:
+  .loc 1 156
+  mov rax, rbx
+  cmp eax, r13d
+  jge .L..43
+.L.begin.69:
+  .loc 1 157
+  cmp ebx, 7
+  je .L..45
+  .loc 1 158
+.L.else.70:
+.L.end.70:
+  .loc 1 159
+  add r12d, 1
+  movsxd r12, r12d
+.L..44:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.69:
+  .loc 1 156
+  mov rax, rbx
+  cmp eax, r13d
+  jl .L.begin.69
+.L..43:
+  .loc 1 161
+  mov rax, r12
+  jmp .L.return.unroll_goto
+.L..45:
+  .loc 1 163
+  mov rax, r12
+  add eax, 100
+.L.return.unroll_goto:
+  mov rbx, [rsp-8]
+  mov r12, [rsp-16]
+  mov r13, [rsp-24]
+  mov r14, [rsp-32]
+  mov r15, [rsp-40]
+  ret
+  .globl unroll_long
+  .text
+unroll_long:
+  mov [rsp-8], rbx
+  mov [rsp-16], r12
+  mov [rsp-24], r13
+  mov [rsp-32], r14
+  mov [rsp-40], r15
+  mov r13, rdi
+.L.body.unroll_long:
+  .loc 1 149
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 150
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 150
+  mov rax, r13
+  mov r14, rax
+  .loc 1 150
+  mov eax, 3
+  mov r15, rax
+  .loc 1 150
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.2
+.L.begin.71:
+  .loc 1 151
+  add r12d, 1
+  movsxd r12, r12d
+  .loc 1 150
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 151
+  add r12d, 1
+  movsxd r12, r12d
+  .loc 1 150
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 151
+  add r12d, 1
+  movsxd r12, r12d
+  .loc 1 150
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 151
+  add r12d, 1
+  movsxd r12, r12d
+.L.opt.3:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.71:
+  .loc 1 150
+  mov rax, r13
+  mov r14, rax
+  .loc 1 150
+  mov eax, 3
+  mov r15, rax
+  .loc 1 150
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.71
+.L.opt.2:
+  .loc 1 150
+  mov rax, rbx
+  movsxd rax, eax
+  cmp rax, r13
+  jge .L..41
+.L.begin.72:
+  .loc 1 151
+  add r12d, 1
+  movsxd r12, r12d
+.L..42:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.72:
+  .loc 1 150
+  mov rax, rbx
+  movsxd rax, eax
+  cmp rax, r13
+  jl .L.begin.72
+.L..41:
+  .loc 1 152
+  mov rax, r12
+.L.return.unroll_long:
+  mov rbx, [rsp-8]
+  mov r12, [rsp-16]
+  mov r13, [rsp-24]
+  mov r14, [rsp-32]
+  mov r15, [rsp-40]
+  ret
+  .globl unroll_char
+  .text
+unroll_char:
+  mov [rsp-8], rbx
+  mov [rsp-16], r12
+  mov [rsp-24], r13
+  mov [rsp-32], r14
+  mov [rsp-40], r15
+  movsxd r13, edi
+.L.body.unroll_char:
+  .loc 1 143
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 144
+  xor eax, eax
+  movsx ebx, al
+  .loc 1 144
+  mov rax, r13
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 144
+  mov eax, 3
+  mov r15, rax
+  .loc 1 144
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.4
+.L.begin.73:
+  .loc 1 145
+  mov rax, rbx
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 144
+  mov rax, rbx
+  add eax, 1
+  movsx eax, al
+  movsx ebx, al
+  .loc 1 145
+  mov rax, rbx
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 144
+  mov rax, rbx
+  add eax, 1
+  movsx eax, al
+  movsx ebx, al
+  .loc 1 145
+  mov rax, rbx
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 144
+  mov rax, rbx
+  add eax, 1
+  movsx eax, al
+  movsx ebx, al
+  .loc 1 145
+  mov rax, rbx
+  add r12d, eax
+  movsxd r12, r12d
+.L.opt.5:
+  .loc 1 144
+  mov rax, rbx
+  add eax, 1
+  movsx eax, al
+  movsx ebx, al
+.L.cond.73:
+  .loc 1 144
+  mov rax, r13
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 144
+  mov eax, 3
+  mov r15, rax
+  .loc 1 144
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.73
+.L.opt.4:
+  .loc 1 144
+  mov rax, rbx
+  cmp eax, r13d
+  jge .L..39
+.L.begin.74:
+  .loc 1 145
+  mov rax, rbx
+  add r12d, eax
+  movsxd r12, r12d
+.L..40:
+  .loc 1 144
+  mov rax, rbx
+  add eax, 1
+  movsx eax, al
+  movsx ebx, al
+.L.cond.74:
+  .loc 1 144
+  mov rax, rbx
+  cmp eax, r13d
+  jl .L.begin.74
+.L..39:
+  .loc 1 146
+  mov rax, r12
+.L.return.unroll_char:
+  mov rbx, [rsp-8]
+  mov r12, [rsp-16]
+  mov r13, [rsp-24]
+  mov r14, [rsp-32]
+  mov r15, [rsp-40]
+  ret
+  .globl unroll_return
+  .text
+unroll_return:
+  mov [rsp-8], rbx
+  mov [rsp-16], r12
+  mov [rsp-24], r13
+  mov [rsp-32], r14
+  mov [rsp-40], r15
+  movsxd r13, edi
+  movsxd r12, esi
+.L.body.unroll_return:
+  .loc 1 137
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 137
+  mov rax, r13
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 137
+  mov eax, 3
+  mov r15, rax
+  .loc 1 137
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.6
+.L.begin.75:
+  .loc 1 138
+  mov rax, rbx
+  cmp eax, r12d
+  jne .L.else.76
+  .loc 1 139
+  mov rax, rbx
+  imul eax, eax, 10
+  jmp .L.return.unroll_return
+.L.else.76:
+.L.end.76:
+  .loc 1 137
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 138
+  mov rax, rbx
+  cmp eax, r12d
+  jne .L.else.77
+  .loc 1 139
+  mov rax, rbx
+  imul eax, eax, 10
+  jmp .L.return.unroll_return
+.L.else.77:
+.L.end.77:
+  .loc 1 137
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 138
+  mov rax, rbx
+  cmp eax, r12d
+  jne .L.else.78
+  .loc 1 139
+  mov rax, rbx
+  imul eax, eax, 10
+  jmp .L.return.unroll_return
+.L.else.78:
+.L.end.78:
+  .loc 1 137
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 138
+  mov rax, rbx
+  cmp eax, r12d
+  jne .L.else.79
+  .loc 1 139
+  mov rax, rbx
+  imul eax, eax, 10
+  jmp .L.return.unroll_return
+.L.else.79:
+.L.end.79:
+.L.opt.7:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.75:
+  .loc 1 137
+  mov rax, r13
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 137
+  mov eax, 3
+  mov r15, rax
+  .loc 1 137
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.75
+.L.opt.6:
+  .loc 1 137
+  mov rax, rbx
+  cmp eax, r13d
+  jge .L..37
+.L.begin.80:
+  .loc 1 138
+  mov rax, rbx
+  cmp eax, r12d
+  jne .L.else.81
+  .loc 1 139
+  mov rax, rbx
+  imul eax, eax, 10
+  jmp .L.return.unroll_return
+.L.else.81:
+.L.end.81:
+.L..38:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.80:
+  .loc 1 137
+  mov rax, rbx
+  cmp eax, r13d
+  jl .L.begin.80
+.L..37:
+  .loc 1 140
+  mov eax, -1
+.L.return.unroll_return:
+  mov rbx, [rsp-8]
+  mov r12, [rsp-16]
+  mov r13, [rsp-24]
+  mov r14, [rsp-32]
+  mov r15, [rsp-40]
+  ret
+  .globl unroll_break
+  .text
+unroll_break:
+  mov [rsp-8], rbx
+  mov [rsp-16], r12
+  mov [rsp-24], r13
+  mov [rsp-32], r14
+  mov [rsp-40], r15
+  movsxd r13, edi
+  movsxd r12, esi
+.L.body.unroll_break:
+  .loc 1 131
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 131
+  mov rax, r13
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 131
+  mov eax, 3
+  mov r15, rax
+  .loc 1 131
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.8
+.L.begin.82:
+  .loc 1 132
+  mov rax, rbx
+  cmp eax, r12d
+  je .L..35
+  .loc 1 133
+.L.else.83:
+.L.end.83:
+  .loc 1 131
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 132
+  mov rax, rbx
+  cmp eax, r12d
+  je .L..35
+  .loc 1 133
+.L.else.84:
+.L.end.84:
+  .loc 1 131
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 132
+  mov rax, rbx
+  cmp eax, r12d
+  je .L..35
+  .loc 1 133
+.L.else.85:
+.L.end.85:
+  .loc 1 131
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 132
+  mov rax, rbx
+  cmp eax, r12d
+  je .L..35
+  .loc 1 133
+.L.else.86:
+.L.end.86:
+.L.opt.9:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.82:
+  .loc 1 131
+  mov rax, r13
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 131
+  mov eax, 3
+  mov r15, rax
+  .loc 1 131
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.82
+.L.opt.8:
+  .loc 1 131
+  mov rax, rbx
+  cmp eax, r13d
+  jge .L..35
+.L.begin.87:
+  .loc 1 132
+  mov rax, rbx
+  cmp eax, r12d
+  je .L..35
+  .loc 1 133
+.L.else.88:
+.L.end.88:
+.L..36:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.87:
+  .loc 1 131
+  mov rax, rbx
+  cmp eax, r13d
+  jl .L.begin.87
+.L..35:
+  .loc 1 134
+  mov rax, rbx
+.L.return.unroll_break:
+  mov rbx, [rsp-8]
+  mov r12, [rsp-16]
+  mov r13, [rsp-24]
+  mov r14, [rsp-32]
+  mov r15, [rsp-40]
+  ret
+  .globl unroll_step
+  .text
+unroll_step:
+  mov [rsp-8], rbx
+  mov [rsp-16], r12
+  mov [rsp-24], r13
+  mov [rsp-32], r14
+  mov [rsp-40], r15
+  movsxd r13, edi
+.L.body.unroll_step:
+  .loc 1 124
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 125
+  mov eax, 1
+  movsxd rbx, eax
+  .loc 1 125
+  mov rax, r13
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 125
+  mov eax, 9
+  mov r15, rax
+  .loc 1 125
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jg .L.opt.10
+.L.begin.89:
+  .loc 1 126
+  mov rax, r12
+  shl eax, 1
+  add eax, ebx
+  movsxd r12, eax
+  .loc 1 125
+  add ebx, 3
+  movsxd rbx, ebx
+  .loc 1 126
+  mov rax, r12
+  shl eax, 1
+  add eax, ebx
+  movsxd r12, eax
+  .loc 1 125
+  add ebx, 3
+  movsxd rbx, ebx
+  .loc 1 126
+  mov rax, r12
+  shl eax, 1
+  add eax, ebx
+  movsxd r12, eax
+  .loc 1 125
+  add ebx, 3
+  movsxd rbx, ebx
+  .loc 1 126
+  mov rax, r12
+  shl eax, 1
+  add eax, ebx
+  movsxd r12, eax
+.L.opt.11:
+  add ebx, 3
+  movsxd rbx, ebx
+.L.cond.89:
+  .loc 1 125
+  mov rax, r13
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 125
+  mov eax, 9
+  mov r15, rax
+  .loc 1 125
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jle .L.begin.89
+.L.opt.10:
+  .loc 1 125
+  mov rax, rbx
+  cmp eax, r13d
+  jg .L..33
+.L.begin.90:
+  .loc 1 126
+  mov rax, r12
+  shl eax, 1
+  add eax, ebx
+  movsxd r12, eax
+.L..34:
+  add ebx, 3
+  movsxd rbx, ebx
+.L.cond.90:
+  .loc 1 125
+  mov rax, rbx
+  cmp eax, r13d
+  jle .L.begin.90
+.L..33:
+  .loc 1 127
+  mov rax, r12
+.L.return.unroll_step:
+  mov rbx, [rsp-8]
+  mov r12, [rsp-16]
+  mov r13, [rsp-24]
+  mov r14, [rsp-32]
+  mov r15, [rsp-40]
+  ret
+  .globl unroll_sum
+  .text
+unroll_sum:
+  mov [rsp-8], rbx
+  mov [rsp-16], r12
+  mov [rsp-24], r13
+  mov [rsp-32], r14
+  mov [rsp-40], r15
+  movsxd r13, edi
+.L.body.unroll_sum:
+  .loc 1 118
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 119
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 119
+  mov rax, r13
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 119
+  mov eax, 3
+  mov r15, rax
+  .loc 1 119
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.12
+.L.begin.91:
+  .loc 1 120
+  mov rax, rbx
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 119
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 120
+  mov rax, rbx
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 119
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 120
+  mov rax, rbx
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 119
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 120
+  mov rax, rbx
+  add r12d, eax
+  movsxd r12, r12d
+.L.opt.13:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.91:
+  .loc 1 119
+  mov rax, r13
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 119
+  mov eax, 3
+  mov r15, rax
+  .loc 1 119
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.91
+.L.opt.12:
+  .loc 1 119
+  mov rax, rbx
+  cmp eax, r13d
+  jge .L..31
+.L.begin.92:
+  .loc 1 120
+  mov rax, rbx
+  add r12d, eax
+  movsxd r12, r12d
+.L..32:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.92:
+  .loc 1 119
+  mov rax, rbx
+  cmp eax, r13d
+  jl .L.begin.92
+.L..31:
+  .loc 1 121
+  mov rax, r12
+.L.return.unroll_sum:
+  mov rbx, [rsp-8]
+  mov r12, [rsp-16]
+  mov r13, [rsp-24]
+  mov r14, [rsp-32]
+  mov r15, [rsp-40]
+  ret
+  .globl loop_call_cond
+  .text
+loop_call_cond:
+  mov [rsp-32], rbx
+  mov [rsp-40], r12
+  mov [rsp-48], r13
+  mov [rsp-24], edi
+.L.body.loop_call_cond:
+  .loc 1 110
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 111
+  jmp .L.cond.93
+.L.begin.93:
+  .loc 1 112
+  add r12d, 1
+  movsxd r12, r12d
+.L..28:
+.L.cond.93:
+  .loc 1 111
+  mov rax, r12
+  mov dword ptr [rsp-20], eax
+  .loc 1 111
+  movsxd rax, dword ptr [rsp-24]
+  mov dword ptr [rsp-16], eax
+  .loc 1 105
+  movsxd rax, dword ptr [rsp-20]
+  cmp eax, dword ptr [rsp-16]
+  jge .L.else.94
+  .loc 1 106
+  mov dword ptr [rsp-12], 1
+  .loc 1 106
+  jmp .L.opt.14
+.L.else.94:
+.L.end.94:
+  .loc 1 107
+  mov dword ptr [rsp-12], 0
+  .loc 1 111
+.L.opt.14:
+  .loc 1 111
+  movsxd rax, dword ptr [rsp-12]
+  test eax, eax
+  jne .L.begin.93
+.L..27:
+  .loc 1 113
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 114
+  jmp .L.cond.95
+.L.begin.95:
+  .loc 1 114
+.L..30:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.95:
+  .loc 1 114
+  mov rax, rbx
+  mov dword ptr [rsp-8], eax
+  .loc 1 114
+  movsxd rax, dword ptr [rsp-24]
+  add eax, 2
+  mov dword ptr [rsp-4], eax
+  .loc 1 105
+  movsxd rax, dword ptr [rsp-8]
+  cmp eax, dword ptr [rsp-4]
+  jge .L.else.96
+  .loc 1 106
+  mov eax, 1
+  movsxd r13, eax
+  .loc 1 106
+  jmp .L.opt.15
+.L.else.96:
+.L.end.96:
+  .loc 1 107
+  xor eax, eax
+  movsxd r13, eax
+  .loc 1 114
+.L.opt.15:
+  .loc 1 114
+  mov rax, r13
+  test eax, eax
+  jne .L.begin.95
+.L..29:
+  .loc 1 115
+  mov rax, r12
+  imul eax, eax, 10
+  add eax, ebx
+.L.return.loop_call_cond:
+  mov rbx, [rsp-32]
+  mov r12, [rsp-40]
+  mov r13, [rsp-48]
+  ret
+  .globl dead_switch
+  .text
+dead_switch:
+  mov [rsp-8], rbx
+  movsxd rbx, edi
+.L.body.dead_switch:
+  .loc 1 93
+  mov rax, rbx
+  cmp eax, 0
+  je .L..25
+  cmp eax, 1
+  je .L..26
+  jmp .L..24
+.L..25:
+  .loc 1 95
+  mov eax, 5
+  jmp .L.return.dead_switch
+.L..26:
+  .loc 1 98
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 99
+.L..24:
+  .loc 1 102
+  mov rax, rbx
+.L.return.dead_switch:
+  mov rbx, [rsp-8]
+  ret
+  .globl dead_if
+  .text
+dead_if:
+  mov [rsp-8], rbx
+  mov [rsp-16], r12
+  movsxd r12, edi
+.L.body.dead_if:
+  .loc 1 79
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 81
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 82
+  jmp .L.else.97
+.L..19:
+  .loc 1 84
+  mov rax, rbx
+  add eax, 100
+  jmp .L.return.dead_if
+.L.else.97:
+.L.end.97:
+  .loc 1 87
+  add ebx, 2
+  movsxd rbx, ebx
+  .loc 1 88
+  mov rax, r12
+  test eax, eax
+  jne .L..19
+  .loc 1 89
+.L.else.98:
+.L.end.98:
+  .loc 1 90
+  mov rax, rbx
+.L.return.dead_if:
+  mov rbx, [rsp-8]
+  mov r12, [rsp-16]
+  ret
+  .globl dead_after_return
+  .text
+dead_after_return:
+  mov [rsp-8], rbx
+  movsxd rbx, edi
+.L.body.dead_after_return:
+  .loc 1 70
+  mov rax, rbx
+  test eax, eax
+  jne .L..18
+  .loc 1 71
+.L.else.99:
+.L.end.99:
+  .loc 1 72
+  mov eax, 1
+  jmp .L.return.dead_after_return
+.L..18:
+  .loc 1 75
+  mov rax, rbx
+  add eax, 1
+.L.return.dead_after_return:
+  mov rbx, [rsp-8]
+  ret
+  .globl switch_sparse
+  .text
+switch_sparse:
+  mov [rsp-8], rbx
+  mov [rsp-16], r12
+  mov r12, rdi
+.L.body.switch_sparse:
+  .loc 1 57
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 58
+  mov rax, r12
+  cmp rax, 1000
+  je .L..14
+  jg .L.bsearch.100
+  cmp rax, -7
+  je .L..11
+  cmp rax, 1
+  je .L..12
+  cmp rax, 100
+  je .L..13
+  jmp .L..10
+.L.bsearch.100:
+  cmp rax, 5000
+  je .L..15
+  cmp rax, 77777
+  je .L..16
+  cmp rax, 123456
+  je .L..17
+  jmp .L..10
+.L..11:
+  .loc 1 59
+  mov eax, 1
+  movsxd rbx, eax
+  .loc 1 59
+  jmp .L..10
+.L..12:
+  .loc 1 60
+  mov eax, 2
+  movsxd rbx, eax
+  .loc 1 60
+  jmp .L..10
+.L..13:
+  .loc 1 61
+  mov eax, 3
+  movsxd rbx, eax
+  .loc 1 61
+  jmp .L..10
+.L..14:
+  .loc 1 62
+  mov eax, 4
+  movsxd rbx, eax
+  .loc 1 63
+.L..15:
+  .loc 1 63
+  add ebx, 5
+  movsxd rbx, ebx
+  .loc 1 63
+  jmp .L..10
+.L..16:
+  .loc 1 64
+  mov eax, 6
+  movsxd rbx, eax
+  .loc 1 64
+  jmp .L..10
+.L..17:
+  .loc 1 65
+  mov eax, 7
+  movsxd rbx, eax
+  .loc 1 65
+.L..10:
+  .loc 1 67
+  mov rax, rbx
+.L.return.switch_sparse:
+  mov rbx, [rsp-8]
+  mov r12, [rsp-16]
+  ret
+  .globl switch_dense
+  .text
+switch_dense:
+  mov [rsp-8], rbx
+  movsxd rbx, edi
+.L.body.switch_dense:
+  .loc 1 44
+  mov rax, rbx
+  sub eax, -2
+  cmp eax, 9
+  ja .L..9
+  lea rdi, .L.jtab.101[rip]
+  movsxd rax, dword ptr [rdi+rax*4]
+  add rax, rdi
+  jmp rax
+  .section .rodata
+  .align 4
+.L.jtab.101:
+  .long .L..1-.L.jtab.101
+  .long .L..2-.L.jtab.101
+  .long .L..3-.L.jtab.101
+  .long .L..4-.L.jtab.101
+  .long .L..9-.L.jtab.101
+  .long .L..5-.L.jtab.101
+  .long .L..6-.L.jtab.101
+  .long .L..7-.L.jtab.101
+  .long .L..9-.L.jtab.101
+  .long .L..8-.L.jtab.101
+  .text
+  .loc 1 45
+.L..1:
+  .loc 1 45
+  mov eax, 10
+  jmp .L.return.switch_dense
+.L..2:
+  .loc 1 46
+  mov eax, 11
+  jmp .L.return.switch_dense
+.L..3:
+  .loc 1 47
+  mov eax, 12
+  jmp .L.return.switch_dense
+.L..4:
+  .loc 1 48
+  mov eax, 13
+  jmp .L.return.switch_dense
+.L..5:
+  .loc 1 49
+  mov eax, 15
+  jmp .L.return.switch_dense
+.L..6:
+  .loc 1 51
+.L..7:
+  .loc 1 51
+  mov eax, 17
+  jmp .L.return.switch_dense
+.L..8:
+  .loc 1 52
+  mov eax, 19
+  jmp .L.return.switch_dense
+.L..9:
+  .loc 1 53
+  mov eax, -1
+.L..0:
+.L.return.switch_dense:
+  mov rbx, [rsp-8]
+  ret
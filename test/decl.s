@@ -0,0 +1,447 @@
+.file 1 "-"
+.intel_syntax noprefix
+  .local .L..13
+  .data
+.L..13:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+  .local .L..12
+  .data
+.L..12:
+  .byte 40
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 41
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 50
+  .byte 53
+  .byte 54
+  .byte 0
+  .local .L..11
+  .data
+.L..11:
+  .byte 40
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 41
+  .byte 50
+  .byte 0
+  .local .L..10
+  .data
+.L..10:
+  .byte 40
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 41
+  .byte 49
+  .byte 0
+  .local .L..9
+  .data
+.L..9:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..8
+  .data
+.L..8:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..7
+  .data
+.L..7:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 95
+  .byte 66
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..6
+  .data
+.L..6:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..5
+  .data
+.L..5:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..4
+  .data
+.L..4:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..3
+  .data
+.L..3:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..2
+  .data
+.L..2:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..1
+  .data
+.L..1:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..0
+  .data
+.L..0:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .globl main
+  .text
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-48], rbx
+  mov [rbp-56], r12
+  mov [rbp-64], r13
+.L.body.main:
+  .loc 1 41
+  mov eax, 1
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..0[rip]
+  call assert
+  .loc 1 42
+  mov eax, 2
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..1[rip]
+  call assert
+  .loc 1 43
+  mov eax, 2
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..2[rip]
+  call assert
+  .loc 1 44
+  mov eax, 4
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..3[rip]
+  call assert
+  .loc 1 45
+  mov eax, 8
+  mov rsi, rax
+  mov edi, 8
+  lea rdx, .L..4[rip]
+  call assert
+  .loc 1 46
+  mov eax, 8
+  mov rsi, rax
+  mov edi, 8
+  lea rdx, .L..5[rip]
+  call assert
+  .loc 1 47
+  mov eax, 8
+  mov rsi, rax
+  mov edi, 8
+  lea rdx, .L..6[rip]
+  call assert
+  .loc 1 48
+  xor eax, eax
+  movsx r13d, al
+  .loc 1 48
+  mov rax, r13
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..7[rip]
+  call assert
+  .loc 1 49
+  mov eax, 1
+  movsx r12d, al
+  .loc 1 49
+  mov rax, r12
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..8[rip]
+  call assert
+  .loc 1 50
+  mov eax, 1
+  movsx ebx, al
+  .loc 1 50
+  mov rax, rbx
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..9[rip]
+  call assert
+  .loc 1 51
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..10[rip]
+  call assert
+  .loc 1 52
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..11[rip]
+  call assert
+  .loc 1 53
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..12[rip]
+  call assert
+  .loc 1 54
+  lea rdi, .L..13[rip]
+  xor eax, eax
+  call printf
+  .loc 1 55
+  xor eax, eax
+.L.return.main:
+  mov rbx, [rbp-48]
+  mov r12, [rbp-56]
+  mov r13, [rbp-64]
+  mov rsp, rbp
+  pop rbp
+  ret
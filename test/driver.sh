@@ -22,4 +22,66 @@ check -o
 ./1cc --help 2>&1 | grep -q 1cc
 check --help
 
+# --dump-ast
+echo 'int main() { return 3; }' > $tmp/ret.c
+./1cc --dump-ast $tmp/ret.c | grep -q 'RETURN'
+check --dump-ast
+
+# inline
+echo 'static int one() { return 1; } int main() { return one(); }' > $tmp/inline.c
+./1cc -o $tmp/inline.s $tmp/inline.c
+! grep -q 'one' $tmp/inline.s
+check inline
+
+# dead code
+echo 'static int unused_g; static int unused() { return unused_g; } int main() { return 0; if (0) unused(); }' > $tmp/dead.c
+./1cc -o $tmp/dead.s $tmp/dead.c
+! grep -q 'unused' $tmp/dead.s
+check 'dead code'
+
+# peephole
+./1cc -o $tmp/ret.s $tmp/ret.c
+! grep -q 'jmp .L.return.main' $tmp/ret.s
+check peephole
+
+# -fomit-frame-pointer
+echo 'int leaf(int x) { int a[4]; a[x] = x; return a[x]; }' > $tmp/leaf.c
+./1cc -o $tmp/leaf.s $tmp/leaf.c
+! grep -q 'rbp' $tmp/leaf.s
+check -fomit-frame-pointer
+./1cc -fno-omit-frame-pointer -o $tmp/leaf.s $tmp/leaf.c
+grep -q 'push rbp' $tmp/leaf.s
+check -fno-omit-frame-pointer
+
+# -funroll-loops
+echo 'int sum(int n) { int s = 0; for (int i = 0; i < n; i++) s = s + i; return s; }' > $tmp/loop.c
+./1cc --dump-ast $tmp/loop.c | grep -c 'FOR' | grep -q '^2$'
+check -funroll-loops
+./1cc -fno-unroll-loops --dump-ast $tmp/loop.c | grep -c 'FOR' | grep -q '^1$'
+check -fno-unroll-loops
+./1cc -fno-unroll-loops -funroll-loops --dump-ast $tmp/loop.c | grep -c 'FOR' | grep -q '^2$'
+check '-funroll-loops without a factor'
+! ./1cc -funroll-loops=abc -o $tmp/loop.s $tmp/loop.c 2> /dev/null
+check '-funroll-loops=abc'
+! ./1cc -funroll-loops=1 -o $tmp/loop.s $tmp/loop.c 2> /dev/null
+check '-funroll-loops=1'
+
+# induction variable
+echo 'int sum(int *a, int n) { int s = 0; for (int i = 0; i < n; i++) s = s + a[i]; return s; }' > $tmp/iv.c
+! ./1cc -fno-unroll-loops -fno-tree-vectorize --dump-ast $tmp/iv.c | grep -q 'VAR i'
+check 'induction variable'
+
+# -ftree-vectorize
+./1cc -o $tmp/iv.s $tmp/iv.c
+grep -q 'paddd' $tmp/iv.s
+check -ftree-vectorize
+./1cc -fno-tree-vectorize -o $tmp/iv.s $tmp/iv.c
+! grep -q 'xmm' $tmp/iv.s
+check -fno-tree-vectorize
+
+# 引数が多すぎる関数呼び出し
+echo 'int f(); int main() { return f(1, 2, 3, 4, 5, 6, 7, 8, 9, 10); }' > $tmp/args.c
+./1cc -o $tmp/args.s $tmp/args.c 2>&1 | grep -q '引数が多すぎます'
+check 'too many arguments'
+
 echo OK
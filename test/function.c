@@ -56,6 +56,52 @@ static int static_fn() { return 3; }
 
 int param_decay(int x[]) { return x[0]; }
 
+int add3_arr(int *a, int i, char *s) { return a[i] + s[0]; }
+long add_long(long a, long b) { return a + b; }
+
+static int inl_max(int x, int y) { if (x > y) return x; return y; }
+static int inl_sq(int x) { return x * x; }
+static int inl_sum_sq(int x, int y) { return inl_sq(x) + inl_sq(y); }
+static void inl_set(int *p, int v) { *p = v; }
+static int inl_loop(int n) {
+  int s = 0;
+  for (int i = 0; i < n; i++) {
+    if (i == 2) continue;
+    if (i == 5) break;
+    s += i;
+  }
+  return s;
+}
+static int inl_switch(int x) {
+  switch (x) {
+  case 0: return 10;
+  case 1: return 11;
+  case 5: return 15;
+  }
+  return -1;
+}
+static int inl_goto(int x) {
+  if (x) goto nonzero;
+  return 0;
+nonzero:
+  return 1;
+}
+static int inl_fact(int n) { if (n <= 1) return 1; return n * inl_fact(n - 1); }
+static char inl_char(int x) { return x; }
+
+int tail_count(int n, int acc) { if (n == 0) return acc; return tail_count(n - 1, acc + 1); }
+int tail_is_even(int n);
+int tail_is_odd(int n) { if (n == 0) return 0; return tail_is_even(n - 1); }
+int tail_is_even(int n) { if (n == 0) return 1; return tail_is_odd(n - 1); }
+long tail_add(long a, long b) { return add_long(b, a); }
+char tail_char(int x) { return tail_count(x, 0); }
+int tail_deref(int *p) { return *p; }
+int tail_local(int x) { int y = x; return tail_deref(&y); }
+
+int leaf_small(int i) { int a[8]; for (int j=0; j<8; j++) a[j] = j * j; return a[i]; }
+int leaf_large(int i) { int a[64]; for (int j=0; j<64; j++) a[j] = j * 2; return a[i] + a[63 - i]; }
+int leaf_retry(int i) { int a[30]; for (int j=0; j<30; j++) a[j] = j + i; return a[i] * a[29 - i]; }
+
 int main() {
   ASSERT(3, ret3());
   ASSERT(8, add2(3, 5));
@@ -90,6 +136,45 @@ int main() {
 
   ASSERT(3, ({ int x[2]; x[0]=3; param_decay(x); }));
 
+  ASSERT(21, add2(1, add2(2, add2(3, add2(4, add2(5, add2(6, 0)))))));
+  ASSERT(17, ((((1 + add2(0, 2)) + add2(1, 2)) + add2(2, 2)) + add2(3, 2)) + add2(4, 2) - 4);
+
+  ASSERT(15, ({ int x=2; add6(x, add2(x, 1), 0, x, add2(3, x), 3); }));
+  ASSERT(42, ({ int x=2; add6(add2(x, 1), add2(x, 2), add2(x, 3), add2(x, 4), add2(x, 5), add2(x, 6)) + 9; }));
+  ASSERT(103, ({ int a[3]={1,2,3}; add3_arr(a, 2, "d"); }));
+  ASSERT(3, ({ g1=3; add2(g1, 0); }));
+  ASSERT(-1, ({ int x=-1; sub2(0, -x); }));
+  ASSERT(1, add_long(4294967296, -4294967295));
+  ASSERT(4, ({ struct {int a; int b;} s={1,4}; addx(&s.b, 0); }));
+
+  ASSERT(7, inl_max(3, 7));
+  ASSERT(7, inl_max(7, 3));
+  ASSERT(14, inl_max(3, 7) + inl_max(7, 3));
+  ASSERT(25, inl_sum_sq(3, 4));
+  ASSERT(9, ({ int x=3; inl_sq(x++); }));
+  ASSERT(4, ({ int x=3; inl_sq(x++); x; }));
+  ASSERT(5, ({ int x=0; inl_set(&x, 5); x; }));
+  ASSERT(8, inl_loop(10));
+  ASSERT(1, inl_loop(2));
+  ASSERT(15, inl_switch(5));
+  ASSERT(-1, inl_switch(4));
+  ASSERT(21, inl_switch(0) + inl_switch(1));
+  ASSERT(1, inl_goto(3));
+  ASSERT(0, inl_goto(0));
+  ASSERT(120, inl_fact(5));
+  ASSERT(44, inl_char(300));
+
+  ASSERT(10000000, tail_count(10000000, 0));
+  ASSERT(1, tail_is_even(10000000));
+  ASSERT(1, tail_is_odd(9999999));
+  ASSERT(1, tail_add(4294967296, -4294967295));
+  ASSERT(44, tail_char(300));
+  ASSERT(7, tail_local(7));
+
+  ASSERT(49, leaf_small(7));
+  ASSERT(126, leaf_large(5));
+  ASSERT(116, leaf_retry(2));
+
   printf("OK\n");
   return 0;
 }
@@ -0,0 +1,3359 @@
+.file 1 "-"
+.intel_syntax noprefix
+  .local .L..72
+  .data
+.L..72:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+  .local .L..71
+  .data
+.L..71:
+  .byte 108
+  .byte 101
+  .byte 97
+  .byte 102
+  .byte 95
+  .byte 114
+  .byte 101
+  .byte 116
+  .byte 114
+  .byte 121
+  .byte 40
+  .byte 50
+  .byte 41
+  .byte 0
+  .local .L..70
+  .data
+.L..70:
+  .byte 108
+  .byte 101
+  .byte 97
+  .byte 102
+  .byte 95
+  .byte 108
+  .byte 97
+  .byte 114
+  .byte 103
+  .byte 101
+  .byte 40
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..69
+  .data
+.L..69:
+  .byte 108
+  .byte 101
+  .byte 97
+  .byte 102
+  .byte 95
+  .byte 115
+  .byte 109
+  .byte 97
+  .byte 108
+  .byte 108
+  .byte 40
+  .byte 55
+  .byte 41
+  .byte 0
+  .local .L..68
+  .data
+.L..68:
+  .byte 116
+  .byte 97
+  .byte 105
+  .byte 108
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 99
+  .byte 97
+  .byte 108
+  .byte 40
+  .byte 55
+  .byte 41
+  .byte 0
+  .local .L..67
+  .data
+.L..67:
+  .byte 116
+  .byte 97
+  .byte 105
+  .byte 108
+  .byte 95
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 40
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..66
+  .data
+.L..66:
+  .byte 116
+  .byte 97
+  .byte 105
+  .byte 108
+  .byte 95
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 40
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 54
+  .byte 44
+  .byte 32
+  .byte 45
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..65
+  .data
+.L..65:
+  .byte 116
+  .byte 97
+  .byte 105
+  .byte 108
+  .byte 95
+  .byte 105
+  .byte 115
+  .byte 95
+  .byte 111
+  .byte 100
+  .byte 100
+  .byte 40
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 57
+  .byte 41
+  .byte 0
+  .local .L..64
+  .data
+.L..64:
+  .byte 116
+  .byte 97
+  .byte 105
+  .byte 108
+  .byte 95
+  .byte 105
+  .byte 115
+  .byte 95
+  .byte 101
+  .byte 118
+  .byte 101
+  .byte 110
+  .byte 40
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..63
+  .data
+.L..63:
+  .byte 116
+  .byte 97
+  .byte 105
+  .byte 108
+  .byte 95
+  .byte 99
+  .byte 111
+  .byte 117
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..62
+  .data
+.L..62:
+  .byte 105
+  .byte 110
+  .byte 108
+  .byte 95
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 40
+  .byte 51
+  .byte 48
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..61
+  .data
+.L..61:
+  .byte 105
+  .byte 110
+  .byte 108
+  .byte 95
+  .byte 102
+  .byte 97
+  .byte 99
+  .byte 116
+  .byte 40
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..60
+  .data
+.L..60:
+  .byte 105
+  .byte 110
+  .byte 108
+  .byte 95
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..59
+  .data
+.L..59:
+  .byte 105
+  .byte 110
+  .byte 108
+  .byte 95
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..58
+  .data
+.L..58:
+  .byte 105
+  .byte 110
+  .byte 108
+  .byte 95
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 108
+  .byte 95
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 0
+  .local .L..57
+  .data
+.L..57:
+  .byte 105
+  .byte 110
+  .byte 108
+  .byte 95
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 52
+  .byte 41
+  .byte 0
+  .local .L..56
+  .data
+.L..56:
+  .byte 105
+  .byte 110
+  .byte 108
+  .byte 95
+  .byte 115
+  .byte 119
+  .byte 105
+  .byte 116
+  .byte 99
+  .byte 104
+  .byte 40
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..55
+  .data
+.L..55:
+  .byte 105
+  .byte 110
+  .byte 108
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 111
+  .byte 112
+  .byte 40
+  .byte 50
+  .byte 41
+  .byte 0
+  .local .L..54
+  .data
+.L..54:
+  .byte 105
+  .byte 110
+  .byte 108
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 111
+  .byte 112
+  .byte 40
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..53
+  .data
+.L..53:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 108
+  .byte 95
+  .byte 115
+  .byte 101
+  .byte 116
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..52
+  .data
+.L..52:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 108
+  .byte 95
+  .byte 115
+  .byte 113
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..51
+  .data
+.L..51:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 108
+  .byte 95
+  .byte 115
+  .byte 113
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..50
+  .data
+.L..50:
+  .byte 105
+  .byte 110
+  .byte 108
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 115
+  .byte 113
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 41
+  .byte 0
+  .local .L..49
+  .data
+.L..49:
+  .byte 105
+  .byte 110
+  .byte 108
+  .byte 95
+  .byte 109
+  .byte 97
+  .byte 120
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 55
+  .byte 41
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 108
+  .byte 95
+  .byte 109
+  .byte 97
+  .byte 120
+  .byte 40
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..48
+  .data
+.L..48:
+  .byte 105
+  .byte 110
+  .byte 108
+  .byte 95
+  .byte 109
+  .byte 97
+  .byte 120
+  .byte 40
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..47
+  .data
+.L..47:
+  .byte 105
+  .byte 110
+  .byte 108
+  .byte 95
+  .byte 109
+  .byte 97
+  .byte 120
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 55
+  .byte 41
+  .byte 0
+  .local .L..46
+  .data
+.L..46:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 120
+  .byte 40
+  .byte 38
+  .byte 115
+  .byte 46
+  .byte 98
+  .byte 44
+  .byte 32
+  .byte 48
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..45
+  .data
+.L..45:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 40
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 54
+  .byte 44
+  .byte 32
+  .byte 45
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..44
+  .data
+.L..44:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 50
+  .byte 40
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 45
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..43
+  .data
+.L..43:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 49
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 48
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..42
+  .data
+.L..42:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 51
+  .byte 95
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 40
+  .byte 97
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 100
+  .byte 34
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..41
+  .data
+.L..41:
+  .byte 100
+  .byte 0
+  .local .L..40
+  .data
+.L..40:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 54
+  .byte 41
+  .byte 41
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..39
+  .data
+.L..39:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 120
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..38
+  .data
+.L..38:
+  .byte 40
+  .byte 40
+  .byte 40
+  .byte 40
+  .byte 49
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 41
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 41
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 41
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 41
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 52
+  .byte 0
+  .local .L..37
+  .data
+.L..37:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 54
+  .byte 44
+  .byte 32
+  .byte 48
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 41
+  .byte 0
+  .local .L..36
+  .data
+.L..36:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 97
+  .byte 114
+  .byte 97
+  .byte 109
+  .byte 95
+  .byte 100
+  .byte 101
+  .byte 99
+  .byte 97
+  .byte 121
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..35
+  .data
+.L..35:
+  .byte 115
+  .byte 116
+  .byte 97
+  .byte 116
+  .byte 105
+  .byte 99
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 40
+  .byte 41
+  .byte 0
+  .local .L..34
+  .data
+.L..34:
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..33
+  .data
+.L..33:
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 95
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..32
+  .data
+.L..32:
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 40
+  .byte 45
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..31
+  .data
+.L..31:
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 95
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 40
+  .byte 45
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..30
+  .data
+.L..30:
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..29
+  .data
+.L..29:
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 102
+  .byte 110
+  .byte 95
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 40
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..28
+  .data
+.L..28:
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 95
+  .byte 97
+  .byte 114
+  .byte 103
+  .byte 40
+  .byte 50
+  .byte 54
+  .byte 49
+  .byte 41
+  .byte 0
+  .local .L..27
+  .data
+.L..27:
+  .byte 100
+  .byte 105
+  .byte 118
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 0
+  .local .L..26
+  .data
+.L..26:
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 95
+  .byte 116
+  .byte 111
+  .byte 95
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 40
+  .byte 50
+  .byte 54
+  .byte 49
+  .byte 41
+  .byte 0
+  .local .L..25
+  .data
+.L..25:
+  .byte 42
+  .byte 103
+  .byte 49
+  .byte 95
+  .byte 112
+  .byte 116
+  .byte 114
+  .byte 40
+  .byte 41
+  .byte 0
+  .local .L..24
+  .data
+.L..24:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 95
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 40
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..23
+  .data
+.L..23:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 40
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..22
+  .data
+.L..22:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 95
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 40
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..21
+  .data
+.L..21:
+  .byte 102
+  .byte 105
+  .byte 98
+  .byte 40
+  .byte 57
+  .byte 41
+  .byte 0
+  .local .L..20
+  .data
+.L..20:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 50
+  .byte 40
+  .byte 52
+  .byte 44
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..19
+  .data
+.L..19:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 41
+  .byte 0
+  .local .L..18
+  .data
+.L..18:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 44
+  .byte 55
+  .byte 44
+  .byte 56
+  .byte 44
+  .byte 57
+  .byte 41
+  .byte 44
+  .byte 49
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 49
+  .byte 44
+  .byte 49
+  .byte 50
+  .byte 44
+  .byte 49
+  .byte 51
+  .byte 41
+  .byte 44
+  .byte 49
+  .byte 52
+  .byte 44
+  .byte 49
+  .byte 53
+  .byte 44
+  .byte 49
+  .byte 54
+  .byte 41
+  .byte 0
+  .local .L..17
+  .data
+.L..17:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 44
+  .byte 55
+  .byte 44
+  .byte 56
+  .byte 41
+  .byte 44
+  .byte 57
+  .byte 44
+  .byte 49
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 49
+  .byte 41
+  .byte 0
+  .local .L..16
+  .data
+.L..16:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 54
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 41
+  .byte 0
+  .local .L..15
+  .data
+.L..15:
+  .byte 115
+  .byte 117
+  .byte 98
+  .byte 50
+  .byte 40
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..14
+  .data
+.L..14:
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 50
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..13
+  .data
+.L..13:
+  .byte 114
+  .byte 101
+  .byte 116
+  .byte 51
+  .byte 40
+  .byte 41
+  .byte 0
+  .globl g1
+  .bss
+g1:
+  .zero 4
+  .globl main
+  .text
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 272
+  mov [rbp-240], rbx
+  mov [rbp-248], r12
+  mov [rbp-256], r13
+  mov [rbp-264], r14
+  mov [rbp-272], r15
+.L.body.main:
+  .loc 1 124
+  xor eax, eax
+  call ret3
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..13[rip]
+  call assert
+  .loc 1 125
+  mov edi, 3
+  mov esi, 5
+  call add2
+  mov rsi, rax
+  mov edi, 8
+  lea rdx, .L..14[rip]
+  call assert
+  .loc 1 126
+  mov edi, 5
+  mov esi, 3
+  call sub2
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..15[rip]
+  call assert
+  .loc 1 127
+  mov edi, 1
+  mov esi, 2
+  mov edx, 3
+  mov ecx, 4
+  mov r8d, 5
+  mov r9d, 6
+  call add6
+  mov rsi, rax
+  mov edi, 21
+  lea rdx, .L..16[rip]
+  call assert
+  .loc 1 128
+  mov edi, 3
+  mov esi, 4
+  mov edx, 5
+  mov ecx, 6
+  mov r8d, 7
+  mov r9d, 8
+  call add6
+  mov rdx, rax
+  mov edi, 1
+  mov esi, 2
+  mov ecx, 9
+  mov r8d, 10
+  mov r9d, 11
+  call add6
+  mov rsi, rax
+  mov edi, 66
+  lea rdx, .L..17[rip]
+  call assert
+  .loc 1 129
+  mov edi, 4
+  mov esi, 5
+  mov edx, 6
+  mov ecx, 7
+  mov r8d, 8
+  mov r9d, 9
+  call add6
+  mov rsi, rax
+  mov edi, 3
+  mov edx, 10
+  mov ecx, 11
+  mov r8d, 12
+  mov r9d, 13
+  call add6
+  mov rdx, rax
+  mov edi, 1
+  mov esi, 2
+  mov ecx, 14
+  mov r8d, 15
+  mov r9d, 16
+  call add6
+  mov rsi, rax
+  mov edi, 136
+  lea rdx, .L..18[rip]
+  call assert
+  .loc 1 130
+  mov edi, 3
+  mov esi, 4
+  call add2
+  mov rsi, rax
+  mov edi, 7
+  lea rdx, .L..19[rip]
+  call assert
+  .loc 1 131
+  mov edi, 4
+  mov esi, 3
+  call sub2
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..20[rip]
+  call assert
+  .loc 1 132
+  mov edi, 9
+  call fib
+  mov rsi, rax
+  mov edi, 55
+  lea rdx, .L..21[rip]
+  call assert
+  .loc 1 133
+  mov edi, 7
+  mov esi, 3
+  mov edx, 3
+  call sub_char
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..22[rip]
+  call assert
+  .loc 1 134
+  mov rdi, 7
+  mov rsi, 3
+  mov rdx, 3
+  call sub_long
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..23[rip]
+  call assert
+  .loc 1 135
+  mov edi, 7
+  mov esi, 3
+  mov edx, 3
+  call sub_short
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..24[rip]
+  call assert
+  .loc 1 136
+  mov dword ptr g1[rip], 3
+  .loc 1 137
+  xor eax, eax
+  call g1_ptr
+  movsxd rax, dword ptr [rax]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..25[rip]
+  call assert
+  .loc 1 138
+  mov edi, 261
+  call int_to_char
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..26[rip]
+  call assert
+  .loc 1 139
+  mov rdi, -10
+  mov rsi, 2
+  call div_long
+  mov rsi, rax
+  mov edi, -5
+  lea rdx, .L..27[rip]
+  call assert
+  .loc 1 140
+  mov edi, 5
+  call char_arg
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..28[rip]
+  call assert
+  .loc 1 141
+  mov edi, 1
+  call bool_fn_add
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..29[rip]
+  call assert
+  .loc 1 142
+  mov edi, 1
+  call bool_fn_sub
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..30[rip]
+  call assert
+  .loc 1 143
+  mov edi, 1
+  call bool_fn_add
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..31[rip]
+  call assert
+  .loc 1 144
+  mov edi, 1
+  call bool_fn_sub
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..32[rip]
+  call assert
+  .loc 1 145
+  xor edi, edi
+  call bool_fn_add
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..33[rip]
+  call assert
+  .loc 1 146
+  xor edi, edi
+  call bool_fn_sub
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..34[rip]
+  call assert
+  .loc 1 79
+  mov dword ptr [rbp-160], 3
+  .loc 1 147
+.L.opt.0:
+  .loc 1 147
+  movsxd rax, dword ptr [rbp-160]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..35[rip]
+  call assert
+  .loc 1 148
+  mov dword ptr [rbp-208], 3
+  .loc 1 148
+  lea rdi, [rbp-208]
+  call param_decay
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..36[rip]
+  call assert
+  .loc 1 149
+  mov edi, 6
+  xor esi, esi
+  call add2
+  mov rsi, rax
+  mov edi, 5
+  call add2
+  mov rsi, rax
+  mov edi, 4
+  call add2
+  mov rsi, rax
+  mov edi, 3
+  call add2
+  mov rsi, rax
+  mov edi, 2
+  call add2
+  mov rsi, rax
+  mov edi, 1
+  call add2
+  mov rsi, rax
+  mov edi, 21
+  lea rdx, .L..37[rip]
+  call assert
+  .loc 1 150
+  mov edi, 4
+  mov esi, 2
+  call add2
+  mov r14, rax
+  .loc 1 150
+  mov edi, 3
+  mov esi, 2
+  call add2
+  mov r15, rax
+  .loc 1 150
+  mov edi, 2
+  mov esi, 2
+  call add2
+  mov [rbp-216], rax
+  .loc 1 150
+  mov edi, 1
+  mov esi, 2
+  call add2
+  mov [rbp-224], rax
+  .loc 1 150
+  xor edi, edi
+  mov esi, 2
+  call add2
+  add eax, 1
+  mov rdi, [rbp-224]
+  add eax, edi
+  mov rdi, [rbp-216]
+  add eax, edi
+  mov rdi, r15
+  add eax, edi
+  mov rdi, r14
+  add eax, edi
+  sub eax, 4
+  mov rsi, rax
+  mov edi, 17
+  lea rdx, .L..38[rip]
+  call assert
+  .loc 1 151
+  mov dword ptr [rbp-200], 2
+  .loc 1 151
+  mov edi, dword ptr [rbp-200]
+  mov esi, 1
+  call add2
+  mov r14, rax
+  .loc 1 151
+  mov edi, 3
+  mov esi, dword ptr [rbp-200]
+  call add2
+  mov r8, rax
+  mov rsi, r14
+  mov edi, dword ptr [rbp-200]
+  xor edx, edx
+  mov ecx, dword ptr [rbp-200]
+  mov r9d, 3
+  call add6
+  mov rsi, rax
+  mov edi, 15
+  lea rdx, .L..39[rip]
+  call assert
+  .loc 1 152
+  mov eax, 2
+  movsxd rbx, eax
+  .loc 1 152
+  mov edi, ebx
+  mov esi, 1
+  call add2
+  mov r14, rax
+  .loc 1 152
+  mov edi, ebx
+  mov esi, 2
+  call add2
+  mov r15, rax
+  .loc 1 152
+  mov edi, ebx
+  mov esi, 3
+  call add2
+  mov [rbp-216], rax
+  .loc 1 152
+  mov edi, ebx
+  mov esi, 4
+  call add2
+  mov [rbp-224], rax
+  .loc 1 152
+  mov edi, ebx
+  mov esi, 5
+  call add2
+  mov [rbp-232], rax
+  .loc 1 152
+  mov edi, ebx
+  mov esi, 6
+  call add2
+  mov r9, rax
+  mov r8, [rbp-232]
+  mov rcx, [rbp-224]
+  mov rdx, [rbp-216]
+  mov rsi, r15
+  mov rdi, r14
+  call add6
+  add eax, 9
+  mov rsi, rax
+  mov edi, 42
+  lea rdx, .L..40[rip]
+  call assert
+  .loc 1 153
+  mov eax, 1
+  mov dword ptr [rbp-196], eax
+  .loc 1 153
+  mov eax, 2
+  mov dword ptr [rbp-192], eax
+  .loc 1 153
+  mov eax, 3
+  mov dword ptr [rbp-188], eax
+  .loc 1 153
+  lea rdi, [rbp-196]
+  mov esi, 2
+  lea rdx, .L..41[rip]
+  call add3_arr
+  mov rsi, rax
+  mov edi, 103
+  lea rdx, .L..42[rip]
+  call assert
+  .loc 1 154
+  mov dword ptr g1[rip], 3
+  .loc 1 154
+  mov edi, dword ptr g1[rip]
+  xor esi, esi
+  call add2
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..43[rip]
+  call assert
+  .loc 1 155
+  mov dword ptr [rbp-184], -1
+  .loc 1 155
+  movsxd rax, dword ptr [rbp-184]
+  neg rax
+  mov rsi, rax
+  xor edi, edi
+  call sub2
+  mov rsi, rax
+  mov edi, -1
+  lea rdx, .L..44[rip]
+  call assert
+  .loc 1 156
+  mov rax, 4294967296
+  mov r14, rax
+  .loc 1 156
+  mov rax, -4294967295
+  mov rsi, rax
+  mov rdi, r14
+  call add_long
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..45[rip]
+  call assert
+  .loc 1 157
+  mov eax, 1
+  mov dword ptr [rbp-180], eax
+  .loc 1 157
+  mov eax, 4
+  mov dword ptr [rbp-176], eax
+  .loc 1 157
+  lea rdi, [rbp-176]
+  xor esi, esi
+  call addx
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..46[rip]
+  call assert
+  .loc 1 158
+  mov dword ptr [rbp-156], 3
+  .loc 1 158
+  mov dword ptr [rbp-152], 7
+  .loc 1 83
+  movsxd rax, dword ptr [rbp-152]
+  cmp eax, dword ptr [rbp-156]
+  jge .L.else.1
+  .loc 1 83
+  movsxd rax, dword ptr [rbp-156]
+  mov dword ptr [rbp-148], eax
+  .loc 1 83
+  jmp .L.opt.1
+.L.else.1:
+.L.end.1:
+  .loc 1 83
+  movsxd rax, dword ptr [rbp-152]
+  mov dword ptr [rbp-148], eax
+  .loc 1 158
+.L.opt.1:
+  .loc 1 158
+  movsxd rax, dword ptr [rbp-148]
+  mov rsi, rax
+  mov edi, 7
+  lea rdx, .L..47[rip]
+  call assert
+  .loc 1 159
+  mov dword ptr [rbp-144], 7
+  .loc 1 159
+  mov dword ptr [rbp-140], 3
+  .loc 1 83
+  movsxd rax, dword ptr [rbp-140]
+  cmp eax, dword ptr [rbp-144]
+  jge .L.else.2
+  .loc 1 83
+  movsxd rax, dword ptr [rbp-144]
+  mov dword ptr [rbp-136], eax
+  .loc 1 83
+  jmp .L.opt.2
+.L.else.2:
+.L.end.2:
+  .loc 1 83
+  movsxd rax, dword ptr [rbp-140]
+  mov dword ptr [rbp-136], eax
+  .loc 1 159
+.L.opt.2:
+  .loc 1 159
+  movsxd rax, dword ptr [rbp-136]
+  mov rsi, rax
+  mov edi, 7
+  lea rdx, .L..48[rip]
+  call assert
+  .loc 1 160
+  mov dword ptr [rbp-120], 7
+  .loc 1 160
+  mov dword ptr [rbp-116], 3
+  .loc 1 83
+  movsxd rax, dword ptr [rbp-116]
+  cmp eax, dword ptr [rbp-120]
+  jge .L.else.3
+  .loc 1 83
+  movsxd rax, dword ptr [rbp-120]
+  mov dword ptr [rbp-112], eax
+  .loc 1 83
+  jmp .L.opt.4
+.L.else.3:
+.L.end.3:
+  .loc 1 83
+  movsxd rax, dword ptr [rbp-116]
+  mov dword ptr [rbp-112], eax
+  .loc 1 160
+.L.opt.4:
+  .loc 1 160
+  movsxd rax, dword ptr [rbp-112]
+  mov r14, rax
+  .loc 1 160
+  mov dword ptr [rbp-132], 3
+  .loc 1 160
+  mov dword ptr [rbp-128], 7
+  .loc 1 83
+  movsxd rax, dword ptr [rbp-128]
+  cmp eax, dword ptr [rbp-132]
+  jge .L.else.4
+  .loc 1 83
+  movsxd rax, dword ptr [rbp-132]
+  mov dword ptr [rbp-124], eax
+  .loc 1 83
+  jmp .L.opt.3
+.L.else.4:
+.L.end.4:
+  .loc 1 83
+  movsxd rax, dword ptr [rbp-128]
+  mov dword ptr [rbp-124], eax
+  .loc 1 160
+.L.opt.3:
+  .loc 1 160
+  movsxd rax, dword ptr [rbp-124]
+  mov rdi, r14
+  add eax, edi
+  mov rsi, rax
+  mov edi, 14
+  lea rdx, .L..49[rip]
+  call assert
+  .loc 1 161
+  mov dword ptr [rbp-108], 3
+  .loc 1 161
+  mov dword ptr [rbp-104], 4
+  .loc 1 85
+  movsxd rax, dword ptr [rbp-104]
+  mov dword ptr [rbp-88], eax
+  .loc 1 84
+  movsxd rax, eax
+  imul eax, dword ptr [rbp-88]
+  mov dword ptr [rbp-84], eax
+  .loc 1 85
+.L.opt.7:
+  .loc 1 85
+  movsxd rax, dword ptr [rbp-84]
+  mov r14, rax
+  .loc 1 85
+  movsxd rax, dword ptr [rbp-108]
+  mov dword ptr [rbp-96], eax
+  .loc 1 84
+  movsxd rax, eax
+  imul eax, dword ptr [rbp-96]
+  mov dword ptr [rbp-92], eax
+  .loc 1 85
+.L.opt.6:
+  .loc 1 85
+  movsxd rax, dword ptr [rbp-92]
+  mov rdi, r14
+  add eax, edi
+  mov dword ptr [rbp-100], eax
+  .loc 1 161
+.L.opt.5:
+  .loc 1 161
+  movsxd rax, dword ptr [rbp-100]
+  mov rsi, rax
+  mov edi, 25
+  lea rdx, .L..50[rip]
+  call assert
+  .loc 1 162
+  mov dword ptr [rbp-172], 3
+  .loc 1 162
+  inc dword ptr [rbp-172]
+  movsxd rax, dword ptr [rbp-172]
+  add eax, -1
+  mov dword ptr [rbp-80], eax
+  .loc 1 84
+  movsxd rax, eax
+  imul eax, dword ptr [rbp-80]
+  mov dword ptr [rbp-76], eax
+  .loc 1 162
+.L.opt.8:
+  .loc 1 162
+  movsxd rax, dword ptr [rbp-76]
+  mov rsi, rax
+  mov edi, 9
+  lea rdx, .L..51[rip]
+  call assert
+  .loc 1 163
+  mov dword ptr [rbp-168], 3
+  .loc 1 163
+  inc dword ptr [rbp-168]
+  movsxd rax, dword ptr [rbp-168]
+  add eax, -1
+  mov dword ptr [rbp-72], eax
+  .loc 1 84
+  movsxd rax, eax
+  imul eax, dword ptr [rbp-72]
+  mov dword ptr [rbp-68], eax
+  .loc 1 163
+.L.opt.9:
+  .loc 1 163
+  movsxd rax, dword ptr [rbp-68]
+  .loc 1 163
+  movsxd rax, dword ptr [rbp-168]
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..52[rip]
+  call assert
+  .loc 1 164
+  mov dword ptr [rbp-164], 0
+  .loc 1 164
+  lea rax, [rbp-164]
+  mov qword ptr [rbp-64], rax
+  .loc 1 164
+  mov dword ptr [rbp-52], 5
+  .loc 1 86
+  movsxd rax, dword ptr [rbp-52]
+  mov r14, rax
+  .loc 1 86
+  mov rax, qword ptr [rbp-64]
+  mov rdx, r14
+  mov dword ptr [rax], edx
+  .loc 1 164
+.L.opt.10:
+  .loc 1 164
+  movsxd rax, dword ptr [rbp-164]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..53[rip]
+  call assert
+  .loc 1 165
+  mov edi, 10
+  call inl_loop
+  mov rsi, rax
+  mov edi, 8
+  lea rdx, .L..54[rip]
+  call assert
+  .loc 1 166
+  mov edi, 2
+  call inl_loop
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..55[rip]
+  call assert
+  .loc 1 167
+  mov dword ptr [rbp-48], 5
+  .loc 1 97
+  movsxd rax, dword ptr [rbp-48]
+  cmp eax, 0
+  je .L.opt.12
+  cmp eax, 1
+  je .L.opt.13
+  cmp eax, 5
+  je .L.opt.14
+  jmp .L.opt.15
+.L.opt.12:
+  .loc 1 98
+  mov dword ptr [rbp-44], 10
+  .loc 1 98
+  jmp .L.opt.11
+.L.opt.13:
+  .loc 1 99
+  mov dword ptr [rbp-44], 11
+  .loc 1 99
+  jmp .L.opt.11
+.L.opt.14:
+  .loc 1 100
+  mov dword ptr [rbp-44], 15
+  .loc 1 100
+  jmp .L.opt.11
+.L.opt.15:
+  .loc 1 102
+  mov dword ptr [rbp-44], -1
+  .loc 1 167
+.L.opt.11:
+  .loc 1 167
+  movsxd rax, dword ptr [rbp-44]
+  mov rsi, rax
+  mov edi, 15
+  lea rdx, .L..56[rip]
+  call assert
+  .loc 1 168
+  mov dword ptr [rbp-40], 4
+  .loc 1 97
+  movsxd rax, dword ptr [rbp-40]
+  cmp eax, 0
+  je .L.opt.17
+  cmp eax, 1
+  je .L.opt.18
+  cmp eax, 5
+  je .L.opt.19
+  jmp .L.opt.20
+.L.opt.17:
+  .loc 1 98
+  mov dword ptr [rbp-36], 10
+  .loc 1 98
+  jmp .L.opt.16
+.L.opt.18:
+  .loc 1 99
+  mov dword ptr [rbp-36], 11
+  .loc 1 99
+  jmp .L.opt.16
+.L.opt.19:
+  .loc 1 100
+  mov dword ptr [rbp-36], 15
+  .loc 1 100
+  jmp .L.opt.16
+.L.opt.20:
+  .loc 1 102
+  mov dword ptr [rbp-36], -1
+  .loc 1 168
+.L.opt.16:
+  .loc 1 168
+  movsxd rax, dword ptr [rbp-36]
+  mov rsi, rax
+  mov edi, -1
+  lea rdx, .L..57[rip]
+  call assert
+  .loc 1 169
+  mov dword ptr [rbp-28], 1
+  .loc 1 97
+  movsxd rax, dword ptr [rbp-28]
+  cmp eax, 0
+  je .L.opt.27
+  cmp eax, 1
+  je .L.opt.28
+  cmp eax, 5
+  je .L.opt.29
+  jmp .L.opt.30
+.L.opt.27:
+  .loc 1 98
+  mov eax, 10
+  movsxd r12, eax
+  .loc 1 98
+  jmp .L.opt.26
+.L.opt.28:
+  .loc 1 99
+  mov eax, 11
+  movsxd r12, eax
+  .loc 1 99
+  jmp .L.opt.26
+.L.opt.29:
+  .loc 1 100
+  mov eax, 15
+  movsxd r12, eax
+  .loc 1 100
+  jmp .L.opt.26
+.L.opt.30:
+  .loc 1 102
+  mov eax, -1
+  movsxd r12, eax
+  .loc 1 169
+.L.opt.26:
+  .loc 1 169
+  mov rax, r12
+  mov r14, rax
+  .loc 1 169
+  mov dword ptr [rbp-32], 0
+  .loc 1 97
+  movsxd rax, dword ptr [rbp-32]
+  cmp eax, 0
+  je .L.opt.22
+  cmp eax, 1
+  je .L.opt.23
+  cmp eax, 5
+  je .L.opt.24
+  jmp .L.opt.25
+.L.opt.22:
+  .loc 1 98
+  mov eax, 10
+  movsxd r13, eax
+  .loc 1 98
+  jmp .L.opt.21
+.L.opt.23:
+  .loc 1 99
+  mov eax, 11
+  movsxd r13, eax
+  .loc 1 99
+  jmp .L.opt.21
+.L.opt.24:
+  .loc 1 100
+  mov eax, 15
+  movsxd r13, eax
+  .loc 1 100
+  jmp .L.opt.21
+.L.opt.25:
+  .loc 1 102
+  mov eax, -1
+  movsxd r13, eax
+  .loc 1 169
+.L.opt.21:
+  .loc 1 169
+  mov rax, r13
+  mov rdi, r14
+  add eax, edi
+  mov rsi, rax
+  mov edi, 21
+  lea rdx, .L..58[rip]
+  call assert
+  .loc 1 170
+  mov dword ptr [rbp-24], 3
+  .loc 1 105
+  movsxd rax, dword ptr [rbp-24]
+  test eax, eax
+  jne .L.opt.32
+  .loc 1 105
+.L.else.5:
+.L.end.5:
+  .loc 1 106
+  mov dword ptr [rbp-20], 0
+  .loc 1 106
+  jmp .L.opt.31
+.L.opt.32:
+  .loc 1 108
+  mov dword ptr [rbp-20], 1
+  .loc 1 170
+.L.opt.31:
+  .loc 1 170
+  movsxd rax, dword ptr [rbp-20]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..59[rip]
+  call assert
+  .loc 1 171
+  mov dword ptr [rbp-16], 0
+  .loc 1 105
+  movsxd rax, dword ptr [rbp-16]
+  test eax, eax
+  jne .L.opt.34
+  .loc 1 105
+.L.else.6:
+.L.end.6:
+  .loc 1 106
+  mov dword ptr [rbp-12], 0
+  .loc 1 106
+  jmp .L.opt.33
+.L.opt.34:
+  .loc 1 108
+  mov dword ptr [rbp-12], 1
+  .loc 1 171
+.L.opt.33:
+  .loc 1 171
+  movsxd rax, dword ptr [rbp-12]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..60[rip]
+  call assert
+  .loc 1 172
+  mov edi, 5
+  call inl_fact
+  mov rsi, rax
+  mov edi, 120
+  lea rdx, .L..61[rip]
+  call assert
+  .loc 1 173
+  mov dword ptr [rbp-8], 300
+  .loc 1 111
+  movsxd rax, dword ptr [rbp-8]
+  movsx eax, al
+  mov byte ptr [rbp-1], al
+  .loc 1 173
+.L.opt.35:
+  .loc 1 173
+  movsx eax, byte ptr [rbp-1]
+  mov rsi, rax
+  mov edi, 44
+  lea rdx, .L..62[rip]
+  call assert
+  .loc 1 174
+  mov edi, 10000000
+  xor esi, esi
+  call tail_count
+  mov rsi, rax
+  mov edi, 10000000
+  lea rdx, .L..63[rip]
+  call assert
+  .loc 1 175
+  mov edi, 10000000
+  call tail_is_even
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..64[rip]
+  call assert
+  .loc 1 176
+  mov edi, 9999999
+  call tail_is_odd
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..65[rip]
+  call assert
+  .loc 1 177
+  mov rax, 4294967296
+  mov r14, rax
+  .loc 1 177
+  mov rax, -4294967295
+  mov rsi, rax
+  mov rdi, r14
+  call tail_add
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..66[rip]
+  call assert
+  .loc 1 178
+  mov edi, 300
+  call tail_char
+  mov rsi, rax
+  mov edi, 44
+  lea rdx, .L..67[rip]
+  call assert
+  .loc 1 179
+  mov edi, 7
+  call tail_local
+  mov rsi, rax
+  mov edi, 7
+  lea rdx, .L..68[rip]
+  call assert
+  .loc 1 180
+  mov edi, 7
+  call leaf_small
+  mov rsi, rax
+  mov edi, 49
+  lea rdx, .L..69[rip]
+  call assert
+  .loc 1 181
+  mov edi, 5
+  call leaf_large
+  mov rsi, rax
+  mov edi, 126
+  lea rdx, .L..70[rip]
+  call assert
+  .loc 1 182
+  mov edi, 2
+  call leaf_retry
+  mov rsi, rax
+  mov edi, 116
+  lea rdx, .L..71[rip]
+  call assert
+  .loc 1 183
+  lea rdi, .L..72[rip]
+  xor eax, eax
+  call printf
+  .loc 1 184
+  xor eax, eax
+.L.return.main:
+  mov rbx, [rbp-240]
+  mov r12, [rbp-248]
+  mov r13, [rbp-256]
+  mov r14, [rbp-264]
+  mov r15, [rbp-272]
+  mov rsp, rbp
+  pop rbp
+  ret
+  .globl leaf_retry
+  .text
+leaf_retry:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 160
+  mov [rbp-128], rbx
+  mov [rbp-136], r12
+  mov [rbp-144], r13
+  mov [rbp-152], r14
+  movsxd r12, edi
+.L.body.leaf_retry:
+  .loc 1 122
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 122
+  mov eax, 30
+  movsxd rax, eax
+  mov r13, rax
+  .loc 1 122
+  mov eax, 3
+  mov r14, rax
+  .loc 1 122
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r14
+  add rax, rdi
+  mov rdi, r13
+  cmp rax, rdi
+  jge .L.opt.36
+.L.begin.9:
+  .loc 1 122
+  mov rax, rbx
+  add eax, r12d
+  mov dword ptr [rbp+rbx*4-120], eax
+  .loc 1 122
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 122
+  mov rax, rbx
+  add eax, r12d
+  mov dword ptr [rbp+rbx*4-120], eax
+  .loc 1 122
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 122
+  mov rax, rbx
+  add eax, r12d
+  mov dword ptr [rbp+rbx*4-120], eax
+  .loc 1 122
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 122
+  mov rax, rbx
+  add eax, r12d
+  mov dword ptr [rbp+rbx*4-120], eax
+.L.opt.37:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.9:
+  .loc 1 122
+  mov eax, 30
+  movsxd rax, eax
+  mov r13, rax
+  .loc 1 122
+  mov eax, 3
+  mov r14, rax
+  .loc 1 122
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r14
+  add rax, rdi
+  mov rdi, r13
+  cmp rax, rdi
+  jl .L.begin.9
+.L.opt.36:
+  .loc 1 122
+  cmp ebx, 30
+  jge .L..11
+.L.begin.10:
+  .loc 1 122
+  mov rax, rbx
+  add eax, r12d
+  mov dword ptr [rbp+rbx*4-120], eax
+.L..12:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.10:
+  cmp ebx, 30
+  jl .L.begin.10
+.L..11:
+  .loc 1 122
+  mov eax, 29
+  sub eax, r12d
+  movsxd rax, eax
+  movsxd rax, dword ptr [rbp+rax*4-120]
+  imul eax, dword ptr [rbp+r12*4-120]
+.L.return.leaf_retry:
+  mov rbx, [rbp-128]
+  mov r12, [rbp-136]
+  mov r13, [rbp-144]
+  mov r14, [rbp-152]
+  mov rsp, rbp
+  pop rbp
+  ret
+  .globl leaf_large
+  .text
+leaf_large:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 288
+  mov [rbp-264], rbx
+  mov [rbp-272], r12
+  mov [rbp-280], r13
+  mov [rbp-288], r14
+  movsxd r12, edi
+.L.body.leaf_large:
+  .loc 1 121
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 121
+  mov eax, 64
+  movsxd rax, eax
+  mov r13, rax
+  .loc 1 121
+  mov eax, 3
+  mov r14, rax
+  .loc 1 121
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r14
+  add rax, rdi
+  mov rdi, r13
+  cmp rax, rdi
+  jge .L.opt.38
+.L.begin.11:
+  .loc 1 121
+  mov rax, rbx
+  shl eax, 1
+  mov dword ptr [rbp+rbx*4-256], eax
+  .loc 1 121
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 121
+  mov rax, rbx
+  shl eax, 1
+  mov dword ptr [rbp+rbx*4-256], eax
+  .loc 1 121
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 121
+  mov rax, rbx
+  shl eax, 1
+  mov dword ptr [rbp+rbx*4-256], eax
+  .loc 1 121
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 121
+  mov rax, rbx
+  shl eax, 1
+  mov dword ptr [rbp+rbx*4-256], eax
+.L.opt.39:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.11:
+  .loc 1 121
+  mov eax, 64
+  movsxd rax, eax
+  mov r13, rax
+  .loc 1 121
+  mov eax, 3
+  mov r14, rax
+  .loc 1 121
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r14
+  add rax, rdi
+  mov rdi, r13
+  cmp rax, rdi
+  jl .L.begin.11
+.L.opt.38:
+  .loc 1 121
+  cmp ebx, 64
+  jge .L..9
+.L.begin.12:
+  .loc 1 121
+  mov rax, rbx
+  shl eax, 1
+  mov dword ptr [rbp+rbx*4-256], eax
+.L..10:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.12:
+  cmp ebx, 64
+  jl .L.begin.12
+.L..9:
+  .loc 1 121
+  mov eax, 63
+  sub eax, r12d
+  movsxd rax, eax
+  movsxd rax, dword ptr [rbp+rax*4-256]
+  add eax, dword ptr [rbp+r12*4-256]
+.L.return.leaf_large:
+  mov rbx, [rbp-264]
+  mov r12, [rbp-272]
+  mov r13, [rbp-280]
+  mov r14, [rbp-288]
+  mov rsp, rbp
+  pop rbp
+  ret
+  .globl leaf_small
+  .text
+leaf_small:
+  mov [rsp-40], rbx
+  mov [rsp-48], r12
+  movsxd r12, edi
+.L.body.leaf_small:
+  .loc 1 120
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 120
+  mov rax, rbx
+  imul eax, ebx
+  mov dword ptr [rsp+rbx*4-32], eax
+  .loc 1 120
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 120
+  mov rax, rbx
+  imul eax, ebx
+  mov dword ptr [rsp+rbx*4-32], eax
+  .loc 1 120
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 120
+  mov rax, rbx
+  imul eax, ebx
+  mov dword ptr [rsp+rbx*4-32], eax
+  .loc 1 120
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 120
+  mov rax, rbx
+  imul eax, ebx
+  mov dword ptr [rsp+rbx*4-32], eax
+  .loc 1 120
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 120
+  mov rax, rbx
+  imul eax, ebx
+  mov dword ptr [rsp+rbx*4-32], eax
+  .loc 1 120
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 120
+  mov rax, rbx
+  imul eax, ebx
+  mov dword ptr [rsp+rbx*4-32], eax
+  .loc 1 120
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 120
+  mov rax, rbx
+  imul eax, ebx
+  mov dword ptr [rsp+rbx*4-32], eax
+  .loc 1 120
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 120
+  mov rax, rbx
+  imul eax, ebx
+  mov dword ptr [rsp+rbx*4-32], eax
+  .loc 1 120
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 120
+  movsxd rax, dword ptr [rsp+r12*4-32]
+.L.return.leaf_small:
+  mov rbx, [rsp-40]
+  mov r12, [rsp-48]
+  ret
+  .globl tail_local
+  .text
+tail_local:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-16], rbx
+  movsxd rbx, edi
+.L.body.tail_local:
+  .loc 1 119
+  mov rax, rbx
+  mov dword ptr [rbp-4], eax
+  .loc 1 119
+  lea rdi, [rbp-4]
+  call tail_deref
+.L.return.tail_local:
+  mov rbx, [rbp-16]
+  mov rsp, rbp
+  pop rbp
+  ret
+  .globl tail_deref
+  .text
+tail_deref:
+  mov [rsp-8], rbx
+  mov rbx, rdi
+.L.body.tail_deref:
+  .loc 1 118
+  movsxd rax, dword ptr [rbx]
+.L.return.tail_deref:
+  mov rbx, [rsp-8]
+  ret
+  .globl tail_char
+  .text
+tail_char:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  movsxd rbx, edi
+.L.body.tail_char:
+  .loc 1 117
+  mov edi, ebx
+  xor esi, esi
+  call tail_count
+  movsx eax, al
+.L.return.tail_char:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+  .globl tail_add
+  .text
+tail_add:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  mov [rbp-16], r12
+  mov rbx, rdi
+  mov r12, rsi
+.L.body.tail_add:
+  .loc 1 116
+  mov rdi, r12
+  mov rsi, rbx
+  jmp .L.tail.tail_add.0
+.L.return.tail_add:
+  mov rbx, [rbp-8]
+  mov r12, [rbp-16]
+  mov rsp, rbp
+  pop rbp
+  ret
+.L.tail.tail_add.0:
+  mov rbx, [rbp-8]
+  mov r12, [rbp-16]
+  mov rsp, rbp
+  pop rbp
+  jmp add_long
+  .globl tail_is_even
+  .text
+tail_is_even:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  movsxd rbx, edi
+.L.body.tail_is_even:
+  .loc 1 115
+  cmp ebx, 0
+  jne .L.else.13
+  .loc 1 115
+  mov eax, 1
+  jmp .L.return.tail_is_even
+.L.else.13:
+.L.end.13:
+  .loc 1 115
+  mov rax, rbx
+  sub eax, 1
+  mov rdi, rax
+  jmp .L.tail.tail_is_even.0
+.L.return.tail_is_even:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.L.tail.tail_is_even.0:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  jmp tail_is_odd
+  .globl tail_is_odd
+  .text
+tail_is_odd:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  movsxd rbx, edi
+.L.body.tail_is_odd:
+  .loc 1 114
+  cmp ebx, 0
+  jne .L.else.14
+  .loc 1 114
+  xor eax, eax
+  jmp .L.return.tail_is_odd
+.L.else.14:
+.L.end.14:
+  .loc 1 114
+  mov rax, rbx
+  sub eax, 1
+  mov rdi, rax
+  jmp .L.tail.tail_is_odd.0
+.L.return.tail_is_odd:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+.L.tail.tail_is_odd.0:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  jmp tail_is_even
+  .globl tail_count
+  .text
+tail_count:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 32
+  mov [rbp-8], rbx
+  mov [rbp-16], r12
+  mov [rbp-24], r13
+  movsxd rbx, edi
+  movsxd r12, esi
+.L.body.tail_count:
+  .loc 1 112
+  cmp ebx, 0
+  jne .L.else.15
+  .loc 1 112
+  mov rax, r12
+  jmp .L.return.tail_count
+.L.else.15:
+.L.end.15:
+  .loc 1 112
+  mov rax, rbx
+  sub eax, 1
+  mov r13, rax
+  .loc 1 112
+  mov rax, r12
+  add eax, 1
+  mov rsi, rax
+  mov rdi, r13
+  movsxd rbx, edi
+  movsxd r12, esi
+  jmp .L.body.tail_count
+.L.return.tail_count:
+  mov rbx, [rbp-8]
+  mov r12, [rbp-16]
+  mov r13, [rbp-24]
+  mov rsp, rbp
+  pop rbp
+  ret
+  .local inl_fact
+  .text
+inl_fact:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  movsxd rbx, edi
+.L.body.inl_fact:
+  .loc 1 110
+  cmp ebx, 1
+  jg .L.else.16
+  .loc 1 110
+  mov eax, 1
+  jmp .L.return.inl_fact
+.L.else.16:
+.L.end.16:
+  .loc 1 110
+  mov rax, rbx
+  sub eax, 1
+  mov rdi, rax
+  call inl_fact
+  imul eax, ebx
+.L.return.inl_fact:
+  mov rbx, [rbp-8]
+  mov rsp, rbp
+  pop rbp
+  ret
+  .local inl_loop
+  .text
+inl_loop:
+  mov [rsp-8], rbx
+  mov [rsp-16], r12
+  mov [rsp-24], r13
+  movsxd r13, edi
+.L.body.inl_loop:
+  .loc 1 88
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 89
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 89
+  mov rax, rbx
+  cmp eax, r13d
+  jge .L..0
+.L.begin.17:
+  .loc 1 90
+  cmp ebx, 2
+  je .L..1
+  .loc 1 90
+.L.else.18:
+.L.end.18:
+  .loc 1 91
+  cmp ebx, 5
+  je .L..0
+  .loc 1 91
+.L.else.19:
+.L.end.19:
+  .loc 1 92
+  mov rax, rbx
+  add r12d, eax
+  movsxd r12, r12d
+.L..1:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.17:
+  .loc 1 89
+  mov rax, rbx
+  cmp eax, r13d
+  jl .L.begin.17
+.L..0:
+  .loc 1 94
+  mov rax, r12
+.L.return.inl_loop:
+  mov rbx, [rsp-8]
+  mov r12, [rsp-16]
+  mov r13, [rsp-24]
+  ret
+  .globl add_long
+  .text
+add_long:
+  mov [rsp-8], rbx
+  mov [rsp-16], r12
+  mov rbx, rdi
+  mov r12, rsi
+.L.body.add_long:
+  .loc 1 82
+  mov rax, rbx
+  add rax, r12
+.L.return.add_long:
+  mov rbx, [rsp-8]
+  mov r12, [rsp-16]
+  ret
+  .globl add3_arr
+  .text
+add3_arr:
+  mov [rsp-8], rbx
+  mov [rsp-16], r12
+  mov [rsp-24], r13
+  mov rbx, rdi
+  movsxd r12, esi
+  mov r13, rdx
+.L.body.add3_arr:
+  .loc 1 81
+  movsx eax, byte ptr [r13]
+  add eax, dword ptr [rbx+r12*4]
+.L.return.add3_arr:
+  mov rbx, [rsp-8]
+  mov r12, [rsp-16]
+  mov r13, [rsp-24]
+  ret
+  .globl param_decay
+  .text
+param_decay:
+  mov [rsp-8], rbx
+  mov rbx, rdi
+.L.body.param_decay:
+  .loc 1 80
+  movsxd rax, dword ptr [rbx]
+.L.return.param_decay:
+  mov rbx, [rsp-8]
+  ret
+  .globl bool_fn_sub
+  .text
+bool_fn_sub:
+  mov [rsp-8], rbx
+  movsx ebx, dil
+.L.body.bool_fn_sub:
+  .loc 1 78
+  mov rax, rbx
+  sub eax, 1
+  test eax, eax
+  setne al
+  movzx eax, al
+.L.return.bool_fn_sub:
+  mov rbx, [rsp-8]
+  ret
+  .globl bool_fn_add
+  .text
+bool_fn_add:
+  mov [rsp-8], rbx
+  movsx ebx, dil
+.L.body.bool_fn_add:
+  .loc 1 77
+  mov rax, rbx
+  add eax, 1
+  test eax, eax
+  setne al
+  movzx eax, al
+.L.return.bool_fn_add:
+  mov rbx, [rsp-8]
+  ret
+  .globl char_arg
+  .text
+char_arg:
+  mov [rsp-8], rbx
+  movsx ebx, dil
+.L.body.char_arg:
+  .loc 1 76
+  mov rax, rbx
+.L.return.char_arg:
+  mov rbx, [rsp-8]
+  ret
+  .globl div_long
+  .text
+div_long:
+  mov [rsp-8], rbx
+  mov [rsp-16], r12
+  mov rbx, rdi
+  mov r12, rsi
+.L.body.div_long:
+  .loc 1 74
+  mov rax, rbx
+  cqo
+  idiv r12
+.L.return.div_long:
+  mov rbx, [rsp-8]
+  mov r12, [rsp-16]
+  ret
+  .globl int_to_char
+  .text
+int_to_char:
+  mov [rsp-8], rbx
+  movsxd rbx, edi
+.L.body.int_to_char:
+  .loc 1 72
+  mov rax, rbx
+  movsx eax, al
+.L.return.int_to_char:
+  mov rbx, [rsp-8]
+  ret
+  .globl g1_ptr
+  .text
+g1_ptr:
+.L.body.g1_ptr:
+  .loc 1 71
+  lea rax, g1[rip]
+.L.return.g1_ptr:
+  ret
+  .globl sub_short
+  .text
+sub_short:
+  mov [rsp-8], rbx
+  mov [rsp-16], r12
+  mov [rsp-24], r13
+  movsx ebx, di
+  movsx r12d, si
+  movsx r13d, dx
+.L.body.sub_short:
+  .loc 1 68
+  mov rax, rbx
+  sub eax, r12d
+  sub eax, r13d
+.L.return.sub_short:
+  mov rbx, [rsp-8]
+  mov r12, [rsp-16]
+  mov r13, [rsp-24]
+  ret
+  .globl sub_long
+  .text
+sub_long:
+  mov [rsp-8], rbx
+  mov [rsp-16], r12
+  mov [rsp-24], r13
+  mov rbx, rdi
+  mov r12, rsi
+  mov r13, rdx
+.L.body.sub_long:
+  .loc 1 65
+  mov rax, rbx
+  sub rax, r12
+  sub rax, r13
+.L.return.sub_long:
+  mov rbx, [rsp-8]
+  mov r12, [rsp-16]
+  mov r13, [rsp-24]
+  ret
+  .globl fib
+  .text
+fib:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+  mov [rbp-8], rbx
+  mov [rbp-16], r12
+  movsxd rbx, edi
+.L.body.fib:
+  .loc 1 60
+  cmp ebx, 1
+  jg .L.else.20
+  .loc 1 61
+  mov eax, 1
+  jmp .L.return.fib
+.L.else.20:
+.L.end.20:
+  .loc 1 62
+  mov rax, rbx
+  sub eax, 2
+  mov rdi, rax
+  call fib
+  mov r12, rax
+  .loc 1 62
+  mov rax, rbx
+  sub eax, 1
+  mov rdi, rax
+  call fib
+  mov rdi, r12
+  add eax, edi
+.L.return.fib:
+  mov rbx, [rbp-8]
+  mov r12, [rbp-16]
+  mov rsp, rbp
+  pop rbp
+  ret
+  .globl sub_char
+  .text
+sub_char:
+  mov [rsp-8], rbx
+  mov [rsp-16], r12
+  mov [rsp-24], r13
+  movsx ebx, dil
+  movsx r12d, sil
+  movsx r13d, dl
+.L.body.sub_char:
+  .loc 1 57
+  mov rax, rbx
+  sub eax, r12d
+  sub eax, r13d
+.L.return.sub_char:
+  mov rbx, [rsp-8]
+  mov r12, [rsp-16]
+  mov r13, [rsp-24]
+  ret
+  .globl addx
+  .text
+addx:
+  mov [rsp-8], rbx
+  mov [rsp-16], r12
+  mov rbx, rdi
+  movsxd r12, esi
+.L.body.addx:
+  .loc 1 54
+  movsxd rax, dword ptr [rbx]
+  add eax, r12d
+.L.return.addx:
+  mov rbx, [rsp-8]
+  mov r12, [rsp-16]
+  ret
+  .globl add6
+  .text
+add6:
+  mov [rsp-24], rbx
+  mov [rsp-32], r12
+  mov [rsp-40], r13
+  movsxd rbx, edi
+  movsxd r12, esi
+  movsxd r13, edx
+  mov [rsp-4], ecx
+  mov [rsp-8], r8d
+  mov [rsp-12], r9d
+.L.body.add6:
+  .loc 1 51
+  mov rax, rbx
+  add eax, r12d
+  add eax, r13d
+  add eax, dword ptr [rsp-4]
+  add eax, dword ptr [rsp-8]
+  add eax, dword ptr [rsp-12]
+.L.return.add6:
+  mov rbx, [rsp-24]
+  mov r12, [rsp-32]
+  mov r13, [rsp-40]
+  ret
+  .globl sub2
+  .text
+sub2:
+  mov [rsp-8], rbx
+  mov [rsp-16], r12
+  movsxd rbx, edi
+  movsxd r12, esi
+.L.body.sub2:
+  .loc 1 48
+  mov rax, rbx
+  sub eax, r12d
+.L.return.sub2:
+  mov rbx, [rsp-8]
+  mov r12, [rsp-16]
+  ret
+  .globl add2
+  .text
+add2:
+  mov [rsp-8], rbx
+  mov [rsp-16], r12
+  movsxd rbx, edi
+  movsxd r12, esi
+.L.body.add2:
+  .loc 1 45
+  mov rax, rbx
+  add eax, r12d
+.L.return.add2:
+  mov rbx, [rsp-8]
+  mov r12, [rsp-16]
+  ret
+  .globl ret3
+  .text
+ret3:
+.L.body.ret3:
+  .loc 1 41
+  mov eax, 3
+.L.return.ret3:
+  ret
@@ -28,6 +28,9 @@ struct {int a[2];} g41[2] = {1, 2, 3, 4};
 char g43[][4] = {'f', 'o', 'o', 0, 'b', 'a', 'r', 0};
 char *g44 = {"foo"};
 
+int init_side;
+int init_bump() { return init_side = init_side + 10; }
+
 int main() {
   ASSERT(1, ({ int x[3]={1,2,3}; x[0]; }));
   ASSERT(2, ({ int x[3]={1,2,3}; x[1]; }));
@@ -167,6 +170,26 @@ int main() {
   ASSERT(1, ({ union {int a; char b;} x={1,}; x.a; }));
   ASSERT(2, ({ enum {x,y,z,}; z; }));
 
+  ASSERT(0, ({ int x[100]={1,2,3}; x[99]; }));
+  ASSERT(0, ({ int x[100]={1}; int s=0; for (int i=0; i<100; i++) s+=x[i]; s-1; }));
+  ASSERT(0, ({ struct {char a; long b; char c[5];} x={1,2}; x.c[0]+x.c[4]; }));
+  ASSERT(0, ({ struct {char a; long b;} x={1,2}; ((char *)&x)[1]; }));
+  ASSERT(0, ({ union {char a; long b;} x={1}; x.b>>8; }));
+  ASSERT(0, ({ char x[37]={1}; x[16]+x[32]+x[36]; }));
+
+  ASSERT(45, ({ int x[10]={0,1,2,3,4,5,6,7,8,9}; int s=0; for (int i=0; i<10; i++) s+=x[i]; s; }));
+  ASSERT(7, ({ int x[10]={0,1,2,3,4,5,6,7,8,9}; x[3]=7; int y[10]={0,1,2,3,4,5,6,7,8,9}; x[3]+y[0]; }));
+  ASSERT(0, ({ int i=0; int x[2][5]={{1,2,3,4,5},{6,7,8,9}}; x[1][4]; }));
+  ASSERT(-1, ({ char x[10]={-1,2,3,4,5,6,7,8,(char)255,1<<2}; x[8]; }));
+  ASSERT(4, ({ char x[10]={-1,2,3,4,5,6,7,8,(char)255,1<<2}; x[9]; }));
+  ASSERT(3, ({ int z=3; int x[10]={0,1,2,3,4,5,6,7,8,z}; x[9]; }));
+  ASSERT(10, ({ struct {char a; long b[4]; short c[4];} x={1,{2,3,4,5},{6,7,8,9}}; x.a+x.c[1]+x.b[0]; }));
+  ASSERT('o', ({ char x[20]="hello, world"; x[4]; }));
+  ASSERT(0, ({ char x[20]="hello, world"; x[19]; }));
+  ASSERT(5, ({ int a[10]={(init_side=5, 1),2,3,4,5,6,7,8,9,10}; init_side; }));
+  ASSERT(15, ({ int a[10]={(init_bump(), 1),2,3,4,5,6,7,8,9,10}; init_side; }));
+  ASSERT(55, ({ int a[10]={(init_side=0, 1),2,3,4,5,6,7,8,9,10}; int s=0; for (int i=0; i<10; i++) s=s+a[i]; s; }));
+
   printf("OK\n");
   return 0;
 }
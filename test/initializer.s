@@ -0,0 +1,7011 @@
+.file 1 "-"
+.intel_syntax noprefix
+  .local .L..155
+  .data
+.L..155:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+  .local .L..154
+  .data
+.L..154:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 105
+  .byte 116
+  .byte 95
+  .byte 115
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 61
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 44
+  .byte 55
+  .byte 44
+  .byte 56
+  .byte 44
+  .byte 57
+  .byte 44
+  .byte 49
+  .byte 48
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 115
+  .byte 43
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..151
+  .data
+.L..151:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 105
+  .byte 116
+  .byte 95
+  .byte 98
+  .byte 117
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 41
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 44
+  .byte 55
+  .byte 44
+  .byte 56
+  .byte 44
+  .byte 57
+  .byte 44
+  .byte 49
+  .byte 48
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 105
+  .byte 116
+  .byte 95
+  .byte 115
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..150
+  .data
+.L..150:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 105
+  .byte 116
+  .byte 95
+  .byte 115
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 61
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 44
+  .byte 55
+  .byte 44
+  .byte 56
+  .byte 44
+  .byte 57
+  .byte 44
+  .byte 49
+  .byte 48
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 105
+  .byte 116
+  .byte 95
+  .byte 115
+  .byte 105
+  .byte 100
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..149
+  .data
+.L..149:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 104
+  .byte 101
+  .byte 108
+  .byte 108
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 119
+  .byte 111
+  .byte 114
+  .byte 108
+  .byte 100
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 57
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..148
+  .section .rodata
+.L..148:
+  .byte 104
+  .byte 101
+  .byte 108
+  .byte 108
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 119
+  .byte 111
+  .byte 114
+  .byte 108
+  .byte 100
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .local .L..147
+  .data
+.L..147:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 104
+  .byte 101
+  .byte 108
+  .byte 108
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 119
+  .byte 111
+  .byte 114
+  .byte 108
+  .byte 100
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..146
+  .section .rodata
+.L..146:
+  .byte 104
+  .byte 101
+  .byte 108
+  .byte 108
+  .byte 111
+  .byte 44
+  .byte 32
+  .byte 119
+  .byte 111
+  .byte 114
+  .byte 108
+  .byte 100
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .local .L..145
+  .data
+.L..145:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 98
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 123
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 54
+  .byte 44
+  .byte 55
+  .byte 44
+  .byte 56
+  .byte 44
+  .byte 57
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 43
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 43
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..144
+  .section .rodata
+.L..144:
+  .byte 1
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 2
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 3
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 4
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 5
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 6
+  .byte 0
+  .byte 7
+  .byte 0
+  .byte 8
+  .byte 0
+  .byte 9
+  .byte 0
+  .local .L..143
+  .data
+.L..143:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 122
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 44
+  .byte 55
+  .byte 44
+  .byte 56
+  .byte 44
+  .byte 122
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 57
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..142
+  .data
+.L..142:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 45
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 44
+  .byte 55
+  .byte 44
+  .byte 56
+  .byte 44
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 50
+  .byte 53
+  .byte 53
+  .byte 44
+  .byte 49
+  .byte 60
+  .byte 60
+  .byte 50
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 57
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..141
+  .section .rodata
+.L..141:
+  .byte -1
+  .byte 2
+  .byte 3
+  .byte 4
+  .byte 5
+  .byte 6
+  .byte 7
+  .byte 8
+  .byte -1
+  .byte 4
+  .local .L..140
+  .data
+.L..140:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 45
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 44
+  .byte 55
+  .byte 44
+  .byte 56
+  .byte 44
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 50
+  .byte 53
+  .byte 53
+  .byte 44
+  .byte 49
+  .byte 60
+  .byte 60
+  .byte 50
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 56
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..139
+  .section .rodata
+.L..139:
+  .byte -1
+  .byte 2
+  .byte 3
+  .byte 4
+  .byte 5
+  .byte 6
+  .byte 7
+  .byte 8
+  .byte -1
+  .byte 4
+  .local .L..138
+  .data
+.L..138:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 54
+  .byte 44
+  .byte 55
+  .byte 44
+  .byte 56
+  .byte 44
+  .byte 57
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..137
+  .section .rodata
+.L..137:
+  .byte 1
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 2
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 3
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 4
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 5
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 6
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 7
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 8
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 9
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .local .L..136
+  .data
+.L..136:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 44
+  .byte 55
+  .byte 44
+  .byte 56
+  .byte 44
+  .byte 57
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 44
+  .byte 55
+  .byte 44
+  .byte 56
+  .byte 44
+  .byte 57
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 43
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..135
+  .section .rodata
+.L..135:
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 1
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 2
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 3
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 4
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 5
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 6
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 7
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 8
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 9
+  .byte 0
+  .byte 0
+  .byte 0
+  .local .L..134
+  .section .rodata
+.L..134:
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 1
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 2
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 3
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 4
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 5
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 6
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 7
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 8
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 9
+  .byte 0
+  .byte 0
+  .byte 0
+  .local .L..133
+  .data
+.L..133:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 44
+  .byte 55
+  .byte 44
+  .byte 56
+  .byte 44
+  .byte 57
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 120
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..130
+  .section .rodata
+.L..130:
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 1
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 2
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 3
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 4
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 5
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 6
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 7
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 8
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 9
+  .byte 0
+  .byte 0
+  .byte 0
+  .local .L..129
+  .data
+.L..129:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 55
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 54
+  .byte 93
+  .byte 43
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 50
+  .byte 93
+  .byte 43
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 54
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..128
+  .data
+.L..128:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 117
+  .byte 110
+  .byte 105
+  .byte 111
+  .byte 110
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 62
+  .byte 62
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..127
+  .data
+.L..127:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 38
+  .byte 120
+  .byte 41
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..126
+  .data
+.L..126:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 43
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..125
+  .data
+.L..125:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 120
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 45
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..122
+  .data
+.L..122:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 57
+  .byte 57
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..121
+  .data
+.L..121:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 101
+  .byte 110
+  .byte 117
+  .byte 109
+  .byte 32
+  .byte 123
+  .byte 120
+  .byte 44
+  .byte 121
+  .byte 44
+  .byte 122
+  .byte 44
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..120
+  .data
+.L..120:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 117
+  .byte 110
+  .byte 105
+  .byte 111
+  .byte 110
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..119
+  .data
+.L..119:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 44
+  .byte 98
+  .byte 44
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..118
+  .data
+.L..118:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..117
+  .data
+.L..117:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 52
+  .byte 52
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 41
+  .byte 0
+  .local .L..116
+  .data
+.L..116:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+  .local .L..115
+  .data
+.L..115:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 52
+  .byte 51
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+  .local .L..114
+  .data
+.L..114:
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+  .local .L..113
+  .data
+.L..113:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 52
+  .byte 51
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 41
+  .byte 0
+  .local .L..112
+  .data
+.L..112:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+  .local .L..111
+  .data
+.L..111:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..110
+  .data
+.L..110:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..109
+  .data
+.L..109:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..108
+  .data
+.L..108:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..107
+  .data
+.L..107:
+  .byte 103
+  .byte 52
+  .byte 49
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+  .local .L..106
+  .data
+.L..106:
+  .byte 103
+  .byte 52
+  .byte 49
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..105
+  .data
+.L..105:
+  .byte 103
+  .byte 52
+  .byte 49
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+  .local .L..104
+  .data
+.L..104:
+  .byte 103
+  .byte 52
+  .byte 49
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..103
+  .data
+.L..103:
+  .byte 103
+  .byte 52
+  .byte 48
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+  .local .L..102
+  .data
+.L..102:
+  .byte 103
+  .byte 52
+  .byte 48
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..101
+  .data
+.L..101:
+  .byte 103
+  .byte 52
+  .byte 48
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+  .local .L..100
+  .data
+.L..100:
+  .byte 103
+  .byte 52
+  .byte 48
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..99
+  .data
+.L..99:
+  .byte 103
+  .byte 51
+  .byte 49
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 0
+  .local .L..98
+  .data
+.L..98:
+  .byte 103
+  .byte 51
+  .byte 49
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+  .local .L..97
+  .data
+.L..97:
+  .byte 103
+  .byte 51
+  .byte 49
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..96
+  .data
+.L..96:
+  .byte 42
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 103
+  .byte 50
+  .byte 57
+  .byte 0
+  .local .L..95
+  .data
+.L..95:
+  .byte 42
+  .byte 103
+  .byte 50
+  .byte 56
+  .byte 0
+  .local .L..94
+  .data
+.L..94:
+  .byte 42
+  .byte 103
+  .byte 50
+  .byte 55
+  .byte 0
+  .local .L..93
+  .data
+.L..93:
+  .byte 42
+  .byte 103
+  .byte 50
+  .byte 53
+  .byte 0
+  .local .L..92
+  .data
+.L..92:
+  .byte 103
+  .byte 50
+  .byte 52
+  .byte 0
+  .local .L..91
+  .data
+.L..91:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 51
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 43
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+  .local .L..90
+  .data
+.L..90:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+  .local .L..89
+  .data
+.L..89:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 51
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+  .local .L..88
+  .data
+.L..88:
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+  .local .L..87
+  .data
+.L..87:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 51
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+  .local .L..86
+  .data
+.L..86:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+  .local .L..85
+  .data
+.L..85:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 50
+  .byte 43
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+  .local .L..84
+  .data
+.L..84:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+  .local .L..83
+  .data
+.L..83:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+  .local .L..82
+  .data
+.L..82:
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+  .local .L..81
+  .data
+.L..81:
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 41
+  .byte 0
+  .local .L..80
+  .data
+.L..80:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+  .local .L..79
+  .data
+.L..79:
+  .byte 109
+  .byte 101
+  .byte 109
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 57
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..78
+  .data
+.L..78:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+  .local .L..77
+  .data
+.L..77:
+  .byte 109
+  .byte 101
+  .byte 109
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 56
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 92
+  .byte 48
+  .byte 92
+  .byte 48
+  .byte 92
+  .byte 48
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..76
+  .data
+.L..76:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .local .L..75
+  .data
+.L..75:
+  .byte 109
+  .byte 101
+  .byte 109
+  .byte 99
+  .byte 109
+  .byte 112
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 55
+  .byte 44
+  .byte 32
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 34
+  .byte 44
+  .byte 32
+  .byte 55
+  .byte 41
+  .byte 0
+  .local .L..74
+  .data
+.L..74:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+  .local .L..73
+  .data
+.L..73:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 57
+  .byte 41
+  .byte 0
+  .local .L..72
+  .data
+.L..72:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 56
+  .byte 41
+  .byte 0
+  .local .L..71
+  .data
+.L..71:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 55
+  .byte 41
+  .byte 0
+  .local .L..70
+  .data
+.L..70:
+  .byte 103
+  .byte 49
+  .byte 51
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+  .local .L..69
+  .data
+.L..69:
+  .byte 103
+  .byte 49
+  .byte 51
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..68
+  .data
+.L..68:
+  .byte 103
+  .byte 49
+  .byte 51
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+  .local .L..67
+  .data
+.L..67:
+  .byte 103
+  .byte 49
+  .byte 51
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..66
+  .data
+.L..66:
+  .byte 103
+  .byte 49
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+  .local .L..65
+  .data
+.L..65:
+  .byte 103
+  .byte 49
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..64
+  .data
+.L..64:
+  .byte 103
+  .byte 49
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+  .local .L..63
+  .data
+.L..63:
+  .byte 103
+  .byte 49
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..62
+  .data
+.L..62:
+  .byte 103
+  .byte 49
+  .byte 49
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 0
+  .local .L..61
+  .data
+.L..61:
+  .byte 103
+  .byte 49
+  .byte 49
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 0
+  .local .L..60
+  .data
+.L..60:
+  .byte 103
+  .byte 49
+  .byte 49
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 0
+  .local .L..59
+  .data
+.L..59:
+  .byte 103
+  .byte 49
+  .byte 49
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 0
+  .local .L..58
+  .data
+.L..58:
+  .byte 103
+  .byte 57
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 0
+  .local .L..57
+  .data
+.L..57:
+  .byte 103
+  .byte 57
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+  .local .L..56
+  .data
+.L..56:
+  .byte 103
+  .byte 57
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..55
+  .data
+.L..55:
+  .byte 103
+  .byte 54
+  .byte 0
+  .local .L..54
+  .data
+.L..54:
+  .byte 103
+  .byte 53
+  .byte 0
+  .local .L..53
+  .data
+.L..53:
+  .byte 103
+  .byte 52
+  .byte 0
+  .local .L..52
+  .data
+.L..52:
+  .byte 103
+  .byte 51
+  .byte 0
+  .local .L..51
+  .data
+.L..51:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 117
+  .byte 110
+  .byte 105
+  .byte 111
+  .byte 110
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 44
+  .byte 98
+  .byte 44
+  .byte 99
+  .byte 44
+  .byte 100
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 102
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 52
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 49
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 102
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..50
+  .data
+.L..50:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 117
+  .byte 110
+  .byte 105
+  .byte 111
+  .byte 110
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 120
+  .byte 48
+  .byte 49
+  .byte 48
+  .byte 50
+  .byte 48
+  .byte 51
+  .byte 48
+  .byte 52
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..49
+  .data
+.L..49:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 117
+  .byte 110
+  .byte 105
+  .byte 111
+  .byte 110
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 98
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 120
+  .byte 48
+  .byte 49
+  .byte 48
+  .byte 50
+  .byte 48
+  .byte 51
+  .byte 48
+  .byte 52
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..48
+  .data
+.L..48:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 44
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 84
+  .byte 59
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..47
+  .data
+.L..47:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 44
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 84
+  .byte 59
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 121
+  .byte 44
+  .byte 32
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 122
+  .byte 61
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 122
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..46
+  .data
+.L..46:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 44
+  .byte 98
+  .byte 44
+  .byte 99
+  .byte 44
+  .byte 100
+  .byte 44
+  .byte 101
+  .byte 44
+  .byte 102
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 84
+  .byte 59
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 46
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..45
+  .data
+.L..45:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..44
+  .data
+.L..44:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..43
+  .data
+.L..43:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..42
+  .data
+.L..42:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..41
+  .data
+.L..41:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..40
+  .data
+.L..40:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..39
+  .data
+.L..39:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..38
+  .data
+.L..38:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..37
+  .data
+.L..37:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..36
+  .data
+.L..36:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..35
+  .data
+.L..35:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 99
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..34
+  .data
+.L..34:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..33
+  .data
+.L..33:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..32
+  .data
+.L..32:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 84
+  .byte 91
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 34
+  .byte 120
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..31
+  .data
+.L..31:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 84
+  .byte 91
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 34
+  .byte 120
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..30
+  .data
+.L..30:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 84
+  .byte 91
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 34
+  .byte 120
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..29
+  .data
+.L..29:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 116
+  .byte 121
+  .byte 112
+  .byte 101
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 84
+  .byte 91
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 84
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 34
+  .byte 120
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..28
+  .data
+.L..28:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..27
+  .data
+.L..27:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..26
+  .data
+.L..26:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..25
+  .data
+.L..25:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 44
+  .byte 34
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 34
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..24
+  .section .rodata
+.L..24:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 0
+  .local .L..23
+  .data
+.L..23:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 44
+  .byte 34
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 34
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..22
+  .section .rodata
+.L..22:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 0
+  .local .L..21
+  .data
+.L..21:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 44
+  .byte 34
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 34
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..20
+  .section .rodata
+.L..20:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 0
+  .local .L..19
+  .data
+.L..19:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 44
+  .byte 34
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 34
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..18
+  .section .rodata
+.L..18:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 0
+  .local .L..17
+  .data
+.L..17:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..16
+  .data
+.L..16:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..15
+  .data
+.L..15:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..14
+  .data
+.L..14:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..13
+  .data
+.L..13:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..12
+  .data
+.L..12:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..11
+  .data
+.L..11:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..10
+  .data
+.L..10:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..9
+  .data
+.L..9:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..8
+  .data
+.L..8:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..7
+  .data
+.L..7:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..6
+  .data
+.L..6:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..5
+  .data
+.L..5:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..4
+  .data
+.L..4:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..3
+  .data
+.L..3:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..2
+  .data
+.L..2:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..1
+  .data
+.L..1:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .globl init_side
+  .bss
+init_side:
+  .zero 4
+  .local .L..0
+  .data
+.L..0:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+  .globl g44
+  .data
+g44:
+  .quad .L..0+0
+  .globl g43
+  .data
+g43:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 0
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+  .globl g41
+  .data
+g41:
+  .byte 1
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 2
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 3
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 4
+  .byte 0
+  .byte 0
+  .byte 0
+  .globl g40
+  .data
+g40:
+  .byte 1
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 2
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 3
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 4
+  .byte 0
+  .byte 0
+  .byte 0
+  .globl g31
+  .data
+g31:
+  .quad g30+0
+  .globl g30
+  .data
+g30:
+  .byte 1
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 2
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 3
+  .byte 0
+  .byte 0
+  .byte 0
+  .globl g29
+  .data
+g29:
+  .quad g26+0
+  .globl g28
+  .data
+g28:
+  .quad g11+8
+  .globl g27
+  .data
+g27:
+  .quad g26+4
+  .globl g26
+  .data
+g26:
+  .byte 1
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 2
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 3
+  .byte 0
+  .byte 0
+  .byte 0
+  .globl g25
+  .data
+g25:
+  .quad g24+0
+  .globl g24
+  .data
+g24:
+  .byte 3
+  .byte 0
+  .byte 0
+  .byte 0
+  .globl g23
+  .data
+g23:
+  .quad g17+0
+  .quad g17+3
+  .quad g17-3
+  .globl g22
+  .data
+g22:
+  .quad g17-3
+  .globl g21
+  .data
+g21:
+  .quad g17+3
+  .globl g20
+  .data
+g20:
+  .quad g17+0
+  .globl g19
+  .data
+g19:
+  .byte 102
+  .byte 111
+  .byte 111
+  .globl g18
+  .data
+g18:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .globl g17
+  .data
+g17:
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 0
+  .globl g13
+  .data
+g13:
+  .byte 4
+  .byte 3
+  .byte 2
+  .byte 1
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 8
+  .byte 7
+  .byte 6
+  .byte 5
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .globl g12
+  .data
+g12:
+  .byte 1
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 2
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .globl g11
+  .data
+g11:
+  .byte 1
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 2
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 3
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 4
+  .byte 0
+  .byte 0
+  .byte 0
+  .globl g9
+  .data
+g9:
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 1
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 2
+  .byte 0
+  .byte 0
+  .byte 0
+  .globl g6
+  .data
+g6:
+  .byte 6
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .globl g5
+  .data
+g5:
+  .byte 5
+  .byte 0
+  .byte 0
+  .byte 0
+  .globl g4
+  .data
+g4:
+  .byte 4
+  .byte 0
+  .globl g3
+  .data
+g3:
+  .byte 3
+  .globl main
+  .text
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 2096
+  mov [rbp-2064], rbx
+  mov [rbp-2072], r12
+  mov [rbp-2080], r13
+  mov [rbp-2088], r14
+  mov [rbp-2096], r15
+.L.body.main:
+  .loc 1 70
+  mov eax, 1
+  mov dword ptr [rbp-2056], eax
+  .loc 1 70
+  mov eax, 2
+  mov dword ptr [rbp-2052], eax
+  .loc 1 70
+  mov eax, 3
+  mov dword ptr [rbp-2048], eax
+  .loc 1 70
+  movsxd rax, dword ptr [rbp-2056]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..1[rip]
+  call assert
+  .loc 1 71
+  mov eax, 1
+  mov dword ptr [rbp-2044], eax
+  .loc 1 71
+  mov eax, 2
+  mov dword ptr [rbp-2040], eax
+  .loc 1 71
+  mov eax, 3
+  mov dword ptr [rbp-2036], eax
+  .loc 1 71
+  movsxd rax, dword ptr [rbp-2040]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..2[rip]
+  call assert
+  .loc 1 72
+  mov eax, 1
+  mov dword ptr [rbp-2032], eax
+  .loc 1 72
+  mov eax, 2
+  mov dword ptr [rbp-2028], eax
+  .loc 1 72
+  mov eax, 3
+  mov dword ptr [rbp-2024], eax
+  .loc 1 72
+  movsxd rax, eax
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..3[rip]
+  call assert
+  .loc 1 73
+  mov eax, 1
+  mov dword ptr [rbp-2020], eax
+  .loc 1 73
+  mov eax, 2
+  mov dword ptr [rbp-2016], eax
+  .loc 1 73
+  mov eax, 3
+  mov dword ptr [rbp-2012], eax
+  .loc 1 73
+  movsxd rax, eax
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..4[rip]
+  call assert
+  .loc 1 74
+  mov eax, 1
+  mov dword ptr [rbp-2008], eax
+  .loc 1 74
+  mov eax, 2
+  mov dword ptr [rbp-2004], eax
+  .loc 1 74
+  mov eax, 3
+  mov dword ptr [rbp-2000], eax
+  .loc 1 74
+  mov eax, 4
+  mov dword ptr [rbp-1996], eax
+  .loc 1 74
+  mov eax, 5
+  mov dword ptr [rbp-1992], eax
+  .loc 1 74
+  mov eax, 6
+  mov dword ptr [rbp-1988], eax
+  .loc 1 74
+  movsxd rax, dword ptr [rbp-2004]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..5[rip]
+  call assert
+  .loc 1 75
+  mov eax, 1
+  mov dword ptr [rbp-1984], eax
+  .loc 1 75
+  mov eax, 2
+  mov dword ptr [rbp-1980], eax
+  .loc 1 75
+  mov eax, 3
+  mov dword ptr [rbp-1976], eax
+  .loc 1 75
+  mov eax, 4
+  mov dword ptr [rbp-1972], eax
+  .loc 1 75
+  mov eax, 5
+  mov dword ptr [rbp-1968], eax
+  .loc 1 75
+  mov eax, 6
+  mov dword ptr [rbp-1964], eax
+  .loc 1 75
+  movsxd rax, dword ptr [rbp-1972]
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..6[rip]
+  call assert
+  .loc 1 76
+  mov eax, 1
+  mov dword ptr [rbp-1960], eax
+  .loc 1 76
+  mov eax, 2
+  mov dword ptr [rbp-1956], eax
+  .loc 1 76
+  mov eax, 3
+  mov dword ptr [rbp-1952], eax
+  .loc 1 76
+  mov eax, 4
+  mov dword ptr [rbp-1948], eax
+  .loc 1 76
+  mov eax, 5
+  mov dword ptr [rbp-1944], eax
+  .loc 1 76
+  mov eax, 6
+  mov dword ptr [rbp-1940], eax
+  .loc 1 76
+  movsxd rax, eax
+  mov rsi, rax
+  mov edi, 6
+  lea rdx, .L..7[rip]
+  call assert
+  .loc 1 77
+  mov qword ptr [rbp-1936], 0
+  mov dword ptr [rbp-1928], 0
+  .loc 1 77
+  movsxd rax, dword ptr [rbp-1936]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..8[rip]
+  call assert
+  .loc 1 78
+  mov qword ptr [rbp-1924], 0
+  mov dword ptr [rbp-1916], 0
+  .loc 1 78
+  movsxd rax, dword ptr [rbp-1920]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..9[rip]
+  call assert
+  .loc 1 79
+  mov qword ptr [rbp-1912], 0
+  mov dword ptr [rbp-1904], 0
+  .loc 1 79
+  movsxd rax, dword ptr [rbp-1904]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..10[rip]
+  call assert
+  .loc 1 80
+  pxor xmm0, xmm0
+  movdqu [rbp-1892], xmm0
+  .loc 1 80
+  mov eax, 1
+  mov dword ptr [rbp-1900], eax
+  .loc 1 80
+  mov eax, 2
+  mov dword ptr [rbp-1896], eax
+  .loc 1 80
+  movsxd rax, eax
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..11[rip]
+  call assert
+  .loc 1 81
+  pxor xmm0, xmm0
+  movdqu [rbp-1868], xmm0
+  .loc 1 81
+  mov eax, 1
+  mov dword ptr [rbp-1876], eax
+  .loc 1 81
+  mov eax, 2
+  mov dword ptr [rbp-1872], eax
+  .loc 1 81
+  movsxd rax, dword ptr [rbp-1864]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..12[rip]
+  call assert
+  .loc 1 82
+  pxor xmm0, xmm0
+  movdqu [rbp-1844], xmm0
+  .loc 1 82
+  mov eax, 1
+  mov dword ptr [rbp-1852], eax
+  .loc 1 82
+  mov eax, 2
+  mov dword ptr [rbp-1848], eax
+  .loc 1 82
+  movsxd rax, dword ptr [rbp-1832]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..13[rip]
+  call assert
+  .loc 1 83
+  mov eax, 1
+  mov dword ptr [rbp-1828], eax
+  .loc 1 83
+  mov eax, 2
+  mov dword ptr [rbp-1824], eax
+  .loc 1 83
+  movsxd rax, eax
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..14[rip]
+  call assert
+  .loc 1 84
+  mov eax, 97
+  mov byte ptr [rbp-1820], al
+  .loc 1 84
+  mov eax, 98
+  mov byte ptr [rbp-1819], al
+  .loc 1 84
+  mov eax, 99
+  mov byte ptr [rbp-1818], al
+  .loc 1 84
+  xor eax, eax
+  mov byte ptr [rbp-1817], al
+  .loc 1 84
+  movsx eax, byte ptr [rbp-1820]
+  mov rsi, rax
+  mov edi, 97
+  lea rdx, .L..15[rip]
+  call assert
+  .loc 1 85
+  mov eax, 97
+  mov byte ptr [rbp-1816], al
+  .loc 1 85
+  mov eax, 98
+  mov byte ptr [rbp-1815], al
+  .loc 1 85
+  mov eax, 99
+  mov byte ptr [rbp-1814], al
+  .loc 1 85
+  xor eax, eax
+  mov byte ptr [rbp-1813], al
+  .loc 1 85
+  movsx eax, byte ptr [rbp-1814]
+  mov rsi, rax
+  mov edi, 99
+  lea rdx, .L..16[rip]
+  call assert
+  .loc 1 86
+  mov eax, 97
+  mov byte ptr [rbp-1812], al
+  .loc 1 86
+  mov eax, 98
+  mov byte ptr [rbp-1811], al
+  .loc 1 86
+  mov eax, 99
+  mov byte ptr [rbp-1810], al
+  .loc 1 86
+  xor eax, eax
+  mov byte ptr [rbp-1809], al
+  .loc 1 86
+  movsx eax, al
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..17[rip]
+  call assert
+  .loc 1 87
+  lea rax, [rbp-1808]
+  mov r14, rax
+  .loc 1 87
+  lea rax, .L..18[rip]
+  mov rdi, r14
+  mov r8, [rax+0]
+  mov [rdi+0], r8
+  .loc 1 87
+  movsx eax, byte ptr [rbp-1808]
+  mov rsi, rax
+  mov edi, 97
+  lea rdx, .L..19[rip]
+  call assert
+  .loc 1 88
+  lea rax, [rbp-1800]
+  mov r14, rax
+  .loc 1 88
+  lea rax, .L..20[rip]
+  mov rdi, r14
+  mov r8, [rax+0]
+  mov [rdi+0], r8
+  .loc 1 88
+  movsx eax, byte ptr [rbp-1797]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..21[rip]
+  call assert
+  .loc 1 89
+  lea rax, [rbp-1792]
+  mov r14, rax
+  .loc 1 89
+  lea rax, .L..22[rip]
+  mov rdi, r14
+  mov r8, [rax+0]
+  mov [rdi+0], r8
+  .loc 1 89
+  movsx eax, byte ptr [rbp-1788]
+  mov rsi, rax
+  mov edi, 100
+  lea rdx, .L..23[rip]
+  call assert
+  .loc 1 90
+  lea rax, [rbp-1784]
+  mov r14, rax
+  .loc 1 90
+  lea rax, .L..24[rip]
+  mov rdi, r14
+  mov r8, [rax+0]
+  mov [rdi+0], r8
+  .loc 1 90
+  movsx eax, byte ptr [rbp-1778]
+  mov rsi, rax
+  mov edi, 102
+  lea rdx, .L..25[rip]
+  call assert
+  .loc 1 91
+  mov eax, 1
+  mov dword ptr [rbp-1776], eax
+  .loc 1 91
+  mov eax, 2
+  mov dword ptr [rbp-1772], eax
+  .loc 1 91
+  mov eax, 3
+  mov dword ptr [rbp-1768], eax
+  .loc 1 91
+  mov eax, 4
+  mov dword ptr [rbp-1764], eax
+  .loc 1 91
+  movsxd rax, eax
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..26[rip]
+  call assert
+  .loc 1 92
+  mov eax, 1
+  mov dword ptr [rbp-1760], eax
+  .loc 1 92
+  mov eax, 2
+  mov dword ptr [rbp-1756], eax
+  .loc 1 92
+  mov eax, 3
+  mov dword ptr [rbp-1752], eax
+  .loc 1 92
+  mov eax, 4
+  mov dword ptr [rbp-1748], eax
+  .loc 1 92
+  mov eax, 16
+  mov rsi, rax
+  mov edi, 16
+  lea rdx, .L..27[rip]
+  call assert
+  .loc 1 93
+  mov eax, 102
+  mov byte ptr [rbp-1744], al
+  .loc 1 93
+  mov eax, 111
+  mov byte ptr [rbp-1743], al
+  .loc 1 93
+  mov eax, 111
+  mov byte ptr [rbp-1742], al
+  .loc 1 93
+  xor eax, eax
+  mov byte ptr [rbp-1741], al
+  .loc 1 93
+  mov eax, 4
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..28[rip]
+  call assert
+  .loc 1 94
+  mov eax, 102
+  mov byte ptr [rbp-1740], al
+  .loc 1 94
+  mov eax, 111
+  mov byte ptr [rbp-1739], al
+  .loc 1 94
+  mov eax, 111
+  mov byte ptr [rbp-1738], al
+  .loc 1 94
+  xor eax, eax
+  mov byte ptr [rbp-1737], al
+  .loc 1 94
+  mov eax, 120
+  mov byte ptr [rbp-1736], al
+  .loc 1 94
+  xor eax, eax
+  mov byte ptr [rbp-1735], al
+  .loc 1 94
+  mov eax, 4
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..29[rip]
+  call assert
+  .loc 1 95
+  mov eax, 102
+  mov byte ptr [rbp-1734], al
+  .loc 1 95
+  mov eax, 111
+  mov byte ptr [rbp-1733], al
+  .loc 1 95
+  mov eax, 111
+  mov byte ptr [rbp-1732], al
+  .loc 1 95
+  xor eax, eax
+  mov byte ptr [rbp-1731], al
+  .loc 1 95
+  mov eax, 120
+  mov byte ptr [rbp-1730], al
+  .loc 1 95
+  xor eax, eax
+  mov byte ptr [rbp-1729], al
+  .loc 1 95
+  mov eax, 2
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..30[rip]
+  call assert
+  .loc 1 96
+  mov eax, 120
+  mov byte ptr [rbp-1728], al
+  .loc 1 96
+  xor eax, eax
+  mov byte ptr [rbp-1727], al
+  .loc 1 96
+  mov eax, 102
+  mov byte ptr [rbp-1726], al
+  .loc 1 96
+  mov eax, 111
+  mov byte ptr [rbp-1725], al
+  .loc 1 96
+  mov eax, 111
+  mov byte ptr [rbp-1724], al
+  .loc 1 96
+  xor eax, eax
+  mov byte ptr [rbp-1723], al
+  .loc 1 96
+  mov eax, 2
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..31[rip]
+  call assert
+  .loc 1 97
+  mov eax, 120
+  mov byte ptr [rbp-1722], al
+  .loc 1 97
+  xor eax, eax
+  mov byte ptr [rbp-1721], al
+  .loc 1 97
+  mov eax, 102
+  mov byte ptr [rbp-1720], al
+  .loc 1 97
+  mov eax, 111
+  mov byte ptr [rbp-1719], al
+  .loc 1 97
+  mov eax, 111
+  mov byte ptr [rbp-1718], al
+  .loc 1 97
+  xor eax, eax
+  mov byte ptr [rbp-1717], al
+  .loc 1 97
+  mov eax, 4
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..32[rip]
+  call assert
+  .loc 1 98
+  mov eax, 1
+  mov dword ptr [rbp-1716], eax
+  .loc 1 98
+  mov eax, 2
+  mov dword ptr [rbp-1712], eax
+  .loc 1 98
+  mov eax, 3
+  mov dword ptr [rbp-1708], eax
+  .loc 1 98
+  movsxd rax, dword ptr [rbp-1716]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..33[rip]
+  call assert
+  .loc 1 99
+  mov eax, 1
+  mov dword ptr [rbp-1704], eax
+  .loc 1 99
+  mov eax, 2
+  mov dword ptr [rbp-1700], eax
+  .loc 1 99
+  mov eax, 3
+  mov dword ptr [rbp-1696], eax
+  .loc 1 99
+  movsxd rax, dword ptr [rbp-1700]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..34[rip]
+  call assert
+  .loc 1 100
+  mov eax, 1
+  mov dword ptr [rbp-1692], eax
+  .loc 1 100
+  mov eax, 2
+  mov dword ptr [rbp-1688], eax
+  .loc 1 100
+  mov eax, 3
+  mov dword ptr [rbp-1684], eax
+  .loc 1 100
+  movsxd rax, eax
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..35[rip]
+  call assert
+  .loc 1 101
+  mov qword ptr [rbp-1676], 0
+  .loc 1 101
+  mov eax, 1
+  mov dword ptr [rbp-1680], eax
+  .loc 1 101
+  movsxd rax, eax
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..36[rip]
+  call assert
+  .loc 1 102
+  mov qword ptr [rbp-1664], 0
+  .loc 1 102
+  mov eax, 1
+  mov dword ptr [rbp-1668], eax
+  .loc 1 102
+  movsxd rax, dword ptr [rbp-1664]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..37[rip]
+  call assert
+  .loc 1 103
+  mov qword ptr [rbp-1652], 0
+  .loc 1 103
+  mov eax, 1
+  mov dword ptr [rbp-1656], eax
+  .loc 1 103
+  movsxd rax, dword ptr [rbp-1648]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..38[rip]
+  call assert
+  .loc 1 104
+  mov eax, 1
+  mov dword ptr [rbp-1644], eax
+  .loc 1 104
+  mov eax, 2
+  mov dword ptr [rbp-1640], eax
+  .loc 1 104
+  mov eax, 3
+  mov dword ptr [rbp-1636], eax
+  .loc 1 104
+  mov eax, 4
+  mov dword ptr [rbp-1632], eax
+  .loc 1 104
+  movsxd rax, dword ptr [rbp-1644]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..39[rip]
+  call assert
+  .loc 1 105
+  mov eax, 1
+  mov dword ptr [rbp-1628], eax
+  .loc 1 105
+  mov eax, 2
+  mov dword ptr [rbp-1624], eax
+  .loc 1 105
+  mov eax, 3
+  mov dword ptr [rbp-1620], eax
+  .loc 1 105
+  mov eax, 4
+  mov dword ptr [rbp-1616], eax
+  .loc 1 105
+  movsxd rax, dword ptr [rbp-1624]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..40[rip]
+  call assert
+  .loc 1 106
+  mov eax, 1
+  mov dword ptr [rbp-1612], eax
+  .loc 1 106
+  mov eax, 2
+  mov dword ptr [rbp-1608], eax
+  .loc 1 106
+  mov eax, 3
+  mov dword ptr [rbp-1604], eax
+  .loc 1 106
+  mov eax, 4
+  mov dword ptr [rbp-1600], eax
+  .loc 1 106
+  movsxd rax, dword ptr [rbp-1604]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..41[rip]
+  call assert
+  .loc 1 107
+  mov eax, 1
+  mov dword ptr [rbp-1596], eax
+  .loc 1 107
+  mov eax, 2
+  mov dword ptr [rbp-1592], eax
+  .loc 1 107
+  mov eax, 3
+  mov dword ptr [rbp-1588], eax
+  .loc 1 107
+  mov eax, 4
+  mov dword ptr [rbp-1584], eax
+  .loc 1 107
+  movsxd rax, eax
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..42[rip]
+  call assert
+  .loc 1 108
+  mov qword ptr [rbp-1572], 0
+  .loc 1 108
+  mov eax, 1
+  mov dword ptr [rbp-1580], eax
+  .loc 1 108
+  mov eax, 2
+  mov dword ptr [rbp-1576], eax
+  .loc 1 108
+  movsxd rax, dword ptr [rbp-1568]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..43[rip]
+  call assert
+  .loc 1 109
+  mov qword ptr [rbp-1564], 0
+  .loc 1 109
+  movsxd rax, dword ptr [rbp-1564]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..44[rip]
+  call assert
+  .loc 1 110
+  mov qword ptr [rbp-1556], 0
+  .loc 1 110
+  movsxd rax, dword ptr [rbp-1552]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..45[rip]
+  call assert
+  .loc 1 111
+  mov eax, 1
+  mov dword ptr [rbp-1548], eax
+  .loc 1 111
+  mov eax, 2
+  mov dword ptr [rbp-1544], eax
+  .loc 1 111
+  mov eax, 3
+  mov dword ptr [rbp-1540], eax
+  .loc 1 111
+  mov eax, 4
+  mov dword ptr [rbp-1536], eax
+  .loc 1 111
+  mov eax, 5
+  mov dword ptr [rbp-1532], eax
+  .loc 1 111
+  mov eax, 6
+  mov dword ptr [rbp-1528], eax
+  .loc 1 111
+  lea rax, [rbp-1524]
+  mov r14, rax
+  .loc 1 111
+  lea rax, [rbp-1548]
+  mov rdi, r14
+  movdqu xmm0, [rax+0]
+  movdqu [rdi+0], xmm0
+  mov r8, [rax+16]
+  mov [rdi+16], r8
+  .loc 1 111
+  movsxd rax, dword ptr [rbp-1508]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..46[rip]
+  call assert
+  .loc 1 112
+  mov eax, 1
+  mov dword ptr [rbp-1500], eax
+  .loc 1 112
+  mov eax, 2
+  mov dword ptr [rbp-1496], eax
+  .loc 1 112
+  lea rax, [rbp-1484]
+  mov r14, rax
+  .loc 1 112
+  lea rax, [rbp-1492]
+  mov r15, rax
+  .loc 1 112
+  lea rax, [rbp-1500]
+  mov rdi, r15
+  mov r8, [rax+0]
+  mov [rdi+0], r8
+  mov rdi, r14
+  mov r8, [rax+0]
+  mov [rdi+0], r8
+  .loc 1 112
+  movsxd rax, dword ptr [rbp-1480]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..47[rip]
+  call assert
+  .loc 1 113
+  mov eax, 1
+  mov dword ptr [rbp-1476], eax
+  .loc 1 113
+  mov eax, 2
+  mov dword ptr [rbp-1472], eax
+  .loc 1 113
+  lea rax, [rbp-1468]
+  mov r14, rax
+  .loc 1 113
+  lea rax, [rbp-1476]
+  mov rdi, r14
+  mov r8, [rax+0]
+  mov [rdi+0], r8
+  .loc 1 113
+  movsxd rax, dword ptr [rbp-1468]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..48[rip]
+  call assert
+  .loc 1 114
+  mov dword ptr [rbp-1460], 16909060
+  .loc 1 114
+  movsx eax, byte ptr [rbp-1460]
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..49[rip]
+  call assert
+  .loc 1 115
+  mov dword ptr [rbp-1456], 16909060
+  .loc 1 115
+  movsx eax, byte ptr [rbp-1455]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..50[rip]
+  call assert
+  .loc 1 116
+  mov eax, 4
+  mov byte ptr [rbp-1452], al
+  .loc 1 116
+  mov eax, 3
+  mov byte ptr [rbp-1451], al
+  .loc 1 116
+  mov eax, 2
+  mov byte ptr [rbp-1450], al
+  .loc 1 116
+  mov eax, 1
+  mov byte ptr [rbp-1449], al
+  .loc 1 116
+  movsxd rax, dword ptr [rbp-1452]
+  mov rsi, rax
+  mov edi, 16909060
+  lea rdx, .L..51[rip]
+  call assert
+  .loc 1 117
+  movsx eax, byte ptr g3[rip]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..52[rip]
+  call assert
+  .loc 1 118
+  movsx eax, word ptr g4[rip]
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..53[rip]
+  call assert
+  .loc 1 119
+  mov edi, 5
+  mov esi, dword ptr g5[rip]
+  lea rdx, .L..54[rip]
+  call assert
+  .loc 1 120
+  mov edi, 6
+  mov esi, dword ptr g6[rip]
+  lea rdx, .L..55[rip]
+  call assert
+  .loc 1 121
+  xor edi, edi
+  mov esi, dword ptr g9[rip]
+  lea rdx, .L..56[rip]
+  call assert
+  .loc 1 122
+  mov edi, 1
+  mov esi, dword ptr g9+4[rip]
+  lea rdx, .L..57[rip]
+  call assert
+  .loc 1 123
+  mov edi, 2
+  mov esi, dword ptr g9+8[rip]
+  lea rdx, .L..58[rip]
+  call assert
+  .loc 1 124
+  movsx eax, byte ptr g11[rip]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..59[rip]
+  call assert
+  .loc 1 125
+  mov edi, 2
+  mov esi, dword ptr g11+4[rip]
+  lea rdx, .L..60[rip]
+  call assert
+  .loc 1 126
+  movsx eax, byte ptr g11+8[rip]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..61[rip]
+  call assert
+  .loc 1 127
+  mov edi, 4
+  mov esi, dword ptr g11+12[rip]
+  lea rdx, .L..62[rip]
+  call assert
+  .loc 1 128
+  mov edi, 1
+  mov esi, dword ptr g12[rip]
+  lea rdx, .L..63[rip]
+  call assert
+  .loc 1 129
+  mov edi, 2
+  mov esi, dword ptr g12+4[rip]
+  lea rdx, .L..64[rip]
+  call assert
+  .loc 1 130
+  xor edi, edi
+  mov esi, dword ptr g12+8[rip]
+  lea rdx, .L..65[rip]
+  call assert
+  .loc 1 131
+  xor edi, edi
+  mov esi, dword ptr g12+12[rip]
+  lea rdx, .L..66[rip]
+  call assert
+  .loc 1 132
+  movsx eax, byte ptr g13[rip]
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..67[rip]
+  call assert
+  .loc 1 133
+  movsx eax, byte ptr g13+1[rip]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..68[rip]
+  call assert
+  .loc 1 134
+  movsx eax, byte ptr g13+8[rip]
+  mov rsi, rax
+  mov edi, 8
+  lea rdx, .L..69[rip]
+  call assert
+  .loc 1 135
+  movsx eax, byte ptr g13+9[rip]
+  mov rsi, rax
+  mov edi, 7
+  lea rdx, .L..70[rip]
+  call assert
+  .loc 1 136
+  mov edi, 7
+  mov esi, 7
+  lea rdx, .L..71[rip]
+  call assert
+  .loc 1 137
+  mov edi, 10
+  mov esi, 10
+  lea rdx, .L..72[rip]
+  call assert
+  .loc 1 138
+  mov edi, 3
+  mov esi, 3
+  lea rdx, .L..73[rip]
+  call assert
+  .loc 1 139
+  lea rdi, g17[rip]
+  lea rsi, .L..74[rip]
+  mov rdx, 7
+  call memcmp
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..75[rip]
+  call assert
+  .loc 1 140
+  lea rdi, g18[rip]
+  lea rsi, .L..76[rip]
+  mov rdx, 10
+  call memcmp
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..77[rip]
+  call assert
+  .loc 1 141
+  lea rdi, g19[rip]
+  lea rsi, .L..78[rip]
+  mov rdx, 3
+  call memcmp
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..79[rip]
+  call assert
+  .loc 1 142
+  mov rdi, qword ptr g20[rip]
+  lea rsi, .L..80[rip]
+  call strcmp
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..81[rip]
+  call assert
+  .loc 1 143
+  mov rdi, qword ptr g21[rip]
+  lea rsi, .L..82[rip]
+  call strcmp
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..83[rip]
+  call assert
+  .loc 1 144
+  mov rax, qword ptr g22[rip]
+  add rax, 3
+  mov rdi, rax
+  lea rsi, .L..84[rip]
+  call strcmp
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..85[rip]
+  call assert
+  .loc 1 145
+  mov rdi, qword ptr g23[rip]
+  lea rsi, .L..86[rip]
+  call strcmp
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..87[rip]
+  call assert
+  .loc 1 146
+  mov rdi, qword ptr g23+8[rip]
+  lea rsi, .L..88[rip]
+  call strcmp
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..89[rip]
+  call assert
+  .loc 1 147
+  mov rax, qword ptr g23+16[rip]
+  add rax, 3
+  mov rdi, rax
+  lea rsi, .L..90[rip]
+  call strcmp
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..91[rip]
+  call assert
+  .loc 1 148
+  mov edi, 3
+  mov esi, dword ptr g24[rip]
+  lea rdx, .L..92[rip]
+  call assert
+  .loc 1 149
+  mov rax, qword ptr g25[rip]
+  movsxd rax, dword ptr [rax]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..93[rip]
+  call assert
+  .loc 1 150
+  mov rax, qword ptr g27[rip]
+  movsxd rax, dword ptr [rax]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..94[rip]
+  call assert
+  .loc 1 151
+  mov rax, qword ptr g28[rip]
+  movsxd rax, dword ptr [rax]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..95[rip]
+  call assert
+  .loc 1 152
+  mov rax, qword ptr g29[rip]
+  movsxd rax, dword ptr [rax]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..96[rip]
+  call assert
+  .loc 1 153
+  mov rax, qword ptr g31[rip]
+  movsxd rax, dword ptr [rax]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..97[rip]
+  call assert
+  .loc 1 154
+  mov rax, qword ptr g31[rip]
+  movsxd rax, dword ptr [rax+4]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..98[rip]
+  call assert
+  .loc 1 155
+  mov rax, qword ptr g31[rip]
+  movsxd rax, dword ptr [rax+8]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..99[rip]
+  call assert
+  .loc 1 156
+  mov edi, 1
+  mov esi, dword ptr g40[rip]
+  lea rdx, .L..100[rip]
+  call assert
+  .loc 1 157
+  mov edi, 2
+  mov esi, dword ptr g40+4[rip]
+  lea rdx, .L..101[rip]
+  call assert
+  .loc 1 158
+  mov edi, 3
+  mov esi, dword ptr g40+8[rip]
+  lea rdx, .L..102[rip]
+  call assert
+  .loc 1 159
+  mov edi, 4
+  mov esi, dword ptr g40+12[rip]
+  lea rdx, .L..103[rip]
+  call assert
+  .loc 1 160
+  mov edi, 1
+  mov esi, dword ptr g41[rip]
+  lea rdx, .L..104[rip]
+  call assert
+  .loc 1 161
+  mov edi, 2
+  mov esi, dword ptr g41+4[rip]
+  lea rdx, .L..105[rip]
+  call assert
+  .loc 1 162
+  mov edi, 3
+  mov esi, dword ptr g41+8[rip]
+  lea rdx, .L..106[rip]
+  call assert
+  .loc 1 163
+  mov edi, 4
+  mov esi, dword ptr g41+12[rip]
+  lea rdx, .L..107[rip]
+  call assert
+  .loc 1 164
+  xor eax, eax
+  mov dword ptr [rbp-1448], eax
+  .loc 1 164
+  mov eax, 1
+  mov dword ptr [rbp-1444], eax
+  .loc 1 164
+  mov eax, 2
+  mov dword ptr [rbp-1440], eax
+  .loc 1 164
+  mov eax, 3
+  mov dword ptr [rbp-1436], eax
+  .loc 1 164
+  mov eax, 4
+  mov dword ptr [rbp-1432], eax
+  .loc 1 164
+  mov eax, 5
+  mov dword ptr [rbp-1428], eax
+  .loc 1 164
+  movsxd rax, dword ptr [rbp-1448]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..108[rip]
+  call assert
+  .loc 1 165
+  xor eax, eax
+  mov dword ptr [rbp-1424], eax
+  .loc 1 165
+  mov eax, 1
+  mov dword ptr [rbp-1420], eax
+  .loc 1 165
+  mov eax, 2
+  mov dword ptr [rbp-1416], eax
+  .loc 1 165
+  mov eax, 3
+  mov dword ptr [rbp-1412], eax
+  .loc 1 165
+  mov eax, 4
+  mov dword ptr [rbp-1408], eax
+  .loc 1 165
+  mov eax, 5
+  mov dword ptr [rbp-1404], eax
+  .loc 1 165
+  movsxd rax, dword ptr [rbp-1412]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..109[rip]
+  call assert
+  .loc 1 166
+  xor eax, eax
+  mov dword ptr [rbp-1400], eax
+  .loc 1 166
+  mov eax, 1
+  mov dword ptr [rbp-1396], eax
+  .loc 1 166
+  mov eax, 2
+  mov dword ptr [rbp-1392], eax
+  .loc 1 166
+  mov eax, 3
+  mov dword ptr [rbp-1388], eax
+  .loc 1 166
+  movsxd rax, dword ptr [rbp-1400]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..110[rip]
+  call assert
+  .loc 1 167
+  xor eax, eax
+  mov dword ptr [rbp-1384], eax
+  .loc 1 167
+  mov eax, 1
+  mov dword ptr [rbp-1380], eax
+  .loc 1 167
+  mov eax, 2
+  mov dword ptr [rbp-1376], eax
+  .loc 1 167
+  mov eax, 3
+  mov dword ptr [rbp-1372], eax
+  .loc 1 167
+  movsxd rax, dword ptr [rbp-1376]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..111[rip]
+  call assert
+  .loc 1 168
+  lea rdi, g43[rip]
+  lea rsi, .L..112[rip]
+  call strcmp
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..113[rip]
+  call assert
+  .loc 1 169
+  lea rdi, g43+4[rip]
+  lea rsi, .L..114[rip]
+  call strcmp
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..115[rip]
+  call assert
+  .loc 1 170
+  mov rdi, qword ptr g44[rip]
+  lea rsi, .L..116[rip]
+  call strcmp
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..117[rip]
+  call assert
+  .loc 1 171
+  mov eax, 1
+  mov dword ptr [rbp-1368], eax
+  .loc 1 171
+  mov eax, 2
+  mov dword ptr [rbp-1364], eax
+  .loc 1 171
+  mov eax, 3
+  mov dword ptr [rbp-1360], eax
+  .loc 1 171
+  movsxd rax, eax
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..118[rip]
+  call assert
+  .loc 1 172
+  mov eax, 1
+  mov dword ptr [rbp-1356], eax
+  .loc 1 172
+  mov eax, 2
+  mov dword ptr [rbp-1352], eax
+  .loc 1 172
+  mov eax, 3
+  mov dword ptr [rbp-1348], eax
+  .loc 1 172
+  movsxd rax, dword ptr [rbp-1356]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..119[rip]
+  call assert
+  .loc 1 173
+  mov dword ptr [rbp-1344], 1
+  .loc 1 173
+  movsxd rax, dword ptr [rbp-1344]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..120[rip]
+  call assert
+  .loc 1 174
+  mov eax, 2
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..121[rip]
+  call assert
+  .loc 1 175
+  lea rdi, [rbp-1328]
+  mov rcx, 48
+  xor eax, eax
+  rep stosq
+  mov dword ptr [rbp-944], 0
+  .loc 1 175
+  mov eax, 1
+  mov dword ptr [rbp-1340], eax
+  .loc 1 175
+  mov eax, 2
+  mov dword ptr [rbp-1336], eax
+  .loc 1 175
+  mov eax, 3
+  mov dword ptr [rbp-1332], eax
+  .loc 1 175
+  movsxd rax, dword ptr [rbp-944]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..122[rip]
+  call assert
+  .loc 1 176
+  lea rdi, [rbp-936]
+  mov rcx, 49
+  xor eax, eax
+  rep stosq
+  mov dword ptr [rbp-544], 0
+  .loc 1 176
+  mov eax, 1
+  mov dword ptr [rbp-940], eax
+  .loc 1 176
+  mov dword ptr [rbp-540], 0
+  .loc 1 176
+  xor eax, eax
+  movsxd r13, eax
+  cmp r13d, 100
+  jge .L..123
+.L.begin.1:
+  .loc 1 176
+  movsxd rax, dword ptr [rbp+r13*4-940]
+  add dword ptr [rbp-540], eax
+.L..124:
+  .loc 1 176
+  add r13d, 1
+  movsxd r13, r13d
+  mov rax, r13
+  add eax, -1
+.L.cond.1:
+  cmp r13d, 100
+  jl .L.begin.1
+.L..123:
+  .loc 1 176
+  movsxd rax, dword ptr [rbp-540]
+  sub eax, 1
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..125[rip]
+  call assert
+  .loc 1 177
+  mov dword ptr [rbp-535], 0
+  mov word ptr [rbp-531], 0
+  mov byte ptr [rbp-529], 0
+  .loc 1 177
+  mov qword ptr [rbp-520], 0
+  .loc 1 177
+  mov eax, 1
+  mov byte ptr [rbp-536], al
+  .loc 1 177
+  mov eax, 2
+  mov qword ptr [rbp-528], rax
+  .loc 1 177
+  movsx eax, byte ptr [rbp-516]
+  mov r14, rax
+  .loc 1 177
+  movsx eax, byte ptr [rbp-520]
+  mov rdi, r14
+  add eax, edi
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..126[rip]
+  call assert
+  .loc 1 178
+  mov dword ptr [rbp-511], 0
+  mov word ptr [rbp-507], 0
+  mov byte ptr [rbp-505], 0
+  .loc 1 178
+  mov eax, 1
+  mov byte ptr [rbp-512], al
+  .loc 1 178
+  mov eax, 2
+  mov qword ptr [rbp-504], rax
+  .loc 1 178
+  movsx eax, byte ptr [rbp-511]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..127[rip]
+  call assert
+  .loc 1 179
+  mov dword ptr [rbp-495], 0
+  mov word ptr [rbp-491], 0
+  mov byte ptr [rbp-489], 0
+  .loc 1 179
+  mov eax, 1
+  mov byte ptr [rbp-496], al
+  .loc 1 179
+  mov rax, qword ptr [rbp-496]
+  sar rax, 8
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..128[rip]
+  call assert
+  .loc 1 180
+  pxor xmm0, xmm0
+  movdqu [rbp-484], xmm0
+  movdqu [rbp-468], xmm0
+  mov dword ptr [rbp-452], 0
+  .loc 1 180
+  mov eax, 1
+  mov byte ptr [rbp-485], al
+  .loc 1 180
+  movsx eax, byte ptr [rbp-449]
+  mov r14, rax
+  .loc 1 180
+  movsx eax, byte ptr [rbp-453]
+  mov r15, rax
+  .loc 1 180
+  movsx eax, byte ptr [rbp-469]
+  mov rdi, r15
+  add eax, edi
+  mov rdi, r14
+  add eax, edi
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..129[rip]
+  call assert
+  .loc 1 181
+  lea rax, [rbp-448]
+  mov r14, rax
+  .loc 1 181
+  lea rax, .L..130[rip]
+  mov rdi, r14
+  movdqu xmm0, [rax+0]
+  movdqu [rdi+0], xmm0
+  movdqu xmm0, [rax+16]
+  movdqu [rdi+16], xmm0
+  mov r8, [rax+32]
+  mov [rdi+32], r8
+  .loc 1 181
+  mov dword ptr [rbp-408], 0
+  .loc 1 181
+  xor eax, eax
+  movsxd r12, eax
+  cmp r12d, 10
+  jge .L..131
+.L.begin.2:
+  .loc 1 181
+  movsxd rax, dword ptr [rbp+r12*4-448]
+  add dword ptr [rbp-408], eax
+.L..132:
+  .loc 1 181
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  add eax, -1
+.L.cond.2:
+  cmp r12d, 10
+  jl .L.begin.2
+.L..131:
+  .loc 1 181
+  movsxd rax, dword ptr [rbp-408]
+  mov rsi, rax
+  mov edi, 45
+  lea rdx, .L..133[rip]
+  call assert
+  .loc 1 182
+  lea rax, [rbp-404]
+  mov r14, rax
+  .loc 1 182
+  lea rax, .L..134[rip]
+  mov rdi, r14
+  movdqu xmm0, [rax+0]
+  movdqu [rdi+0], xmm0
+  movdqu xmm0, [rax+16]
+  movdqu [rdi+16], xmm0
+  mov r8, [rax+32]
+  mov [rdi+32], r8
+  .loc 1 182
+  mov dword ptr [rbp-392], 7
+  .loc 1 182
+  lea rax, [rbp-364]
+  mov r14, rax
+  .loc 1 182
+  lea rax, .L..135[rip]
+  mov rdi, r14
+  movdqu xmm0, [rax+0]
+  movdqu [rdi+0], xmm0
+  movdqu xmm0, [rax+16]
+  movdqu [rdi+16], xmm0
+  mov r8, [rax+32]
+  mov [rdi+32], r8
+  .loc 1 182
+  movsxd rax, dword ptr [rbp-392]
+  add eax, dword ptr [rbp-364]
+  mov rsi, rax
+  mov edi, 7
+  lea rdx, .L..136[rip]
+  call assert
+  .loc 1 183
+  mov dword ptr [rbp-324], 0
+  .loc 1 183
+  lea rax, [rbp-320]
+  mov r14, rax
+  .loc 1 183
+  lea rax, .L..137[rip]
+  mov rdi, r14
+  movdqu xmm0, [rax+0]
+  movdqu [rdi+0], xmm0
+  movdqu xmm0, [rax+16]
+  movdqu [rdi+16], xmm0
+  mov r8, [rax+32]
+  mov [rdi+32], r8
+  .loc 1 183
+  movsxd rax, dword ptr [rbp-284]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..138[rip]
+  call assert
+  .loc 1 184
+  lea rax, [rbp-280]
+  mov r14, rax
+  .loc 1 184
+  lea rax, .L..139[rip]
+  mov rdi, r14
+  mov r8, [rax+0]
+  mov [rdi+0], r8
+  mov r8w, [rax+8]
+  mov [rdi+8], r8w
+  .loc 1 184
+  movsx eax, byte ptr [rbp-272]
+  mov rsi, rax
+  mov edi, -1
+  lea rdx, .L..140[rip]
+  call assert
+  .loc 1 185
+  lea rax, [rbp-270]
+  mov r14, rax
+  .loc 1 185
+  lea rax, .L..141[rip]
+  mov rdi, r14
+  mov r8, [rax+0]
+  mov [rdi+0], r8
+  mov r8w, [rax+8]
+  mov [rdi+8], r8w
+  .loc 1 185
+  movsx eax, byte ptr [rbp-261]
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..142[rip]
+  call assert
+  .loc 1 186
+  mov dword ptr [rbp-260], 3
+  .loc 1 186
+  xor eax, eax
+  mov dword ptr [rbp-256], eax
+  .loc 1 186
+  mov eax, 1
+  mov dword ptr [rbp-252], eax
+  .loc 1 186
+  mov eax, 2
+  mov dword ptr [rbp-248], eax
+  .loc 1 186
+  mov eax, 3
+  mov dword ptr [rbp-244], eax
+  .loc 1 186
+  mov eax, 4
+  mov dword ptr [rbp-240], eax
+  .loc 1 186
+  mov eax, 5
+  mov dword ptr [rbp-236], eax
+  .loc 1 186
+  mov eax, 6
+  mov dword ptr [rbp-232], eax
+  .loc 1 186
+  mov eax, 7
+  mov dword ptr [rbp-228], eax
+  .loc 1 186
+  mov eax, 8
+  mov dword ptr [rbp-224], eax
+  .loc 1 186
+  movsxd rax, dword ptr [rbp-260]
+  mov dword ptr [rbp-220], eax
+  .loc 1 186
+  movsxd rax, eax
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..143[rip]
+  call assert
+  .loc 1 187
+  lea rax, [rbp-216]
+  mov r14, rax
+  .loc 1 187
+  lea rax, .L..144[rip]
+  mov rdi, r14
+  movdqu xmm0, [rax+0]
+  movdqu [rdi+0], xmm0
+  movdqu xmm0, [rax+16]
+  movdqu [rdi+16], xmm0
+  movdqu xmm0, [rax+32]
+  movdqu [rdi+32], xmm0
+  .loc 1 187
+  movsx eax, word ptr [rbp-174]
+  mov r14, rax
+  .loc 1 187
+  movsx eax, byte ptr [rbp-216]
+  mov rdi, r14
+  add eax, edi
+  movsxd rax, eax
+  add rax, qword ptr [rbp-208]
+  mov rsi, rax
+  mov edi, 10
+  lea rdx, .L..145[rip]
+  call assert
+  .loc 1 188
+  lea rax, [rbp-164]
+  mov r14, rax
+  .loc 1 188
+  lea rax, .L..146[rip]
+  mov rdi, r14
+  movdqu xmm0, [rax+0]
+  movdqu [rdi+0], xmm0
+  mov r8d, [rax+16]
+  mov [rdi+16], r8d
+  .loc 1 188
+  movsx eax, byte ptr [rbp-160]
+  mov rsi, rax
+  mov edi, 111
+  lea rdx, .L..147[rip]
+  call assert
+  .loc 1 189
+  lea rax, [rbp-144]
+  mov r14, rax
+  .loc 1 189
+  lea rax, .L..148[rip]
+  mov rdi, r14
+  movdqu xmm0, [rax+0]
+  movdqu [rdi+0], xmm0
+  mov r8d, [rax+16]
+  mov [rdi+16], r8d
+  .loc 1 189
+  movsx eax, byte ptr [rbp-125]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..149[rip]
+  call assert
+  .loc 1 190
+  mov eax, 5
+  mov dword ptr init_side[rip], eax
+  .loc 1 190
+  mov eax, 1
+  mov dword ptr [rbp-124], eax
+  .loc 1 190
+  mov eax, 2
+  mov dword ptr [rbp-120], eax
+  .loc 1 190
+  mov eax, 3
+  mov dword ptr [rbp-116], eax
+  .loc 1 190
+  mov eax, 4
+  mov dword ptr [rbp-112], eax
+  .loc 1 190
+  mov eax, 5
+  mov dword ptr [rbp-108], eax
+  .loc 1 190
+  mov eax, 6
+  mov dword ptr [rbp-104], eax
+  .loc 1 190
+  mov eax, 7
+  mov dword ptr [rbp-100], eax
+  .loc 1 190
+  mov eax, 8
+  mov dword ptr [rbp-96], eax
+  .loc 1 190
+  mov eax, 9
+  mov dword ptr [rbp-92], eax
+  .loc 1 190
+  mov eax, 10
+  mov dword ptr [rbp-88], eax
+  .loc 1 190
+  movsxd rax, dword ptr init_side[rip]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..150[rip]
+  call assert
+  .loc 1 191
+  xor eax, eax
+  call init_bump
+  .loc 1 191
+  mov eax, 1
+  mov dword ptr [rbp-84], eax
+  .loc 1 191
+  mov eax, 2
+  mov dword ptr [rbp-80], eax
+  .loc 1 191
+  mov eax, 3
+  mov dword ptr [rbp-76], eax
+  .loc 1 191
+  mov eax, 4
+  mov dword ptr [rbp-72], eax
+  .loc 1 191
+  mov eax, 5
+  mov dword ptr [rbp-68], eax
+  .loc 1 191
+  mov eax, 6
+  mov dword ptr [rbp-64], eax
+  .loc 1 191
+  mov eax, 7
+  mov dword ptr [rbp-60], eax
+  .loc 1 191
+  mov eax, 8
+  mov dword ptr [rbp-56], eax
+  .loc 1 191
+  mov eax, 9
+  mov dword ptr [rbp-52], eax
+  .loc 1 191
+  mov eax, 10
+  mov dword ptr [rbp-48], eax
+  .loc 1 191
+  movsxd rax, dword ptr init_side[rip]
+  mov rsi, rax
+  mov edi, 15
+  lea rdx, .L..151[rip]
+  call assert
+  .loc 1 192
+  xor eax, eax
+  mov dword ptr init_side[rip], eax
+  .loc 1 192
+  mov eax, 1
+  mov dword ptr [rbp-44], eax
+  .loc 1 192
+  mov eax, 2
+  mov dword ptr [rbp-40], eax
+  .loc 1 192
+  mov eax, 3
+  mov dword ptr [rbp-36], eax
+  .loc 1 192
+  mov eax, 4
+  mov dword ptr [rbp-32], eax
+  .loc 1 192
+  mov eax, 5
+  mov dword ptr [rbp-28], eax
+  .loc 1 192
+  mov eax, 6
+  mov dword ptr [rbp-24], eax
+  .loc 1 192
+  mov eax, 7
+  mov dword ptr [rbp-20], eax
+  .loc 1 192
+  mov eax, 8
+  mov dword ptr [rbp-16], eax
+  .loc 1 192
+  mov eax, 9
+  mov dword ptr [rbp-12], eax
+  .loc 1 192
+  mov eax, 10
+  mov dword ptr [rbp-8], eax
+  .loc 1 192
+  mov dword ptr [rbp-4], 0
+  .loc 1 192
+  xor eax, eax
+  movsxd rbx, eax
+  cmp ebx, 10
+  jge .L..152
+.L.begin.3:
+  .loc 1 192
+  movsxd rax, dword ptr [rbp+rbx*4-44]
+  add dword ptr [rbp-4], eax
+.L..153:
+  .loc 1 192
+  add ebx, 1
+  movsxd rbx, ebx
+  mov rax, rbx
+  add eax, -1
+.L.cond.3:
+  cmp ebx, 10
+  jl .L.begin.3
+.L..152:
+  .loc 1 192
+  movsxd rax, dword ptr [rbp-4]
+  mov rsi, rax
+  mov edi, 55
+  lea rdx, .L..154[rip]
+  call assert
+  .loc 1 193
+  lea rdi, .L..155[rip]
+  xor eax, eax
+  call printf
+  .loc 1 194
+  xor eax, eax
+.L.return.main:
+  mov rbx, [rbp-2064]
+  mov r12, [rbp-2072]
+  mov r13, [rbp-2080]
+  mov r14, [rbp-2088]
+  mov r15, [rbp-2096]
+  mov rsp, rbp
+  pop rbp
+  ret
+  .globl init_bump
+  .text
+init_bump:
+.L.body.init_bump:
+  .loc 1 68
+  add dword ptr init_side[rip], 10
+  movsxd rax, dword ptr init_side[rip]
+.L.return.init_bump:
+  ret
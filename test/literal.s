@@ -0,0 +1,217 @@
+.file 1 "-"
+.intel_syntax noprefix
+  .local .L..14
+  .data
+.L..14:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+  .local .L..13
+  .data
+.L..13:
+  .byte 48
+  .byte 66
+  .byte 49
+  .byte 48
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 0
+  .local .L..12
+  .data
+.L..12:
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 48
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 49
+  .byte 0
+  .local .L..11
+  .data
+.L..11:
+  .byte 48
+  .byte 98
+  .byte 49
+  .byte 0
+  .local .L..10
+  .data
+.L..10:
+  .byte 48
+  .byte 98
+  .byte 48
+  .byte 0
+  .local .L..9
+  .data
+.L..9:
+  .byte 48
+  .byte 88
+  .byte 66
+  .byte 69
+  .byte 69
+  .byte 70
+  .byte 0
+  .local .L..8
+  .data
+.L..8:
+  .byte 48
+  .byte 120
+  .byte 66
+  .byte 69
+  .byte 69
+  .byte 70
+  .byte 0
+  .local .L..7
+  .data
+.L..7:
+  .byte 48
+  .byte 120
+  .byte 98
+  .byte 101
+  .byte 101
+  .byte 102
+  .byte 0
+  .local .L..6
+  .data
+.L..6:
+  .byte 48
+  .byte 88
+  .byte 65
+  .byte 0
+  .local .L..5
+  .data
+.L..5:
+  .byte 48
+  .byte 120
+  .byte 97
+  .byte 0
+  .local .L..4
+  .data
+.L..4:
+  .byte 48
+  .byte 120
+  .byte 48
+  .byte 0
+  .local .L..3
+  .data
+.L..3:
+  .byte 48
+  .byte 55
+  .byte 55
+  .byte 55
+  .byte 0
+  .local .L..2
+  .data
+.L..2:
+  .byte 39
+  .byte 92
+  .byte 120
+  .byte 56
+  .byte 48
+  .byte 39
+  .byte 0
+  .local .L..1
+  .data
+.L..1:
+  .byte 39
+  .byte 92
+  .byte 110
+  .byte 39
+  .byte 0
+  .local .L..0
+  .data
+.L..0:
+  .byte 39
+  .byte 97
+  .byte 39
+  .byte 0
+  .globl main
+  .text
+main:
+  push rbp
+  mov rbp, rsp
+.L.body.main:
+  .loc 1 41
+  mov edi, 97
+  mov esi, 97
+  lea rdx, .L..0[rip]
+  call assert
+  .loc 1 42
+  mov edi, 10
+  mov esi, 10
+  lea rdx, .L..1[rip]
+  call assert
+  .loc 1 43
+  mov edi, -128
+  mov esi, -128
+  lea rdx, .L..2[rip]
+  call assert
+  .loc 1 44
+  mov edi, 511
+  mov esi, 511
+  lea rdx, .L..3[rip]
+  call assert
+  .loc 1 45
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..4[rip]
+  call assert
+  .loc 1 46
+  mov edi, 10
+  mov esi, 10
+  lea rdx, .L..5[rip]
+  call assert
+  .loc 1 47
+  mov edi, 10
+  mov esi, 10
+  lea rdx, .L..6[rip]
+  call assert
+  .loc 1 48
+  mov edi, 48879
+  mov esi, 48879
+  lea rdx, .L..7[rip]
+  call assert
+  .loc 1 49
+  mov edi, 48879
+  mov esi, 48879
+  lea rdx, .L..8[rip]
+  call assert
+  .loc 1 50
+  mov edi, 48879
+  mov esi, 48879
+  lea rdx, .L..9[rip]
+  call assert
+  .loc 1 51
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..10[rip]
+  call assert
+  .loc 1 52
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..11[rip]
+  call assert
+  .loc 1 53
+  mov edi, 47
+  mov esi, 47
+  lea rdx, .L..12[rip]
+  call assert
+  .loc 1 54
+  mov edi, 47
+  mov esi, 47
+  lea rdx, .L..13[rip]
+  call assert
+  .loc 1 55
+  lea rdi, .L..14[rip]
+  xor eax, eax
+  call printf
+  .loc 1 56
+  xor eax, eax
+.L.return.main:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -1,5 +1,37 @@
 #include "test.h"
 
+struct P { long pad; struct { int x; int b[4]; } a; };
+struct P gp[3];
+int garr[10];
+short gsh[4];
+
+struct Vec { int len; int *data; };
+int cse_sum(struct Vec *v) { int s = 0; for (int i = 0; i < v->len; i++) { s = s + v->data[i] * v->data[i]; } return s; }
+int cse_clobber(int *p, int *q) { int a = *p + 1; *q = 5; int b = *p + 1; return a + b; }
+int cse_var(int a, int b) { int x = (a*b+1) * (a*b+1); a = 3; int y = a*b+1; return x + y; }
+int cse_cond(int *p) { int r = p && *p + 1 > 0 ? *p + 1 : 0; return r; }
+
+int licm_sum(struct Vec *v) { int s = 0; for (int i = 0; i < v->len; i++) s = s + v->data[i]; return s; }
+int licm_mul(int n, int stride, int *a) { int s = 0; int i = 0; while (i < n * stride) { s = s + a[i]; i++; } return s; }
+int licm_store(int *p, int n) { int s = 0; for (int i = 0; i < *p; i++) { s++; if (i == 2) *p = n; } return s; }
+int licm_fault(int *p, int n) { int s = 0; for (int i = 0; i < n; i++) s = s + *p * 2; return s; }
+int licm_div(int a, int b, int n) { int s = 0; for (int i = 0; i < n; i++) s = s + a / b; return s; }
+int licm_goto(int n, int m) { int s = 0; int i = 0; if (n > 5) goto inside; while (i < n * m) { inside: s++; i++; } return s; }
+int licm_nested(int n, int m) { int s = 0; for (int i = 0; i < n; i++) for (int j = 0; j < m * n; j++) s = s + (n * m + 1); return s; }
+
+int iv_sum(int *a, int n) { int s = 0; for (int i = 0; i < n; i++) s = s + a[i]; return s; }
+int iv_last(int *a, int n) { int i; for (i = 0; i < n; i++) if (a[i] < 0) break; return i; }
+int iv_index(int *a, int n) { int s = 0; for (int i = 0; i < n; i++) s = s + a[i] * i; return s; }
+int iv_copy(char *dst, char *src, int n) { for (int i = 0; i < n; i++) dst[i] = src[i] + 1; return dst[n - 1]; }
+int iv_step(long *a, int n) { long s = 0; for (int i = 1; i <= n; i = i + 2) s = s + a[i] - a[i - 1]; return s; }
+int iv_down(short *a, int n) { int s = 0; for (int i = n - 1; i >= 0; i--) s = s * 2 + a[i]; return s; }
+int iv_from(int *a, int k, int n) { int s = 0; for (int i = k; i < n; i++) s = s + a[i]; return s; }
+int iv_2d(int m[3][4]) { int s = 0; for (int i = 0; i < 3; i++) for (int j = 0; j < 4; j++) s = s + m[i][j] * (i + 1); return s; }
+int iv_continue(int *a, int n) { int s = 0; for (long i = 0; i < n; i++) { if (a[i] == 2) continue; s = s + a[i]; } return s; }
+int iv_long(int *a, long n) { int s = 0; for (int i = 0; i < n; i++) s = s + a[i]; return s; }
+int iv_fault(struct Vec *v, int n) { int s = 0; for (int i = 0; i < n; i++) s = s + v->data[i] * 2; return s; }
+int iv_find(int *a, long n) { for (long i = 0; i < n; i++) if (a[i] == 0) return 1; return 0; }
+
 int main() {
   ASSERT(3, ({ int x=3; *&x; }));
   ASSERT(3, ({ int x=3; int *y=&x; int **z=&y; **z; }));
@@ -39,6 +71,61 @@ int main() {
   ASSERT(4, ({ int x[2][3]; int *y=x; y[4]=4; x[1][1]; }));
   ASSERT(5, ({ int x[2][3]; int *y=x; y[5]=5; x[1][2]; }));
 
+  ASSERT(7, ({ struct P *p=gp; int i=2; p->a.b[i]=7; gp[0].a.b[2]; }));
+  ASSERT(9, ({ long j=2; gp[j].a.x=9; gp[2].a.x; }));
+  ASSERT(10, ({ int i=1; gp[1].a.b[3]=4; gp[i].a.b[3]+=6; gp[1].a.b[3]; }));
+  ASSERT(3, ({ int i=3; garr[i]=3; garr[3]; }));
+  ASSERT(5, ({ int i=4; garr[i-1]=5; garr[3]; }));
+  ASSERT(6, ({ int *p=garr+5; p[-1]=6; garr[4]; }));
+  ASSERT(8, ({ int i=2, j=0; garr[i]=garr[j]=8; garr[2]+garr[0]-8; }));
+  ASSERT(-3, ({ int i=1; gsh[i]=-3; gsh[1]; }));
+  ASSERT(2, ({ int i=0; garr[1]=1; garr[2]=2; garr[++i+1]; }));
+  ASSERT(1, ({ int i=0; garr[i++]=1; i; }));
+  ASSERT(4, ({ char x[8]="abcdefg"; int i=3; x[i]-x[0]+x[i-3]-'a'+1; }));
+  ASSERT(12, ({ int x[2][3]={{1,2,3},{4,5,6}}; int i=1, j=2; x[i][j]*2; }));
+
+  ASSERT(14, ({ int d[3]={1,2,3}; struct Vec v={3,d}; cse_sum(&v); }));
+  ASSERT(10, ({ int x=3; cse_clobber(&x, &x); }));
+  ASSERT(8, ({ int x=3, y=0; cse_clobber(&x, &y); }));
+  ASSERT(137, cse_var(2, 5));
+  ASSERT(0, cse_cond(0));
+  ASSERT(5, ({ int x=4; cse_cond(&x); }));
+  ASSERT(6, ({ int a[3]={1,2,3}; int i=1; a[i]*a[i]+a[i]; }));
+
+  ASSERT(6, ({ int d[3]={1,2,3}; struct Vec v={3,d}; licm_sum(&v); }));
+  ASSERT(21, ({ int d[6]={1,2,3,4,5,6}; licm_mul(2, 3, d); }));
+  ASSERT(4, ({ int x=5; licm_store(&x, 4); }));
+  ASSERT(0, licm_fault(0, 0));
+  ASSERT(18, ({ int x=3; licm_fault(&x, 3); }));
+  ASSERT(0, licm_div(1, 0, 0));
+  ASSERT(12, licm_div(9, 2, 3));
+  ASSERT(126, licm_nested(3, 2));
+  ASSERT(6, licm_goto(2, 3));
+  ASSERT(6, licm_goto(6, 1));
+
+  ASSERT(0, ({ int d[1]={7}; iv_sum(d, 0); }));
+  ASSERT(7, ({ int d[1]={7}; iv_sum(d, 1); }));
+  ASSERT(45, ({ int d[10]={0,1,2,3,4,5,6,7,8,9}; iv_sum(d, 10); }));
+  ASSERT(21, ({ int d[10]={0,1,2,3,4,5,6,7,8,9}; iv_sum(d, 7); }));
+  ASSERT(3, ({ int d[5]={1,2,3,-1,5}; iv_last(d, 5); }));
+  ASSERT(5, ({ int d[5]={1,2,3,4,5}; iv_last(d, 5); }));
+  ASSERT(40, ({ int d[5]={1,2,3,4,5}; iv_index(d, 5); }));
+  ASSERT(6, ({ char s[5]={1,2,3,4,5}; char d[5]; iv_copy(d, s, 5); }));
+  ASSERT(14, ({ char s[5]={1,2,3,4,5}; char d[5]; iv_copy(d, s, 5); d[0]+d[1]+d[2]+d[3]; }));
+  ASSERT(3, ({ long d[7]={1,2,3,4,5,6,7}; iv_step(d, 6); }));
+  ASSERT(49, ({ short d[4]={1,2,3,4}; iv_down(d, 4); }));
+  ASSERT(0, ({ short d[4]={1,2,3,4}; iv_down(d, 0); }));
+  ASSERT(9, ({ int d[5]={1,2,3,4,5}; iv_from(d, 3, 5); }));
+  ASSERT(0, ({ int d[5]={1,2,3,4,5}; iv_from(d, 5, 3); }));
+  ASSERT(188, ({ int m[3][4]={{1,2,3,4},{5,6,7,8},{9,10,11,12}}; iv_2d(m); }));
+  ASSERT(13, ({ int d[5]={1,2,3,4,5}; iv_continue(d, 5); }));
+  ASSERT(10, ({ int d[5]={1,2,3,4,5}; iv_long(d, 4); }));
+  ASSERT(0, ({ int d[5]={1,2,3,4,5}; iv_long(d, -4); }));
+  ASSERT(0, iv_fault(0, 0));
+  ASSERT(1, ({ int d[4]={3,2,0,1}; iv_find(d, 9223372036854775807); }));
+  ASSERT(10, ({ int s=0, n=2, m=5; for (int i=0; i<n*m; i++) s++; s; }));
+  ASSERT(11, ({ int a[3]={1,2,3}; int i=1; int x=a[i]*a[i]; a[i]=3; x+a[i]*a[i]-a[i]+1; }));
+
   printf("OK\n");
   return 0;
 }
@@ -0,0 +1,7751 @@
+.file 1 "-"
+.intel_syntax noprefix
+  .local .L..134
+  .data
+.L..134:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+  .local .L..133
+  .data
+.L..133:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 42
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 43
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 42
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 45
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..132
+  .data
+.L..132:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 110
+  .byte 61
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 109
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 110
+  .byte 42
+  .byte 109
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..129
+  .data
+.L..129:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 51
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 118
+  .byte 95
+  .byte 102
+  .byte 105
+  .byte 110
+  .byte 100
+  .byte 40
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 57
+  .byte 50
+  .byte 50
+  .byte 51
+  .byte 51
+  .byte 55
+  .byte 50
+  .byte 48
+  .byte 51
+  .byte 54
+  .byte 56
+  .byte 53
+  .byte 52
+  .byte 55
+  .byte 55
+  .byte 53
+  .byte 56
+  .byte 48
+  .byte 55
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..128
+  .data
+.L..128:
+  .byte 105
+  .byte 118
+  .byte 95
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .byte 40
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..127
+  .data
+.L..127:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 118
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 40
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 45
+  .byte 52
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..126
+  .data
+.L..126:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 118
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 40
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..125
+  .data
+.L..125:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 118
+  .byte 95
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 116
+  .byte 105
+  .byte 110
+  .byte 117
+  .byte 101
+  .byte 40
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..124
+  .data
+.L..124:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 109
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 44
+  .byte 55
+  .byte 44
+  .byte 56
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 57
+  .byte 44
+  .byte 49
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 49
+  .byte 44
+  .byte 49
+  .byte 50
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 118
+  .byte 95
+  .byte 50
+  .byte 100
+  .byte 40
+  .byte 109
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..123
+  .section .rodata
+.L..123:
+  .byte 1
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 2
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 3
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 4
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 5
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 6
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 7
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 8
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 9
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 10
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 11
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 12
+  .byte 0
+  .byte 0
+  .byte 0
+  .local .L..122
+  .data
+.L..122:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 118
+  .byte 95
+  .byte 102
+  .byte 114
+  .byte 111
+  .byte 109
+  .byte 40
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..121
+  .data
+.L..121:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 118
+  .byte 95
+  .byte 102
+  .byte 114
+  .byte 111
+  .byte 109
+  .byte 40
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..120
+  .data
+.L..120:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 118
+  .byte 95
+  .byte 100
+  .byte 111
+  .byte 119
+  .byte 110
+  .byte 40
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 48
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..119
+  .data
+.L..119:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 118
+  .byte 95
+  .byte 100
+  .byte 111
+  .byte 119
+  .byte 110
+  .byte 40
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..118
+  .data
+.L..118:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 55
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 44
+  .byte 55
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 118
+  .byte 95
+  .byte 115
+  .byte 116
+  .byte 101
+  .byte 112
+  .byte 40
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 54
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..117
+  .data
+.L..117:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 115
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 118
+  .byte 95
+  .byte 99
+  .byte 111
+  .byte 112
+  .byte 121
+  .byte 40
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 43
+  .byte 100
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 43
+  .byte 100
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 43
+  .byte 100
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..116
+  .data
+.L..116:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 115
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 118
+  .byte 95
+  .byte 99
+  .byte 111
+  .byte 112
+  .byte 121
+  .byte 40
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 115
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..115
+  .data
+.L..115:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 118
+  .byte 95
+  .byte 105
+  .byte 110
+  .byte 100
+  .byte 101
+  .byte 120
+  .byte 40
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..114
+  .data
+.L..114:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 118
+  .byte 95
+  .byte 108
+  .byte 97
+  .byte 115
+  .byte 116
+  .byte 40
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..113
+  .data
+.L..113:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 45
+  .byte 49
+  .byte 44
+  .byte 53
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 118
+  .byte 95
+  .byte 108
+  .byte 97
+  .byte 115
+  .byte 116
+  .byte 40
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..112
+  .data
+.L..112:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 44
+  .byte 55
+  .byte 44
+  .byte 56
+  .byte 44
+  .byte 57
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 118
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 40
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 55
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..111
+  .section .rodata
+.L..111:
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 1
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 2
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 3
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 4
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 5
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 6
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 7
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 8
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 9
+  .byte 0
+  .byte 0
+  .byte 0
+  .local .L..110
+  .data
+.L..110:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 48
+  .byte 44
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 44
+  .byte 55
+  .byte 44
+  .byte 56
+  .byte 44
+  .byte 57
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 118
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 40
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 48
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..109
+  .section .rodata
+.L..109:
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 1
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 2
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 3
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 4
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 5
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 6
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 7
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 8
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 9
+  .byte 0
+  .byte 0
+  .byte 0
+  .local .L..108
+  .data
+.L..108:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 55
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 118
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 40
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..107
+  .data
+.L..107:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 55
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 118
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 40
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 48
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..106
+  .data
+.L..106:
+  .byte 108
+  .byte 105
+  .byte 99
+  .byte 109
+  .byte 95
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 40
+  .byte 54
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 0
+  .local .L..105
+  .data
+.L..105:
+  .byte 108
+  .byte 105
+  .byte 99
+  .byte 109
+  .byte 95
+  .byte 103
+  .byte 111
+  .byte 116
+  .byte 111
+  .byte 40
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..104
+  .data
+.L..104:
+  .byte 108
+  .byte 105
+  .byte 99
+  .byte 109
+  .byte 95
+  .byte 110
+  .byte 101
+  .byte 115
+  .byte 116
+  .byte 101
+  .byte 100
+  .byte 40
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 41
+  .byte 0
+  .local .L..103
+  .data
+.L..103:
+  .byte 108
+  .byte 105
+  .byte 99
+  .byte 109
+  .byte 95
+  .byte 100
+  .byte 105
+  .byte 118
+  .byte 40
+  .byte 57
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 0
+  .local .L..102
+  .data
+.L..102:
+  .byte 108
+  .byte 105
+  .byte 99
+  .byte 109
+  .byte 95
+  .byte 100
+  .byte 105
+  .byte 118
+  .byte 40
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..101
+  .data
+.L..101:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 105
+  .byte 99
+  .byte 109
+  .byte 95
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..100
+  .data
+.L..100:
+  .byte 108
+  .byte 105
+  .byte 99
+  .byte 109
+  .byte 95
+  .byte 102
+  .byte 97
+  .byte 117
+  .byte 108
+  .byte 116
+  .byte 40
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..99
+  .data
+.L..99:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 105
+  .byte 99
+  .byte 109
+  .byte 95
+  .byte 115
+  .byte 116
+  .byte 111
+  .byte 114
+  .byte 101
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 52
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..98
+  .data
+.L..98:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 54
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 105
+  .byte 99
+  .byte 109
+  .byte 95
+  .byte 109
+  .byte 117
+  .byte 108
+  .byte 40
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 100
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..97
+  .data
+.L..97:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 86
+  .byte 101
+  .byte 99
+  .byte 32
+  .byte 118
+  .byte 61
+  .byte 123
+  .byte 51
+  .byte 44
+  .byte 100
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 105
+  .byte 99
+  .byte 109
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 40
+  .byte 38
+  .byte 118
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..96
+  .data
+.L..96:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 42
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 43
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..95
+  .data
+.L..95:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 115
+  .byte 101
+  .byte 95
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 100
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..94
+  .data
+.L..94:
+  .byte 99
+  .byte 115
+  .byte 101
+  .byte 95
+  .byte 99
+  .byte 111
+  .byte 110
+  .byte 100
+  .byte 40
+  .byte 48
+  .byte 41
+  .byte 0
+  .local .L..93
+  .data
+.L..93:
+  .byte 99
+  .byte 115
+  .byte 101
+  .byte 95
+  .byte 118
+  .byte 97
+  .byte 114
+  .byte 40
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..92
+  .data
+.L..92:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 115
+  .byte 101
+  .byte 95
+  .byte 99
+  .byte 108
+  .byte 111
+  .byte 98
+  .byte 98
+  .byte 101
+  .byte 114
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 38
+  .byte 121
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..91
+  .data
+.L..91:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 115
+  .byte 101
+  .byte 95
+  .byte 99
+  .byte 108
+  .byte 111
+  .byte 98
+  .byte 98
+  .byte 101
+  .byte 114
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 38
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..90
+  .data
+.L..90:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 86
+  .byte 101
+  .byte 99
+  .byte 32
+  .byte 118
+  .byte 61
+  .byte 123
+  .byte 51
+  .byte 44
+  .byte 100
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 115
+  .byte 101
+  .byte 95
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 40
+  .byte 38
+  .byte 118
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..89
+  .data
+.L..89:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 125
+  .byte 44
+  .byte 123
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 125
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 91
+  .byte 106
+  .byte 93
+  .byte 42
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..88
+  .data
+.L..88:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 56
+  .byte 93
+  .byte 61
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 103
+  .byte 34
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 45
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 43
+  .byte 120
+  .byte 91
+  .byte 105
+  .byte 45
+  .byte 51
+  .byte 93
+  .byte 45
+  .byte 39
+  .byte 97
+  .byte 39
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..87
+  .section .rodata
+.L..87:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 100
+  .byte 101
+  .byte 102
+  .byte 103
+  .byte 0
+  .local .L..86
+  .data
+.L..86:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..85
+  .data
+.L..85:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 43
+  .byte 43
+  .byte 105
+  .byte 43
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..84
+  .data
+.L..84:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 115
+  .byte 104
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 61
+  .byte 45
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 115
+  .byte 104
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..83
+  .data
+.L..83:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 44
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 61
+  .byte 103
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 106
+  .byte 93
+  .byte 61
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 43
+  .byte 103
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 45
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..82
+  .data
+.L..82:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 103
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 43
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 91
+  .byte 45
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..81
+  .data
+.L..81:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 105
+  .byte 45
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..80
+  .data
+.L..80:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 97
+  .byte 114
+  .byte 114
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..79
+  .data
+.L..79:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 112
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 46
+  .byte 98
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 112
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 46
+  .byte 98
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 43
+  .byte 61
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 112
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 46
+  .byte 98
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..78
+  .data
+.L..78:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 106
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 112
+  .byte 91
+  .byte 106
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 46
+  .byte 120
+  .byte 61
+  .byte 57
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 112
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 46
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..77
+  .data
+.L..77:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 80
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 103
+  .byte 112
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 112
+  .byte 45
+  .byte 62
+  .byte 97
+  .byte 46
+  .byte 98
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 112
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 46
+  .byte 97
+  .byte 46
+  .byte 98
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..76
+  .data
+.L..76:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 53
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..75
+  .data
+.L..75:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..74
+  .data
+.L..74:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..73
+  .data
+.L..73:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..72
+  .data
+.L..72:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..71
+  .data
+.L..71:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..70
+  .data
+.L..70:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 50
+  .byte 91
+  .byte 120
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..69
+  .data
+.L..69:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..68
+  .data
+.L..68:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..67
+  .data
+.L..67:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..66
+  .data
+.L..66:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..65
+  .data
+.L..65:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 53
+  .byte 41
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..64
+  .data
+.L..64:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 52
+  .byte 41
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..63
+  .data
+.L..63:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 51
+  .byte 41
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..62
+  .data
+.L..62:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..61
+  .data
+.L..61:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 121
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..60
+  .data
+.L..60:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..59
+  .data
+.L..59:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..58
+  .data
+.L..58:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..57
+  .data
+.L..57:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..56
+  .data
+.L..56:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..55
+  .data
+.L..55:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 44
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 43
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..54
+  .data
+.L..54:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 43
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..53
+  .data
+.L..53:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 43
+  .byte 50
+  .byte 41
+  .byte 45
+  .byte 38
+  .byte 120
+  .byte 43
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..52
+  .data
+.L..52:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 121
+  .byte 45
+  .byte 50
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..51
+  .data
+.L..51:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..50
+  .data
+.L..50:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..49
+  .data
+.L..49:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 45
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..48
+  .data
+.L..48:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 121
+  .byte 45
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..47
+  .data
+.L..47:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 40
+  .byte 38
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..46
+  .data
+.L..46:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 122
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..45
+  .data
+.L..45:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .globl gsh
+  .bss
+gsh:
+  .zero 8
+  .globl garr
+  .bss
+garr:
+  .zero 40
+  .globl gp
+  .bss
+gp:
+  .zero 96
+  .globl main
+  .text
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 1344
+  mov [rbp-1312], rbx
+  mov [rbp-1320], r12
+  mov [rbp-1328], r13
+  mov [rbp-1336], r14
+  mov [rbp-1344], r15
+.L.body.main:
+  .loc 1 69
+  mov dword ptr [rbp-1296], 3
+  .loc 1 69
+  movsxd rax, dword ptr [rbp-1296]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..45[rip]
+  call assert
+  .loc 1 70
+  mov dword ptr [rbp-1292], 3
+  .loc 1 70
+  lea rax, [rbp-1292]
+  mov qword ptr [rbp-1288], rax
+  .loc 1 70
+  lea rax, [rbp-1288]
+  mov qword ptr [rbp-1280], rax
+  .loc 1 70
+  mov rax, qword ptr [rax]
+  movsxd rax, dword ptr [rax]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..46[rip]
+  call assert
+  .loc 1 71
+  mov dword ptr [rbp-1268], 3
+  .loc 1 71
+  mov dword ptr [rbp-1264], 5
+  .loc 1 71
+  movsxd rax, dword ptr [rbp-1264]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..47[rip]
+  call assert
+  .loc 1 72
+  mov dword ptr [rbp-1260], 3
+  .loc 1 72
+  mov dword ptr [rbp-1256], 5
+  .loc 1 72
+  movsxd rax, dword ptr [rbp-1260]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..48[rip]
+  call assert
+  .loc 1 73
+  mov dword ptr [rbp-1252], 3
+  .loc 1 73
+  mov dword ptr [rbp-1248], 5
+  .loc 1 73
+  movsxd rax, dword ptr [rbp-1248]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..49[rip]
+  call assert
+  .loc 1 74
+  mov dword ptr [rbp-1244], 3
+  .loc 1 74
+  lea rax, [rbp-1244]
+  mov qword ptr [rbp-1240], rax
+  .loc 1 74
+  mov dword ptr [rax], 5
+  .loc 1 74
+  movsxd rax, dword ptr [rbp-1244]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..50[rip]
+  call assert
+  .loc 1 75
+  mov dword ptr [rbp-1228], 3
+  .loc 1 75
+  mov dword ptr [rbp-1224], 5
+  .loc 1 75
+  mov dword ptr [rbp-1224], 7
+  .loc 1 75
+  movsxd rax, dword ptr [rbp-1224]
+  mov rsi, rax
+  mov edi, 7
+  lea rdx, .L..51[rip]
+  call assert
+  .loc 1 76
+  mov dword ptr [rbp-1220], 3
+  .loc 1 76
+  mov dword ptr [rbp-1216], 5
+  .loc 1 76
+  mov dword ptr [rbp-1220], 7
+  .loc 1 76
+  movsxd rax, dword ptr [rbp-1220]
+  mov rsi, rax
+  mov edi, 7
+  lea rdx, .L..52[rip]
+  call assert
+  .loc 1 77
+  mov dword ptr [rbp-1212], 3
+  .loc 1 77
+  lea rax, [rbp-1212]
+  mov r14, rax
+  .loc 1 77
+  lea rax, [rbp-1212]
+  add rax, 8
+  mov rdi, r14
+  sub rax, rdi
+  lea rdx, [rax+3]
+  test rax, rax
+  cmovs rax, rdx
+  sar rax, 2
+  add rax, 3
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..53[rip]
+  call assert
+  .loc 1 78
+  mov dword ptr [rbp-1208], 3
+  .loc 1 78
+  mov dword ptr [rbp-1204], 5
+  .loc 1 78
+  movsxd rax, dword ptr [rbp-1208]
+  add eax, dword ptr [rbp-1204]
+  mov rsi, rax
+  mov edi, 8
+  lea rdx, .L..54[rip]
+  call assert
+  .loc 1 79
+  mov dword ptr [rbp-1200], 3
+  .loc 1 79
+  mov dword ptr [rbp-1196], 5
+  .loc 1 79
+  movsxd rax, dword ptr [rbp-1200]
+  add eax, dword ptr [rbp-1196]
+  mov rsi, rax
+  mov edi, 8
+  lea rdx, .L..55[rip]
+  call assert
+  .loc 1 80
+  lea rax, [rbp-1192]
+  mov qword ptr [rbp-1184], rax
+  .loc 1 80
+  mov dword ptr [rax], 3
+  .loc 1 80
+  movsxd rax, dword ptr [rbp-1192]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..56[rip]
+  call assert
+  .loc 1 81
+  mov dword ptr [rbp-1172], 3
+  .loc 1 81
+  mov dword ptr [rbp-1168], 4
+  .loc 1 81
+  mov dword ptr [rbp-1164], 5
+  .loc 1 81
+  movsxd rax, dword ptr [rbp-1172]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..57[rip]
+  call assert
+  .loc 1 82
+  mov dword ptr [rbp-1160], 3
+  .loc 1 82
+  mov dword ptr [rbp-1156], 4
+  .loc 1 82
+  mov dword ptr [rbp-1152], 5
+  .loc 1 82
+  movsxd rax, dword ptr [rbp-1156]
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..58[rip]
+  call assert
+  .loc 1 83
+  mov dword ptr [rbp-1148], 3
+  .loc 1 83
+  mov dword ptr [rbp-1144], 4
+  .loc 1 83
+  mov dword ptr [rbp-1140], 5
+  .loc 1 83
+  movsxd rax, dword ptr [rbp-1140]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..59[rip]
+  call assert
+  .loc 1 84
+  lea rax, [rbp-1136]
+  mov qword ptr [rbp-1112], rax
+  .loc 1 84
+  mov dword ptr [rax], 0
+  .loc 1 84
+  movsxd rax, dword ptr [rbp-1136]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..60[rip]
+  call assert
+  .loc 1 85
+  lea rax, [rbp-1104]
+  mov qword ptr [rbp-1080], rax
+  .loc 1 85
+  mov dword ptr [rax+4], 1
+  .loc 1 85
+  movsxd rax, dword ptr [rbp-1100]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..61[rip]
+  call assert
+  .loc 1 86
+  lea rax, [rbp-1072]
+  mov qword ptr [rbp-1048], rax
+  .loc 1 86
+  mov dword ptr [rax+8], 2
+  .loc 1 86
+  movsxd rax, dword ptr [rbp-1064]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..62[rip]
+  call assert
+  .loc 1 87
+  lea rax, [rbp-1040]
+  mov qword ptr [rbp-1016], rax
+  .loc 1 87
+  mov dword ptr [rax+12], 3
+  .loc 1 87
+  movsxd rax, dword ptr [rbp-1028]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..63[rip]
+  call assert
+  .loc 1 88
+  lea rax, [rbp-1008]
+  mov qword ptr [rbp-984], rax
+  .loc 1 88
+  mov dword ptr [rax+16], 4
+  .loc 1 88
+  movsxd rax, dword ptr [rbp-992]
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..64[rip]
+  call assert
+  .loc 1 89
+  lea rax, [rbp-976]
+  mov qword ptr [rbp-952], rax
+  .loc 1 89
+  mov dword ptr [rax+20], 5
+  .loc 1 89
+  movsxd rax, dword ptr [rbp-956]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..65[rip]
+  call assert
+  .loc 1 90
+  mov dword ptr [rbp-940], 3
+  .loc 1 90
+  mov dword ptr [rbp-936], 4
+  .loc 1 90
+  mov dword ptr [rbp-932], 5
+  .loc 1 90
+  movsxd rax, dword ptr [rbp-940]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..66[rip]
+  call assert
+  .loc 1 91
+  mov dword ptr [rbp-928], 3
+  .loc 1 91
+  mov dword ptr [rbp-924], 4
+  .loc 1 91
+  mov dword ptr [rbp-920], 5
+  .loc 1 91
+  movsxd rax, dword ptr [rbp-924]
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..67[rip]
+  call assert
+  .loc 1 92
+  mov dword ptr [rbp-916], 3
+  .loc 1 92
+  mov dword ptr [rbp-912], 4
+  .loc 1 92
+  mov dword ptr [rbp-908], 5
+  .loc 1 92
+  movsxd rax, dword ptr [rbp-908]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..68[rip]
+  call assert
+  .loc 1 93
+  mov dword ptr [rbp-904], 3
+  .loc 1 93
+  mov dword ptr [rbp-900], 4
+  .loc 1 93
+  mov dword ptr [rbp-896], 5
+  .loc 1 93
+  movsxd rax, dword ptr [rbp-896]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..69[rip]
+  call assert
+  .loc 1 94
+  mov dword ptr [rbp-892], 3
+  .loc 1 94
+  mov dword ptr [rbp-888], 4
+  .loc 1 94
+  mov dword ptr [rbp-884], 5
+  .loc 1 94
+  movsxd rax, dword ptr [rbp-884]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..70[rip]
+  call assert
+  .loc 1 95
+  lea rax, [rbp-880]
+  mov qword ptr [rbp-856], rax
+  .loc 1 95
+  mov dword ptr [rax], 0
+  .loc 1 95
+  movsxd rax, dword ptr [rbp-880]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..71[rip]
+  call assert
+  .loc 1 96
+  lea rax, [rbp-848]
+  mov qword ptr [rbp-824], rax
+  .loc 1 96
+  mov dword ptr [rax+4], 1
+  .loc 1 96
+  movsxd rax, dword ptr [rbp-844]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..72[rip]
+  call assert
+  .loc 1 97
+  lea rax, [rbp-816]
+  mov qword ptr [rbp-792], rax
+  .loc 1 97
+  mov dword ptr [rax+8], 2
+  .loc 1 97
+  movsxd rax, dword ptr [rbp-808]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..73[rip]
+  call assert
+  .loc 1 98
+  lea rax, [rbp-784]
+  mov qword ptr [rbp-760], rax
+  .loc 1 98
+  mov dword ptr [rax+12], 3
+  .loc 1 98
+  movsxd rax, dword ptr [rbp-772]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..74[rip]
+  call assert
+  .loc 1 99
+  lea rax, [rbp-752]
+  mov qword ptr [rbp-728], rax
+  .loc 1 99
+  mov dword ptr [rax+16], 4
+  .loc 1 99
+  movsxd rax, dword ptr [rbp-736]
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..75[rip]
+  call assert
+  .loc 1 100
+  lea rax, [rbp-720]
+  mov qword ptr [rbp-696], rax
+  .loc 1 100
+  mov dword ptr [rax+20], 5
+  .loc 1 100
+  movsxd rax, dword ptr [rbp-700]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..76[rip]
+  call assert
+  .loc 1 101
+  lea rax, gp[rip]
+  mov qword ptr [rbp-688], rax
+  .loc 1 101
+  mov dword ptr [rbp-676], 2
+  .loc 1 101
+  movsxd rax, dword ptr [rbp-676]
+  mov r14, rax
+  .loc 1 101
+  mov rax, qword ptr [rbp-688]
+  mov rdi, r14
+  mov dword ptr [rax+rdi*4+12], 7
+  .loc 1 101
+  movsxd rax, dword ptr gp+20[rip]
+  mov rsi, rax
+  mov edi, 7
+  lea rdx, .L..77[rip]
+  call assert
+  .loc 1 102
+  mov qword ptr [rbp-672], 2
+  .loc 1 102
+  mov rax, qword ptr [rbp-672]
+  shl rax, 5
+  mov r14, rax
+  lea rax, gp[rip]
+  mov rdi, r14
+  mov dword ptr [rax+rdi*1+8], 9
+  .loc 1 102
+  movsxd rax, dword ptr gp+72[rip]
+  mov rsi, rax
+  mov edi, 9
+  lea rdx, .L..78[rip]
+  call assert
+  .loc 1 103
+  mov dword ptr [rbp-660], 1
+  .loc 1 103
+  mov dword ptr gp+56[rip], 4
+  .loc 1 103
+  movsxd rax, dword ptr [rbp-660]
+  shl rax, 5
+  mov r14, rax
+  lea rax, gp[rip]
+  mov rdi, r14
+  add dword ptr [rax+rdi*1+24], 6
+  .loc 1 103
+  movsxd rax, dword ptr gp+56[rip]
+  mov rsi, rax
+  mov edi, 10
+  lea rdx, .L..79[rip]
+  call assert
+  .loc 1 104
+  mov dword ptr [rbp-656], 3
+  .loc 1 104
+  movsxd rax, dword ptr [rbp-656]
+  mov r14, rax
+  lea rax, garr[rip]
+  mov rdi, r14
+  mov dword ptr [rax+rdi*4], 3
+  .loc 1 104
+  movsxd rax, dword ptr garr+12[rip]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..80[rip]
+  call assert
+  .loc 1 105
+  mov dword ptr [rbp-652], 4
+  .loc 1 105
+  movsxd rax, dword ptr [rbp-652]
+  sub eax, 1
+  movsxd rax, eax
+  mov r14, rax
+  lea rax, garr[rip]
+  mov rdi, r14
+  mov dword ptr [rax+rdi*4], 5
+  .loc 1 105
+  movsxd rax, dword ptr garr+12[rip]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..81[rip]
+  call assert
+  .loc 1 106
+  lea rax, garr[rip]
+  add rax, 20
+  mov qword ptr [rbp-648], rax
+  .loc 1 106
+  mov dword ptr [rax-4], 6
+  .loc 1 106
+  movsxd rax, dword ptr garr+16[rip]
+  mov rsi, rax
+  mov edi, 6
+  lea rdx, .L..82[rip]
+  call assert
+  .loc 1 107
+  mov dword ptr [rbp-636], 2
+  .loc 1 107
+  mov dword ptr [rbp-632], 0
+  .loc 1 107
+  mov eax, 8
+  mov r14, rax
+  .loc 1 107
+  movsxd rax, dword ptr [rbp-632]
+  mov r15, rax
+  lea rax, garr[rip]
+  mov rdi, r15
+  mov rdx, r14
+  mov dword ptr [rax+rdi*4], edx
+  mov rax, rdx
+  mov r14, rax
+  .loc 1 107
+  movsxd rax, dword ptr [rbp-636]
+  mov r15, rax
+  lea rax, garr[rip]
+  mov rdi, r15
+  mov rdx, r14
+  mov dword ptr [rax+rdi*4], edx
+  .loc 1 107
+  movsxd rax, dword ptr garr+8[rip]
+  add eax, dword ptr garr[rip]
+  sub eax, 8
+  mov rsi, rax
+  mov edi, 8
+  lea rdx, .L..83[rip]
+  call assert
+  .loc 1 108
+  mov dword ptr [rbp-628], 1
+  .loc 1 108
+  movsxd rax, dword ptr [rbp-628]
+  mov r14, rax
+  lea rax, gsh[rip]
+  mov rdi, r14
+  mov word ptr [rax+rdi*2], -3
+  .loc 1 108
+  movsx eax, word ptr gsh+2[rip]
+  mov rsi, rax
+  mov edi, -3
+  lea rdx, .L..84[rip]
+  call assert
+  .loc 1 109
+  mov dword ptr [rbp-624], 0
+  .loc 1 109
+  mov dword ptr garr+4[rip], 1
+  .loc 1 109
+  mov dword ptr garr+8[rip], 2
+  .loc 1 109
+  inc dword ptr [rbp-624]
+  movsxd rax, dword ptr [rbp-624]
+  add eax, 1
+  movsxd rax, eax
+  mov r14, rax
+  lea rax, garr[rip]
+  mov rdi, r14
+  movsxd rax, dword ptr [rax+rdi*4]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..85[rip]
+  call assert
+  .loc 1 110
+  mov dword ptr [rbp-620], 0
+  .loc 1 110
+  inc dword ptr [rbp-620]
+  movsxd rax, dword ptr [rbp-620]
+  add eax, -1
+  movsxd rax, eax
+  mov r14, rax
+  lea rax, garr[rip]
+  mov rdi, r14
+  mov dword ptr [rax+rdi*4], 1
+  .loc 1 110
+  movsxd rax, dword ptr [rbp-620]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..86[rip]
+  call assert
+  .loc 1 111
+  lea rax, [rbp-616]
+  mov r14, rax
+  .loc 1 111
+  lea rax, .L..87[rip]
+  mov rdi, r14
+  mov r8, [rax+0]
+  mov [rdi+0], r8
+  .loc 1 111
+  mov dword ptr [rbp-608], 3
+  .loc 1 111
+  movsxd rax, dword ptr [rbp-608]
+  sub eax, 3
+  movsxd rax, eax
+  movsx eax, byte ptr [rbp+rax*1-616]
+  mov r14, rax
+  .loc 1 111
+  movsx eax, byte ptr [rbp-616]
+  mov r15, rax
+  .loc 1 111
+  movsxd rax, dword ptr [rbp-608]
+  movsx eax, byte ptr [rbp+rax*1-616]
+  mov rdi, r15
+  sub eax, edi
+  mov rdi, r14
+  add eax, edi
+  sub eax, 97
+  add eax, 1
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..88[rip]
+  call assert
+  .loc 1 112
+  mov eax, 1
+  mov dword ptr [rbp-604], eax
+  .loc 1 112
+  mov eax, 2
+  mov dword ptr [rbp-600], eax
+  .loc 1 112
+  mov eax, 3
+  mov dword ptr [rbp-596], eax
+  .loc 1 112
+  mov eax, 4
+  mov dword ptr [rbp-592], eax
+  .loc 1 112
+  mov eax, 5
+  mov dword ptr [rbp-588], eax
+  .loc 1 112
+  mov eax, 6
+  mov dword ptr [rbp-584], eax
+  .loc 1 112
+  mov dword ptr [rbp-580], 1
+  .loc 1 112
+  mov dword ptr [rbp-576], 2
+  .loc 1 112
+  movsxd rax, dword ptr [rbp-576]
+  mov r14, rax
+  .loc 1 112
+  movsxd rax, dword ptr [rbp-580]
+  imul rax, rax, 12
+  mov r15, rax
+  .loc 1 112
+  lea rax, [rbp-604]
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  movsxd rax, dword ptr [rax+rdi*4]
+  shl eax, 1
+  mov rsi, rax
+  mov edi, 12
+  lea rdx, .L..89[rip]
+  call assert
+  .loc 1 113
+  mov eax, 1
+  mov dword ptr [rbp-572], eax
+  .loc 1 113
+  mov eax, 2
+  mov dword ptr [rbp-568], eax
+  .loc 1 113
+  mov eax, 3
+  mov dword ptr [rbp-564], eax
+  .loc 1 113
+  mov dword ptr [rbp-556], 0
+  .loc 1 113
+  mov eax, 3
+  mov dword ptr [rbp-560], eax
+  .loc 1 113
+  lea rax, [rbp-572]
+  mov qword ptr [rbp-552], rax
+  .loc 1 113
+  lea rdi, [rbp-560]
+  call cse_sum
+  mov rsi, rax
+  mov edi, 14
+  lea rdx, .L..90[rip]
+  call assert
+  .loc 1 114
+  mov dword ptr [rbp-540], 3
+  .loc 1 114
+  lea rdi, [rbp-540]
+  lea rsi, [rbp-540]
+  call cse_clobber
+  mov rsi, rax
+  mov edi, 10
+  lea rdx, .L..91[rip]
+  call assert
+  .loc 1 115
+  mov dword ptr [rbp-536], 3
+  .loc 1 115
+  mov dword ptr [rbp-532], 0
+  .loc 1 115
+  lea rdi, [rbp-536]
+  lea rsi, [rbp-532]
+  call cse_clobber
+  mov rsi, rax
+  mov edi, 8
+  lea rdx, .L..92[rip]
+  call assert
+  .loc 1 116
+  mov edi, 2
+  mov esi, 5
+  call cse_var
+  mov rsi, rax
+  mov edi, 137
+  lea rdx, .L..93[rip]
+  call assert
+  .loc 1 117
+  xor edi, edi
+  call cse_cond
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..94[rip]
+  call assert
+  .loc 1 118
+  mov dword ptr [rbp-528], 4
+  .loc 1 118
+  lea rdi, [rbp-528]
+  call cse_cond
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..95[rip]
+  call assert
+  .loc 1 119
+  mov eax, 1
+  mov dword ptr [rbp-524], eax
+  .loc 1 119
+  mov eax, 2
+  mov dword ptr [rbp-520], eax
+  .loc 1 119
+  mov eax, 3
+  mov dword ptr [rbp-516], eax
+  .loc 1 119
+  mov dword ptr [rbp-512], 1
+  .loc 1 119
+  movsxd rax, dword ptr [rbp-512]
+  movsxd rax, dword ptr [rbp+rax*4-524]
+  mov dword ptr [rbp-12], eax
+  .loc 1 119
+  movsxd rax, eax
+  imul eax, dword ptr [rbp-12]
+  add eax, dword ptr [rbp-12]
+  mov rsi, rax
+  mov edi, 6
+  lea rdx, .L..96[rip]
+  call assert
+  .loc 1 120
+  mov eax, 1
+  mov dword ptr [rbp-508], eax
+  .loc 1 120
+  mov eax, 2
+  mov dword ptr [rbp-504], eax
+  .loc 1 120
+  mov eax, 3
+  mov dword ptr [rbp-500], eax
+  .loc 1 120
+  mov dword ptr [rbp-492], 0
+  .loc 1 120
+  mov eax, 3
+  mov dword ptr [rbp-496], eax
+  .loc 1 120
+  lea rax, [rbp-508]
+  mov qword ptr [rbp-488], rax
+  .loc 1 120
+  lea rdi, [rbp-496]
+  call licm_sum
+  mov rsi, rax
+  mov edi, 6
+  lea rdx, .L..97[rip]
+  call assert
+  .loc 1 121
+  mov eax, 1
+  mov dword ptr [rbp-480], eax
+  .loc 1 121
+  mov eax, 2
+  mov dword ptr [rbp-476], eax
+  .loc 1 121
+  mov eax, 3
+  mov dword ptr [rbp-472], eax
+  .loc 1 121
+  mov eax, 4
+  mov dword ptr [rbp-468], eax
+  .loc 1 121
+  mov eax, 5
+  mov dword ptr [rbp-464], eax
+  .loc 1 121
+  mov eax, 6
+  mov dword ptr [rbp-460], eax
+  .loc 1 121
+  mov edi, 2
+  mov esi, 3
+  lea rdx, [rbp-480]
+  call licm_mul
+  mov rsi, rax
+  mov edi, 21
+  lea rdx, .L..98[rip]
+  call assert
+  .loc 1 122
+  mov dword ptr [rbp-456], 5
+  .loc 1 122
+  lea rdi, [rbp-456]
+  mov esi, 4
+  call licm_store
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..99[rip]
+  call assert
+  .loc 1 123
+  xor edi, edi
+  xor esi, esi
+  call licm_fault
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..100[rip]
+  call assert
+  .loc 1 124
+  mov dword ptr [rbp-452], 3
+  .loc 1 124
+  lea rdi, [rbp-452]
+  mov esi, 3
+  call licm_fault
+  mov rsi, rax
+  mov edi, 18
+  lea rdx, .L..101[rip]
+  call assert
+  .loc 1 125
+  mov edi, 1
+  xor esi, esi
+  xor edx, edx
+  call licm_div
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..102[rip]
+  call assert
+  .loc 1 126
+  mov edi, 9
+  mov esi, 2
+  mov edx, 3
+  call licm_div
+  mov rsi, rax
+  mov edi, 12
+  lea rdx, .L..103[rip]
+  call assert
+  .loc 1 127
+  mov edi, 3
+  mov esi, 2
+  call licm_nested
+  mov rsi, rax
+  mov edi, 126
+  lea rdx, .L..104[rip]
+  call assert
+  .loc 1 128
+  mov edi, 2
+  mov esi, 3
+  call licm_goto
+  mov rsi, rax
+  mov edi, 6
+  lea rdx, .L..105[rip]
+  call assert
+  .loc 1 129
+  mov edi, 6
+  mov esi, 1
+  call licm_goto
+  mov rsi, rax
+  mov edi, 6
+  lea rdx, .L..106[rip]
+  call assert
+  .loc 1 130
+  mov dword ptr [rbp-448], 7
+  .loc 1 130
+  lea rdi, [rbp-448]
+  xor esi, esi
+  call iv_sum
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..107[rip]
+  call assert
+  .loc 1 131
+  mov dword ptr [rbp-444], 7
+  .loc 1 131
+  lea rdi, [rbp-444]
+  mov esi, 1
+  call iv_sum
+  mov rsi, rax
+  mov edi, 7
+  lea rdx, .L..108[rip]
+  call assert
+  .loc 1 132
+  lea rax, [rbp-440]
+  mov r14, rax
+  .loc 1 132
+  lea rax, .L..109[rip]
+  mov rdi, r14
+  movdqu xmm0, [rax+0]
+  movdqu [rdi+0], xmm0
+  movdqu xmm0, [rax+16]
+  movdqu [rdi+16], xmm0
+  mov r8, [rax+32]
+  mov [rdi+32], r8
+  .loc 1 132
+  lea rdi, [rbp-440]
+  mov esi, 10
+  call iv_sum
+  mov rsi, rax
+  mov edi, 45
+  lea rdx, .L..110[rip]
+  call assert
+  .loc 1 133
+  lea rax, [rbp-400]
+  mov r14, rax
+  .loc 1 133
+  lea rax, .L..111[rip]
+  mov rdi, r14
+  movdqu xmm0, [rax+0]
+  movdqu [rdi+0], xmm0
+  movdqu xmm0, [rax+16]
+  movdqu [rdi+16], xmm0
+  mov r8, [rax+32]
+  mov [rdi+32], r8
+  .loc 1 133
+  lea rdi, [rbp-400]
+  mov esi, 7
+  call iv_sum
+  mov rsi, rax
+  mov edi, 21
+  lea rdx, .L..112[rip]
+  call assert
+  .loc 1 134
+  mov eax, 1
+  mov dword ptr [rbp-360], eax
+  .loc 1 134
+  mov eax, 2
+  mov dword ptr [rbp-356], eax
+  .loc 1 134
+  mov eax, 3
+  mov dword ptr [rbp-352], eax
+  .loc 1 134
+  mov eax, -1
+  mov dword ptr [rbp-348], eax
+  .loc 1 134
+  mov eax, 5
+  mov dword ptr [rbp-344], eax
+  .loc 1 134
+  lea rdi, [rbp-360]
+  mov esi, 5
+  call iv_last
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..113[rip]
+  call assert
+  .loc 1 135
+  mov eax, 1
+  mov dword ptr [rbp-340], eax
+  .loc 1 135
+  mov eax, 2
+  mov dword ptr [rbp-336], eax
+  .loc 1 135
+  mov eax, 3
+  mov dword ptr [rbp-332], eax
+  .loc 1 135
+  mov eax, 4
+  mov dword ptr [rbp-328], eax
+  .loc 1 135
+  mov eax, 5
+  mov dword ptr [rbp-324], eax
+  .loc 1 135
+  lea rdi, [rbp-340]
+  mov esi, 5
+  call iv_last
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..114[rip]
+  call assert
+  .loc 1 136
+  mov eax, 1
+  mov dword ptr [rbp-320], eax
+  .loc 1 136
+  mov eax, 2
+  mov dword ptr [rbp-316], eax
+  .loc 1 136
+  mov eax, 3
+  mov dword ptr [rbp-312], eax
+  .loc 1 136
+  mov eax, 4
+  mov dword ptr [rbp-308], eax
+  .loc 1 136
+  mov eax, 5
+  mov dword ptr [rbp-304], eax
+  .loc 1 136
+  lea rdi, [rbp-320]
+  mov esi, 5
+  call iv_index
+  mov rsi, rax
+  mov edi, 40
+  lea rdx, .L..115[rip]
+  call assert
+  .loc 1 137
+  mov eax, 1
+  mov byte ptr [rbp-300], al
+  .loc 1 137
+  mov eax, 2
+  mov byte ptr [rbp-299], al
+  .loc 1 137
+  mov eax, 3
+  mov byte ptr [rbp-298], al
+  .loc 1 137
+  mov eax, 4
+  mov byte ptr [rbp-297], al
+  .loc 1 137
+  mov eax, 5
+  mov byte ptr [rbp-296], al
+  .loc 1 137
+  lea rdi, [rbp-295]
+  lea rsi, [rbp-300]
+  mov edx, 5
+  call iv_copy
+  mov rsi, rax
+  mov edi, 6
+  lea rdx, .L..116[rip]
+  call assert
+  .loc 1 138
+  mov eax, 1
+  mov byte ptr [rbp-290], al
+  .loc 1 138
+  mov eax, 2
+  mov byte ptr [rbp-289], al
+  .loc 1 138
+  mov eax, 3
+  mov byte ptr [rbp-288], al
+  .loc 1 138
+  mov eax, 4
+  mov byte ptr [rbp-287], al
+  .loc 1 138
+  mov eax, 5
+  mov byte ptr [rbp-286], al
+  .loc 1 138
+  lea rdi, [rbp-285]
+  lea rsi, [rbp-290]
+  mov edx, 5
+  call iv_copy
+  .loc 1 138
+  movsx eax, byte ptr [rbp-282]
+  mov r14, rax
+  .loc 1 138
+  movsx eax, byte ptr [rbp-283]
+  mov r15, rax
+  .loc 1 138
+  movsx eax, byte ptr [rbp-284]
+  mov [rbp-1304], rax
+  .loc 1 138
+  movsx eax, byte ptr [rbp-285]
+  mov rdi, [rbp-1304]
+  add eax, edi
+  mov rdi, r15
+  add eax, edi
+  mov rdi, r14
+  add eax, edi
+  mov rsi, rax
+  mov edi, 14
+  lea rdx, .L..117[rip]
+  call assert
+  .loc 1 139
+  mov eax, 1
+  mov qword ptr [rbp-280], rax
+  .loc 1 139
+  mov eax, 2
+  mov qword ptr [rbp-272], rax
+  .loc 1 139
+  mov eax, 3
+  mov qword ptr [rbp-264], rax
+  .loc 1 139
+  mov eax, 4
+  mov qword ptr [rbp-256], rax
+  .loc 1 139
+  mov eax, 5
+  mov qword ptr [rbp-248], rax
+  .loc 1 139
+  mov eax, 6
+  mov qword ptr [rbp-240], rax
+  .loc 1 139
+  mov eax, 7
+  mov qword ptr [rbp-232], rax
+  .loc 1 139
+  lea rdi, [rbp-280]
+  mov esi, 6
+  call iv_step
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..118[rip]
+  call assert
+  .loc 1 140
+  mov eax, 1
+  mov word ptr [rbp-220], ax
+  .loc 1 140
+  mov eax, 2
+  mov word ptr [rbp-218], ax
+  .loc 1 140
+  mov eax, 3
+  mov word ptr [rbp-216], ax
+  .loc 1 140
+  mov eax, 4
+  mov word ptr [rbp-214], ax
+  .loc 1 140
+  lea rdi, [rbp-220]
+  mov esi, 4
+  call iv_down
+  mov rsi, rax
+  mov edi, 49
+  lea rdx, .L..119[rip]
+  call assert
+  .loc 1 141
+  mov eax, 1
+  mov word ptr [rbp-212], ax
+  .loc 1 141
+  mov eax, 2
+  mov word ptr [rbp-210], ax
+  .loc 1 141
+  mov eax, 3
+  mov word ptr [rbp-208], ax
+  .loc 1 141
+  mov eax, 4
+  mov word ptr [rbp-206], ax
+  .loc 1 141
+  lea rdi, [rbp-212]
+  xor esi, esi
+  call iv_down
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..120[rip]
+  call assert
+  .loc 1 142
+  mov eax, 1
+  mov dword ptr [rbp-204], eax
+  .loc 1 142
+  mov eax, 2
+  mov dword ptr [rbp-200], eax
+  .loc 1 142
+  mov eax, 3
+  mov dword ptr [rbp-196], eax
+  .loc 1 142
+  mov eax, 4
+  mov dword ptr [rbp-192], eax
+  .loc 1 142
+  mov eax, 5
+  mov dword ptr [rbp-188], eax
+  .loc 1 142
+  lea rdi, [rbp-204]
+  mov esi, 3
+  mov edx, 5
+  call iv_from
+  mov rsi, rax
+  mov edi, 9
+  lea rdx, .L..121[rip]
+  call assert
+  .loc 1 143
+  mov eax, 1
+  mov dword ptr [rbp-184], eax
+  .loc 1 143
+  mov eax, 2
+  mov dword ptr [rbp-180], eax
+  .loc 1 143
+  mov eax, 3
+  mov dword ptr [rbp-176], eax
+  .loc 1 143
+  mov eax, 4
+  mov dword ptr [rbp-172], eax
+  .loc 1 143
+  mov eax, 5
+  mov dword ptr [rbp-168], eax
+  .loc 1 143
+  lea rdi, [rbp-184]
+  mov esi, 5
+  mov edx, 3
+  call iv_from
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..122[rip]
+  call assert
+  .loc 1 144
+  lea rax, [rbp-164]
+  mov r14, rax
+  .loc 1 144
+  lea rax, .L..123[rip]
+  mov rdi, r14
+  movdqu xmm0, [rax+0]
+  movdqu [rdi+0], xmm0
+  movdqu xmm0, [rax+16]
+  movdqu [rdi+16], xmm0
+  movdqu xmm0, [rax+32]
+  movdqu [rdi+32], xmm0
+  .loc 1 144
+  lea rdi, [rbp-164]
+  call iv_2d
+  mov rsi, rax
+  mov edi, 188
+  lea rdx, .L..124[rip]
+  call assert
+  .loc 1 145
+  mov eax, 1
+  mov dword ptr [rbp-116], eax
+  .loc 1 145
+  mov eax, 2
+  mov dword ptr [rbp-112], eax
+  .loc 1 145
+  mov eax, 3
+  mov dword ptr [rbp-108], eax
+  .loc 1 145
+  mov eax, 4
+  mov dword ptr [rbp-104], eax
+  .loc 1 145
+  mov eax, 5
+  mov dword ptr [rbp-100], eax
+  .loc 1 145
+  lea rdi, [rbp-116]
+  mov esi, 5
+  call iv_continue
+  mov rsi, rax
+  mov edi, 13
+  lea rdx, .L..125[rip]
+  call assert
+  .loc 1 146
+  mov eax, 1
+  mov dword ptr [rbp-96], eax
+  .loc 1 146
+  mov eax, 2
+  mov dword ptr [rbp-92], eax
+  .loc 1 146
+  mov eax, 3
+  mov dword ptr [rbp-88], eax
+  .loc 1 146
+  mov eax, 4
+  mov dword ptr [rbp-84], eax
+  .loc 1 146
+  mov eax, 5
+  mov dword ptr [rbp-80], eax
+  .loc 1 146
+  lea rdi, [rbp-96]
+  mov rsi, 4
+  call iv_long
+  mov rsi, rax
+  mov edi, 10
+  lea rdx, .L..126[rip]
+  call assert
+  .loc 1 147
+  mov eax, 1
+  mov dword ptr [rbp-76], eax
+  .loc 1 147
+  mov eax, 2
+  mov dword ptr [rbp-72], eax
+  .loc 1 147
+  mov eax, 3
+  mov dword ptr [rbp-68], eax
+  .loc 1 147
+  mov eax, 4
+  mov dword ptr [rbp-64], eax
+  .loc 1 147
+  mov eax, 5
+  mov dword ptr [rbp-60], eax
+  .loc 1 147
+  lea rdi, [rbp-76]
+  mov rsi, -4
+  call iv_long
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..127[rip]
+  call assert
+  .loc 1 148
+  xor edi, edi
+  xor esi, esi
+  call iv_fault
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..128[rip]
+  call assert
+  .loc 1 149
+  mov eax, 3
+  mov dword ptr [rbp-56], eax
+  .loc 1 149
+  mov eax, 2
+  mov dword ptr [rbp-52], eax
+  .loc 1 149
+  xor eax, eax
+  mov dword ptr [rbp-48], eax
+  .loc 1 149
+  mov eax, 1
+  mov dword ptr [rbp-44], eax
+  .loc 1 149
+  mov rax, 9223372036854775807
+  mov rsi, rax
+  lea rdi, [rbp-56]
+  call iv_find
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..129[rip]
+  call assert
+  .loc 1 150
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 150
+  mov dword ptr [rbp-40], 2
+  .loc 1 150
+  mov dword ptr [rbp-36], 5
+  .loc 1 150
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 150
+  movsxd rax, dword ptr [rbp-40]
+  imul eax, dword ptr [rbp-36]
+  movsxd r13, eax
+  .loc 1 150
+  mov rax, rbx
+  cmp eax, r13d
+  jge .L..130
+.L.begin.1:
+  .loc 1 150
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  add eax, -1
+.L..131:
+  .loc 1 150
+  add ebx, 1
+  movsxd rbx, ebx
+  mov rax, rbx
+  add eax, -1
+.L.cond.1:
+  .loc 1 150
+  mov rax, rbx
+  cmp eax, r13d
+  jl .L.begin.1
+.L..130:
+  .loc 1 150
+  mov rax, r12
+  mov rsi, rax
+  mov edi, 10
+  lea rdx, .L..132[rip]
+  call assert
+  .loc 1 151
+  mov eax, 1
+  mov dword ptr [rbp-32], eax
+  .loc 1 151
+  mov eax, 2
+  mov dword ptr [rbp-28], eax
+  .loc 1 151
+  mov eax, 3
+  mov dword ptr [rbp-24], eax
+  .loc 1 151
+  mov dword ptr [rbp-20], 1
+  .loc 1 151
+  movsxd rax, dword ptr [rbp-20]
+  movsxd rax, dword ptr [rbp+rax*4-32]
+  mov dword ptr [rbp-8], eax
+  .loc 1 151
+  movsxd rax, eax
+  imul eax, dword ptr [rbp-8]
+  mov dword ptr [rbp-16], eax
+  .loc 1 151
+  movsxd rax, dword ptr [rbp-20]
+  mov dword ptr [rbp+rax*4-32], 3
+  .loc 1 151
+  movsxd rax, dword ptr [rbp-20]
+  movsxd rax, dword ptr [rbp+rax*4-32]
+  mov dword ptr [rbp-4], eax
+  .loc 1 151
+  movsxd rax, eax
+  imul eax, dword ptr [rbp-4]
+  add eax, dword ptr [rbp-16]
+  sub eax, dword ptr [rbp-4]
+  add eax, 1
+  mov rsi, rax
+  mov edi, 11
+  lea rdx, .L..133[rip]
+  call assert
+  .loc 1 152
+  lea rdi, .L..134[rip]
+  xor eax, eax
+  call printf
+  .loc 1 153
+  xor eax, eax
+.L.return.main:
+  mov rbx, [rbp-1312]
+  mov r12, [rbp-1320]
+  mov r13, [rbp-1328]
+  mov r14, [rbp-1336]
+  mov r15, [rbp-1344]
+  mov rsp, rbp
+  pop rbp
+  ret
+  .globl iv_find
+  .text
+iv_find:
+  mov [rsp-16], rbx
+  mov [rsp-24], r12
+  mov [rsp-32], r13
+  mov [rsp-8], rdi
+  mov r13, rsi
+.L.body.iv_find:
+  .loc 1 67
+  xor eax, eax
+  mov r12, rax
+  .loc 1 67
+  mov rax, qword ptr [rsp-8]
+  mov rbx, rax
+  .loc 1 67
+  mov rax, r12
+  cmp rax, r13
+  jge .L..43
+.L.begin.2:
+  .loc 1 67
+  cmp dword ptr [rbx], 0
+  jne .L.else.3
+  .loc 1 67
+  mov eax, 1
+  jmp .L.return.iv_find
+.L.else.3:
+.L.end.3:
+.L..44:
+  .loc 1 67
+  add r12, 1
+  mov rax, r12
+  .loc 1 67
+  add rbx, 4
+  mov rax, rbx
+.L.cond.2:
+  .loc 1 67
+  mov rax, r12
+  cmp rax, r13
+  jl .L.begin.2
+.L..43:
+  .loc 1 67
+  xor eax, eax
+.L.return.iv_find:
+  mov rbx, [rsp-16]
+  mov r12, [rsp-24]
+  mov r13, [rsp-32]
+  ret
+  .globl iv_fault
+  .text
+iv_fault:
+  mov [rsp-16], rbx
+  mov [rsp-24], r12
+  mov [rsp-32], r13
+  mov [rsp-40], r14
+  mov [rsp-48], r15
+  mov r13, rdi
+  mov [rsp-4], esi
+.L.body.iv_fault:
+  .loc 1 66
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 66
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 66
+  movsxd rax, dword ptr [rsp-4]
+  mov r14, rax
+  .loc 1 66
+  mov eax, 3
+  mov r15, rax
+  .loc 1 66
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.0
+.L.begin.4:
+  .loc 1 66
+  mov rax, qword ptr [r13+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  shl eax, 1
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 66
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 66
+  mov rax, qword ptr [r13+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  shl eax, 1
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 66
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 66
+  mov rax, qword ptr [r13+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  shl eax, 1
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 66
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 66
+  mov rax, qword ptr [r13+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  shl eax, 1
+  add r12d, eax
+  movsxd r12, r12d
+.L.opt.1:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.4:
+  .loc 1 66
+  movsxd rax, dword ptr [rsp-4]
+  mov r14, rax
+  .loc 1 66
+  mov eax, 3
+  mov r15, rax
+  .loc 1 66
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.4
+.L.opt.0:
+  .loc 1 66
+  mov rax, rbx
+  cmp eax, dword ptr [rsp-4]
+  jge .L..41
+.L.begin.5:
+  .loc 1 66
+  mov rax, qword ptr [r13+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  shl eax, 1
+  add r12d, eax
+  movsxd r12, r12d
+.L..42:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.5:
+  .loc 1 66
+  mov rax, rbx
+  cmp eax, dword ptr [rsp-4]
+  jl .L.begin.5
+.L..41:
+  .loc 1 66
+  mov rax, r12
+.L.return.iv_fault:
+  mov rbx, [rsp-16]
+  mov r12, [rsp-24]
+  mov r13, [rsp-32]
+  mov r14, [rsp-40]
+  mov r15, [rsp-48]
+  ret
+  .globl iv_long
+  .text
+iv_long:
+  mov [rsp-48], rbx
+  mov [rsp-56], r12
+  mov [rsp-64], r13
+  mov [rsp-72], r14
+  mov [rsp-80], r15
+  mov [rsp-32], rdi
+  mov [rsp-40], rsi
+.L.body.iv_long:
+  .loc 1 65
+  xor eax, eax
+  movsxd r13, eax
+  .loc 1 65
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 65
+  mov rax, r12
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 65
+  mov rax, qword ptr [rsp-40]
+  mov rdi, r14
+  sub rax, rdi
+  mov qword ptr [rsp-24], rax
+  .loc 1 65
+  mov eax, 3
+  cmp rax, qword ptr [rsp-24]
+  jge .L.else.6
+  .loc 1 65
+  mov rax, r12
+  movsxd rax, eax
+  shl rax, 2
+  add rax, qword ptr [rsp-32]
+  mov qword ptr [rsp-16], rax
+  .loc 1 65
+  mov rax, qword ptr [rsp-24]
+  sar rax, 2
+  mov rcx, rax
+  .loc 1 65
+  mov rax, qword ptr [rsp-16]
+  mov rsi, rax
+  pxor xmm0, xmm0
+.L.vector.7:
+  movdqu xmm1, [rsi]
+  paddd xmm0, xmm1
+  add rsi, 16
+  sub rcx, 1
+  jnz .L.vector.7
+  pshufd xmm1, xmm0, 0x4e
+  paddd xmm0, xmm1
+  pshufd xmm1, xmm0, 0xb1
+  paddd xmm0, xmm1
+  movq rax, xmm0
+  movsxd rax, eax
+  mov dword ptr [rsp-4], eax
+  .loc 1 65
+  movsxd rax, eax
+  add r13d, eax
+  movsxd r13, r13d
+  .loc 1 65
+  mov rax, -4
+  and rax, qword ptr [rsp-24]
+  add r12d, eax
+  movsxd r12, r12d
+.L.else.6:
+.L.end.6:
+  .loc 1 65
+  mov rax, r12
+  movsxd rax, eax
+  shl rax, 2
+  add rax, qword ptr [rsp-32]
+  mov rbx, rax
+  .loc 1 65
+  mov rax, qword ptr [rsp-40]
+  mov r14, rax
+  .loc 1 65
+  mov eax, 3
+  mov r15, rax
+  .loc 1 65
+  mov rax, r12
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.2
+.L.begin.8:
+  .loc 1 65
+  movsxd rax, dword ptr [rbx]
+  add r13d, eax
+  movsxd r13, r13d
+  .loc 1 65
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 65
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 65
+  movsxd rax, dword ptr [rbx]
+  add r13d, eax
+  movsxd r13, r13d
+  .loc 1 65
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 65
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 65
+  movsxd rax, dword ptr [rbx]
+  add r13d, eax
+  movsxd r13, r13d
+  .loc 1 65
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 65
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 65
+  movsxd rax, dword ptr [rbx]
+  add r13d, eax
+  movsxd r13, r13d
+.L.opt.3:
+  .loc 1 65
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 65
+  add rbx, 4
+  mov rax, rbx
+.L.cond.8:
+  .loc 1 65
+  mov rax, qword ptr [rsp-40]
+  mov r14, rax
+  .loc 1 65
+  mov eax, 3
+  mov r15, rax
+  .loc 1 65
+  mov rax, r12
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.8
+.L.opt.2:
+  .loc 1 65
+  mov rax, r12
+  movsxd rax, eax
+  cmp rax, qword ptr [rsp-40]
+  jge .L..39
+.L.begin.9:
+  .loc 1 65
+  movsxd rax, dword ptr [rbx]
+  add r13d, eax
+  movsxd r13, r13d
+.L..40:
+  .loc 1 65
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 65
+  add rbx, 4
+  mov rax, rbx
+.L.cond.9:
+  .loc 1 65
+  mov rax, r12
+  movsxd rax, eax
+  cmp rax, qword ptr [rsp-40]
+  jl .L.begin.9
+.L..39:
+  .loc 1 65
+  mov rax, r13
+.L.return.iv_long:
+  mov rbx, [rsp-48]
+  mov r12, [rsp-56]
+  mov r13, [rsp-64]
+  mov r14, [rsp-72]
+  mov r15, [rsp-80]
+  ret
+  .globl iv_continue
+  .text
+iv_continue:
+  mov [rsp-32], rbx
+  mov [rsp-40], r12
+  mov [rsp-48], r13
+  mov [rsp-16], rdi
+  mov [rsp-20], esi
+.L.body.iv_continue:
+  .loc 1 64
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 64
+  mov rax, qword ptr [rsp-16]
+  mov rbx, rax
+  .loc 1 64
+  movsxd rax, dword ptr [rsp-20]
+  shl rax, 2
+  add rax, qword ptr [rsp-16]
+  mov r13, rax
+  .loc 1 64
+  mov rax, rbx
+  cmp rax, r13
+  jge .L..37
+.L.begin.10:
+  .loc 1 64
+  cmp dword ptr [rbx], 2
+  je .L..38
+  .loc 1 64
+.L.else.11:
+.L.end.11:
+  .loc 1 64
+  movsxd rax, dword ptr [rbx]
+  add r12d, eax
+  movsxd r12, r12d
+.L..38:
+  add rbx, 4
+.L.cond.10:
+  .loc 1 64
+  mov rax, rbx
+  cmp rax, r13
+  jl .L.begin.10
+.L..37:
+  .loc 1 64
+  mov rax, r12
+.L.return.iv_continue:
+  mov rbx, [rsp-32]
+  mov r12, [rsp-40]
+  mov r13, [rsp-48]
+  ret
+  .globl iv_2d
+  .text
+iv_2d:
+  mov [rsp-40], rbx
+  mov [rsp-48], r12
+  mov [rsp-56], r13
+  mov [rsp-32], rdi
+.L.body.iv_2d:
+  .loc 1 63
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 63
+  mov dword ptr [rsp-20], 0
+  .loc 1 63
+  mov rax, qword ptr [rsp-32]
+  mov qword ptr [rsp-8], rax
+  cmp dword ptr [rsp-20], 3
+  jge .L..33
+.L.begin.12:
+  .loc 1 63
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 63
+  mov rax, qword ptr [rsp-8]
+  mov qword ptr [rsp-16], rax
+  .loc 1 63
+  movsxd rax, dword ptr [rsp-20]
+  add eax, 1
+  movsxd r13, eax
+  .loc 1 63
+  mov rax, qword ptr [rsp-16]
+  movsxd rax, dword ptr [rax+rbx*4]
+  imul eax, r13d
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 63
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 63
+  mov rax, qword ptr [rsp-16]
+  movsxd rax, dword ptr [rax+rbx*4]
+  imul eax, r13d
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 63
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 63
+  mov rax, qword ptr [rsp-16]
+  movsxd rax, dword ptr [rax+rbx*4]
+  imul eax, r13d
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 63
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 63
+  mov rax, qword ptr [rsp-16]
+  movsxd rax, dword ptr [rax+rbx*4]
+  imul eax, r13d
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 63
+  add ebx, 1
+  movsxd rbx, ebx
+.L..34:
+  .loc 1 63
+  inc dword ptr [rsp-20]
+  movsxd rax, dword ptr [rsp-20]
+  .loc 1 63
+  add qword ptr [rsp-8], 16
+  mov rax, qword ptr [rsp-8]
+.L.cond.12:
+  cmp dword ptr [rsp-20], 3
+  jl .L.begin.12
+.L..33:
+  .loc 1 63
+  mov rax, r12
+.L.return.iv_2d:
+  mov rbx, [rsp-40]
+  mov r12, [rsp-48]
+  mov r13, [rsp-56]
+  ret
+  .globl iv_from
+  .text
+iv_from:
+  mov [rsp-48], rbx
+  mov [rsp-56], r12
+  mov [rsp-64], r13
+  mov [rsp-72], r14
+  mov [rsp-80], r15
+  mov [rsp-32], rdi
+  mov [rsp-36], esi
+  mov [rsp-40], edx
+.L.body.iv_from:
+  .loc 1 62
+  xor eax, eax
+  movsxd r13, eax
+  .loc 1 62
+  movsxd rax, dword ptr [rsp-36]
+  movsxd r12, eax
+  .loc 1 62
+  mov rax, r12
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 62
+  movsxd rax, dword ptr [rsp-40]
+  mov rdi, r14
+  sub rax, rdi
+  mov qword ptr [rsp-24], rax
+  .loc 1 62
+  mov eax, 3
+  cmp rax, qword ptr [rsp-24]
+  jge .L.else.13
+  .loc 1 62
+  mov rax, r12
+  movsxd rax, eax
+  shl rax, 2
+  add rax, qword ptr [rsp-32]
+  mov qword ptr [rsp-16], rax
+  .loc 1 62
+  mov rax, qword ptr [rsp-24]
+  sar rax, 2
+  mov rcx, rax
+  .loc 1 62
+  mov rax, qword ptr [rsp-16]
+  mov rsi, rax
+  pxor xmm0, xmm0
+.L.vector.14:
+  movdqu xmm1, [rsi]
+  paddd xmm0, xmm1
+  add rsi, 16
+  sub rcx, 1
+  jnz .L.vector.14
+  pshufd xmm1, xmm0, 0x4e
+  paddd xmm0, xmm1
+  pshufd xmm1, xmm0, 0xb1
+  paddd xmm0, xmm1
+  movq rax, xmm0
+  movsxd rax, eax
+  mov dword ptr [rsp-4], eax
+  .loc 1 62
+  movsxd rax, eax
+  add r13d, eax
+  movsxd r13, r13d
+  .loc 1 62
+  mov rax, -4
+  and rax, qword ptr [rsp-24]
+  add r12d, eax
+  movsxd r12, r12d
+.L.else.13:
+.L.end.13:
+  .loc 1 62
+  mov rax, r12
+  movsxd rax, eax
+  shl rax, 2
+  add rax, qword ptr [rsp-32]
+  mov rbx, rax
+  .loc 1 62
+  movsxd rax, dword ptr [rsp-40]
+  mov r14, rax
+  .loc 1 62
+  mov eax, 3
+  mov r15, rax
+  .loc 1 62
+  mov rax, r12
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.4
+.L.begin.15:
+  .loc 1 62
+  movsxd rax, dword ptr [rbx]
+  add r13d, eax
+  movsxd r13, r13d
+  .loc 1 62
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 62
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 62
+  movsxd rax, dword ptr [rbx]
+  add r13d, eax
+  movsxd r13, r13d
+  .loc 1 62
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 62
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 62
+  movsxd rax, dword ptr [rbx]
+  add r13d, eax
+  movsxd r13, r13d
+  .loc 1 62
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 62
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 62
+  movsxd rax, dword ptr [rbx]
+  add r13d, eax
+  movsxd r13, r13d
+.L.opt.5:
+  .loc 1 62
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 62
+  add rbx, 4
+  mov rax, rbx
+.L.cond.15:
+  .loc 1 62
+  movsxd rax, dword ptr [rsp-40]
+  mov r14, rax
+  .loc 1 62
+  mov eax, 3
+  mov r15, rax
+  .loc 1 62
+  mov rax, r12
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.15
+.L.opt.4:
+  .loc 1 62
+  mov rax, r12
+  cmp eax, dword ptr [rsp-40]
+  jge .L..31
+.L.begin.16:
+  .loc 1 62
+  movsxd rax, dword ptr [rbx]
+  add r13d, eax
+  movsxd r13, r13d
+.L..32:
+  .loc 1 62
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 62
+  add rbx, 4
+  mov rax, rbx
+.L.cond.16:
+  .loc 1 62
+  mov rax, r12
+  cmp eax, dword ptr [rsp-40]
+  jl .L.begin.16
+.L..31:
+  .loc 1 62
+  mov rax, r13
+.L.return.iv_from:
+  mov rbx, [rsp-48]
+  mov r12, [rsp-56]
+  mov r13, [rsp-64]
+  mov r14, [rsp-72]
+  mov r15, [rsp-80]
+  ret
+  .globl iv_down
+  .text
+iv_down:
+  mov [rsp-24], rbx
+  mov [rsp-32], r12
+  mov [rsp-40], r13
+  mov [rsp-48], r14
+  mov [rsp-8], rdi
+  mov [rsp-12], esi
+.L.body.iv_down:
+  .loc 1 61
+  xor eax, eax
+  movsxd r13, eax
+  .loc 1 61
+  movsxd rax, dword ptr [rsp-12]
+  sub eax, 1
+  movsxd rbx, eax
+  .loc 1 61
+  mov rax, rbx
+  movsxd rax, eax
+  shl rax, 1
+  add rax, qword ptr [rsp-8]
+  mov r12, rax
+  cmp ebx, 0
+  jl .L..29
+.L.begin.17:
+  .loc 1 61
+  movsx eax, word ptr [r12]
+  mov r14, rax
+  .loc 1 61
+  mov rax, r13
+  shl eax, 1
+  mov rdi, r14
+  add eax, edi
+  movsxd r13, eax
+.L..30:
+  .loc 1 61
+  add ebx, -1
+  movsxd rbx, ebx
+  mov rax, rbx
+  .loc 1 61
+  add r12, -2
+  mov rax, r12
+.L.cond.17:
+  cmp ebx, 0
+  jge .L.begin.17
+.L..29:
+  .loc 1 61
+  mov rax, r13
+.L.return.iv_down:
+  mov rbx, [rsp-24]
+  mov r12, [rsp-32]
+  mov r13, [rsp-40]
+  mov r14, [rsp-48]
+  ret
+  .globl iv_step
+  .text
+iv_step:
+  mov [rsp-24], rbx
+  mov [rsp-32], r12
+  mov [rsp-40], r13
+  mov [rsp-48], r14
+  mov [rsp-56], r15
+  mov [rsp-8], rdi
+  mov [rsp-12], esi
+.L.body.iv_step:
+  .loc 1 60
+  xor eax, eax
+  mov r13, rax
+  .loc 1 60
+  mov eax, 1
+  movsxd rbx, eax
+  .loc 1 60
+  mov rax, qword ptr [rsp-8]
+  add rax, 8
+  mov r12, rax
+  .loc 1 60
+  movsxd rax, dword ptr [rsp-12]
+  mov r14, rax
+  .loc 1 60
+  mov eax, 6
+  mov r15, rax
+  .loc 1 60
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jg .L.opt.6
+.L.begin.18:
+  .loc 1 60
+  mov rax, rbx
+  sub eax, 1
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 60
+  mov rax, qword ptr [rsp-8]
+  mov rdi, r14
+  mov rax, qword ptr [rax+rdi*8]
+  mov r14, rax
+  .loc 1 60
+  mov rax, r13
+  add rax, qword ptr [r12]
+  mov rdi, r14
+  sub rax, rdi
+  mov r13, rax
+  .loc 1 60
+  add ebx, 2
+  movsxd rbx, ebx
+  mov rax, rbx
+  .loc 1 60
+  add r12, 16
+  mov rax, r12
+  .loc 1 60
+  mov rax, rbx
+  sub eax, 1
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 60
+  mov rax, qword ptr [rsp-8]
+  mov rdi, r14
+  mov rax, qword ptr [rax+rdi*8]
+  mov r14, rax
+  .loc 1 60
+  mov rax, r13
+  add rax, qword ptr [r12]
+  mov rdi, r14
+  sub rax, rdi
+  mov r13, rax
+  .loc 1 60
+  add ebx, 2
+  movsxd rbx, ebx
+  mov rax, rbx
+  .loc 1 60
+  add r12, 16
+  mov rax, r12
+  .loc 1 60
+  mov rax, rbx
+  sub eax, 1
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 60
+  mov rax, qword ptr [rsp-8]
+  mov rdi, r14
+  mov rax, qword ptr [rax+rdi*8]
+  mov r14, rax
+  .loc 1 60
+  mov rax, r13
+  add rax, qword ptr [r12]
+  mov rdi, r14
+  sub rax, rdi
+  mov r13, rax
+  .loc 1 60
+  add ebx, 2
+  movsxd rbx, ebx
+  mov rax, rbx
+  .loc 1 60
+  add r12, 16
+  mov rax, r12
+  .loc 1 60
+  mov rax, rbx
+  sub eax, 1
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 60
+  mov rax, qword ptr [rsp-8]
+  mov rdi, r14
+  mov rax, qword ptr [rax+rdi*8]
+  mov r14, rax
+  .loc 1 60
+  mov rax, r13
+  add rax, qword ptr [r12]
+  mov rdi, r14
+  sub rax, rdi
+  mov r13, rax
+.L.opt.7:
+  .loc 1 60
+  add ebx, 2
+  movsxd rbx, ebx
+  mov rax, rbx
+  .loc 1 60
+  add r12, 16
+  mov rax, r12
+.L.cond.18:
+  .loc 1 60
+  movsxd rax, dword ptr [rsp-12]
+  mov r14, rax
+  .loc 1 60
+  mov eax, 6
+  mov r15, rax
+  .loc 1 60
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jle .L.begin.18
+.L.opt.6:
+  .loc 1 60
+  mov rax, rbx
+  cmp eax, dword ptr [rsp-12]
+  jg .L..27
+.L.begin.19:
+  .loc 1 60
+  mov rax, rbx
+  sub eax, 1
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 60
+  mov rax, qword ptr [rsp-8]
+  mov rdi, r14
+  mov rax, qword ptr [rax+rdi*8]
+  mov r14, rax
+  .loc 1 60
+  mov rax, r13
+  add rax, qword ptr [r12]
+  mov rdi, r14
+  sub rax, rdi
+  mov r13, rax
+.L..28:
+  .loc 1 60
+  add ebx, 2
+  movsxd rbx, ebx
+  mov rax, rbx
+  .loc 1 60
+  add r12, 16
+  mov rax, r12
+.L.cond.19:
+  .loc 1 60
+  mov rax, rbx
+  cmp eax, dword ptr [rsp-12]
+  jle .L.begin.19
+.L..27:
+  .loc 1 60
+  mov rax, r13
+.L.return.iv_step:
+  mov rbx, [rsp-24]
+  mov r12, [rsp-32]
+  mov r13, [rsp-40]
+  mov r14, [rsp-48]
+  mov r15, [rsp-56]
+  ret
+  .globl iv_copy
+  .text
+iv_copy:
+  mov [rsp-64], rbx
+  mov [rsp-72], r12
+  mov [rsp-80], r13
+  mov [rsp-88], r14
+  mov [rsp-96], r15
+  mov [rsp-40], rdi
+  mov [rsp-48], rsi
+  mov [rsp-52], edx
+.L.body.iv_copy:
+  .loc 1 59
+  xor eax, eax
+  movsxd r13, eax
+  .loc 1 59
+  mov rax, r13
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 59
+  movsxd rax, dword ptr [rsp-52]
+  mov rdi, r14
+  sub rax, rdi
+  mov qword ptr [rsp-32], rax
+  .loc 1 59
+  mov eax, 15
+  cmp rax, qword ptr [rsp-32]
+  jge .L.else.20
+  .loc 1 59
+  mov rax, qword ptr [rsp-40]
+  add rax, r13
+  mov qword ptr [rsp-24], rax
+  .loc 1 59
+  mov rax, qword ptr [rsp-32]
+  shl rax, 0
+  mov qword ptr [rsp-16], rax
+  .loc 1 59
+  mov rax, qword ptr [rsp-48]
+  add rax, r13
+  mov qword ptr [rsp-8], rax
+  .loc 1 59
+  mov rax, qword ptr [rsp-24]
+  cmp rax, qword ptr [rsp-8]
+  je .L.skip.22
+  .loc 1 59
+  mov rax, qword ptr [rsp-24]
+  add rax, qword ptr [rsp-16]
+  cmp rax, qword ptr [rsp-8]
+  jle .L.skip.23
+  .loc 1 59
+  mov rax, qword ptr [rsp-8]
+  add rax, qword ptr [rsp-16]
+  cmp rax, qword ptr [rsp-24]
+  jg .L.end.20
+.L.skip.23:
+.L.skip.22:
+  .loc 1 59
+  mov rax, qword ptr [rsp-32]
+  sar rax, 4
+  mov rcx, rax
+  .loc 1 59
+  mov rax, qword ptr [rsp-8]
+  mov rsi, rax
+  .loc 1 59
+  mov eax, 1
+  movq xmm2, rax
+  punpcklbw xmm2, xmm2
+  punpcklwd xmm2, xmm2
+  pshufd xmm2, xmm2, 0
+  .loc 1 59
+  mov rax, qword ptr [rsp-24]
+  mov rdi, rax
+.L.vector.24:
+  movdqu xmm0, [rsi]
+  paddb xmm0, xmm2
+  movdqu [rdi], xmm0
+  add rsi, 16
+  add rdi, 16
+  sub rcx, 1
+  jnz .L.vector.24
+  .loc 1 59
+  mov rax, -16
+  and rax, qword ptr [rsp-32]
+  add r13d, eax
+  movsxd r13, r13d
+.L.else.21:
+.L.end.21:
+.L.else.20:
+.L.end.20:
+  .loc 1 59
+  mov rax, r13
+  movsxd rax, eax
+  shl rax, 0
+  add rax, qword ptr [rsp-40]
+  mov r12, rax
+  .loc 1 59
+  mov rax, r13
+  movsxd rax, eax
+  shl rax, 0
+  add rax, qword ptr [rsp-48]
+  mov rbx, rax
+  .loc 1 59
+  movsxd rax, dword ptr [rsp-52]
+  mov r14, rax
+  .loc 1 59
+  mov eax, 3
+  mov r15, rax
+  .loc 1 59
+  mov rax, r13
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.8
+.L.begin.25:
+  .loc 1 59
+  movsx eax, byte ptr [rbx]
+  add eax, 1
+  movsx eax, al
+  mov byte ptr [r12], al
+  .loc 1 59
+  add r13d, 1
+  movsxd r13, r13d
+  mov rax, r13
+  .loc 1 59
+  add r12, 1
+  mov rax, r12
+  .loc 1 59
+  add rbx, 1
+  mov rax, rbx
+  .loc 1 59
+  movsx eax, byte ptr [rbx]
+  add eax, 1
+  movsx eax, al
+  mov byte ptr [r12], al
+  .loc 1 59
+  add r13d, 1
+  movsxd r13, r13d
+  mov rax, r13
+  .loc 1 59
+  add r12, 1
+  mov rax, r12
+  .loc 1 59
+  add rbx, 1
+  mov rax, rbx
+  .loc 1 59
+  movsx eax, byte ptr [rbx]
+  add eax, 1
+  movsx eax, al
+  mov byte ptr [r12], al
+  .loc 1 59
+  add r13d, 1
+  movsxd r13, r13d
+  mov rax, r13
+  .loc 1 59
+  add r12, 1
+  mov rax, r12
+  .loc 1 59
+  add rbx, 1
+  mov rax, rbx
+  .loc 1 59
+  movsx eax, byte ptr [rbx]
+  add eax, 1
+  movsx eax, al
+  mov byte ptr [r12], al
+.L.opt.9:
+  .loc 1 59
+  add r13d, 1
+  movsxd r13, r13d
+  mov rax, r13
+  .loc 1 59
+  add r12, 1
+  mov rax, r12
+  .loc 1 59
+  add rbx, 1
+  mov rax, rbx
+.L.cond.25:
+  .loc 1 59
+  movsxd rax, dword ptr [rsp-52]
+  mov r14, rax
+  .loc 1 59
+  mov eax, 3
+  mov r15, rax
+  .loc 1 59
+  mov rax, r13
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.25
+.L.opt.8:
+  .loc 1 59
+  mov rax, r13
+  cmp eax, dword ptr [rsp-52]
+  jge .L..25
+.L.begin.26:
+  .loc 1 59
+  movsx eax, byte ptr [rbx]
+  add eax, 1
+  movsx eax, al
+  mov byte ptr [r12], al
+.L..26:
+  .loc 1 59
+  add r13d, 1
+  movsxd r13, r13d
+  mov rax, r13
+  .loc 1 59
+  add r12, 1
+  mov rax, r12
+  .loc 1 59
+  add rbx, 1
+  mov rax, rbx
+.L.cond.26:
+  .loc 1 59
+  mov rax, r13
+  cmp eax, dword ptr [rsp-52]
+  jl .L.begin.26
+.L..25:
+  .loc 1 59
+  movsxd rax, dword ptr [rsp-52]
+  sub eax, 1
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 59
+  mov rax, qword ptr [rsp-40]
+  mov rdi, r14
+  movsx eax, byte ptr [rax+rdi*1]
+.L.return.iv_copy:
+  mov rbx, [rsp-64]
+  mov r12, [rsp-72]
+  mov r13, [rsp-80]
+  mov r14, [rsp-88]
+  mov r15, [rsp-96]
+  ret
+  .globl iv_index
+  .text
+iv_index:
+  mov [rsp-24], rbx
+  mov [rsp-32], r12
+  mov [rsp-40], r13
+  mov [rsp-48], r14
+  mov [rsp-56], r15
+  mov [rsp-8], rdi
+  mov [rsp-12], esi
+.L.body.iv_index:
+  .loc 1 58
+  xor eax, eax
+  movsxd r13, eax
+  .loc 1 58
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 58
+  mov rax, qword ptr [rsp-8]
+  mov r12, rax
+  .loc 1 58
+  movsxd rax, dword ptr [rsp-12]
+  mov r14, rax
+  .loc 1 58
+  mov eax, 3
+  mov r15, rax
+  .loc 1 58
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.10
+.L.begin.27:
+  .loc 1 58
+  movsxd rax, dword ptr [r12]
+  imul eax, ebx
+  add r13d, eax
+  movsxd r13, r13d
+  .loc 1 58
+  add ebx, 1
+  movsxd rbx, ebx
+  mov rax, rbx
+  .loc 1 58
+  add r12, 4
+  mov rax, r12
+  .loc 1 58
+  movsxd rax, dword ptr [r12]
+  imul eax, ebx
+  add r13d, eax
+  movsxd r13, r13d
+  .loc 1 58
+  add ebx, 1
+  movsxd rbx, ebx
+  mov rax, rbx
+  .loc 1 58
+  add r12, 4
+  mov rax, r12
+  .loc 1 58
+  movsxd rax, dword ptr [r12]
+  imul eax, ebx
+  add r13d, eax
+  movsxd r13, r13d
+  .loc 1 58
+  add ebx, 1
+  movsxd rbx, ebx
+  mov rax, rbx
+  .loc 1 58
+  add r12, 4
+  mov rax, r12
+  .loc 1 58
+  movsxd rax, dword ptr [r12]
+  imul eax, ebx
+  add r13d, eax
+  movsxd r13, r13d
+.L.opt.11:
+  .loc 1 58
+  add ebx, 1
+  movsxd rbx, ebx
+  mov rax, rbx
+  .loc 1 58
+  add r12, 4
+  mov rax, r12
+.L.cond.27:
+  .loc 1 58
+  movsxd rax, dword ptr [rsp-12]
+  mov r14, rax
+  .loc 1 58
+  mov eax, 3
+  mov r15, rax
+  .loc 1 58
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.27
+.L.opt.10:
+  .loc 1 58
+  mov rax, rbx
+  cmp eax, dword ptr [rsp-12]
+  jge .L..23
+.L.begin.28:
+  .loc 1 58
+  movsxd rax, dword ptr [r12]
+  imul eax, ebx
+  add r13d, eax
+  movsxd r13, r13d
+.L..24:
+  .loc 1 58
+  add ebx, 1
+  movsxd rbx, ebx
+  mov rax, rbx
+  .loc 1 58
+  add r12, 4
+  mov rax, r12
+.L.cond.28:
+  .loc 1 58
+  mov rax, rbx
+  cmp eax, dword ptr [rsp-12]
+  jl .L.begin.28
+.L..23:
+  .loc 1 58
+  mov rax, r13
+.L.return.iv_index:
+  mov rbx, [rsp-24]
+  mov r12, [rsp-32]
+  mov r13, [rsp-40]
+  mov r14, [rsp-48]
+  mov r15, [rsp-56]
+  ret
+  .globl iv_last
+  .text
+iv_last:
+  mov [rsp-16], rbx
+  mov [rsp-24], r12
+  mov [rsp-32], r13
+  mov [rsp-40], r14
+  mov [rsp-48], r15
+  mov [rsp-8], rdi
+  movsxd r13, esi
+.L.body.iv_last:
+  .loc 1 57
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 57
+  mov rax, qword ptr [rsp-8]
+  mov rbx, rax
+  .loc 1 57
+  mov rax, r13
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 57
+  mov eax, 3
+  mov r15, rax
+  .loc 1 57
+  mov rax, r12
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.12
+.L.begin.29:
+  .loc 1 57
+  cmp dword ptr [rbx], 0
+  jl .L..21
+  .loc 1 57
+.L.else.30:
+.L.end.30:
+  .loc 1 57
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 57
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 57
+  cmp dword ptr [rbx], 0
+  jl .L..21
+  .loc 1 57
+.L.else.31:
+.L.end.31:
+  .loc 1 57
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 57
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 57
+  cmp dword ptr [rbx], 0
+  jl .L..21
+  .loc 1 57
+.L.else.32:
+.L.end.32:
+  .loc 1 57
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 57
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 57
+  cmp dword ptr [rbx], 0
+  jl .L..21
+  .loc 1 57
+.L.else.33:
+.L.end.33:
+.L.opt.13:
+  .loc 1 57
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 57
+  add rbx, 4
+  mov rax, rbx
+.L.cond.29:
+  .loc 1 57
+  mov rax, r13
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 57
+  mov eax, 3
+  mov r15, rax
+  .loc 1 57
+  mov rax, r12
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.29
+.L.opt.12:
+  .loc 1 57
+  mov rax, r12
+  cmp eax, r13d
+  jge .L..21
+.L.begin.34:
+  .loc 1 57
+  cmp dword ptr [rbx], 0
+  jl .L..21
+  .loc 1 57
+.L.else.35:
+.L.end.35:
+.L..22:
+  .loc 1 57
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 57
+  add rbx, 4
+  mov rax, rbx
+.L.cond.34:
+  .loc 1 57
+  mov rax, r12
+  cmp eax, r13d
+  jl .L.begin.34
+.L..21:
+  .loc 1 57
+  mov rax, r12
+.L.return.iv_last:
+  mov rbx, [rsp-16]
+  mov r12, [rsp-24]
+  mov r13, [rsp-32]
+  mov r14, [rsp-40]
+  mov r15, [rsp-48]
+  ret
+  .globl iv_sum
+  .text
+iv_sum:
+  mov [rsp-48], rbx
+  mov [rsp-56], r12
+  mov [rsp-64], r13
+  mov [rsp-72], r14
+  mov [rsp-80], r15
+  mov [rsp-32], rdi
+  mov [rsp-36], esi
+.L.body.iv_sum:
+  .loc 1 56
+  xor eax, eax
+  movsxd r13, eax
+  .loc 1 56
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 56
+  mov rax, r12
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 56
+  movsxd rax, dword ptr [rsp-36]
+  mov rdi, r14
+  sub rax, rdi
+  mov qword ptr [rsp-24], rax
+  .loc 1 56
+  mov eax, 3
+  cmp rax, qword ptr [rsp-24]
+  jge .L.else.36
+  .loc 1 56
+  mov rax, r12
+  movsxd rax, eax
+  shl rax, 2
+  add rax, qword ptr [rsp-32]
+  mov qword ptr [rsp-16], rax
+  .loc 1 56
+  mov rax, qword ptr [rsp-24]
+  sar rax, 2
+  mov rcx, rax
+  .loc 1 56
+  mov rax, qword ptr [rsp-16]
+  mov rsi, rax
+  pxor xmm0, xmm0
+.L.vector.37:
+  movdqu xmm1, [rsi]
+  paddd xmm0, xmm1
+  add rsi, 16
+  sub rcx, 1
+  jnz .L.vector.37
+  pshufd xmm1, xmm0, 0x4e
+  paddd xmm0, xmm1
+  pshufd xmm1, xmm0, 0xb1
+  paddd xmm0, xmm1
+  movq rax, xmm0
+  movsxd rax, eax
+  mov dword ptr [rsp-4], eax
+  .loc 1 56
+  movsxd rax, eax
+  add r13d, eax
+  movsxd r13, r13d
+  .loc 1 56
+  mov rax, -4
+  and rax, qword ptr [rsp-24]
+  add r12d, eax
+  movsxd r12, r12d
+.L.else.36:
+.L.end.36:
+  .loc 1 56
+  mov rax, r12
+  movsxd rax, eax
+  shl rax, 2
+  add rax, qword ptr [rsp-32]
+  mov rbx, rax
+  .loc 1 56
+  movsxd rax, dword ptr [rsp-36]
+  mov r14, rax
+  .loc 1 56
+  mov eax, 3
+  mov r15, rax
+  .loc 1 56
+  mov rax, r12
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.14
+.L.begin.38:
+  .loc 1 56
+  movsxd rax, dword ptr [rbx]
+  add r13d, eax
+  movsxd r13, r13d
+  .loc 1 56
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 56
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 56
+  movsxd rax, dword ptr [rbx]
+  add r13d, eax
+  movsxd r13, r13d
+  .loc 1 56
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 56
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 56
+  movsxd rax, dword ptr [rbx]
+  add r13d, eax
+  movsxd r13, r13d
+  .loc 1 56
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 56
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 56
+  movsxd rax, dword ptr [rbx]
+  add r13d, eax
+  movsxd r13, r13d
+.L.opt.15:
+  .loc 1 56
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 56
+  add rbx, 4
+  mov rax, rbx
+.L.cond.38:
+  .loc 1 56
+  movsxd rax, dword ptr [rsp-36]
+  mov r14, rax
+  .loc 1 56
+  mov eax, 3
+  mov r15, rax
+  .loc 1 56
+  mov rax, r12
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.38
+.L.opt.14:
+  .loc 1 56
+  mov rax, r12
+  cmp eax, dword ptr [rsp-36]
+  jge .L..19
+.L.begin.39:
+  .loc 1 56
+  movsxd rax, dword ptr [rbx]
+  add r13d, eax
+  movsxd r13, r13d
+.L..20:
+  .loc 1 56
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 56
+  add rbx, 4
+  mov rax, rbx
+.L.cond.39:
+  .loc 1 56
+  mov rax, r12
+  cmp eax, dword ptr [rsp-36]
+  jl .L.begin.39
+.L..19:
+  .loc 1 56
+  mov rax, r13
+.L.return.iv_sum:
+  mov rbx, [rsp-48]
+  mov r12, [rsp-56]
+  mov r13, [rsp-64]
+  mov r14, [rsp-72]
+  mov r15, [rsp-80]
+  ret
+  .globl licm_nested
+  .text
+licm_nested:
+  mov [rsp-24], rbx
+  mov [rsp-32], r12
+  mov [rsp-40], r13
+  mov [rsp-48], r14
+  mov [rsp-56], r15
+  mov [rsp-12], edi
+  mov [rsp-16], esi
+.L.body.licm_nested:
+  .loc 1 55
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 55
+  mov dword ptr [rsp-8], 0
+  .loc 1 55
+  movsxd rax, dword ptr [rsp-12]
+  imul eax, dword ptr [rsp-16]
+  add eax, 1
+  movsxd r13, eax
+  .loc 1 55
+  movsxd rax, dword ptr [rsp-16]
+  imul eax, dword ptr [rsp-12]
+  mov dword ptr [rsp-4], eax
+  .loc 1 55
+  movsxd rax, dword ptr [rsp-8]
+  cmp eax, dword ptr [rsp-12]
+  jge .L..15
+.L.begin.40:
+  .loc 1 55
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 55
+  movsxd rax, dword ptr [rsp-4]
+  mov r14, rax
+  .loc 1 55
+  mov eax, 3
+  mov r15, rax
+  .loc 1 55
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.16
+.L.begin.41:
+  .loc 1 55
+  mov rax, r13
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 55
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 55
+  mov rax, r13
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 55
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 55
+  mov rax, r13
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 55
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 55
+  mov rax, r13
+  add r12d, eax
+  movsxd r12, r12d
+.L.opt.17:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.41:
+  .loc 1 55
+  movsxd rax, dword ptr [rsp-4]
+  mov r14, rax
+  .loc 1 55
+  mov eax, 3
+  mov r15, rax
+  .loc 1 55
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.41
+.L.opt.16:
+  .loc 1 55
+  mov rax, rbx
+  cmp eax, dword ptr [rsp-4]
+  jge .L..17
+.L.begin.42:
+  .loc 1 55
+  mov rax, r13
+  add r12d, eax
+  movsxd r12, r12d
+.L..18:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.42:
+  .loc 1 55
+  mov rax, rbx
+  cmp eax, dword ptr [rsp-4]
+  jl .L.begin.42
+.L..17:
+.L..16:
+  inc dword ptr [rsp-8]
+.L.cond.40:
+  .loc 1 55
+  movsxd rax, dword ptr [rsp-8]
+  cmp eax, dword ptr [rsp-12]
+  jl .L.begin.40
+.L..15:
+  .loc 1 55
+  mov rax, r12
+.L.return.licm_nested:
+  mov rbx, [rsp-24]
+  mov r12, [rsp-32]
+  mov r13, [rsp-40]
+  mov r14, [rsp-48]
+  mov r15, [rsp-56]
+  ret
+  .globl licm_goto
+  .text
+licm_goto:
+  mov [rsp-16], rbx
+  mov [rsp-24], r12
+  mov [rsp-32], r13
+  movsxd r13, edi
+  mov [rsp-4], esi
+.L.body.licm_goto:
+  .loc 1 54
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 54
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 54
+  cmp r13d, 5
+  jg .L..14
+  .loc 1 54
+.L.else.43:
+.L.end.43:
+  .loc 1 54
+  mov rax, r13
+  imul eax, dword ptr [rsp-4]
+  cmp eax, ebx
+  jle .L..12
+.L.begin.44:
+  .loc 1 54
+.L..14:
+  .loc 1 54
+  add r12d, 1
+  movsxd r12, r12d
+  .loc 1 54
+  add ebx, 1
+  movsxd rbx, ebx
+.L..13:
+.L.cond.44:
+  .loc 1 54
+  mov rax, r13
+  imul eax, dword ptr [rsp-4]
+  cmp eax, ebx
+  jg .L.begin.44
+.L..12:
+  .loc 1 54
+  mov rax, r12
+.L.return.licm_goto:
+  mov rbx, [rsp-16]
+  mov r12, [rsp-24]
+  mov r13, [rsp-32]
+  ret
+  .globl licm_div
+  .text
+licm_div:
+  mov [rsp-16], rbx
+  mov [rsp-24], r12
+  mov [rsp-32], r13
+  mov [rsp-40], r14
+  mov [rsp-48], r15
+  movsxd r13, edi
+  mov [rsp-4], esi
+  mov [rsp-8], edx
+.L.body.licm_div:
+  .loc 1 53
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 53
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 53
+  movsxd rax, dword ptr [rsp-8]
+  mov r14, rax
+  .loc 1 53
+  mov eax, 3
+  mov r15, rax
+  .loc 1 53
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.18
+.L.begin.45:
+  .loc 1 53
+  mov rax, r13
+  cdq
+  idiv dword ptr [rsp-4]
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 53
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 53
+  mov rax, r13
+  cdq
+  idiv dword ptr [rsp-4]
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 53
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 53
+  mov rax, r13
+  cdq
+  idiv dword ptr [rsp-4]
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 53
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 53
+  mov rax, r13
+  cdq
+  idiv dword ptr [rsp-4]
+  add r12d, eax
+  movsxd r12, r12d
+.L.opt.19:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.45:
+  .loc 1 53
+  movsxd rax, dword ptr [rsp-8]
+  mov r14, rax
+  .loc 1 53
+  mov eax, 3
+  mov r15, rax
+  .loc 1 53
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.45
+.L.opt.18:
+  .loc 1 53
+  mov rax, rbx
+  cmp eax, dword ptr [rsp-8]
+  jge .L..10
+.L.begin.46:
+  .loc 1 53
+  mov rax, r13
+  cdq
+  idiv dword ptr [rsp-4]
+  add r12d, eax
+  movsxd r12, r12d
+.L..11:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.46:
+  .loc 1 53
+  mov rax, rbx
+  cmp eax, dword ptr [rsp-8]
+  jl .L.begin.46
+.L..10:
+  .loc 1 53
+  mov rax, r12
+.L.return.licm_div:
+  mov rbx, [rsp-16]
+  mov r12, [rsp-24]
+  mov r13, [rsp-32]
+  mov r14, [rsp-40]
+  mov r15, [rsp-48]
+  ret
+  .globl licm_fault
+  .text
+licm_fault:
+  mov [rsp-16], rbx
+  mov [rsp-24], r12
+  mov [rsp-32], r13
+  mov [rsp-40], r14
+  mov [rsp-48], r15
+  mov r13, rdi
+  mov [rsp-4], esi
+.L.body.licm_fault:
+  .loc 1 52
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 52
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 52
+  movsxd rax, dword ptr [rsp-4]
+  mov r14, rax
+  .loc 1 52
+  mov eax, 3
+  mov r15, rax
+  .loc 1 52
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.20
+.L.begin.47:
+  .loc 1 52
+  movsxd rax, dword ptr [r13]
+  shl eax, 1
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 52
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 52
+  movsxd rax, dword ptr [r13]
+  shl eax, 1
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 52
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 52
+  movsxd rax, dword ptr [r13]
+  shl eax, 1
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 52
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 52
+  movsxd rax, dword ptr [r13]
+  shl eax, 1
+  add r12d, eax
+  movsxd r12, r12d
+.L.opt.21:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.47:
+  .loc 1 52
+  movsxd rax, dword ptr [rsp-4]
+  mov r14, rax
+  .loc 1 52
+  mov eax, 3
+  mov r15, rax
+  .loc 1 52
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.47
+.L.opt.20:
+  .loc 1 52
+  mov rax, rbx
+  cmp eax, dword ptr [rsp-4]
+  jge .L..8
+.L.begin.48:
+  .loc 1 52
+  movsxd rax, dword ptr [r13]
+  shl eax, 1
+  add r12d, eax
+  movsxd r12, r12d
+.L..9:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.48:
+  .loc 1 52
+  mov rax, rbx
+  cmp eax, dword ptr [rsp-4]
+  jl .L.begin.48
+.L..8:
+  .loc 1 52
+  mov rax, r12
+.L.return.licm_fault:
+  mov rbx, [rsp-16]
+  mov r12, [rsp-24]
+  mov r13, [rsp-32]
+  mov r14, [rsp-40]
+  mov r15, [rsp-48]
+  ret
+  .globl licm_store
+  .text
+licm_store:
+  mov [rsp-16], rbx
+  mov [rsp-24], r12
+  mov [rsp-32], r13
+  mov r13, rdi
+  mov [rsp-4], esi
+.L.body.licm_store:
+  .loc 1 51
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 51
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 51
+  mov rax, rbx
+  cmp eax, dword ptr [r13]
+  jge .L..6
+.L.begin.49:
+  .loc 1 51
+  add r12d, 1
+  movsxd r12, r12d
+  .loc 1 51
+  cmp ebx, 2
+  jne .L.else.50
+  .loc 1 51
+  movsxd rax, dword ptr [rsp-4]
+  mov dword ptr [r13], eax
+.L.else.50:
+.L.end.50:
+.L..7:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.49:
+  .loc 1 51
+  mov rax, rbx
+  cmp eax, dword ptr [r13]
+  jl .L.begin.49
+.L..6:
+  .loc 1 51
+  mov rax, r12
+.L.return.licm_store:
+  mov rbx, [rsp-16]
+  mov r12, [rsp-24]
+  mov r13, [rsp-32]
+  ret
+  .globl licm_mul
+  .text
+licm_mul:
+  mov [rsp-24], rbx
+  mov [rsp-32], r12
+  mov [rsp-40], r13
+  mov [rsp-4], edi
+  mov [rsp-8], esi
+  mov [rsp-16], rdx
+.L.body.licm_mul:
+  .loc 1 50
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 50
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 50
+  movsxd rax, dword ptr [rsp-4]
+  imul eax, dword ptr [rsp-8]
+  movsxd r13, eax
+  .loc 1 50
+  mov rax, rbx
+  cmp eax, r13d
+  jge .L..4
+.L.begin.51:
+  .loc 1 50
+  mov rax, qword ptr [rsp-16]
+  movsxd rax, dword ptr [rax+rbx*4]
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 50
+  add ebx, 1
+  movsxd rbx, ebx
+.L..5:
+.L.cond.51:
+  .loc 1 50
+  mov rax, rbx
+  cmp eax, r13d
+  jl .L.begin.51
+.L..4:
+  .loc 1 50
+  mov rax, r12
+.L.return.licm_mul:
+  mov rbx, [rsp-24]
+  mov r12, [rsp-32]
+  mov r13, [rsp-40]
+  ret
+  .globl licm_sum
+  .text
+licm_sum:
+  mov [rsp-40], rbx
+  mov [rsp-48], r12
+  mov [rsp-56], r13
+  mov [rsp-64], r14
+  mov [rsp-72], r15
+  mov r13, rdi
+.L.body.licm_sum:
+  .loc 1 49
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 49
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 49
+  movsxd rax, dword ptr [r13]
+  mov dword ptr [rsp-28], eax
+  .loc 1 49
+  mov rax, rbx
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 49
+  movsxd rax, dword ptr [rsp-28]
+  mov rdi, r14
+  sub rax, rdi
+  mov qword ptr [rsp-24], rax
+  .loc 1 49
+  mov eax, 3
+  cmp rax, qword ptr [rsp-24]
+  jge .L.else.52
+  .loc 1 49
+  mov rax, rbx
+  movsxd rax, eax
+  shl rax, 2
+  add rax, qword ptr [r13+8]
+  mov qword ptr [rsp-16], rax
+  .loc 1 49
+  mov rax, qword ptr [rsp-24]
+  sar rax, 2
+  mov rcx, rax
+  .loc 1 49
+  mov rax, qword ptr [rsp-16]
+  mov rsi, rax
+  pxor xmm0, xmm0
+.L.vector.53:
+  movdqu xmm1, [rsi]
+  paddd xmm0, xmm1
+  add rsi, 16
+  sub rcx, 1
+  jnz .L.vector.53
+  pshufd xmm1, xmm0, 0x4e
+  paddd xmm0, xmm1
+  pshufd xmm1, xmm0, 0xb1
+  paddd xmm0, xmm1
+  movq rax, xmm0
+  movsxd rax, eax
+  mov dword ptr [rsp-4], eax
+  .loc 1 49
+  movsxd rax, eax
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 49
+  mov rax, -4
+  and rax, qword ptr [rsp-24]
+  add ebx, eax
+  movsxd rbx, ebx
+.L.else.52:
+.L.end.52:
+  .loc 1 49
+  movsxd rax, dword ptr [rsp-28]
+  mov r14, rax
+  .loc 1 49
+  mov eax, 3
+  mov r15, rax
+  .loc 1 49
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.22
+.L.begin.54:
+  .loc 1 49
+  mov rax, qword ptr [r13+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 49
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 49
+  mov rax, qword ptr [r13+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 49
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 49
+  mov rax, qword ptr [r13+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 49
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 49
+  mov rax, qword ptr [r13+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  add r12d, eax
+  movsxd r12, r12d
+.L.opt.23:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.54:
+  .loc 1 49
+  movsxd rax, dword ptr [rsp-28]
+  mov r14, rax
+  .loc 1 49
+  mov eax, 3
+  mov r15, rax
+  .loc 1 49
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.54
+.L.opt.22:
+  .loc 1 49
+  mov rax, rbx
+  cmp eax, dword ptr [rsp-28]
+  jge .L..2
+.L.begin.55:
+  .loc 1 49
+  mov rax, qword ptr [r13+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  add r12d, eax
+  movsxd r12, r12d
+.L..3:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.55:
+  .loc 1 49
+  mov rax, rbx
+  cmp eax, dword ptr [rsp-28]
+  jl .L.begin.55
+.L..2:
+  .loc 1 49
+  mov rax, r12
+.L.return.licm_sum:
+  mov rbx, [rsp-40]
+  mov r12, [rsp-48]
+  mov r13, [rsp-56]
+  mov r14, [rsp-64]
+  mov r15, [rsp-72]
+  ret
+  .globl cse_cond
+  .text
+cse_cond:
+  mov [rsp-8], rbx
+  mov [rsp-16], r12
+  mov rbx, rdi
+.L.body.cse_cond:
+  .loc 1 48
+  mov rax, rbx
+  test rax, rax
+  je .L.else.56
+  .loc 1 48
+  movsxd rax, dword ptr [rbx]
+  add eax, 1
+  test eax, eax
+  jle .L.else.56
+  .loc 1 48
+  movsxd rax, dword ptr [rbx]
+  add eax, 1
+  jmp .L.end.56
+.L.else.56:
+  .loc 1 48
+  xor eax, eax
+.L.end.56:
+  movsxd r12, eax
+  .loc 1 48
+  mov rax, r12
+.L.return.cse_cond:
+  mov rbx, [rsp-8]
+  mov r12, [rsp-16]
+  ret
+  .globl cse_var
+  .text
+cse_var:
+  mov [rsp-16], rbx
+  mov [rsp-24], r12
+  mov [rsp-32], r13
+  movsxd r12, edi
+  mov [rsp-8], esi
+.L.body.cse_var:
+  .loc 1 47
+  mov rax, r12
+  imul eax, dword ptr [rsp-8]
+  add eax, 1
+  movsxd rbx, eax
+  .loc 1 47
+  mov rax, rbx
+  imul eax, ebx
+  mov dword ptr [rsp-4], eax
+  .loc 1 47
+  mov eax, 3
+  movsxd r12, eax
+  .loc 1 47
+  mov rax, r12
+  imul eax, dword ptr [rsp-8]
+  add eax, 1
+  movsxd r13, eax
+  .loc 1 47
+  movsxd rax, dword ptr [rsp-4]
+  add eax, r13d
+.L.return.cse_var:
+  mov rbx, [rsp-16]
+  mov r12, [rsp-24]
+  mov r13, [rsp-32]
+  ret
+  .globl cse_clobber
+  .text
+cse_clobber:
+  mov [rsp-16], rbx
+  mov [rsp-24], r12
+  mov [rsp-32], r13
+  mov r13, rdi
+  mov [rsp-8], rsi
+.L.body.cse_clobber:
+  .loc 1 46
+  movsxd rax, dword ptr [r13]
+  add eax, 1
+  movsxd r12, eax
+  .loc 1 46
+  mov rax, qword ptr [rsp-8]
+  mov dword ptr [rax], 5
+  .loc 1 46
+  movsxd rax, dword ptr [r13]
+  add eax, 1
+  movsxd rbx, eax
+  .loc 1 46
+  mov rax, r12
+  add eax, ebx
+.L.return.cse_clobber:
+  mov rbx, [rsp-16]
+  mov r12, [rsp-24]
+  mov r13, [rsp-32]
+  ret
+  .globl cse_sum
+  .text
+cse_sum:
+  mov [rsp-24], rbx
+  mov [rsp-32], r12
+  mov [rsp-40], r13
+  mov [rsp-48], r14
+  mov [rsp-56], r15
+  mov [rsp-16], rdi
+.L.body.cse_sum:
+  .loc 1 45
+  xor eax, eax
+  movsxd r13, eax
+  .loc 1 45
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 45
+  mov rax, qword ptr [rsp-16]
+  movsxd rax, dword ptr [rax]
+  mov dword ptr [rsp-4], eax
+  .loc 1 45
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 45
+  mov eax, 3
+  mov r15, rax
+  .loc 1 45
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.24
+.L.begin.57:
+  .loc 1 45
+  mov rax, qword ptr [rsp-16]
+  mov rax, qword ptr [rax+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  movsxd r12, eax
+  .loc 1 45
+  mov rax, r12
+  imul eax, r12d
+  add r13d, eax
+  movsxd r13, r13d
+  .loc 1 45
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 45
+  mov rax, qword ptr [rsp-16]
+  mov rax, qword ptr [rax+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  movsxd r12, eax
+  .loc 1 45
+  mov rax, r12
+  imul eax, r12d
+  add r13d, eax
+  movsxd r13, r13d
+  .loc 1 45
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 45
+  mov rax, qword ptr [rsp-16]
+  mov rax, qword ptr [rax+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  movsxd r12, eax
+  .loc 1 45
+  mov rax, r12
+  imul eax, r12d
+  add r13d, eax
+  movsxd r13, r13d
+  .loc 1 45
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 45
+  mov rax, qword ptr [rsp-16]
+  mov rax, qword ptr [rax+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  movsxd r12, eax
+  .loc 1 45
+  mov rax, r12
+  imul eax, r12d
+  add r13d, eax
+  movsxd r13, r13d
+.L.opt.25:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.57:
+  .loc 1 45
+  movsxd rax, dword ptr [rsp-4]
+  mov r14, rax
+  .loc 1 45
+  mov eax, 3
+  mov r15, rax
+  .loc 1 45
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.57
+.L.opt.24:
+  .loc 1 45
+  mov rax, rbx
+  cmp eax, dword ptr [rsp-4]
+  jge .L..0
+.L.begin.58:
+  .loc 1 45
+  mov rax, qword ptr [rsp-16]
+  mov rax, qword ptr [rax+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  movsxd r12, eax
+  .loc 1 45
+  mov rax, r12
+  imul eax, r12d
+  add r13d, eax
+  movsxd r13, r13d
+.L..1:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.58:
+  .loc 1 45
+  mov rax, rbx
+  cmp eax, dword ptr [rsp-4]
+  jl .L.begin.58
+.L..0:
+  .loc 1 45
+  mov rax, r13
+.L.return.cse_sum:
+  mov rbx, [rsp-24]
+  mov r12, [rsp-32]
+  mov r13, [rsp-40]
+  mov r14, [rsp-48]
+  mov r15, [rsp-56]
+  ret
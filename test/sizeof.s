@@ -0,0 +1,893 @@
+.file 1 "-"
+.intel_syntax noprefix
+  .local .L..32
+  .data
+.L..32:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+  .local .L..31
+  .data
+.L..31:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..30
+  .data
+.L..30:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 42
+  .byte 41
+  .byte 91
+  .byte 93
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 41
+  .byte 0
+  .local .L..29
+  .data
+.L..29:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 42
+  .byte 41
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 41
+  .byte 0
+  .local .L..28
+  .data
+.L..28:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..27
+  .data
+.L..27:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 43
+  .byte 43
+  .byte 105
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..26
+  .data
+.L..26:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 52
+  .byte 50
+  .byte 57
+  .byte 52
+  .byte 57
+  .byte 54
+  .byte 55
+  .byte 50
+  .byte 57
+  .byte 54
+  .byte 41
+  .byte 0
+  .local .L..25
+  .data
+.L..25:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 0
+  .local .L..24
+  .data
+.L..24:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 47
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..23
+  .data
+.L..23:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 42
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..22
+  .data
+.L..22:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..21
+  .data
+.L..21:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..20
+  .data
+.L..20:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 47
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..19
+  .data
+.L..19:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 42
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..18
+  .data
+.L..18:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..17
+  .data
+.L..17:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 53
+  .byte 41
+  .byte 0
+  .local .L..16
+  .data
+.L..16:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..15
+  .data
+.L..15:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .byte 0
+  .local .L..14
+  .data
+.L..14:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .byte 0
+  .local .L..13
+  .data
+.L..13:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 42
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .byte 0
+  .local .L..12
+  .data
+.L..12:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 40
+  .byte 42
+  .byte 41
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 41
+  .byte 0
+  .local .L..11
+  .data
+.L..11:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 41
+  .byte 0
+  .local .L..10
+  .data
+.L..10:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 0
+  .local .L..9
+  .data
+.L..9:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 0
+  .local .L..8
+  .data
+.L..8:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 41
+  .byte 0
+  .local .L..7
+  .data
+.L..7:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+  .local .L..6
+  .data
+.L..6:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+  .local .L..5
+  .data
+.L..5:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 0
+  .local .L..4
+  .data
+.L..4:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+  .local .L..3
+  .data
+.L..3:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 0
+  .local .L..2
+  .data
+.L..2:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 41
+  .byte 0
+  .local .L..1
+  .data
+.L..1:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 41
+  .byte 0
+  .local .L..0
+  .data
+.L..0:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 41
+  .byte 0
+  .globl main
+  .text
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 16
+.L.body.main:
+  .loc 1 41
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..0[rip]
+  call assert
+  .loc 1 42
+  mov edi, 2
+  mov esi, 2
+  lea rdx, .L..1[rip]
+  call assert
+  .loc 1 43
+  mov edi, 2
+  mov esi, 2
+  lea rdx, .L..2[rip]
+  call assert
+  .loc 1 44
+  mov edi, 2
+  mov esi, 2
+  lea rdx, .L..3[rip]
+  call assert
+  .loc 1 45
+  mov edi, 4
+  mov esi, 4
+  lea rdx, .L..4[rip]
+  call assert
+  .loc 1 46
+  mov edi, 8
+  mov esi, 8
+  lea rdx, .L..5[rip]
+  call assert
+  .loc 1 47
+  mov edi, 8
+  mov esi, 8
+  lea rdx, .L..6[rip]
+  call assert
+  .loc 1 48
+  mov edi, 8
+  mov esi, 8
+  lea rdx, .L..7[rip]
+  call assert
+  .loc 1 49
+  mov edi, 8
+  mov esi, 8
+  lea rdx, .L..8[rip]
+  call assert
+  .loc 1 50
+  mov edi, 8
+  mov esi, 8
+  lea rdx, .L..9[rip]
+  call assert
+  .loc 1 51
+  mov edi, 8
+  mov esi, 8
+  lea rdx, .L..10[rip]
+  call assert
+  .loc 1 52
+  mov edi, 8
+  mov esi, 8
+  lea rdx, .L..11[rip]
+  call assert
+  .loc 1 53
+  mov edi, 8
+  mov esi, 8
+  lea rdx, .L..12[rip]
+  call assert
+  .loc 1 54
+  mov edi, 32
+  mov esi, 32
+  lea rdx, .L..13[rip]
+  call assert
+  .loc 1 55
+  mov edi, 16
+  mov esi, 16
+  lea rdx, .L..14[rip]
+  call assert
+  .loc 1 56
+  mov edi, 48
+  mov esi, 48
+  lea rdx, .L..15[rip]
+  call assert
+  .loc 1 57
+  mov edi, 8
+  mov esi, 8
+  lea rdx, .L..16[rip]
+  call assert
+  .loc 1 58
+  mov edi, 8
+  mov esi, 8
+  lea rdx, .L..17[rip]
+  call assert
+  .loc 1 59
+  mov edi, 8
+  mov esi, 8
+  lea rdx, .L..18[rip]
+  call assert
+  .loc 1 60
+  mov edi, 8
+  mov esi, 8
+  lea rdx, .L..19[rip]
+  call assert
+  .loc 1 61
+  mov edi, 8
+  mov esi, 8
+  lea rdx, .L..20[rip]
+  call assert
+  .loc 1 62
+  mov edi, 8
+  mov esi, 8
+  lea rdx, .L..21[rip]
+  call assert
+  .loc 1 63
+  mov edi, 8
+  mov esi, 8
+  lea rdx, .L..22[rip]
+  call assert
+  .loc 1 64
+  mov edi, 8
+  mov esi, 8
+  lea rdx, .L..23[rip]
+  call assert
+  .loc 1 65
+  mov edi, 8
+  mov esi, 8
+  lea rdx, .L..24[rip]
+  call assert
+  .loc 1 66
+  mov edi, 4
+  mov esi, 4
+  lea rdx, .L..25[rip]
+  call assert
+  .loc 1 67
+  mov edi, 8
+  mov esi, 8
+  lea rdx, .L..26[rip]
+  call assert
+  .loc 1 68
+  mov eax, 1
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..27[rip]
+  call assert
+  .loc 1 69
+  mov eax, 1
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..28[rip]
+  call assert
+  .loc 1 70
+  mov edi, 8
+  mov esi, 8
+  lea rdx, .L..29[rip]
+  call assert
+  .loc 1 71
+  mov edi, 8
+  mov esi, 8
+  lea rdx, .L..30[rip]
+  call assert
+  .loc 1 72
+  mov edi, 4
+  mov esi, 4
+  lea rdx, .L..31[rip]
+  call assert
+  .loc 1 73
+  lea rdi, .L..32[rip]
+  xor eax, eax
+  call printf
+  .loc 1 74
+  xor eax, eax
+.L.return.main:
+  mov rsp, rbp
+  pop rbp
+  ret
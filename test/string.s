@@ -0,0 +1,686 @@
+.file 1 "-"
+.intel_syntax noprefix
+  .local .L..56
+  .data
+.L..56:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+  .local .L..55
+  .data
+.L..55:
+  .byte 34
+  .byte 92
+  .byte 120
+  .byte 55
+  .byte 55
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..54
+  .data
+.L..54:
+  .byte 119
+  .byte 0
+  .local .L..53
+  .data
+.L..53:
+  .byte 34
+  .byte 92
+  .byte 120
+  .byte 48
+  .byte 48
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..52
+  .data
+.L..52:
+  .byte 0
+  .byte 0
+  .local .L..51
+  .data
+.L..51:
+  .byte 34
+  .byte 92
+  .byte 49
+  .byte 53
+  .byte 48
+  .byte 48
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..50
+  .data
+.L..50:
+  .byte 104
+  .byte 48
+  .byte 0
+  .local .L..49
+  .data
+.L..49:
+  .byte 34
+  .byte 92
+  .byte 49
+  .byte 48
+  .byte 49
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..48
+  .data
+.L..48:
+  .byte 65
+  .byte 0
+  .local .L..47
+  .data
+.L..47:
+  .byte 34
+  .byte 92
+  .byte 50
+  .byte 48
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..46
+  .data
+.L..46:
+  .byte 16
+  .byte 0
+  .local .L..45
+  .data
+.L..45:
+  .byte 34
+  .byte 92
+  .byte 48
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..44
+  .data
+.L..44:
+  .byte 0
+  .byte 0
+  .local .L..43
+  .data
+.L..43:
+  .byte 34
+  .byte 92
+  .byte 97
+  .byte 120
+  .byte 92
+  .byte 110
+  .byte 121
+  .byte 34
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 0
+  .local .L..42
+  .data
+.L..42:
+  .byte 7
+  .byte 120
+  .byte 10
+  .byte 121
+  .byte 0
+  .local .L..41
+  .data
+.L..41:
+  .byte 34
+  .byte 92
+  .byte 97
+  .byte 120
+  .byte 92
+  .byte 110
+  .byte 121
+  .byte 34
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 0
+  .local .L..40
+  .data
+.L..40:
+  .byte 7
+  .byte 120
+  .byte 10
+  .byte 121
+  .byte 0
+  .local .L..39
+  .data
+.L..39:
+  .byte 34
+  .byte 92
+  .byte 97
+  .byte 120
+  .byte 92
+  .byte 110
+  .byte 121
+  .byte 34
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+  .local .L..38
+  .data
+.L..38:
+  .byte 7
+  .byte 120
+  .byte 10
+  .byte 121
+  .byte 0
+  .local .L..37
+  .data
+.L..37:
+  .byte 34
+  .byte 92
+  .byte 97
+  .byte 120
+  .byte 92
+  .byte 110
+  .byte 121
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..36
+  .data
+.L..36:
+  .byte 7
+  .byte 120
+  .byte 10
+  .byte 121
+  .byte 0
+  .local .L..35
+  .data
+.L..35:
+  .byte 34
+  .byte 92
+  .byte 108
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..34
+  .data
+.L..34:
+  .byte 108
+  .byte 0
+  .local .L..33
+  .data
+.L..33:
+  .byte 34
+  .byte 92
+  .byte 107
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..32
+  .data
+.L..32:
+  .byte 107
+  .byte 0
+  .local .L..31
+  .data
+.L..31:
+  .byte 34
+  .byte 92
+  .byte 106
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..30
+  .data
+.L..30:
+  .byte 106
+  .byte 0
+  .local .L..29
+  .data
+.L..29:
+  .byte 34
+  .byte 92
+  .byte 101
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..28
+  .data
+.L..28:
+  .byte 27
+  .byte 0
+  .local .L..27
+  .data
+.L..27:
+  .byte 34
+  .byte 92
+  .byte 114
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..26
+  .data
+.L..26:
+  .byte 13
+  .byte 0
+  .local .L..25
+  .data
+.L..25:
+  .byte 34
+  .byte 92
+  .byte 102
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..24
+  .data
+.L..24:
+  .byte 12
+  .byte 0
+  .local .L..23
+  .data
+.L..23:
+  .byte 34
+  .byte 92
+  .byte 118
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..22
+  .data
+.L..22:
+  .byte 11
+  .byte 0
+  .local .L..21
+  .data
+.L..21:
+  .byte 34
+  .byte 92
+  .byte 110
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..20
+  .data
+.L..20:
+  .byte 10
+  .byte 0
+  .local .L..19
+  .data
+.L..19:
+  .byte 34
+  .byte 92
+  .byte 116
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..18
+  .data
+.L..18:
+  .byte 9
+  .byte 0
+  .local .L..17
+  .data
+.L..17:
+  .byte 34
+  .byte 92
+  .byte 98
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..16
+  .data
+.L..16:
+  .byte 8
+  .byte 0
+  .local .L..15
+  .data
+.L..15:
+  .byte 34
+  .byte 92
+  .byte 97
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..14
+  .data
+.L..14:
+  .byte 7
+  .byte 0
+  .local .L..13
+  .data
+.L..13:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 41
+  .byte 0
+  .local .L..11
+  .data
+.L..11:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 0
+  .local .L..10
+  .data
+.L..10:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+  .local .L..9
+  .data
+.L..9:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 0
+  .local .L..8
+  .data
+.L..8:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+  .local .L..7
+  .data
+.L..7:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 0
+  .local .L..6
+  .data
+.L..6:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+  .local .L..5
+  .data
+.L..5:
+  .byte 34
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..4
+  .data
+.L..4:
+  .byte 97
+  .byte 98
+  .byte 99
+  .byte 0
+  .local .L..3
+  .data
+.L..3:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 34
+  .byte 34
+  .byte 41
+  .byte 0
+  .local .L..1
+  .data
+.L..1:
+  .byte 34
+  .byte 34
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 0
+  .local .L..0
+  .data
+.L..0:
+  .byte 0
+  .globl main
+  .text
+main:
+  push rbp
+  mov rbp, rsp
+.L.body.main:
+  .loc 1 41
+  movsx eax, byte ptr .L..0[rip]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..1[rip]
+  call assert
+  .loc 1 42
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..3[rip]
+  call assert
+  .loc 1 43
+  movsx eax, byte ptr .L..4[rip]
+  mov rsi, rax
+  mov edi, 97
+  lea rdx, .L..5[rip]
+  call assert
+  .loc 1 44
+  movsx eax, byte ptr .L..6+1[rip]
+  mov rsi, rax
+  mov edi, 98
+  lea rdx, .L..7[rip]
+  call assert
+  .loc 1 45
+  movsx eax, byte ptr .L..8+2[rip]
+  mov rsi, rax
+  mov edi, 99
+  lea rdx, .L..9[rip]
+  call assert
+  .loc 1 46
+  movsx eax, byte ptr .L..10+3[rip]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..11[rip]
+  call assert
+  .loc 1 47
+  mov edi, 4
+  mov esi, 4
+  lea rdx, .L..13[rip]
+  call assert
+  .loc 1 48
+  movsx eax, byte ptr .L..14[rip]
+  mov rsi, rax
+  mov edi, 7
+  lea rdx, .L..15[rip]
+  call assert
+  .loc 1 49
+  movsx eax, byte ptr .L..16[rip]
+  mov rsi, rax
+  mov edi, 8
+  lea rdx, .L..17[rip]
+  call assert
+  .loc 1 50
+  movsx eax, byte ptr .L..18[rip]
+  mov rsi, rax
+  mov edi, 9
+  lea rdx, .L..19[rip]
+  call assert
+  .loc 1 51
+  movsx eax, byte ptr .L..20[rip]
+  mov rsi, rax
+  mov edi, 10
+  lea rdx, .L..21[rip]
+  call assert
+  .loc 1 52
+  movsx eax, byte ptr .L..22[rip]
+  mov rsi, rax
+  mov edi, 11
+  lea rdx, .L..23[rip]
+  call assert
+  .loc 1 53
+  movsx eax, byte ptr .L..24[rip]
+  mov rsi, rax
+  mov edi, 12
+  lea rdx, .L..25[rip]
+  call assert
+  .loc 1 54
+  movsx eax, byte ptr .L..26[rip]
+  mov rsi, rax
+  mov edi, 13
+  lea rdx, .L..27[rip]
+  call assert
+  .loc 1 55
+  movsx eax, byte ptr .L..28[rip]
+  mov rsi, rax
+  mov edi, 27
+  lea rdx, .L..29[rip]
+  call assert
+  .loc 1 56
+  movsx eax, byte ptr .L..30[rip]
+  mov rsi, rax
+  mov edi, 106
+  lea rdx, .L..31[rip]
+  call assert
+  .loc 1 57
+  movsx eax, byte ptr .L..32[rip]
+  mov rsi, rax
+  mov edi, 107
+  lea rdx, .L..33[rip]
+  call assert
+  .loc 1 58
+  movsx eax, byte ptr .L..34[rip]
+  mov rsi, rax
+  mov edi, 108
+  lea rdx, .L..35[rip]
+  call assert
+  .loc 1 59
+  movsx eax, byte ptr .L..36[rip]
+  mov rsi, rax
+  mov edi, 7
+  lea rdx, .L..37[rip]
+  call assert
+  .loc 1 60
+  movsx eax, byte ptr .L..38+1[rip]
+  mov rsi, rax
+  mov edi, 120
+  lea rdx, .L..39[rip]
+  call assert
+  .loc 1 61
+  movsx eax, byte ptr .L..40+2[rip]
+  mov rsi, rax
+  mov edi, 10
+  lea rdx, .L..41[rip]
+  call assert
+  .loc 1 62
+  movsx eax, byte ptr .L..42+3[rip]
+  mov rsi, rax
+  mov edi, 121
+  lea rdx, .L..43[rip]
+  call assert
+  .loc 1 63
+  movsx eax, byte ptr .L..44[rip]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..45[rip]
+  call assert
+  .loc 1 64
+  movsx eax, byte ptr .L..46[rip]
+  mov rsi, rax
+  mov edi, 16
+  lea rdx, .L..47[rip]
+  call assert
+  .loc 1 65
+  movsx eax, byte ptr .L..48[rip]
+  mov rsi, rax
+  mov edi, 65
+  lea rdx, .L..49[rip]
+  call assert
+  .loc 1 66
+  movsx eax, byte ptr .L..50[rip]
+  mov rsi, rax
+  mov edi, 104
+  lea rdx, .L..51[rip]
+  call assert
+  .loc 1 67
+  movsx eax, byte ptr .L..52[rip]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..53[rip]
+  call assert
+  .loc 1 68
+  movsx eax, byte ptr .L..54[rip]
+  mov rsi, rax
+  mov edi, 119
+  lea rdx, .L..55[rip]
+  call assert
+  .loc 1 69
+  lea rdi, .L..56[rip]
+  xor eax, eax
+  call printf
+  .loc 1 70
+  xor eax, eax
+.L.return.main:
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -52,6 +52,14 @@ int main() {
   ASSERT(1, ({ struct T { struct T *next; int x; } a; struct T b; b.x=1; a.next=&b; a.next->x; }));
   ASSERT(4, ({ typedef struct T T; struct T { int x; }; sizeof(T); }));
 
+  ASSERT(7, ({ struct {char a[7];} x, y; x.a[0]=1; x.a[6]=7; y=x; y.a[6]; }));
+  ASSERT(35, ({ struct {char a[35];} x, y; for (int i=0; i<35; i++) x.a[i]=i+1; y=x; y.a[34]; }));
+  ASSERT(16, ({ struct {char a[35];} x, y; for (int i=0; i<35; i++) x.a[i]=i+1; y=x; y.a[15]; }));
+  ASSERT(1, ({ struct {char a[35];} x, y; for (int i=0; i<35; i++) x.a[i]=i+1; y=x; memcmp(x.a, y.a, 35)==0; }));
+  ASSERT(1, ({ struct {long a[40]; char b;} x, y; for (int i=0; i<40; i++) x.a[i]=i*3; x.b=9; y=x; memcmp(&x, &y, sizeof(x))==0; }));
+  ASSERT(117, ({ struct {long a[40]; char b;} x, y; for (int i=0; i<40; i++) x.a[i]=i*3; y=x; y.a[39]; }));
+  ASSERT(9, ({ struct {long a[40]; char b;} x, y; x.b=9; y=x; y.b; }));
+
   printf("OK\n");
   return 0;
 }
@@ -0,0 +1,599 @@
+.file 1 "-"
+.intel_syntax noprefix
+  .local .L..17
+  .data
+.L..17:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+  .local .L..16
+  .data
+.L..16:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 116
+  .byte 32
+  .byte 123
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 44
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 46
+  .byte 97
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 46
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..15
+  .data
+.L..15:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 45
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..14
+  .data
+.L..14:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 121
+  .byte 61
+  .byte 120
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..13
+  .data
+.L..13:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 45
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..12
+  .data
+.L..12:
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 50
+  .byte 0
+  .local .L..11
+  .data
+.L..11:
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 50
+  .byte 32
+  .byte 62
+  .byte 61
+  .byte 32
+  .byte 45
+  .byte 49
+  .byte 0
+  .local .L..10
+  .data
+.L..10:
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 50
+  .byte 32
+  .byte 62
+  .byte 32
+  .byte 45
+  .byte 49
+  .byte 0
+  .local .L..9
+  .data
+.L..9:
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 50
+  .byte 32
+  .byte 60
+  .byte 61
+  .byte 32
+  .byte 45
+  .byte 49
+  .byte 0
+  .local .L..8
+  .data
+.L..8:
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 50
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 45
+  .byte 49
+  .byte 0
+  .local .L..7
+  .data
+.L..7:
+  .byte 45
+  .byte 50
+  .byte 32
+  .byte 62
+  .byte 61
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 0
+  .local .L..6
+  .data
+.L..6:
+  .byte 45
+  .byte 50
+  .byte 32
+  .byte 62
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 0
+  .local .L..5
+  .data
+.L..5:
+  .byte 45
+  .byte 50
+  .byte 32
+  .byte 60
+  .byte 61
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 0
+  .local .L..4
+  .data
+.L..4:
+  .byte 45
+  .byte 50
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 45
+  .byte 49
+  .byte 0
+  .local .L..3
+  .data
+.L..3:
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 47
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 53
+  .byte 0
+  .local .L..2
+  .data
+.L..2:
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 42
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 53
+  .byte 0
+  .local .L..1
+  .data
+.L..1:
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 53
+  .byte 0
+  .local .L..0
+  .data
+.L..0:
+  .byte 45
+  .byte 49
+  .byte 48
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 40
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 41
+  .byte 53
+  .byte 0
+  .globl main
+  .text
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-16], rbx
+  mov [rbp-24], r12
+  mov [rbp-32], r13
+  mov [rbp-40], r14
+.L.body.main:
+  .loc 1 41
+  mov edi, -5
+  mov esi, -5
+  lea rdx, .L..0[rip]
+  call assert
+  .loc 1 42
+  mov edi, -15
+  mov esi, -15
+  lea rdx, .L..1[rip]
+  call assert
+  .loc 1 43
+  mov edi, -50
+  mov esi, -50
+  lea rdx, .L..2[rip]
+  call assert
+  .loc 1 44
+  mov edi, -2
+  mov esi, -2
+  lea rdx, .L..3[rip]
+  call assert
+  .loc 1 45
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..4[rip]
+  call assert
+  .loc 1 46
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..5[rip]
+  call assert
+  .loc 1 47
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..6[rip]
+  call assert
+  .loc 1 48
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..7[rip]
+  call assert
+  .loc 1 49
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..8[rip]
+  call assert
+  .loc 1 50
+  mov edi, 1
+  mov esi, 1
+  lea rdx, .L..9[rip]
+  call assert
+  .loc 1 51
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..10[rip]
+  call assert
+  .loc 1 52
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..11[rip]
+  call assert
+  .loc 1 53
+  xor edi, edi
+  xor esi, esi
+  lea rdx, .L..12[rip]
+  call assert
+  .loc 1 54
+  mov rax, -1
+  mov r13, rax
+  .loc 1 54
+  mov rax, r13
+  mov rsi, rax
+  mov edi, -1
+  lea rdx, .L..13[rip]
+  call assert
+  .loc 1 55
+  mov byte ptr [rbp-8], 0
+  .loc 1 55
+  mov byte ptr [rbp-7], 1
+  .loc 1 55
+  mov byte ptr [rbp-6], 2
+  .loc 1 55
+  lea rax, [rbp-8]
+  add rax, 1
+  mov r12, rax
+  .loc 1 55
+  movsx eax, byte ptr [r12]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..14[rip]
+  call assert
+  .loc 1 56
+  mov byte ptr [rbp-5], 0
+  .loc 1 56
+  mov byte ptr [rbp-4], 1
+  .loc 1 56
+  mov byte ptr [rbp-3], 2
+  .loc 1 56
+  lea rax, [rbp-5]
+  add rax, 1
+  mov rbx, rax
+  .loc 1 56
+  movsx eax, byte ptr [rbx-1]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..15[rip]
+  call assert
+  .loc 1 57
+  mov byte ptr [rbp-2], 5
+  .loc 1 57
+  lea rax, [rbp-1]
+  mov r14, rax
+  .loc 1 57
+  lea rax, [rbp-2]
+  mov rdi, r14
+  mov r8b, [rax+0]
+  mov [rdi+0], r8b
+  .loc 1 57
+  movsx eax, byte ptr [rbp-1]
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..16[rip]
+  call assert
+  .loc 1 58
+  lea rdi, .L..17[rip]
+  xor eax, eax
+  call printf
+  .loc 1 59
+  xor eax, eax
+.L.return.main:
+  mov rbx, [rbp-16]
+  mov r12, [rbp-24]
+  mov r13, [rbp-32]
+  mov r14, [rbp-40]
+  mov rsp, rbp
+  pop rbp
+  ret
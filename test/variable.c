@@ -64,6 +64,13 @@ int main() {
 
   { void *x; }
 
+  ASSERT(-128, ({ char c=127; c++; c; }));
+  ASSERT(-32768, ({ short s=32767; s+=1; s; }));
+  ASSERT(-1, ({ int i=2147483647; long l=i; l=l*2+1; i=l; i; }));
+  ASSERT(45, ({ int s=0; for (int i=0; i<10; i++) s+=i; s; }));
+  ASSERT(7, ({ int x=3; int *p=&x; *p=7; x; }));
+  ASSERT(4, ({ long a=1, b=1, c=1, d=1, e=0; e=a+b+c+d; e; }));
+
   printf("OK\n");
   return 0;
 }
@@ -0,0 +1,2436 @@
+.file 1 "-"
+.intel_syntax noprefix
+  .local .L..56
+  .data
+.L..56:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+  .local .L..55
+  .data
+.L..55:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 61
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 99
+  .byte 61
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 100
+  .byte 61
+  .byte 49
+  .byte 44
+  .byte 32
+  .byte 101
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 61
+  .byte 97
+  .byte 43
+  .byte 98
+  .byte 43
+  .byte 99
+  .byte 43
+  .byte 100
+  .byte 59
+  .byte 32
+  .byte 101
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..54
+  .data
+.L..54:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 38
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 42
+  .byte 112
+  .byte 61
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..53
+  .data
+.L..53:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 60
+  .byte 49
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..50
+  .data
+.L..50:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 50
+  .byte 49
+  .byte 52
+  .byte 55
+  .byte 52
+  .byte 56
+  .byte 51
+  .byte 54
+  .byte 52
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 108
+  .byte 61
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 108
+  .byte 61
+  .byte 108
+  .byte 42
+  .byte 50
+  .byte 43
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 61
+  .byte 108
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..49
+  .data
+.L..49:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 115
+  .byte 61
+  .byte 51
+  .byte 50
+  .byte 55
+  .byte 54
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 43
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..48
+  .data
+.L..48:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 99
+  .byte 61
+  .byte 49
+  .byte 50
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 43
+  .byte 43
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..47
+  .data
+.L..47:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 121
+  .byte 41
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..46
+  .data
+.L..46:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..45
+  .data
+.L..45:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 41
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..44
+  .data
+.L..44:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 41
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..43
+  .data
+.L..43:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..42
+  .data
+.L..42:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..41
+  .data
+.L..41:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..40
+  .data
+.L..40:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..39
+  .data
+.L..39:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 111
+  .byte 114
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..38
+  .data
+.L..38:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..37
+  .data
+.L..37:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 97
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 98
+  .byte 61
+  .byte 38
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 45
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..36
+  .data
+.L..36:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 97
+  .byte 61
+  .byte 38
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 42
+  .byte 98
+  .byte 61
+  .byte 38
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 45
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..35
+  .data
+.L..35:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..34
+  .data
+.L..34:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 52
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..33
+  .data
+.L..33:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..32
+  .data
+.L..32:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 49
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..31
+  .data
+.L..31:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..30
+  .data
+.L..30:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 121
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..29
+  .data
+.L..29:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 121
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..28
+  .data
+.L..28:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..27
+  .data
+.L..27:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 50
+  .byte 41
+  .byte 0
+  .local .L..26
+  .data
+.L..26:
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 103
+  .byte 49
+  .byte 41
+  .byte 0
+  .local .L..25
+  .data
+.L..25:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..24
+  .data
+.L..24:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..23
+  .data
+.L..23:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..22
+  .data
+.L..22:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 61
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 49
+  .byte 93
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 50
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..21
+  .data
+.L..21:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 103
+  .byte 49
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 103
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..20
+  .data
+.L..20:
+  .byte 103
+  .byte 49
+  .byte 0
+  .local .L..19
+  .data
+.L..19:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..18
+  .data
+.L..18:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 61
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 61
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..17
+  .data
+.L..17:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..16
+  .data
+.L..16:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 32
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..15
+  .data
+.L..15:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..14
+  .data
+.L..14:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..13
+  .data
+.L..13:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 42
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..12
+  .data
+.L..12:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 51
+  .byte 93
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..11
+  .data
+.L..11:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 91
+  .byte 52
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..10
+  .data
+.L..10:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 42
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..9
+  .data
+.L..9:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..8
+  .data
+.L..8:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 120
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 105
+  .byte 122
+  .byte 101
+  .byte 111
+  .byte 102
+  .byte 40
+  .byte 120
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..7
+  .data
+.L..7:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 49
+  .byte 50
+  .byte 51
+  .byte 43
+  .byte 98
+  .byte 97
+  .byte 114
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..6
+  .data
+.L..6:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 111
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..5
+  .data
+.L..5:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 98
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 43
+  .byte 98
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..4
+  .data
+.L..4:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 122
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 43
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..3
+  .data
+.L..3:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..2
+  .data
+.L..2:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 122
+  .byte 61
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 43
+  .byte 122
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..1
+  .data
+.L..1:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..0
+  .data
+.L..0:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 61
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .globl g2
+  .bss
+g2:
+  .zero 16
+  .globl g1
+  .bss
+g1:
+  .zero 4
+  .globl main
+  .text
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 704
+  mov [rbp-680], rbx
+  mov [rbp-688], r12
+  mov [rbp-696], r13
+.L.body.main:
+  .loc 1 42
+  mov dword ptr [rbp-672], 3
+  .loc 1 42
+  movsxd rax, dword ptr [rbp-672]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..0[rip]
+  call assert
+  .loc 1 43
+  mov dword ptr [rbp-668], 3
+  .loc 1 43
+  movsxd rax, dword ptr [rbp-668]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..1[rip]
+  call assert
+  .loc 1 44
+  mov dword ptr [rbp-664], 3
+  .loc 1 44
+  mov dword ptr [rbp-660], 5
+  .loc 1 44
+  movsxd rax, dword ptr [rbp-664]
+  add eax, dword ptr [rbp-660]
+  mov rsi, rax
+  mov edi, 8
+  lea rdx, .L..2[rip]
+  call assert
+  .loc 1 45
+  mov dword ptr [rbp-656], 3
+  .loc 1 45
+  movsxd rax, dword ptr [rbp-656]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..3[rip]
+  call assert
+  .loc 1 46
+  mov dword ptr [rbp-652], 3
+  .loc 1 46
+  mov dword ptr [rbp-648], 5
+  .loc 1 46
+  movsxd rax, dword ptr [rbp-652]
+  add eax, dword ptr [rbp-648]
+  mov rsi, rax
+  mov edi, 8
+  lea rdx, .L..4[rip]
+  call assert
+  .loc 1 47
+  mov eax, 3
+  mov dword ptr [rbp-640], eax
+  mov dword ptr [rbp-644], eax
+  .loc 1 47
+  movsxd rax, eax
+  add eax, dword ptr [rbp-640]
+  mov rsi, rax
+  mov edi, 6
+  lea rdx, .L..5[rip]
+  call assert
+  .loc 1 48
+  mov dword ptr [rbp-636], 3
+  .loc 1 48
+  movsxd rax, dword ptr [rbp-636]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..6[rip]
+  call assert
+  .loc 1 49
+  mov dword ptr [rbp-632], 3
+  .loc 1 49
+  mov dword ptr [rbp-628], 5
+  .loc 1 49
+  movsxd rax, dword ptr [rbp-632]
+  add eax, dword ptr [rbp-628]
+  mov rsi, rax
+  mov edi, 8
+  lea rdx, .L..7[rip]
+  call assert
+  .loc 1 50
+  mov eax, 4
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..8[rip]
+  call assert
+  .loc 1 51
+  mov eax, 4
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..9[rip]
+  call assert
+  .loc 1 52
+  mov eax, 8
+  mov rsi, rax
+  mov edi, 8
+  lea rdx, .L..10[rip]
+  call assert
+  .loc 1 53
+  mov eax, 16
+  mov rsi, rax
+  mov edi, 16
+  lea rdx, .L..11[rip]
+  call assert
+  .loc 1 54
+  mov eax, 48
+  mov rsi, rax
+  mov edi, 48
+  lea rdx, .L..12[rip]
+  call assert
+  .loc 1 55
+  mov eax, 16
+  mov rsi, rax
+  mov edi, 16
+  lea rdx, .L..13[rip]
+  call assert
+  .loc 1 56
+  mov eax, 4
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..14[rip]
+  call assert
+  .loc 1 57
+  mov eax, 5
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..15[rip]
+  call assert
+  .loc 1 58
+  mov eax, 5
+  mov rsi, rax
+  mov edi, 5
+  lea rdx, .L..16[rip]
+  call assert
+  .loc 1 59
+  mov eax, 4
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..17[rip]
+  call assert
+  .loc 1 60
+  mov dword ptr [rbp-300], 1
+  .loc 1 60
+  mov eax, 4
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..18[rip]
+  call assert
+  .loc 1 61
+  mov dword ptr [rbp-296], 1
+  .loc 1 61
+  movsxd rax, dword ptr [rbp-296]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..19[rip]
+  call assert
+  .loc 1 62
+  xor edi, edi
+  mov esi, dword ptr g1[rip]
+  lea rdx, .L..20[rip]
+  call assert
+  .loc 1 63
+  mov dword ptr g1[rip], 3
+  .loc 1 63
+  movsxd rax, dword ptr g1[rip]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..21[rip]
+  call assert
+  .loc 1 64
+  mov dword ptr g2[rip], 0
+  .loc 1 64
+  mov dword ptr g2+4[rip], 1
+  .loc 1 64
+  mov dword ptr g2+8[rip], 2
+  .loc 1 64
+  mov dword ptr g2+12[rip], 3
+  .loc 1 64
+  movsxd rax, dword ptr g2[rip]
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..22[rip]
+  call assert
+  .loc 1 65
+  mov dword ptr g2[rip], 0
+  .loc 1 65
+  mov dword ptr g2+4[rip], 1
+  .loc 1 65
+  mov dword ptr g2+8[rip], 2
+  .loc 1 65
+  mov dword ptr g2+12[rip], 3
+  .loc 1 65
+  movsxd rax, dword ptr g2+4[rip]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..23[rip]
+  call assert
+  .loc 1 66
+  mov dword ptr g2[rip], 0
+  .loc 1 66
+  mov dword ptr g2+4[rip], 1
+  .loc 1 66
+  mov dword ptr g2+8[rip], 2
+  .loc 1 66
+  mov dword ptr g2+12[rip], 3
+  .loc 1 66
+  movsxd rax, dword ptr g2+8[rip]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..24[rip]
+  call assert
+  .loc 1 67
+  mov dword ptr g2[rip], 0
+  .loc 1 67
+  mov dword ptr g2+4[rip], 1
+  .loc 1 67
+  mov dword ptr g2+8[rip], 2
+  .loc 1 67
+  mov dword ptr g2+12[rip], 3
+  .loc 1 67
+  movsxd rax, dword ptr g2+12[rip]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..25[rip]
+  call assert
+  .loc 1 68
+  mov edi, 4
+  mov esi, 4
+  lea rdx, .L..26[rip]
+  call assert
+  .loc 1 69
+  mov edi, 16
+  mov esi, 16
+  lea rdx, .L..27[rip]
+  call assert
+  .loc 1 70
+  mov byte ptr [rbp-292], 1
+  .loc 1 70
+  movsx eax, byte ptr [rbp-292]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..28[rip]
+  call assert
+  .loc 1 71
+  mov byte ptr [rbp-291], 1
+  .loc 1 71
+  mov byte ptr [rbp-290], 2
+  .loc 1 71
+  movsx eax, byte ptr [rbp-291]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..29[rip]
+  call assert
+  .loc 1 72
+  mov byte ptr [rbp-289], 1
+  .loc 1 72
+  mov byte ptr [rbp-288], 2
+  .loc 1 72
+  movsx eax, byte ptr [rbp-288]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..30[rip]
+  call assert
+  .loc 1 73
+  mov eax, 1
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..31[rip]
+  call assert
+  .loc 1 74
+  mov eax, 10
+  mov rsi, rax
+  mov edi, 10
+  lea rdx, .L..32[rip]
+  call assert
+  .loc 1 75
+  mov dword ptr [rbp-276], 2
+  .loc 1 75
+  mov dword ptr [rbp-272], 3
+  .loc 1 75
+  movsxd rax, dword ptr [rbp-276]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..33[rip]
+  call assert
+  .loc 1 76
+  mov dword ptr [rbp-268], 2
+  .loc 1 76
+  mov dword ptr [rbp-264], 3
+  .loc 1 76
+  mov dword ptr [rbp-260], 4
+  .loc 1 76
+  movsxd rax, dword ptr [rbp-268]
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..34[rip]
+  call assert
+  .loc 1 77
+  mov dword ptr [rbp-256], 2
+  .loc 1 77
+  mov dword ptr [rbp-256], 3
+  .loc 1 77
+  movsxd rax, dword ptr [rbp-256]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..35[rip]
+  call assert
+  .loc 1 78
+  lea rax, [rbp-248]
+  mov qword ptr [rbp-240], rax
+  .loc 1 78
+  lea rax, [rbp-241]
+  mov qword ptr [rbp-232], rax
+  .loc 1 78
+  sub rax, qword ptr [rbp-240]
+  mov rsi, rax
+  mov edi, 7
+  lea rdx, .L..36[rip]
+  call assert
+  .loc 1 79
+  lea rax, [rbp-213]
+  mov qword ptr [rbp-208], rax
+  .loc 1 79
+  lea rax, [rbp-212]
+  mov qword ptr [rbp-200], rax
+  .loc 1 79
+  sub rax, qword ptr [rbp-208]
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..37[rip]
+  call assert
+  .loc 1 80
+  mov eax, 8
+  mov rsi, rax
+  mov edi, 8
+  lea rdx, .L..38[rip]
+  call assert
+  .loc 1 81
+  mov eax, 2
+  mov rsi, rax
+  mov edi, 2
+  lea rdx, .L..39[rip]
+  call assert
+  .loc 1 82
+  mov eax, 24
+  mov rsi, rax
+  mov edi, 24
+  lea rdx, .L..40[rip]
+  call assert
+  .loc 1 83
+  mov eax, 8
+  mov rsi, rax
+  mov edi, 8
+  lea rdx, .L..41[rip]
+  call assert
+  .loc 1 84
+  mov eax, 1
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..42[rip]
+  call assert
+  .loc 1 85
+  mov eax, 3
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..43[rip]
+  call assert
+  .loc 1 86
+  mov eax, 12
+  mov rsi, rax
+  mov edi, 12
+  lea rdx, .L..44[rip]
+  call assert
+  .loc 1 87
+  mov eax, 4
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..45[rip]
+  call assert
+  .loc 1 88
+  lea rax, [rbp-84]
+  mov qword ptr [rbp-112], rax
+  .loc 1 88
+  mov byte ptr [rbp-84], 3
+  .loc 1 88
+  mov rax, qword ptr [rbp-112]
+  movsx eax, byte ptr [rax]
+  mov rsi, rax
+  mov edi, 3
+  lea rdx, .L..46[rip]
+  call assert
+  .loc 1 89
+  lea rax, [rbp-83]
+  mov qword ptr [rbp-80], rax
+  .loc 1 89
+  mov byte ptr [rax], 4
+  .loc 1 89
+  mov rax, qword ptr [rbp-80]
+  movsx eax, byte ptr [rax]
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..47[rip]
+  call assert
+  .loc 1 91
+  mov byte ptr [rbp-59], 127
+  .loc 1 91
+  inc byte ptr [rbp-59]
+  movsx eax, byte ptr [rbp-59]
+  add eax, -1
+  movsx eax, al
+  .loc 1 91
+  movsx eax, byte ptr [rbp-59]
+  mov rsi, rax
+  mov edi, -128
+  lea rdx, .L..48[rip]
+  call assert
+  .loc 1 92
+  mov word ptr [rbp-58], 32767
+  .loc 1 92
+  inc word ptr [rbp-58]
+  .loc 1 92
+  movsx eax, word ptr [rbp-58]
+  mov rsi, rax
+  mov edi, -32768
+  lea rdx, .L..49[rip]
+  call assert
+  .loc 1 93
+  mov dword ptr [rbp-56], 2147483647
+  .loc 1 93
+  movsxd rax, dword ptr [rbp-56]
+  mov r13, rax
+  .loc 1 93
+  mov rax, r13
+  shl rax, 1
+  add rax, 1
+  mov r13, rax
+  .loc 1 93
+  mov rax, r13
+  mov dword ptr [rbp-56], eax
+  .loc 1 93
+  movsxd rax, eax
+  mov rsi, rax
+  mov edi, -1
+  lea rdx, .L..50[rip]
+  call assert
+  .loc 1 94
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 94
+  xor eax, eax
+  movsxd rbx, eax
+  cmp ebx, 10
+  jge .L..51
+.L.begin.1:
+  .loc 1 94
+  mov rax, rbx
+  add r12d, eax
+  movsxd r12, r12d
+.L..52:
+  .loc 1 94
+  add ebx, 1
+  movsxd rbx, ebx
+  mov rax, rbx
+  add eax, -1
+.L.cond.1:
+  cmp ebx, 10
+  jl .L.begin.1
+.L..51:
+  .loc 1 94
+  mov rax, r12
+  mov rsi, rax
+  mov edi, 45
+  lea rdx, .L..53[rip]
+  call assert
+  .loc 1 95
+  mov dword ptr [rbp-52], 3
+  .loc 1 95
+  lea rax, [rbp-52]
+  mov qword ptr [rbp-48], rax
+  .loc 1 95
+  mov dword ptr [rax], 7
+  .loc 1 95
+  movsxd rax, dword ptr [rbp-52]
+  mov rsi, rax
+  mov edi, 7
+  lea rdx, .L..54[rip]
+  call assert
+  .loc 1 96
+  mov qword ptr [rbp-40], 1
+  .loc 1 96
+  mov qword ptr [rbp-32], 1
+  .loc 1 96
+  mov qword ptr [rbp-24], 1
+  .loc 1 96
+  mov qword ptr [rbp-16], 1
+  .loc 1 96
+  mov qword ptr [rbp-8], 0
+  .loc 1 96
+  mov rax, qword ptr [rbp-40]
+  add rax, qword ptr [rbp-32]
+  add rax, qword ptr [rbp-24]
+  add rax, qword ptr [rbp-16]
+  mov qword ptr [rbp-8], rax
+  .loc 1 96
+  mov rsi, rax
+  mov edi, 4
+  lea rdx, .L..55[rip]
+  call assert
+  .loc 1 97
+  lea rdi, .L..56[rip]
+  xor eax, eax
+  call printf
+  .loc 1 98
+  xor eax, eax
+.L.return.main:
+  mov rbx, [rbp-680]
+  mov r12, [rbp-688]
+  mov r13, [rbp-696]
+  mov rsp, rbp
+  pop rbp
+  ret
@@ -0,0 +1,118 @@
+#include "test.h"
+
+char c1[100], c2[100], c3[100];
+short s1[100], s2[100], s3[100];
+int i1[100], i2[100], i3[100];
+long l1[100], l2[100], l3[100];
+
+// whileはベクトル化しないので、結果をこれと比べる
+void fill(int seed) {
+  int i = 0;
+  while (i < 100) {
+    c1[i] = i * seed + 7; c2[i] = 100 - i * 3; c3[i] = 0;
+    s1[i] = i * seed * 300 - 5000; s2[i] = i * 77; s3[i] = 0;
+    i1[i] = i * seed * 1000003 - 99; i2[i] = i * -12345; i3[i] = 0;
+    l1[i] = i * seed * 100000000007; l2[i] = 5 - i; l3[i] = 0;
+    i++;
+  }
+}
+
+void add_int(int *d, int *a, int *b, int n) { for (int i = 0; i < n; i++) d[i] = a[i] + b[i]; }
+void sub_short(short *d, short *a, short *b, int n) { for (int i = 0; i < n; i++) d[i] = a[i] - b[i]; }
+void xor_char(char *d, char *a, char k, int n) { for (int i = 0; i < n; i++) d[i] = a[i] ^ k; }
+void and_long(long *d, long *a, long *b, int n) { for (int i = 0; i <= n - 1; i++) d[i] = a[i] & b[i]; }
+void or_inplace(int *d, int *a, int n) { for (int i = 0; i < n; i++) d[i] = d[i] | a[i]; }
+void shift_char(char *d, int n) { for (int i = 0; i < n; i++) d[i + 1] = d[i] + 1; }
+
+int checksum(char *a, int n) { int s = 0; for (int i = 0; i < n; i++) s = s + a[i]; return s; }
+long sum_short(short *a, int n) { long s = 0; for (int i = 0; i < n; i++) s = s + a[i]; return s; }
+int xor_int(int *a, int n) { int s = 0; for (int i = 0; i < n; i++) s = a[i] ^ s; return s; }
+long and_long_all(long *a, int n) { long s = -1; for (int i = 0; i < n; i++) s = s & a[i]; return s; }
+int min_int(int *a, int n) { int m = 1000000000; for (int i = 0; i < n; i++) if (a[i] < m) m = a[i]; return m; }
+int max_short(short *a, int n) { int m = -100000; for (int i = 0; i < n; i++) if (m < a[i]) m = a[i]; return m; }
+int max_char(char *a, int n) { char m = -128; for (int i = 0; i < n; i++) if (m < a[i]) m = a[i]; return m; }
+_Bool bool_add(char *a, int n) { _Bool b = 0; for (int i = 0; i < n; i++) b = b + a[i]; return b; }
+_Bool bool_xor(char *a, int n) { _Bool b = 0; for (int i = 0; i < n; i++) b = b ^ a[i]; return b; }
+_Bool bool_min(int *a, int n) { _Bool m = 1; for (int i = 0; i < n; i++) if (a[i] < m) m = a[i]; return m; }
+long min_long(long *a, int n) { long m = 0; for (int i = 0; i < n; i++) if (a[i] < m) m = a[i]; return m; }
+
+struct V { int n; int *d; };
+void add_field(struct V *v, int *b, int n) { for (int i = 0; i < n; i++) b[i] = v->d[i] + 1; }
+int sum_field(struct V *v, int n) { int s = 0; for (int i = 0; i < n; i++) s = s + v->d[i]; return s; }
+
+// 長さ0から40までベクトル化したループの結果をwhileの結果と比べ、食い違った数を返す
+int check_maps(int seed) {
+  int bad = 0;
+  for (int n = 0; n <= 40; n++) {
+    fill(seed);
+    add_int(i3, i1, i2, n);
+    sub_short(s3, s1, s2, n);
+    xor_char(c3, c1, 0x5a, n);
+    and_long(l3, l1, l2, n);
+    or_inplace(i2, i1, n);
+    int i = 0;
+    while (i < 100) {
+      int in = i < n;
+      if (i3[i] != (in ? i1[i] + i * -12345 : 0)) bad++;
+      if (s3[i] != (in ? (short)(s1[i] - s2[i]) : 0)) bad++;
+      if (c3[i] != (in ? (char)(c1[i] ^ 0x5a) : 0)) bad++;
+      if (l3[i] != (in ? (l1[i] & l2[i]) : 0)) bad++;
+      if (i2[i] != (in ? (i1[i] | i * -12345) : i * -12345)) bad++;
+      i++;
+    }
+  }
+  return bad;
+}
+
+int check_reductions(int seed) {
+  int bad = 0;
+  for (int n = 0; n <= 40; n++) {
+    fill(seed);
+    int cs = 0, xi = 0, mi = 1000000000, ms = -100000, mc = -128;
+    long ss = 0, al = -1;
+    int i = 0;
+    while (i < n) {
+      cs = cs + c1[i];
+      ss = ss + s1[i];
+      xi = xi ^ i1[i];
+      al = al & l1[i];
+      if (i1[i] < mi) mi = i1[i];
+      if (s1[i] > ms) ms = s1[i];
+      if (c1[i] > mc) mc = c1[i];
+      i++;
+    }
+    bad += checksum(c1, n) != cs;
+    bad += sum_short(s1, n) != ss;
+    bad += xor_int(i1, n) != xi;
+    bad += and_long_all(l1, n) != al;
+    bad += min_int(i1, n) != mi;
+    bad += max_short(s1, n) != ms;
+    bad += max_char(c1, n) != mc;
+  }
+  return bad;
+}
+
+int main() {
+  ASSERT(0, check_maps(1));
+  ASSERT(0, check_maps(37));
+  ASSERT(0, check_reductions(1));
+  ASSERT(0, check_reductions(37));
+
+  ASSERT(13, ({ char d[20]; d[0] = 1; shift_char(d, 12); d[12]; }));
+  ASSERT(20, ({ char d[40]; d[0] = 3; shift_char(d, 17); d[17]; }));
+  ASSERT(-2048, ({ char a[16]; for (int i = 0; i < 16; i++) a[i] = -128; checksum(a, 16); }));
+  ASSERT(120, ({ char a[16]; for (int i = 0; i < 16; i++) a[i] = i; checksum(a, 16); }));
+  ASSERT(-3, ({ long a[20]; for (int i = 0; i < 20; i++) a[i] = (i % 7) - 3; min_long(a, 20); }));
+  ASSERT(127, ({ char a[33]; for (int i = 0; i < 33; i++) a[i] = i * 5; a[31] = 127; max_char(a, 33); }));
+
+  ASSERT(0, ({ char a[32]={2,-1}; bool_add(a, 32); }));
+  ASSERT(1, ({ char a[32]; for (int i = 0; i < 32; i++) a[i] = 2; bool_xor(a, 32); }));
+  ASSERT(0, ({ int a[16]={-5,0}; for (int i = 2; i < 16; i++) a[i] = 1; bool_min(a, 16); }));
+
+  // 1回も回らないループではv->dを読まない
+  ASSERT(0, ({ add_field(0, 0, 0); sum_field(0, 0); }));
+  ASSERT(38, ({ int a[9]={1,2,3,4,5,6,7,8,9}; int b[9]; struct V v={9,a}; add_field(&v, b, 9); b[8] + sum_field(&v, 5) + 13; }));
+
+  printf("OK\n");
+  return 0;
+}
@@ -0,0 +1,5582 @@
+.file 1 "-"
+.intel_syntax noprefix
+  .local .L..76
+  .data
+.L..76:
+  .byte 79
+  .byte 75
+  .byte 10
+  .byte 0
+  .local .L..75
+  .data
+.L..75:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 57
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 49
+  .byte 44
+  .byte 50
+  .byte 44
+  .byte 51
+  .byte 44
+  .byte 52
+  .byte 44
+  .byte 53
+  .byte 44
+  .byte 54
+  .byte 44
+  .byte 55
+  .byte 44
+  .byte 56
+  .byte 44
+  .byte 57
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 98
+  .byte 91
+  .byte 57
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 116
+  .byte 114
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 32
+  .byte 86
+  .byte 32
+  .byte 118
+  .byte 61
+  .byte 123
+  .byte 57
+  .byte 44
+  .byte 97
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 102
+  .byte 105
+  .byte 101
+  .byte 108
+  .byte 100
+  .byte 40
+  .byte 38
+  .byte 118
+  .byte 44
+  .byte 32
+  .byte 98
+  .byte 44
+  .byte 32
+  .byte 57
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 91
+  .byte 56
+  .byte 93
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 102
+  .byte 105
+  .byte 101
+  .byte 108
+  .byte 100
+  .byte 40
+  .byte 38
+  .byte 118
+  .byte 44
+  .byte 32
+  .byte 53
+  .byte 41
+  .byte 32
+  .byte 43
+  .byte 32
+  .byte 49
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..74
+  .section .rodata
+.L..74:
+  .byte 1
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 2
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 3
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 4
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 5
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 6
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 7
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 8
+  .byte 0
+  .byte 0
+  .byte 0
+  .byte 9
+  .byte 0
+  .byte 0
+  .byte 0
+  .local .L..73
+  .data
+.L..73:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 95
+  .byte 102
+  .byte 105
+  .byte 101
+  .byte 108
+  .byte 100
+  .byte 40
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 48
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 95
+  .byte 102
+  .byte 105
+  .byte 101
+  .byte 108
+  .byte 100
+  .byte 40
+  .byte 48
+  .byte 44
+  .byte 32
+  .byte 48
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..72
+  .data
+.L..72:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 54
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 45
+  .byte 53
+  .byte 44
+  .byte 48
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 49
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 109
+  .byte 105
+  .byte 110
+  .byte 40
+  .byte 97
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 54
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..69
+  .data
+.L..69:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 51
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 50
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 120
+  .byte 111
+  .byte 114
+  .byte 40
+  .byte 97
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..66
+  .data
+.L..66:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 50
+  .byte 93
+  .byte 61
+  .byte 123
+  .byte 50
+  .byte 44
+  .byte 45
+  .byte 49
+  .byte 125
+  .byte 59
+  .byte 32
+  .byte 98
+  .byte 111
+  .byte 111
+  .byte 108
+  .byte 95
+  .byte 97
+  .byte 100
+  .byte 100
+  .byte 40
+  .byte 97
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..65
+  .data
+.L..65:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 51
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 51
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 105
+  .byte 32
+  .byte 42
+  .byte 32
+  .byte 53
+  .byte 59
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 51
+  .byte 49
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 49
+  .byte 50
+  .byte 55
+  .byte 59
+  .byte 32
+  .byte 109
+  .byte 97
+  .byte 120
+  .byte 95
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 40
+  .byte 97
+  .byte 44
+  .byte 32
+  .byte 51
+  .byte 51
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..62
+  .data
+.L..62:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 50
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 50
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 32
+  .byte 37
+  .byte 32
+  .byte 55
+  .byte 41
+  .byte 32
+  .byte 45
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 109
+  .byte 105
+  .byte 110
+  .byte 95
+  .byte 108
+  .byte 111
+  .byte 110
+  .byte 103
+  .byte 40
+  .byte 97
+  .byte 44
+  .byte 32
+  .byte 50
+  .byte 48
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..59
+  .data
+.L..59:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 54
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 49
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 105
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 101
+  .byte 99
+  .byte 107
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 40
+  .byte 97
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 54
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..56
+  .data
+.L..56:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 49
+  .byte 54
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 102
+  .byte 111
+  .byte 114
+  .byte 32
+  .byte 40
+  .byte 105
+  .byte 110
+  .byte 116
+  .byte 32
+  .byte 105
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 48
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 32
+  .byte 60
+  .byte 32
+  .byte 49
+  .byte 54
+  .byte 59
+  .byte 32
+  .byte 105
+  .byte 43
+  .byte 43
+  .byte 41
+  .byte 32
+  .byte 97
+  .byte 91
+  .byte 105
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 45
+  .byte 49
+  .byte 50
+  .byte 56
+  .byte 59
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 101
+  .byte 99
+  .byte 107
+  .byte 115
+  .byte 117
+  .byte 109
+  .byte 40
+  .byte 97
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 54
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..53
+  .data
+.L..53:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 52
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 51
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 105
+  .byte 102
+  .byte 116
+  .byte 95
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 40
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 55
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 49
+  .byte 55
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..52
+  .data
+.L..52:
+  .byte 40
+  .byte 123
+  .byte 32
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 50
+  .byte 48
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 48
+  .byte 93
+  .byte 32
+  .byte 61
+  .byte 32
+  .byte 49
+  .byte 59
+  .byte 32
+  .byte 115
+  .byte 104
+  .byte 105
+  .byte 102
+  .byte 116
+  .byte 95
+  .byte 99
+  .byte 104
+  .byte 97
+  .byte 114
+  .byte 40
+  .byte 100
+  .byte 44
+  .byte 32
+  .byte 49
+  .byte 50
+  .byte 41
+  .byte 59
+  .byte 32
+  .byte 100
+  .byte 91
+  .byte 49
+  .byte 50
+  .byte 93
+  .byte 59
+  .byte 32
+  .byte 125
+  .byte 41
+  .byte 0
+  .local .L..51
+  .data
+.L..51:
+  .byte 99
+  .byte 104
+  .byte 101
+  .byte 99
+  .byte 107
+  .byte 95
+  .byte 114
+  .byte 101
+  .byte 100
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 105
+  .byte 111
+  .byte 110
+  .byte 115
+  .byte 40
+  .byte 51
+  .byte 55
+  .byte 41
+  .byte 0
+  .local .L..50
+  .data
+.L..50:
+  .byte 99
+  .byte 104
+  .byte 101
+  .byte 99
+  .byte 107
+  .byte 95
+  .byte 114
+  .byte 101
+  .byte 100
+  .byte 117
+  .byte 99
+  .byte 116
+  .byte 105
+  .byte 111
+  .byte 110
+  .byte 115
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 0
+  .local .L..49
+  .data
+.L..49:
+  .byte 99
+  .byte 104
+  .byte 101
+  .byte 99
+  .byte 107
+  .byte 95
+  .byte 109
+  .byte 97
+  .byte 112
+  .byte 115
+  .byte 40
+  .byte 51
+  .byte 55
+  .byte 41
+  .byte 0
+  .local .L..48
+  .data
+.L..48:
+  .byte 99
+  .byte 104
+  .byte 101
+  .byte 99
+  .byte 107
+  .byte 95
+  .byte 109
+  .byte 97
+  .byte 112
+  .byte 115
+  .byte 40
+  .byte 49
+  .byte 41
+  .byte 0
+  .globl l3
+  .bss
+l3:
+  .zero 800
+  .globl l2
+  .bss
+l2:
+  .zero 800
+  .globl l1
+  .bss
+l1:
+  .zero 800
+  .globl i3
+  .bss
+i3:
+  .zero 400
+  .globl i2
+  .bss
+i2:
+  .zero 400
+  .globl i1
+  .bss
+i1:
+  .zero 400
+  .globl s3
+  .bss
+s3:
+  .zero 200
+  .globl s2
+  .bss
+s2:
+  .zero 200
+  .globl s1
+  .bss
+s1:
+  .zero 200
+  .globl c3
+  .bss
+c3:
+  .zero 100
+  .globl c2
+  .bss
+c2:
+  .zero 100
+  .globl c1
+  .bss
+c1:
+  .zero 100
+  .globl main
+  .text
+main:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 560
+  mov [rbp-528], rbx
+  mov [rbp-536], r12
+  mov [rbp-544], r13
+  mov [rbp-552], r14
+.L.body.main:
+  .loc 1 126
+  mov edi, 1
+  call check_maps
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..48[rip]
+  call assert
+  .loc 1 127
+  mov edi, 37
+  call check_maps
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..49[rip]
+  call assert
+  .loc 1 128
+  mov edi, 1
+  call check_reductions
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..50[rip]
+  call assert
+  .loc 1 129
+  mov edi, 37
+  call check_reductions
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..51[rip]
+  call assert
+  .loc 1 130
+  mov byte ptr [rbp-520], 1
+  .loc 1 130
+  lea rdi, [rbp-520]
+  mov esi, 12
+  call shift_char
+  .loc 1 130
+  movsx eax, byte ptr [rbp-508]
+  mov rsi, rax
+  mov edi, 13
+  lea rdx, .L..52[rip]
+  call assert
+  .loc 1 131
+  mov byte ptr [rbp-500], 3
+  .loc 1 131
+  lea rdi, [rbp-500]
+  mov esi, 17
+  call shift_char
+  .loc 1 131
+  movsx eax, byte ptr [rbp-483]
+  mov rsi, rax
+  mov edi, 20
+  lea rdx, .L..53[rip]
+  call assert
+  .loc 1 132
+  mov dword ptr [rbp-444], 0
+  cmp dword ptr [rbp-444], 16
+  jge .L..54
+.L.begin.1:
+  .loc 1 132
+  movsxd rax, dword ptr [rbp-444]
+  mov byte ptr [rbp+rax*1-460], -128
+.L..55:
+  .loc 1 132
+  inc dword ptr [rbp-444]
+  movsxd rax, dword ptr [rbp-444]
+  add eax, -1
+.L.cond.1:
+  cmp dword ptr [rbp-444], 16
+  jl .L.begin.1
+.L..54:
+  .loc 1 132
+  lea rdi, [rbp-460]
+  mov esi, 16
+  call checksum
+  mov rsi, rax
+  mov edi, -2048
+  lea rdx, .L..56[rip]
+  call assert
+  .loc 1 133
+  xor eax, eax
+  movsxd r13, eax
+  cmp r13d, 16
+  jge .L..57
+.L.begin.2:
+  .loc 1 133
+  mov rax, r13
+  movsx eax, al
+  mov byte ptr [rbp+r13*1-440], al
+.L..58:
+  .loc 1 133
+  add r13d, 1
+  movsxd r13, r13d
+  mov rax, r13
+  add eax, -1
+.L.cond.2:
+  cmp r13d, 16
+  jl .L.begin.2
+.L..57:
+  .loc 1 133
+  lea rdi, [rbp-440]
+  mov esi, 16
+  call checksum
+  mov rsi, rax
+  mov edi, 120
+  lea rdx, .L..59[rip]
+  call assert
+  .loc 1 134
+  xor eax, eax
+  movsxd r12, eax
+  cmp r12d, 20
+  jge .L..60
+.L.begin.3:
+  .loc 1 134
+  mov rax, r12
+  movsxd rdx, eax
+  mov edi, eax
+  mov rcx, 2454267027
+  imul rcx, rdx
+  sar rcx, 34
+  shr edx, 31
+  lea eax, [rcx+rdx]
+  imul eax, eax, 7
+  sub edi, eax
+  mov eax, edi
+  sub eax, 3
+  movsxd rax, eax
+  mov qword ptr [rbp+r12*8-424], rax
+.L..61:
+  .loc 1 134
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  add eax, -1
+.L.cond.3:
+  cmp r12d, 20
+  jl .L.begin.3
+.L..60:
+  .loc 1 134
+  lea rdi, [rbp-424]
+  mov esi, 20
+  call min_long
+  mov rsi, rax
+  mov edi, -3
+  lea rdx, .L..62[rip]
+  call assert
+  .loc 1 135
+  xor eax, eax
+  movsxd rbx, eax
+  cmp ebx, 33
+  jge .L..63
+.L.begin.4:
+  .loc 1 135
+  mov rax, rbx
+  lea eax, [rax+rax*4]
+  movsx eax, al
+  mov byte ptr [rbp+rbx*1-257], al
+.L..64:
+  .loc 1 135
+  add ebx, 1
+  movsxd rbx, ebx
+  mov rax, rbx
+  add eax, -1
+.L.cond.4:
+  cmp ebx, 33
+  jl .L.begin.4
+.L..63:
+  .loc 1 135
+  mov byte ptr [rbp-226], 127
+  .loc 1 135
+  lea rdi, [rbp-257]
+  mov esi, 33
+  call max_char
+  mov rsi, rax
+  mov edi, 127
+  lea rdx, .L..65[rip]
+  call assert
+  .loc 1 136
+  pxor xmm0, xmm0
+  movdqu [rbp-222], xmm0
+  mov qword ptr [rbp-206], 0
+  mov dword ptr [rbp-198], 0
+  mov word ptr [rbp-194], 0
+  .loc 1 136
+  mov eax, 2
+  mov byte ptr [rbp-224], al
+  .loc 1 136
+  mov eax, -1
+  mov byte ptr [rbp-223], al
+  .loc 1 136
+  lea rdi, [rbp-224]
+  mov esi, 32
+  call bool_add
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..66[rip]
+  call assert
+  .loc 1 137
+  mov dword ptr [rbp-160], 0
+  cmp dword ptr [rbp-160], 32
+  jge .L..67
+.L.begin.5:
+  .loc 1 137
+  movsxd rax, dword ptr [rbp-160]
+  mov byte ptr [rbp+rax*1-192], 2
+.L..68:
+  .loc 1 137
+  inc dword ptr [rbp-160]
+  movsxd rax, dword ptr [rbp-160]
+  add eax, -1
+.L.cond.5:
+  cmp dword ptr [rbp-160], 32
+  jl .L.begin.5
+.L..67:
+  .loc 1 137
+  lea rdi, [rbp-192]
+  mov esi, 32
+  call bool_xor
+  mov rsi, rax
+  mov edi, 1
+  lea rdx, .L..69[rip]
+  call assert
+  .loc 1 138
+  pxor xmm0, xmm0
+  movdqu [rbp-148], xmm0
+  movdqu [rbp-132], xmm0
+  movdqu [rbp-116], xmm0
+  mov qword ptr [rbp-100], 0
+  .loc 1 138
+  mov eax, -5
+  mov dword ptr [rbp-156], eax
+  .loc 1 138
+  xor eax, eax
+  mov dword ptr [rbp-152], eax
+  .loc 1 138
+  mov dword ptr [rbp-92], 2
+  cmp dword ptr [rbp-92], 16
+  jge .L..70
+.L.begin.6:
+  .loc 1 138
+  movsxd rax, dword ptr [rbp-92]
+  mov dword ptr [rbp+rax*4-156], 1
+.L..71:
+  .loc 1 138
+  inc dword ptr [rbp-92]
+  movsxd rax, dword ptr [rbp-92]
+  add eax, -1
+.L.cond.6:
+  cmp dword ptr [rbp-92], 16
+  jl .L.begin.6
+.L..70:
+  .loc 1 138
+  lea rdi, [rbp-156]
+  mov esi, 16
+  call bool_min
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..72[rip]
+  call assert
+  .loc 1 140
+  xor edi, edi
+  xor esi, esi
+  xor edx, edx
+  call add_field
+  .loc 1 140
+  xor edi, edi
+  xor esi, esi
+  call sum_field
+  mov rsi, rax
+  xor edi, edi
+  lea rdx, .L..73[rip]
+  call assert
+  .loc 1 141
+  lea rax, [rbp-88]
+  mov r14, rax
+  .loc 1 141
+  lea rax, .L..74[rip]
+  mov rdi, r14
+  movdqu xmm0, [rax+0]
+  movdqu [rdi+0], xmm0
+  movdqu xmm0, [rax+16]
+  movdqu [rdi+16], xmm0
+  mov r8d, [rax+32]
+  mov [rdi+32], r8d
+  .loc 1 141
+  mov dword ptr [rbp-12], 0
+  .loc 1 141
+  mov eax, 9
+  mov dword ptr [rbp-16], eax
+  .loc 1 141
+  lea rax, [rbp-88]
+  mov qword ptr [rbp-8], rax
+  .loc 1 141
+  lea rdi, [rbp-16]
+  lea rsi, [rbp-52]
+  mov edx, 9
+  call add_field
+  .loc 1 141
+  lea rdi, [rbp-16]
+  mov esi, 5
+  call sum_field
+  add eax, dword ptr [rbp-20]
+  add eax, 13
+  mov rsi, rax
+  mov edi, 38
+  lea rdx, .L..75[rip]
+  call assert
+  .loc 1 142
+  lea rdi, .L..76[rip]
+  xor eax, eax
+  call printf
+  .loc 1 143
+  xor eax, eax
+.L.return.main:
+  mov rbx, [rbp-528]
+  mov r12, [rbp-536]
+  mov r13, [rbp-544]
+  mov r14, [rbp-552]
+  mov rsp, rbp
+  pop rbp
+  ret
+  .globl check_reductions
+  .text
+check_reductions:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 64
+  mov [rbp-48], rbx
+  mov [rbp-56], r12
+  mov [rbp-64], r13
+  mov [rbp-36], edi
+.L.body.check_reductions:
+  .loc 1 99
+  mov dword ptr [rbp-32], 0
+  .loc 1 100
+  xor eax, eax
+  movsxd r12, eax
+  cmp r12d, 40
+  jg .L..44
+.L.begin.7:
+  .loc 1 101
+  mov edi, dword ptr [rbp-36]
+  call fill
+  .loc 1 102
+  mov dword ptr [rbp-28], 0
+  .loc 1 102
+  mov dword ptr [rbp-24], 0
+  .loc 1 102
+  mov dword ptr [rbp-20], 1000000000
+  .loc 1 102
+  mov dword ptr [rbp-16], -100000
+  .loc 1 102
+  mov dword ptr [rbp-12], -128
+  .loc 1 103
+  mov qword ptr [rbp-8], 0
+  .loc 1 103
+  mov rax, -1
+  mov r13, rax
+  .loc 1 104
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 105
+  mov rax, rbx
+  cmp eax, r12d
+  jge .L..46
+.L.begin.8:
+  .loc 1 106
+  lea rax, c1[rip]
+  movsx eax, byte ptr [rax+rbx*1]
+  add dword ptr [rbp-28], eax
+  .loc 1 107
+  lea rax, s1[rip]
+  movsx eax, word ptr [rax+rbx*2]
+  movsxd rax, eax
+  add qword ptr [rbp-8], rax
+  .loc 1 108
+  lea rax, i1[rip]
+  movsxd rax, dword ptr [rax+rbx*4]
+  xor dword ptr [rbp-24], eax
+  .loc 1 109
+  lea rax, l1[rip]
+  mov rax, qword ptr [rax+rbx*8]
+  and r13, rax
+  .loc 1 110
+  lea rax, i1[rip]
+  movsxd rax, dword ptr [rax+rbx*4]
+  cmp eax, dword ptr [rbp-20]
+  jge .L.else.9
+  .loc 1 110
+  lea rax, i1[rip]
+  movsxd rax, dword ptr [rax+rbx*4]
+  mov dword ptr [rbp-20], eax
+.L.else.9:
+.L.end.9:
+  .loc 1 111
+  lea rax, s1[rip]
+  movsx eax, word ptr [rax+rbx*2]
+  cmp eax, dword ptr [rbp-16]
+  jle .L.else.10
+  .loc 1 111
+  lea rax, s1[rip]
+  movsx eax, word ptr [rax+rbx*2]
+  mov dword ptr [rbp-16], eax
+.L.else.10:
+.L.end.10:
+  .loc 1 112
+  lea rax, c1[rip]
+  movsx eax, byte ptr [rax+rbx*1]
+  cmp eax, dword ptr [rbp-12]
+  jle .L.else.11
+  .loc 1 112
+  lea rax, c1[rip]
+  movsx eax, byte ptr [rax+rbx*1]
+  mov dword ptr [rbp-12], eax
+.L.else.11:
+.L.end.11:
+  .loc 1 113
+  add ebx, 1
+  movsxd rbx, ebx
+.L..47:
+.L.cond.8:
+  .loc 1 105
+  mov rax, rbx
+  cmp eax, r12d
+  jl .L.begin.8
+.L..46:
+  .loc 1 115
+  lea rdi, c1[rip]
+  mov esi, r12d
+  call checksum
+  cmp eax, dword ptr [rbp-28]
+  setne al
+  movzb rax, al
+  add dword ptr [rbp-32], eax
+  .loc 1 116
+  lea rdi, s1[rip]
+  mov esi, r12d
+  call sum_short
+  cmp rax, qword ptr [rbp-8]
+  setne al
+  movzb rax, al
+  add dword ptr [rbp-32], eax
+  .loc 1 117
+  lea rdi, i1[rip]
+  mov esi, r12d
+  call xor_int
+  cmp eax, dword ptr [rbp-24]
+  setne al
+  movzb rax, al
+  add dword ptr [rbp-32], eax
+  .loc 1 118
+  lea rdi, l1[rip]
+  mov esi, r12d
+  call and_long_all
+  cmp rax, r13
+  setne al
+  movzb rax, al
+  add dword ptr [rbp-32], eax
+  .loc 1 119
+  lea rdi, i1[rip]
+  mov esi, r12d
+  call min_int
+  cmp eax, dword ptr [rbp-20]
+  setne al
+  movzb rax, al
+  add dword ptr [rbp-32], eax
+  .loc 1 120
+  lea rdi, s1[rip]
+  mov esi, r12d
+  call max_short
+  cmp eax, dword ptr [rbp-16]
+  setne al
+  movzb rax, al
+  add dword ptr [rbp-32], eax
+  .loc 1 121
+  lea rdi, c1[rip]
+  mov esi, r12d
+  call max_char
+  cmp eax, dword ptr [rbp-12]
+  setne al
+  movzb rax, al
+  add dword ptr [rbp-32], eax
+.L..45:
+  add r12d, 1
+  movsxd r12, r12d
+.L.cond.7:
+  cmp r12d, 40
+  jle .L.begin.7
+.L..44:
+  .loc 1 123
+  movsxd rax, dword ptr [rbp-32]
+.L.return.check_reductions:
+  mov rbx, [rbp-48]
+  mov r12, [rbp-56]
+  mov r13, [rbp-64]
+  mov rsp, rbp
+  pop rbp
+  ret
+  .globl check_maps
+  .text
+check_maps:
+  push rbp
+  mov rbp, rsp
+  sub rsp, 48
+  mov [rbp-16], rbx
+  mov [rbp-24], r12
+  mov [rbp-32], r13
+  mov [rbp-40], r14
+  mov [rbp-8], edi
+.L.body.check_maps:
+  .loc 1 77
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 78
+  mov dword ptr [rbp-4], 0
+  cmp dword ptr [rbp-4], 40
+  jg .L..40
+.L.begin.12:
+  .loc 1 79
+  mov edi, dword ptr [rbp-8]
+  call fill
+  .loc 1 80
+  lea rdi, i3[rip]
+  lea rsi, i1[rip]
+  lea rdx, i2[rip]
+  mov ecx, dword ptr [rbp-4]
+  call add_int
+  .loc 1 81
+  lea rdi, s3[rip]
+  lea rsi, s1[rip]
+  lea rdx, s2[rip]
+  mov ecx, dword ptr [rbp-4]
+  call sub_short
+  .loc 1 82
+  lea rdi, c3[rip]
+  lea rsi, c1[rip]
+  mov edx, 90
+  mov ecx, dword ptr [rbp-4]
+  call xor_char
+  .loc 1 83
+  lea rdi, l3[rip]
+  lea rsi, l1[rip]
+  lea rdx, l2[rip]
+  mov ecx, dword ptr [rbp-4]
+  call and_long
+  .loc 1 84
+  lea rdi, i2[rip]
+  lea rsi, i1[rip]
+  mov edx, dword ptr [rbp-4]
+  call or_inplace
+  .loc 1 85
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 86
+  cmp ebx, 100
+  jge .L..42
+.L.begin.13:
+  .loc 1 87
+  mov rax, rbx
+  cmp eax, dword ptr [rbp-4]
+  setl al
+  movzb rax, al
+  movsxd r13, eax
+  .loc 1 88
+  mov rax, r13
+  test eax, eax
+  je .L.else.15
+  .loc 1 88
+  mov rax, rbx
+  imul eax, eax, -12345
+  mov r14, rax
+  .loc 1 88
+  lea rax, i1[rip]
+  movsxd rax, dword ptr [rax+rbx*4]
+  mov rdi, r14
+  add eax, edi
+  jmp .L.end.15
+.L.else.15:
+  .loc 1 88
+  xor eax, eax
+.L.end.15:
+  mov r14, rax
+  .loc 1 88
+  lea rax, i3[rip]
+  movsxd rax, dword ptr [rax+rbx*4]
+  mov rdi, r14
+  cmp eax, edi
+  je .L.else.14
+  .loc 1 88
+  add r12d, 1
+  movsxd r12, r12d
+.L.else.14:
+.L.end.14:
+  .loc 1 89
+  mov rax, r13
+  test eax, eax
+  je .L.else.17
+  .loc 1 89
+  lea rax, s2[rip]
+  movsx eax, word ptr [rax+rbx*2]
+  mov r14, rax
+  .loc 1 89
+  lea rax, s1[rip]
+  movsx eax, word ptr [rax+rbx*2]
+  mov rdi, r14
+  sub eax, edi
+  movsx eax, ax
+  jmp .L.end.17
+.L.else.17:
+  .loc 1 89
+  xor eax, eax
+.L.end.17:
+  mov r14, rax
+  .loc 1 89
+  lea rax, s3[rip]
+  movsx eax, word ptr [rax+rbx*2]
+  mov rdi, r14
+  cmp eax, edi
+  je .L.else.16
+  .loc 1 89
+  add r12d, 1
+  movsxd r12, r12d
+.L.else.16:
+.L.end.16:
+  .loc 1 90
+  mov rax, r13
+  test eax, eax
+  je .L.else.19
+  .loc 1 90
+  lea rax, c1[rip]
+  movsx eax, byte ptr [rax+rbx*1]
+  xor eax, 90
+  movsx eax, al
+  jmp .L.end.19
+.L.else.19:
+  .loc 1 90
+  xor eax, eax
+.L.end.19:
+  mov r14, rax
+  .loc 1 90
+  lea rax, c3[rip]
+  movsx eax, byte ptr [rax+rbx*1]
+  mov rdi, r14
+  cmp eax, edi
+  je .L.else.18
+  .loc 1 90
+  add r12d, 1
+  movsxd r12, r12d
+.L.else.18:
+.L.end.18:
+  .loc 1 91
+  mov rax, r13
+  test eax, eax
+  je .L.else.21
+  .loc 1 91
+  lea rax, l2[rip]
+  mov rax, qword ptr [rax+rbx*8]
+  mov r14, rax
+  .loc 1 91
+  lea rax, l1[rip]
+  mov rax, qword ptr [rax+rbx*8]
+  mov rdi, r14
+  and rax, rdi
+  jmp .L.end.21
+.L.else.21:
+  .loc 1 91
+  xor eax, eax
+.L.end.21:
+  mov r14, rax
+  .loc 1 91
+  lea rax, l3[rip]
+  mov rax, qword ptr [rax+rbx*8]
+  mov rdi, r14
+  cmp rax, rdi
+  je .L.else.20
+  .loc 1 91
+  add r12d, 1
+  movsxd r12, r12d
+.L.else.20:
+.L.end.20:
+  .loc 1 92
+  mov rax, r13
+  test eax, eax
+  je .L.else.23
+  .loc 1 92
+  mov rax, rbx
+  imul eax, eax, -12345
+  mov r14, rax
+  .loc 1 92
+  lea rax, i1[rip]
+  movsxd rax, dword ptr [rax+rbx*4]
+  mov rdi, r14
+  or rax, rdi
+  jmp .L.end.23
+.L.else.23:
+  .loc 1 92
+  mov rax, rbx
+  imul eax, eax, -12345
+.L.end.23:
+  mov r14, rax
+  .loc 1 92
+  lea rax, i2[rip]
+  movsxd rax, dword ptr [rax+rbx*4]
+  mov rdi, r14
+  cmp eax, edi
+  je .L.else.22
+  .loc 1 92
+  add r12d, 1
+  movsxd r12, r12d
+.L.else.22:
+.L.end.22:
+  .loc 1 93
+  add ebx, 1
+  movsxd rbx, ebx
+.L..43:
+.L.cond.13:
+  cmp ebx, 100
+  jl .L.begin.13
+.L..42:
+.L..41:
+  inc dword ptr [rbp-4]
+.L.cond.12:
+  cmp dword ptr [rbp-4], 40
+  jle .L.begin.12
+.L..40:
+  .loc 1 96
+  mov rax, r12
+.L.return.check_maps:
+  mov rbx, [rbp-16]
+  mov r12, [rbp-24]
+  mov r13, [rbp-32]
+  mov r14, [rbp-40]
+  mov rsp, rbp
+  pop rbp
+  ret
+  .globl sum_field
+  .text
+sum_field:
+  mov [rsp-40], rbx
+  mov [rsp-48], r12
+  mov [rsp-56], r13
+  mov [rsp-64], r14
+  mov [rsp-72], r15
+  mov r13, rdi
+  mov [rsp-28], esi
+.L.body.sum_field:
+  .loc 1 74
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 74
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 74
+  mov rax, rbx
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 74
+  movsxd rax, dword ptr [rsp-28]
+  mov rdi, r14
+  sub rax, rdi
+  mov qword ptr [rsp-24], rax
+  .loc 1 74
+  mov eax, 3
+  cmp rax, qword ptr [rsp-24]
+  jge .L.else.24
+  .loc 1 74
+  mov rax, rbx
+  movsxd rax, eax
+  shl rax, 2
+  add rax, qword ptr [r13+8]
+  mov qword ptr [rsp-16], rax
+  .loc 1 74
+  mov rax, qword ptr [rsp-24]
+  sar rax, 2
+  mov rcx, rax
+  .loc 1 74
+  mov rax, qword ptr [rsp-16]
+  mov rsi, rax
+  pxor xmm0, xmm0
+.L.vector.25:
+  movdqu xmm1, [rsi]
+  paddd xmm0, xmm1
+  add rsi, 16
+  sub rcx, 1
+  jnz .L.vector.25
+  pshufd xmm1, xmm0, 0x4e
+  paddd xmm0, xmm1
+  pshufd xmm1, xmm0, 0xb1
+  paddd xmm0, xmm1
+  movq rax, xmm0
+  movsxd rax, eax
+  mov dword ptr [rsp-4], eax
+  .loc 1 74
+  movsxd rax, eax
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 74
+  mov rax, -4
+  and rax, qword ptr [rsp-24]
+  add ebx, eax
+  movsxd rbx, ebx
+.L.else.24:
+.L.end.24:
+  .loc 1 74
+  movsxd rax, dword ptr [rsp-28]
+  mov r14, rax
+  .loc 1 74
+  mov eax, 3
+  mov r15, rax
+  .loc 1 74
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.0
+.L.begin.26:
+  .loc 1 74
+  mov rax, qword ptr [r13+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 74
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 74
+  mov rax, qword ptr [r13+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 74
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 74
+  mov rax, qword ptr [r13+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  add r12d, eax
+  movsxd r12, r12d
+  .loc 1 74
+  add ebx, 1
+  movsxd rbx, ebx
+  .loc 1 74
+  mov rax, qword ptr [r13+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  add r12d, eax
+  movsxd r12, r12d
+.L.opt.1:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.26:
+  .loc 1 74
+  movsxd rax, dword ptr [rsp-28]
+  mov r14, rax
+  .loc 1 74
+  mov eax, 3
+  mov r15, rax
+  .loc 1 74
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.26
+.L.opt.0:
+  .loc 1 74
+  mov rax, rbx
+  cmp eax, dword ptr [rsp-28]
+  jge .L..38
+.L.begin.27:
+  .loc 1 74
+  mov rax, qword ptr [r13+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  add r12d, eax
+  movsxd r12, r12d
+.L..39:
+  add ebx, 1
+  movsxd rbx, ebx
+.L.cond.27:
+  .loc 1 74
+  mov rax, rbx
+  cmp eax, dword ptr [rsp-28]
+  jl .L.begin.27
+.L..38:
+  .loc 1 74
+  mov rax, r12
+.L.return.sum_field:
+  mov rbx, [rsp-40]
+  mov r12, [rsp-48]
+  mov r13, [rsp-56]
+  mov r14, [rsp-64]
+  mov r15, [rsp-72]
+  ret
+  .globl add_field
+  .text
+add_field:
+  mov [rsp-24], rbx
+  mov [rsp-32], r12
+  mov [rsp-40], r13
+  mov [rsp-48], r14
+  mov [rsp-56], r15
+  mov r13, rdi
+  mov [rsp-8], rsi
+  mov [rsp-12], edx
+.L.body.add_field:
+  .loc 1 73
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 73
+  mov rax, qword ptr [rsp-8]
+  mov r12, rax
+  .loc 1 73
+  movsxd rax, dword ptr [rsp-12]
+  mov r14, rax
+  .loc 1 73
+  mov eax, 3
+  mov r15, rax
+  .loc 1 73
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.2
+.L.begin.28:
+  .loc 1 73
+  mov rax, qword ptr [r13+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  add eax, 1
+  mov dword ptr [r12], eax
+  .loc 1 73
+  add ebx, 1
+  movsxd rbx, ebx
+  mov rax, rbx
+  .loc 1 73
+  add r12, 4
+  mov rax, r12
+  .loc 1 73
+  mov rax, qword ptr [r13+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  add eax, 1
+  mov dword ptr [r12], eax
+  .loc 1 73
+  add ebx, 1
+  movsxd rbx, ebx
+  mov rax, rbx
+  .loc 1 73
+  add r12, 4
+  mov rax, r12
+  .loc 1 73
+  mov rax, qword ptr [r13+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  add eax, 1
+  mov dword ptr [r12], eax
+  .loc 1 73
+  add ebx, 1
+  movsxd rbx, ebx
+  mov rax, rbx
+  .loc 1 73
+  add r12, 4
+  mov rax, r12
+  .loc 1 73
+  mov rax, qword ptr [r13+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  add eax, 1
+  mov dword ptr [r12], eax
+.L.opt.3:
+  .loc 1 73
+  add ebx, 1
+  movsxd rbx, ebx
+  mov rax, rbx
+  .loc 1 73
+  add r12, 4
+  mov rax, r12
+.L.cond.28:
+  .loc 1 73
+  movsxd rax, dword ptr [rsp-12]
+  mov r14, rax
+  .loc 1 73
+  mov eax, 3
+  mov r15, rax
+  .loc 1 73
+  mov rax, rbx
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.28
+.L.opt.2:
+  .loc 1 73
+  mov rax, rbx
+  cmp eax, dword ptr [rsp-12]
+  jge .L..36
+.L.begin.29:
+  .loc 1 73
+  mov rax, qword ptr [r13+8]
+  movsxd rax, dword ptr [rax+rbx*4]
+  add eax, 1
+  mov dword ptr [r12], eax
+.L..37:
+  .loc 1 73
+  add ebx, 1
+  movsxd rbx, ebx
+  mov rax, rbx
+  .loc 1 73
+  add r12, 4
+  mov rax, r12
+.L.cond.29:
+  .loc 1 73
+  mov rax, rbx
+  cmp eax, dword ptr [rsp-12]
+  jl .L.begin.29
+.L..36:
+.L.return.add_field:
+  mov rbx, [rsp-24]
+  mov r12, [rsp-32]
+  mov r13, [rsp-40]
+  mov r14, [rsp-48]
+  mov r15, [rsp-56]
+  ret
+  .globl min_long
+  .text
+min_long:
+  mov [rsp-32], rbx
+  mov [rsp-40], r12
+  mov [rsp-48], r13
+  mov [rsp-56], r14
+  mov [rsp-64], r15
+  mov [rsp-16], rdi
+  mov [rsp-20], esi
+.L.body.min_long:
+  .loc 1 71
+  xor eax, eax
+  mov r12, rax
+  .loc 1 71
+  mov rax, qword ptr [rsp-16]
+  mov rbx, rax
+  .loc 1 71
+  movsxd rax, dword ptr [rsp-20]
+  shl rax, 3
+  add rax, qword ptr [rsp-16]
+  mov r13, rax
+  .loc 1 71
+  mov rax, r13
+  mov r14, rax
+  .loc 1 71
+  mov eax, 24
+  mov r15, rax
+  .loc 1 71
+  mov rax, rbx
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.4
+.L.begin.30:
+  .loc 1 71
+  mov rax, qword ptr [rbx]
+  cmp rax, r12
+  jge .L.else.31
+  .loc 1 71
+  mov rax, qword ptr [rbx]
+  mov r12, rax
+.L.else.31:
+.L.end.31:
+  .loc 1 71
+  add rbx, 8
+  .loc 1 71
+  mov rax, qword ptr [rbx]
+  cmp rax, r12
+  jge .L.else.32
+  .loc 1 71
+  mov rax, qword ptr [rbx]
+  mov r12, rax
+.L.else.32:
+.L.end.32:
+  .loc 1 71
+  add rbx, 8
+  .loc 1 71
+  mov rax, qword ptr [rbx]
+  cmp rax, r12
+  jge .L.else.33
+  .loc 1 71
+  mov rax, qword ptr [rbx]
+  mov r12, rax
+.L.else.33:
+.L.end.33:
+  .loc 1 71
+  add rbx, 8
+  .loc 1 71
+  mov rax, qword ptr [rbx]
+  cmp rax, r12
+  jge .L.else.34
+  .loc 1 71
+  mov rax, qword ptr [rbx]
+  mov r12, rax
+.L.else.34:
+.L.end.34:
+.L.opt.5:
+  add rbx, 8
+.L.cond.30:
+  .loc 1 71
+  mov rax, r13
+  mov r14, rax
+  .loc 1 71
+  mov eax, 24
+  mov r15, rax
+  .loc 1 71
+  mov rax, rbx
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.30
+.L.opt.4:
+  .loc 1 71
+  mov rax, rbx
+  cmp rax, r13
+  jge .L..34
+.L.begin.35:
+  .loc 1 71
+  mov rax, qword ptr [rbx]
+  cmp rax, r12
+  jge .L.else.36
+  .loc 1 71
+  mov rax, qword ptr [rbx]
+  mov r12, rax
+.L.else.36:
+.L.end.36:
+.L..35:
+  add rbx, 8
+.L.cond.35:
+  .loc 1 71
+  mov rax, rbx
+  cmp rax, r13
+  jl .L.begin.35
+.L..34:
+  .loc 1 71
+  mov rax, r12
+.L.return.min_long:
+  mov rbx, [rsp-32]
+  mov r12, [rsp-40]
+  mov r13, [rsp-48]
+  mov r14, [rsp-56]
+  mov r15, [rsp-64]
+  ret
+  .globl bool_min
+  .text
+bool_min:
+  mov [rsp-32], rbx
+  mov [rsp-40], r12
+  mov [rsp-48], r13
+  mov [rsp-56], r14
+  mov [rsp-64], r15
+  mov [rsp-16], rdi
+  mov [rsp-20], esi
+.L.body.bool_min:
+  .loc 1 70
+  mov eax, 1
+  movsx r12d, al
+  .loc 1 70
+  mov rax, qword ptr [rsp-16]
+  mov rbx, rax
+  .loc 1 70
+  movsxd rax, dword ptr [rsp-20]
+  shl rax, 2
+  add rax, qword ptr [rsp-16]
+  mov r13, rax
+  .loc 1 70
+  mov rax, r13
+  mov r14, rax
+  .loc 1 70
+  mov eax, 12
+  mov r15, rax
+  .loc 1 70
+  mov rax, rbx
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.6
+.L.begin.37:
+  .loc 1 70
+  mov rax, r12
+  cmp eax, dword ptr [rbx]
+  jle .L.else.38
+  .loc 1 70
+  movsxd rax, dword ptr [rbx]
+  test eax, eax
+  setne al
+  movzx eax, al
+  movsx r12d, al
+.L.else.38:
+.L.end.38:
+  .loc 1 70
+  add rbx, 4
+  .loc 1 70
+  mov rax, r12
+  cmp eax, dword ptr [rbx]
+  jle .L.else.39
+  .loc 1 70
+  movsxd rax, dword ptr [rbx]
+  test eax, eax
+  setne al
+  movzx eax, al
+  movsx r12d, al
+.L.else.39:
+.L.end.39:
+  .loc 1 70
+  add rbx, 4
+  .loc 1 70
+  mov rax, r12
+  cmp eax, dword ptr [rbx]
+  jle .L.else.40
+  .loc 1 70
+  movsxd rax, dword ptr [rbx]
+  test eax, eax
+  setne al
+  movzx eax, al
+  movsx r12d, al
+.L.else.40:
+.L.end.40:
+  .loc 1 70
+  add rbx, 4
+  .loc 1 70
+  mov rax, r12
+  cmp eax, dword ptr [rbx]
+  jle .L.else.41
+  .loc 1 70
+  movsxd rax, dword ptr [rbx]
+  test eax, eax
+  setne al
+  movzx eax, al
+  movsx r12d, al
+.L.else.41:
+.L.end.41:
+.L.opt.7:
+  add rbx, 4
+.L.cond.37:
+  .loc 1 70
+  mov rax, r13
+  mov r14, rax
+  .loc 1 70
+  mov eax, 12
+  mov r15, rax
+  .loc 1 70
+  mov rax, rbx
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.37
+.L.opt.6:
+  .loc 1 70
+  mov rax, rbx
+  cmp rax, r13
+  jge .L..32
+.L.begin.42:
+  .loc 1 70
+  mov rax, r12
+  cmp eax, dword ptr [rbx]
+  jle .L.else.43
+  .loc 1 70
+  movsxd rax, dword ptr [rbx]
+  test eax, eax
+  setne al
+  movzx eax, al
+  movsx r12d, al
+.L.else.43:
+.L.end.43:
+.L..33:
+  add rbx, 4
+.L.cond.42:
+  .loc 1 70
+  mov rax, rbx
+  cmp rax, r13
+  jl .L.begin.42
+.L..32:
+  .loc 1 70
+  mov rax, r12
+.L.return.bool_min:
+  mov rbx, [rsp-32]
+  mov r12, [rsp-40]
+  mov r13, [rsp-48]
+  mov r14, [rsp-56]
+  mov r15, [rsp-64]
+  ret
+  .globl bool_xor
+  .text
+bool_xor:
+  mov [rsp-32], rbx
+  mov [rsp-40], r12
+  mov [rsp-48], r13
+  mov [rsp-56], r14
+  mov [rsp-64], r15
+  mov [rsp-16], rdi
+  mov [rsp-20], esi
+.L.body.bool_xor:
+  .loc 1 69
+  xor eax, eax
+  movsx r12d, al
+  .loc 1 69
+  mov rax, qword ptr [rsp-16]
+  mov rbx, rax
+  .loc 1 69
+  movsxd rax, dword ptr [rsp-20]
+  shl rax, 0
+  add rax, qword ptr [rsp-16]
+  mov r13, rax
+  .loc 1 69
+  mov rax, r13
+  mov r14, rax
+  .loc 1 69
+  mov eax, 3
+  mov r15, rax
+  .loc 1 69
+  mov rax, rbx
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.8
+.L.begin.44:
+  .loc 1 69
+  movsx eax, byte ptr [rbx]
+  mov r14, rax
+  .loc 1 69
+  mov rax, r12
+  mov rdi, r14
+  xor rax, rdi
+  test eax, eax
+  setne al
+  movzx eax, al
+  movsx r12d, al
+  .loc 1 69
+  add rbx, 1
+  .loc 1 69
+  movsx eax, byte ptr [rbx]
+  mov r14, rax
+  .loc 1 69
+  mov rax, r12
+  mov rdi, r14
+  xor rax, rdi
+  test eax, eax
+  setne al
+  movzx eax, al
+  movsx r12d, al
+  .loc 1 69
+  add rbx, 1
+  .loc 1 69
+  movsx eax, byte ptr [rbx]
+  mov r14, rax
+  .loc 1 69
+  mov rax, r12
+  mov rdi, r14
+  xor rax, rdi
+  test eax, eax
+  setne al
+  movzx eax, al
+  movsx r12d, al
+  .loc 1 69
+  add rbx, 1
+  .loc 1 69
+  movsx eax, byte ptr [rbx]
+  mov r14, rax
+  .loc 1 69
+  mov rax, r12
+  mov rdi, r14
+  xor rax, rdi
+  test eax, eax
+  setne al
+  movzx eax, al
+  movsx r12d, al
+.L.opt.9:
+  add rbx, 1
+.L.cond.44:
+  .loc 1 69
+  mov rax, r13
+  mov r14, rax
+  .loc 1 69
+  mov eax, 3
+  mov r15, rax
+  .loc 1 69
+  mov rax, rbx
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.44
+.L.opt.8:
+  .loc 1 69
+  mov rax, rbx
+  cmp rax, r13
+  jge .L..30
+.L.begin.45:
+  .loc 1 69
+  movsx eax, byte ptr [rbx]
+  mov r14, rax
+  .loc 1 69
+  mov rax, r12
+  mov rdi, r14
+  xor rax, rdi
+  test eax, eax
+  setne al
+  movzx eax, al
+  movsx r12d, al
+.L..31:
+  add rbx, 1
+.L.cond.45:
+  .loc 1 69
+  mov rax, rbx
+  cmp rax, r13
+  jl .L.begin.45
+.L..30:
+  .loc 1 69
+  mov rax, r12
+.L.return.bool_xor:
+  mov rbx, [rsp-32]
+  mov r12, [rsp-40]
+  mov r13, [rsp-48]
+  mov r14, [rsp-56]
+  mov r15, [rsp-64]
+  ret
+  .globl bool_add
+  .text
+bool_add:
+  mov [rsp-32], rbx
+  mov [rsp-40], r12
+  mov [rsp-48], r13
+  mov [rsp-56], r14
+  mov [rsp-64], r15
+  mov [rsp-16], rdi
+  mov [rsp-20], esi
+.L.body.bool_add:
+  .loc 1 68
+  xor eax, eax
+  movsx r12d, al
+  .loc 1 68
+  mov rax, qword ptr [rsp-16]
+  mov rbx, rax
+  .loc 1 68
+  movsxd rax, dword ptr [rsp-20]
+  shl rax, 0
+  add rax, qword ptr [rsp-16]
+  mov r13, rax
+  .loc 1 68
+  mov rax, r13
+  mov r14, rax
+  .loc 1 68
+  mov eax, 3
+  mov r15, rax
+  .loc 1 68
+  mov rax, rbx
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.10
+.L.begin.46:
+  .loc 1 68
+  movsx eax, byte ptr [rbx]
+  mov r14, rax
+  .loc 1 68
+  mov rax, r12
+  mov rdi, r14
+  add eax, edi
+  test eax, eax
+  setne al
+  movzx eax, al
+  movsx r12d, al
+  .loc 1 68
+  add rbx, 1
+  .loc 1 68
+  movsx eax, byte ptr [rbx]
+  mov r14, rax
+  .loc 1 68
+  mov rax, r12
+  mov rdi, r14
+  add eax, edi
+  test eax, eax
+  setne al
+  movzx eax, al
+  movsx r12d, al
+  .loc 1 68
+  add rbx, 1
+  .loc 1 68
+  movsx eax, byte ptr [rbx]
+  mov r14, rax
+  .loc 1 68
+  mov rax, r12
+  mov rdi, r14
+  add eax, edi
+  test eax, eax
+  setne al
+  movzx eax, al
+  movsx r12d, al
+  .loc 1 68
+  add rbx, 1
+  .loc 1 68
+  movsx eax, byte ptr [rbx]
+  mov r14, rax
+  .loc 1 68
+  mov rax, r12
+  mov rdi, r14
+  add eax, edi
+  test eax, eax
+  setne al
+  movzx eax, al
+  movsx r12d, al
+.L.opt.11:
+  add rbx, 1
+.L.cond.46:
+  .loc 1 68
+  mov rax, r13
+  mov r14, rax
+  .loc 1 68
+  mov eax, 3
+  mov r15, rax
+  .loc 1 68
+  mov rax, rbx
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.46
+.L.opt.10:
+  .loc 1 68
+  mov rax, rbx
+  cmp rax, r13
+  jge .L..28
+.L.begin.47:
+  .loc 1 68
+  movsx eax, byte ptr [rbx]
+  mov r14, rax
+  .loc 1 68
+  mov rax, r12
+  mov rdi, r14
+  add eax, edi
+  test eax, eax
+  setne al
+  movzx eax, al
+  movsx r12d, al
+.L..29:
+  add rbx, 1
+.L.cond.47:
+  .loc 1 68
+  mov rax, rbx
+  cmp rax, r13
+  jl .L.begin.47
+.L..28:
+  .loc 1 68
+  mov rax, r12
+.L.return.bool_add:
+  mov rbx, [rsp-32]
+  mov r12, [rsp-40]
+  mov r13, [rsp-48]
+  mov r14, [rsp-56]
+  mov r15, [rsp-64]
+  ret
+  .globl max_char
+  .text
+max_char:
+  mov [rsp-48], rbx
+  mov [rsp-56], r12
+  mov [rsp-64], r13
+  mov [rsp-72], r14
+  mov [rsp-80], r15
+  mov [rsp-32], rdi
+  mov [rsp-36], esi
+.L.body.max_char:
+  .loc 1 67
+  mov eax, -128
+  movsx r13d, al
+  .loc 1 67
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 67
+  mov rax, r12
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 67
+  movsxd rax, dword ptr [rsp-36]
+  mov rdi, r14
+  sub rax, rdi
+  mov qword ptr [rsp-24], rax
+  .loc 1 67
+  mov eax, 15
+  cmp rax, qword ptr [rsp-24]
+  jge .L.else.48
+  .loc 1 67
+  mov rax, qword ptr [rsp-32]
+  add rax, r12
+  mov qword ptr [rsp-16], rax
+  .loc 1 67
+  mov rax, qword ptr [rsp-24]
+  sar rax, 4
+  mov rcx, rax
+  .loc 1 67
+  mov rax, qword ptr [rsp-16]
+  mov rsi, rax
+  movdqu xmm0, [rsi]
+.L.vector.49:
+  movdqu xmm1, [rsi]
+  movdqa xmm4, xmm1
+  pcmpgtb xmm4, xmm0
+  pand xmm1, xmm4
+  pandn xmm4, xmm0
+  por xmm4, xmm1
+  movdqa xmm0, xmm4
+  add rsi, 16
+  sub rcx, 1
+  jnz .L.vector.49
+  pshufd xmm1, xmm0, 0x4e
+  movdqa xmm4, xmm1
+  pcmpgtb xmm4, xmm0
+  pand xmm1, xmm4
+  pandn xmm4, xmm0
+  por xmm4, xmm1
+  movdqa xmm0, xmm4
+  pshufd xmm1, xmm0, 0xb1
+  movdqa xmm4, xmm1
+  pcmpgtb xmm4, xmm0
+  pand xmm1, xmm4
+  pandn xmm4, xmm0
+  por xmm4, xmm1
+  movdqa xmm0, xmm4
+  movdqa xmm1, xmm0
+  psrld xmm1, 16
+  movdqa xmm4, xmm1
+  pcmpgtb xmm4, xmm0
+  pand xmm1, xmm4
+  pandn xmm4, xmm0
+  por xmm4, xmm1
+  movdqa xmm0, xmm4
+  movdqa xmm1, xmm0
+  psrlw xmm1, 8
+  movdqa xmm4, xmm1
+  pcmpgtb xmm4, xmm0
+  pand xmm1, xmm4
+  pandn xmm4, xmm0
+  por xmm4, xmm1
+  movdqa xmm0, xmm4
+  movq rax, xmm0
+  movsx eax, al
+  mov byte ptr [rsp-1], al
+  .loc 1 67
+  movsx eax, al
+  cmp eax, r13d
+  jle .L.else.50
+  .loc 1 67
+  movsx eax, byte ptr [rsp-1]
+  movsx r13d, al
+.L.else.50:
+.L.end.50:
+  .loc 1 67
+  mov rax, -16
+  and rax, qword ptr [rsp-24]
+  add r12d, eax
+  movsxd r12, r12d
+.L.else.48:
+.L.end.48:
+  .loc 1 67
+  mov rax, r12
+  movsxd rax, eax
+  shl rax, 0
+  add rax, qword ptr [rsp-32]
+  mov rbx, rax
+  .loc 1 67
+  movsxd rax, dword ptr [rsp-36]
+  mov r14, rax
+  .loc 1 67
+  mov eax, 3
+  mov r15, rax
+  .loc 1 67
+  mov rax, r12
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.12
+.L.begin.51:
+  .loc 1 67
+  movsx eax, byte ptr [rbx]
+  cmp eax, r13d
+  jle .L.else.52
+  .loc 1 67
+  movsx eax, byte ptr [rbx]
+  movsx r13d, al
+.L.else.52:
+.L.end.52:
+  .loc 1 67
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 67
+  add rbx, 1
+  mov rax, rbx
+  .loc 1 67
+  movsx eax, byte ptr [rbx]
+  cmp eax, r13d
+  jle .L.else.53
+  .loc 1 67
+  movsx eax, byte ptr [rbx]
+  movsx r13d, al
+.L.else.53:
+.L.end.53:
+  .loc 1 67
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 67
+  add rbx, 1
+  mov rax, rbx
+  .loc 1 67
+  movsx eax, byte ptr [rbx]
+  cmp eax, r13d
+  jle .L.else.54
+  .loc 1 67
+  movsx eax, byte ptr [rbx]
+  movsx r13d, al
+.L.else.54:
+.L.end.54:
+  .loc 1 67
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 67
+  add rbx, 1
+  mov rax, rbx
+  .loc 1 67
+  movsx eax, byte ptr [rbx]
+  cmp eax, r13d
+  jle .L.else.55
+  .loc 1 67
+  movsx eax, byte ptr [rbx]
+  movsx r13d, al
+.L.else.55:
+.L.end.55:
+.L.opt.13:
+  .loc 1 67
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 67
+  add rbx, 1
+  mov rax, rbx
+.L.cond.51:
+  .loc 1 67
+  movsxd rax, dword ptr [rsp-36]
+  mov r14, rax
+  .loc 1 67
+  mov eax, 3
+  mov r15, rax
+  .loc 1 67
+  mov rax, r12
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.51
+.L.opt.12:
+  .loc 1 67
+  mov rax, r12
+  cmp eax, dword ptr [rsp-36]
+  jge .L..26
+.L.begin.56:
+  .loc 1 67
+  movsx eax, byte ptr [rbx]
+  cmp eax, r13d
+  jle .L.else.57
+  .loc 1 67
+  movsx eax, byte ptr [rbx]
+  movsx r13d, al
+.L.else.57:
+.L.end.57:
+.L..27:
+  .loc 1 67
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 67
+  add rbx, 1
+  mov rax, rbx
+.L.cond.56:
+  .loc 1 67
+  mov rax, r12
+  cmp eax, dword ptr [rsp-36]
+  jl .L.begin.56
+.L..26:
+  .loc 1 67
+  mov rax, r13
+.L.return.max_char:
+  mov rbx, [rsp-48]
+  mov r12, [rsp-56]
+  mov r13, [rsp-64]
+  mov r14, [rsp-72]
+  mov r15, [rsp-80]
+  ret
+  .globl max_short
+  .text
+max_short:
+  mov [rsp-48], rbx
+  mov [rsp-56], r12
+  mov [rsp-64], r13
+  mov [rsp-72], r14
+  mov [rsp-80], r15
+  mov [rsp-32], rdi
+  mov [rsp-36], esi
+.L.body.max_short:
+  .loc 1 66
+  mov eax, -100000
+  movsxd r13, eax
+  .loc 1 66
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 66
+  mov rax, r12
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 66
+  movsxd rax, dword ptr [rsp-36]
+  mov rdi, r14
+  sub rax, rdi
+  mov qword ptr [rsp-24], rax
+  .loc 1 66
+  mov eax, 7
+  cmp rax, qword ptr [rsp-24]
+  jge .L.else.58
+  .loc 1 66
+  mov rax, r12
+  movsxd rax, eax
+  shl rax, 1
+  add rax, qword ptr [rsp-32]
+  mov qword ptr [rsp-16], rax
+  .loc 1 66
+  mov rax, qword ptr [rsp-24]
+  sar rax, 3
+  mov rcx, rax
+  .loc 1 66
+  mov rax, qword ptr [rsp-16]
+  mov rsi, rax
+  movdqu xmm0, [rsi]
+.L.vector.59:
+  movdqu xmm1, [rsi]
+  pmaxsw xmm0, xmm1
+  add rsi, 16
+  sub rcx, 1
+  jnz .L.vector.59
+  pshufd xmm1, xmm0, 0x4e
+  pmaxsw xmm0, xmm1
+  pshufd xmm1, xmm0, 0xb1
+  pmaxsw xmm0, xmm1
+  movdqa xmm1, xmm0
+  psrld xmm1, 16
+  pmaxsw xmm0, xmm1
+  movq rax, xmm0
+  movsx eax, ax
+  mov word ptr [rsp-2], ax
+  .loc 1 66
+  movsx eax, ax
+  cmp eax, r13d
+  jle .L.else.60
+  .loc 1 66
+  movsx eax, word ptr [rsp-2]
+  movsxd r13, eax
+.L.else.60:
+.L.end.60:
+  .loc 1 66
+  mov rax, -8
+  and rax, qword ptr [rsp-24]
+  add r12d, eax
+  movsxd r12, r12d
+.L.else.58:
+.L.end.58:
+  .loc 1 66
+  mov rax, r12
+  movsxd rax, eax
+  shl rax, 1
+  add rax, qword ptr [rsp-32]
+  mov rbx, rax
+  .loc 1 66
+  movsxd rax, dword ptr [rsp-36]
+  mov r14, rax
+  .loc 1 66
+  mov eax, 3
+  mov r15, rax
+  .loc 1 66
+  mov rax, r12
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.14
+.L.begin.61:
+  .loc 1 66
+  movsx eax, word ptr [rbx]
+  cmp eax, r13d
+  jle .L.else.62
+  .loc 1 66
+  movsx eax, word ptr [rbx]
+  movsxd r13, eax
+.L.else.62:
+.L.end.62:
+  .loc 1 66
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 66
+  add rbx, 2
+  mov rax, rbx
+  .loc 1 66
+  movsx eax, word ptr [rbx]
+  cmp eax, r13d
+  jle .L.else.63
+  .loc 1 66
+  movsx eax, word ptr [rbx]
+  movsxd r13, eax
+.L.else.63:
+.L.end.63:
+  .loc 1 66
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 66
+  add rbx, 2
+  mov rax, rbx
+  .loc 1 66
+  movsx eax, word ptr [rbx]
+  cmp eax, r13d
+  jle .L.else.64
+  .loc 1 66
+  movsx eax, word ptr [rbx]
+  movsxd r13, eax
+.L.else.64:
+.L.end.64:
+  .loc 1 66
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 66
+  add rbx, 2
+  mov rax, rbx
+  .loc 1 66
+  movsx eax, word ptr [rbx]
+  cmp eax, r13d
+  jle .L.else.65
+  .loc 1 66
+  movsx eax, word ptr [rbx]
+  movsxd r13, eax
+.L.else.65:
+.L.end.65:
+.L.opt.15:
+  .loc 1 66
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 66
+  add rbx, 2
+  mov rax, rbx
+.L.cond.61:
+  .loc 1 66
+  movsxd rax, dword ptr [rsp-36]
+  mov r14, rax
+  .loc 1 66
+  mov eax, 3
+  mov r15, rax
+  .loc 1 66
+  mov rax, r12
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.61
+.L.opt.14:
+  .loc 1 66
+  mov rax, r12
+  cmp eax, dword ptr [rsp-36]
+  jge .L..24
+.L.begin.66:
+  .loc 1 66
+  movsx eax, word ptr [rbx]
+  cmp eax, r13d
+  jle .L.else.67
+  .loc 1 66
+  movsx eax, word ptr [rbx]
+  movsxd r13, eax
+.L.else.67:
+.L.end.67:
+.L..25:
+  .loc 1 66
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 66
+  add rbx, 2
+  mov rax, rbx
+.L.cond.66:
+  .loc 1 66
+  mov rax, r12
+  cmp eax, dword ptr [rsp-36]
+  jl .L.begin.66
+.L..24:
+  .loc 1 66
+  mov rax, r13
+.L.return.max_short:
+  mov rbx, [rsp-48]
+  mov r12, [rsp-56]
+  mov r13, [rsp-64]
+  mov r14, [rsp-72]
+  mov r15, [rsp-80]
+  ret
+  .globl min_int
+  .text
+min_int:
+  mov [rsp-48], rbx
+  mov [rsp-56], r12
+  mov [rsp-64], r13
+  mov [rsp-72], r14
+  mov [rsp-80], r15
+  mov [rsp-32], rdi
+  mov [rsp-36], esi
+.L.body.min_int:
+  .loc 1 65
+  mov eax, 1000000000
+  movsxd r13, eax
+  .loc 1 65
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 65
+  mov rax, r12
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 65
+  movsxd rax, dword ptr [rsp-36]
+  mov rdi, r14
+  sub rax, rdi
+  mov qword ptr [rsp-24], rax
+  .loc 1 65
+  mov eax, 3
+  cmp rax, qword ptr [rsp-24]
+  jge .L.else.68
+  .loc 1 65
+  mov rax, r12
+  movsxd rax, eax
+  shl rax, 2
+  add rax, qword ptr [rsp-32]
+  mov qword ptr [rsp-16], rax
+  .loc 1 65
+  mov rax, qword ptr [rsp-24]
+  sar rax, 2
+  mov rcx, rax
+  .loc 1 65
+  mov rax, qword ptr [rsp-16]
+  mov rsi, rax
+  movdqu xmm0, [rsi]
+.L.vector.69:
+  movdqu xmm1, [rsi]
+  movdqa xmm4, xmm0
+  pcmpgtd xmm4, xmm1
+  pand xmm1, xmm4
+  pandn xmm4, xmm0
+  por xmm4, xmm1
+  movdqa xmm0, xmm4
+  add rsi, 16
+  sub rcx, 1
+  jnz .L.vector.69
+  pshufd xmm1, xmm0, 0x4e
+  movdqa xmm4, xmm0
+  pcmpgtd xmm4, xmm1
+  pand xmm1, xmm4
+  pandn xmm4, xmm0
+  por xmm4, xmm1
+  movdqa xmm0, xmm4
+  pshufd xmm1, xmm0, 0xb1
+  movdqa xmm4, xmm0
+  pcmpgtd xmm4, xmm1
+  pand xmm1, xmm4
+  pandn xmm4, xmm0
+  por xmm4, xmm1
+  movdqa xmm0, xmm4
+  movq rax, xmm0
+  movsxd rax, eax
+  mov dword ptr [rsp-4], eax
+  .loc 1 65
+  movsxd rax, eax
+  cmp eax, r13d
+  jge .L.else.70
+  .loc 1 65
+  movsxd rax, dword ptr [rsp-4]
+  movsxd r13, eax
+.L.else.70:
+.L.end.70:
+  .loc 1 65
+  mov rax, -4
+  and rax, qword ptr [rsp-24]
+  add r12d, eax
+  movsxd r12, r12d
+.L.else.68:
+.L.end.68:
+  .loc 1 65
+  mov rax, r12
+  movsxd rax, eax
+  shl rax, 2
+  add rax, qword ptr [rsp-32]
+  mov rbx, rax
+  .loc 1 65
+  movsxd rax, dword ptr [rsp-36]
+  mov r14, rax
+  .loc 1 65
+  mov eax, 3
+  mov r15, rax
+  .loc 1 65
+  mov rax, r12
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.16
+.L.begin.71:
+  .loc 1 65
+  movsxd rax, dword ptr [rbx]
+  cmp eax, r13d
+  jge .L.else.72
+  .loc 1 65
+  movsxd rax, dword ptr [rbx]
+  movsxd r13, eax
+.L.else.72:
+.L.end.72:
+  .loc 1 65
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 65
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 65
+  movsxd rax, dword ptr [rbx]
+  cmp eax, r13d
+  jge .L.else.73
+  .loc 1 65
+  movsxd rax, dword ptr [rbx]
+  movsxd r13, eax
+.L.else.73:
+.L.end.73:
+  .loc 1 65
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 65
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 65
+  movsxd rax, dword ptr [rbx]
+  cmp eax, r13d
+  jge .L.else.74
+  .loc 1 65
+  movsxd rax, dword ptr [rbx]
+  movsxd r13, eax
+.L.else.74:
+.L.end.74:
+  .loc 1 65
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 65
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 65
+  movsxd rax, dword ptr [rbx]
+  cmp eax, r13d
+  jge .L.else.75
+  .loc 1 65
+  movsxd rax, dword ptr [rbx]
+  movsxd r13, eax
+.L.else.75:
+.L.end.75:
+.L.opt.17:
+  .loc 1 65
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 65
+  add rbx, 4
+  mov rax, rbx
+.L.cond.71:
+  .loc 1 65
+  movsxd rax, dword ptr [rsp-36]
+  mov r14, rax
+  .loc 1 65
+  mov eax, 3
+  mov r15, rax
+  .loc 1 65
+  mov rax, r12
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.71
+.L.opt.16:
+  .loc 1 65
+  mov rax, r12
+  cmp eax, dword ptr [rsp-36]
+  jge .L..22
+.L.begin.76:
+  .loc 1 65
+  movsxd rax, dword ptr [rbx]
+  cmp eax, r13d
+  jge .L.else.77
+  .loc 1 65
+  movsxd rax, dword ptr [rbx]
+  movsxd r13, eax
+.L.else.77:
+.L.end.77:
+.L..23:
+  .loc 1 65
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 65
+  add rbx, 4
+  mov rax, rbx
+.L.cond.76:
+  .loc 1 65
+  mov rax, r12
+  cmp eax, dword ptr [rsp-36]
+  jl .L.begin.76
+.L..22:
+  .loc 1 65
+  mov rax, r13
+.L.return.min_int:
+  mov rbx, [rsp-48]
+  mov r12, [rsp-56]
+  mov r13, [rsp-64]
+  mov r14, [rsp-72]
+  mov r15, [rsp-80]
+  ret
+  .globl and_long_all
+  .text
+and_long_all:
+  mov [rsp-48], rbx
+  mov [rsp-56], r12
+  mov [rsp-64], r13
+  mov [rsp-72], r14
+  mov [rsp-80], r15
+  mov [rsp-32], rdi
+  mov [rsp-36], esi
+.L.body.and_long_all:
+  .loc 1 64
+  mov rax, -1
+  mov r13, rax
+  .loc 1 64
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 64
+  mov rax, r12
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 64
+  movsxd rax, dword ptr [rsp-36]
+  mov rdi, r14
+  sub rax, rdi
+  mov qword ptr [rsp-24], rax
+  .loc 1 64
+  mov eax, 1
+  cmp rax, qword ptr [rsp-24]
+  jge .L.else.78
+  .loc 1 64
+  mov rax, r12
+  movsxd rax, eax
+  shl rax, 3
+  add rax, qword ptr [rsp-32]
+  mov qword ptr [rsp-16], rax
+  .loc 1 64
+  mov rax, qword ptr [rsp-24]
+  sar rax, 1
+  mov rcx, rax
+  .loc 1 64
+  mov rax, qword ptr [rsp-16]
+  mov rsi, rax
+  movdqu xmm0, [rsi]
+.L.vector.79:
+  movdqu xmm1, [rsi]
+  pand xmm0, xmm1
+  add rsi, 16
+  sub rcx, 1
+  jnz .L.vector.79
+  pshufd xmm1, xmm0, 0x4e
+  pand xmm0, xmm1
+  movq rax, xmm0
+  mov qword ptr [rsp-8], rax
+  .loc 1 64
+  and r13, rax
+  .loc 1 64
+  mov rax, -2
+  and rax, qword ptr [rsp-24]
+  add r12d, eax
+  movsxd r12, r12d
+.L.else.78:
+.L.end.78:
+  .loc 1 64
+  mov rax, r12
+  movsxd rax, eax
+  shl rax, 3
+  add rax, qword ptr [rsp-32]
+  mov rbx, rax
+  .loc 1 64
+  movsxd rax, dword ptr [rsp-36]
+  mov r14, rax
+  .loc 1 64
+  mov eax, 3
+  mov r15, rax
+  .loc 1 64
+  mov rax, r12
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.18
+.L.begin.80:
+  .loc 1 64
+  mov rax, qword ptr [rbx]
+  and r13, rax
+  .loc 1 64
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 64
+  add rbx, 8
+  mov rax, rbx
+  .loc 1 64
+  mov rax, qword ptr [rbx]
+  and r13, rax
+  .loc 1 64
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 64
+  add rbx, 8
+  mov rax, rbx
+  .loc 1 64
+  mov rax, qword ptr [rbx]
+  and r13, rax
+  .loc 1 64
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 64
+  add rbx, 8
+  mov rax, rbx
+  .loc 1 64
+  mov rax, qword ptr [rbx]
+  and r13, rax
+.L.opt.19:
+  .loc 1 64
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 64
+  add rbx, 8
+  mov rax, rbx
+.L.cond.80:
+  .loc 1 64
+  movsxd rax, dword ptr [rsp-36]
+  mov r14, rax
+  .loc 1 64
+  mov eax, 3
+  mov r15, rax
+  .loc 1 64
+  mov rax, r12
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.80
+.L.opt.18:
+  .loc 1 64
+  mov rax, r12
+  cmp eax, dword ptr [rsp-36]
+  jge .L..20
+.L.begin.81:
+  .loc 1 64
+  mov rax, qword ptr [rbx]
+  and r13, rax
+.L..21:
+  .loc 1 64
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 64
+  add rbx, 8
+  mov rax, rbx
+.L.cond.81:
+  .loc 1 64
+  mov rax, r12
+  cmp eax, dword ptr [rsp-36]
+  jl .L.begin.81
+.L..20:
+  .loc 1 64
+  mov rax, r13
+.L.return.and_long_all:
+  mov rbx, [rsp-48]
+  mov r12, [rsp-56]
+  mov r13, [rsp-64]
+  mov r14, [rsp-72]
+  mov r15, [rsp-80]
+  ret
+  .globl xor_int
+  .text
+xor_int:
+  mov [rsp-48], rbx
+  mov [rsp-56], r12
+  mov [rsp-64], r13
+  mov [rsp-72], r14
+  mov [rsp-80], r15
+  mov [rsp-32], rdi
+  mov [rsp-36], esi
+.L.body.xor_int:
+  .loc 1 63
+  xor eax, eax
+  movsxd r13, eax
+  .loc 1 63
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 63
+  mov rax, r12
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 63
+  movsxd rax, dword ptr [rsp-36]
+  mov rdi, r14
+  sub rax, rdi
+  mov qword ptr [rsp-24], rax
+  .loc 1 63
+  mov eax, 3
+  cmp rax, qword ptr [rsp-24]
+  jge .L.else.82
+  .loc 1 63
+  mov rax, r12
+  movsxd rax, eax
+  shl rax, 2
+  add rax, qword ptr [rsp-32]
+  mov qword ptr [rsp-16], rax
+  .loc 1 63
+  mov rax, qword ptr [rsp-24]
+  sar rax, 2
+  mov rcx, rax
+  .loc 1 63
+  mov rax, qword ptr [rsp-16]
+  mov rsi, rax
+  pxor xmm0, xmm0
+.L.vector.83:
+  movdqu xmm1, [rsi]
+  pxor xmm0, xmm1
+  add rsi, 16
+  sub rcx, 1
+  jnz .L.vector.83
+  pshufd xmm1, xmm0, 0x4e
+  pxor xmm0, xmm1
+  pshufd xmm1, xmm0, 0xb1
+  pxor xmm0, xmm1
+  movq rax, xmm0
+  movsxd rax, eax
+  mov dword ptr [rsp-4], eax
+  .loc 1 63
+  movsxd rax, eax
+  xor eax, r13d
+  movsxd r13, eax
+  .loc 1 63
+  mov rax, -4
+  and rax, qword ptr [rsp-24]
+  add r12d, eax
+  movsxd r12, r12d
+.L.else.82:
+.L.end.82:
+  .loc 1 63
+  mov rax, r12
+  movsxd rax, eax
+  shl rax, 2
+  add rax, qword ptr [rsp-32]
+  mov rbx, rax
+  .loc 1 63
+  movsxd rax, dword ptr [rsp-36]
+  mov r14, rax
+  .loc 1 63
+  mov eax, 3
+  mov r15, rax
+  .loc 1 63
+  mov rax, r12
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.20
+.L.begin.84:
+  .loc 1 63
+  movsxd rax, dword ptr [rbx]
+  xor eax, r13d
+  movsxd r13, eax
+  .loc 1 63
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 63
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 63
+  movsxd rax, dword ptr [rbx]
+  xor eax, r13d
+  movsxd r13, eax
+  .loc 1 63
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 63
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 63
+  movsxd rax, dword ptr [rbx]
+  xor eax, r13d
+  movsxd r13, eax
+  .loc 1 63
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 63
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 63
+  movsxd rax, dword ptr [rbx]
+  xor eax, r13d
+  movsxd r13, eax
+.L.opt.21:
+  .loc 1 63
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 63
+  add rbx, 4
+  mov rax, rbx
+.L.cond.84:
+  .loc 1 63
+  movsxd rax, dword ptr [rsp-36]
+  mov r14, rax
+  .loc 1 63
+  mov eax, 3
+  mov r15, rax
+  .loc 1 63
+  mov rax, r12
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.84
+.L.opt.20:
+  .loc 1 63
+  mov rax, r12
+  cmp eax, dword ptr [rsp-36]
+  jge .L..18
+.L.begin.85:
+  .loc 1 63
+  movsxd rax, dword ptr [rbx]
+  xor eax, r13d
+  movsxd r13, eax
+.L..19:
+  .loc 1 63
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 63
+  add rbx, 4
+  mov rax, rbx
+.L.cond.85:
+  .loc 1 63
+  mov rax, r12
+  cmp eax, dword ptr [rsp-36]
+  jl .L.begin.85
+.L..18:
+  .loc 1 63
+  mov rax, r13
+.L.return.xor_int:
+  mov rbx, [rsp-48]
+  mov r12, [rsp-56]
+  mov r13, [rsp-64]
+  mov r14, [rsp-72]
+  mov r15, [rsp-80]
+  ret
+  .globl sum_short
+  .text
+sum_short:
+  mov [rsp-48], rbx
+  mov [rsp-56], r12
+  mov [rsp-64], r13
+  mov [rsp-72], r14
+  mov [rsp-80], r15
+  mov [rsp-32], rdi
+  mov [rsp-36], esi
+.L.body.sum_short:
+  .loc 1 62
+  xor eax, eax
+  mov r13, rax
+  .loc 1 62
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 62
+  mov rax, r12
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 62
+  movsxd rax, dword ptr [rsp-36]
+  mov rdi, r14
+  sub rax, rdi
+  mov qword ptr [rsp-24], rax
+  .loc 1 62
+  mov eax, 7
+  cmp rax, qword ptr [rsp-24]
+  jge .L.else.86
+  .loc 1 62
+  mov rax, r12
+  movsxd rax, eax
+  shl rax, 1
+  add rax, qword ptr [rsp-32]
+  mov qword ptr [rsp-16], rax
+  .loc 1 62
+  mov rax, qword ptr [rsp-24]
+  sar rax, 3
+  mov rcx, rax
+  .loc 1 62
+  mov rax, qword ptr [rsp-16]
+  mov rsi, rax
+  pxor xmm0, xmm0
+.L.vector.87:
+  movdqu xmm1, [rsi]
+  pxor xmm3, xmm3
+  pcmpgtw xmm3, xmm1
+  movdqa xmm2, xmm1
+  punpcklwd xmm1, xmm3
+  punpckhwd xmm2, xmm3
+  paddd xmm1, xmm2
+  pxor xmm3, xmm3
+  pcmpgtd xmm3, xmm1
+  movdqa xmm2, xmm1
+  punpckldq xmm1, xmm3
+  punpckhdq xmm2, xmm3
+  paddq xmm1, xmm2
+  paddq xmm0, xmm1
+  add rsi, 16
+  sub rcx, 1
+  jnz .L.vector.87
+  pshufd xmm1, xmm0, 0x4e
+  paddq xmm0, xmm1
+  movq rax, xmm0
+  mov qword ptr [rsp-8], rax
+  .loc 1 62
+  add r13, rax
+  .loc 1 62
+  mov rax, -8
+  and rax, qword ptr [rsp-24]
+  add r12d, eax
+  movsxd r12, r12d
+.L.else.86:
+.L.end.86:
+  .loc 1 62
+  mov rax, r12
+  movsxd rax, eax
+  shl rax, 1
+  add rax, qword ptr [rsp-32]
+  mov rbx, rax
+  .loc 1 62
+  movsxd rax, dword ptr [rsp-36]
+  mov r14, rax
+  .loc 1 62
+  mov eax, 3
+  mov r15, rax
+  .loc 1 62
+  mov rax, r12
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.22
+.L.begin.88:
+  .loc 1 62
+  movsx eax, word ptr [rbx]
+  movsxd rax, eax
+  add r13, rax
+  .loc 1 62
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 62
+  add rbx, 2
+  mov rax, rbx
+  .loc 1 62
+  movsx eax, word ptr [rbx]
+  movsxd rax, eax
+  add r13, rax
+  .loc 1 62
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 62
+  add rbx, 2
+  mov rax, rbx
+  .loc 1 62
+  movsx eax, word ptr [rbx]
+  movsxd rax, eax
+  add r13, rax
+  .loc 1 62
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 62
+  add rbx, 2
+  mov rax, rbx
+  .loc 1 62
+  movsx eax, word ptr [rbx]
+  movsxd rax, eax
+  add r13, rax
+.L.opt.23:
+  .loc 1 62
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 62
+  add rbx, 2
+  mov rax, rbx
+.L.cond.88:
+  .loc 1 62
+  movsxd rax, dword ptr [rsp-36]
+  mov r14, rax
+  .loc 1 62
+  mov eax, 3
+  mov r15, rax
+  .loc 1 62
+  mov rax, r12
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.88
+.L.opt.22:
+  .loc 1 62
+  mov rax, r12
+  cmp eax, dword ptr [rsp-36]
+  jge .L..16
+.L.begin.89:
+  .loc 1 62
+  movsx eax, word ptr [rbx]
+  movsxd rax, eax
+  add r13, rax
+.L..17:
+  .loc 1 62
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 62
+  add rbx, 2
+  mov rax, rbx
+.L.cond.89:
+  .loc 1 62
+  mov rax, r12
+  cmp eax, dword ptr [rsp-36]
+  jl .L.begin.89
+.L..16:
+  .loc 1 62
+  mov rax, r13
+.L.return.sum_short:
+  mov rbx, [rsp-48]
+  mov r12, [rsp-56]
+  mov r13, [rsp-64]
+  mov r14, [rsp-72]
+  mov r15, [rsp-80]
+  ret
+  .globl checksum
+  .text
+checksum:
+  mov [rsp-48], rbx
+  mov [rsp-56], r12
+  mov [rsp-64], r13
+  mov [rsp-72], r14
+  mov [rsp-80], r15
+  mov [rsp-32], rdi
+  mov [rsp-36], esi
+.L.body.checksum:
+  .loc 1 61
+  xor eax, eax
+  movsxd r13, eax
+  .loc 1 61
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 61
+  mov rax, r12
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 61
+  movsxd rax, dword ptr [rsp-36]
+  mov rdi, r14
+  sub rax, rdi
+  mov qword ptr [rsp-24], rax
+  .loc 1 61
+  mov eax, 15
+  cmp rax, qword ptr [rsp-24]
+  jge .L.else.90
+  .loc 1 61
+  mov rax, qword ptr [rsp-32]
+  add rax, r12
+  mov qword ptr [rsp-16], rax
+  .loc 1 61
+  mov rax, qword ptr [rsp-24]
+  sar rax, 4
+  mov rcx, rax
+  .loc 1 61
+  mov rax, qword ptr [rsp-16]
+  mov rsi, rax
+  pxor xmm0, xmm0
+.L.vector.91:
+  movdqu xmm1, [rsi]
+  pxor xmm3, xmm3
+  pcmpgtb xmm3, xmm1
+  movdqa xmm2, xmm1
+  punpcklbw xmm1, xmm3
+  punpckhbw xmm2, xmm3
+  paddw xmm1, xmm2
+  pxor xmm3, xmm3
+  pcmpgtw xmm3, xmm1
+  movdqa xmm2, xmm1
+  punpcklwd xmm1, xmm3
+  punpckhwd xmm2, xmm3
+  paddd xmm1, xmm2
+  paddd xmm0, xmm1
+  add rsi, 16
+  sub rcx, 1
+  jnz .L.vector.91
+  pshufd xmm1, xmm0, 0x4e
+  paddd xmm0, xmm1
+  pshufd xmm1, xmm0, 0xb1
+  paddd xmm0, xmm1
+  movq rax, xmm0
+  movsxd rax, eax
+  mov dword ptr [rsp-4], eax
+  .loc 1 61
+  movsxd rax, eax
+  add r13d, eax
+  movsxd r13, r13d
+  .loc 1 61
+  mov rax, -16
+  and rax, qword ptr [rsp-24]
+  add r12d, eax
+  movsxd r12, r12d
+.L.else.90:
+.L.end.90:
+  .loc 1 61
+  mov rax, r12
+  movsxd rax, eax
+  shl rax, 0
+  add rax, qword ptr [rsp-32]
+  mov rbx, rax
+  .loc 1 61
+  movsxd rax, dword ptr [rsp-36]
+  mov r14, rax
+  .loc 1 61
+  mov eax, 3
+  mov r15, rax
+  .loc 1 61
+  mov rax, r12
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.24
+.L.begin.92:
+  .loc 1 61
+  movsx eax, byte ptr [rbx]
+  add r13d, eax
+  movsxd r13, r13d
+  .loc 1 61
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 61
+  add rbx, 1
+  mov rax, rbx
+  .loc 1 61
+  movsx eax, byte ptr [rbx]
+  add r13d, eax
+  movsxd r13, r13d
+  .loc 1 61
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 61
+  add rbx, 1
+  mov rax, rbx
+  .loc 1 61
+  movsx eax, byte ptr [rbx]
+  add r13d, eax
+  movsxd r13, r13d
+  .loc 1 61
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 61
+  add rbx, 1
+  mov rax, rbx
+  .loc 1 61
+  movsx eax, byte ptr [rbx]
+  add r13d, eax
+  movsxd r13, r13d
+.L.opt.25:
+  .loc 1 61
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 61
+  add rbx, 1
+  mov rax, rbx
+.L.cond.92:
+  .loc 1 61
+  movsxd rax, dword ptr [rsp-36]
+  mov r14, rax
+  .loc 1 61
+  mov eax, 3
+  mov r15, rax
+  .loc 1 61
+  mov rax, r12
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.92
+.L.opt.24:
+  .loc 1 61
+  mov rax, r12
+  cmp eax, dword ptr [rsp-36]
+  jge .L..14
+.L.begin.93:
+  .loc 1 61
+  movsx eax, byte ptr [rbx]
+  add r13d, eax
+  movsxd r13, r13d
+.L..15:
+  .loc 1 61
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 61
+  add rbx, 1
+  mov rax, rbx
+.L.cond.93:
+  .loc 1 61
+  mov rax, r12
+  cmp eax, dword ptr [rsp-36]
+  jl .L.begin.93
+.L..14:
+  .loc 1 61
+  mov rax, r13
+.L.return.checksum:
+  mov rbx, [rsp-48]
+  mov r12, [rsp-56]
+  mov r13, [rsp-64]
+  mov r14, [rsp-72]
+  mov r15, [rsp-80]
+  ret
+  .globl shift_char
+  .text
+shift_char:
+  mov [rsp-48], rbx
+  mov [rsp-56], r12
+  mov [rsp-64], r13
+  mov [rsp-72], r14
+  mov [rsp-80], r15
+  mov [rsp-40], rdi
+  movsxd r13, esi
+.L.body.shift_char:
+  .loc 1 60
+  xor eax, eax
+  movsxd r12, eax
+  .loc 1 60
+  mov rax, r12
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 60
+  mov rax, r13
+  movsxd rax, eax
+  mov rdi, r14
+  sub rax, rdi
+  mov qword ptr [rsp-32], rax
+  .loc 1 60
+  mov eax, 15
+  cmp rax, qword ptr [rsp-32]
+  jge .L.else.94
+  .loc 1 60
+  mov rax, r12
+  add eax, 1
+  movsxd rax, eax
+  add rax, qword ptr [rsp-40]
+  mov qword ptr [rsp-24], rax
+  .loc 1 60
+  mov rax, qword ptr [rsp-32]
+  shl rax, 0
+  mov qword ptr [rsp-16], rax
+  .loc 1 60
+  mov rax, qword ptr [rsp-40]
+  add rax, r12
+  mov qword ptr [rsp-8], rax
+  .loc 1 60
+  mov rax, qword ptr [rsp-24]
+  cmp rax, qword ptr [rsp-8]
+  je .L.skip.96
+  .loc 1 60
+  mov rax, qword ptr [rsp-24]
+  add rax, qword ptr [rsp-16]
+  cmp rax, qword ptr [rsp-8]
+  jle .L.skip.97
+  .loc 1 60
+  mov rax, qword ptr [rsp-8]
+  add rax, qword ptr [rsp-16]
+  cmp rax, qword ptr [rsp-24]
+  jg .L.end.94
+.L.skip.97:
+.L.skip.96:
+  .loc 1 60
+  mov rax, qword ptr [rsp-32]
+  sar rax, 4
+  mov rcx, rax
+  .loc 1 60
+  mov rax, qword ptr [rsp-8]
+  mov rsi, rax
+  .loc 1 60
+  mov eax, 1
+  movq xmm2, rax
+  punpcklbw xmm2, xmm2
+  punpcklwd xmm2, xmm2
+  pshufd xmm2, xmm2, 0
+  .loc 1 60
+  mov rax, qword ptr [rsp-24]
+  mov rdi, rax
+.L.vector.98:
+  movdqu xmm0, [rsi]
+  paddb xmm0, xmm2
+  movdqu [rdi], xmm0
+  add rsi, 16
+  add rdi, 16
+  sub rcx, 1
+  jnz .L.vector.98
+  .loc 1 60
+  mov rax, -16
+  and rax, qword ptr [rsp-32]
+  add r12d, eax
+  movsxd r12, r12d
+.L.else.95:
+.L.end.95:
+.L.else.94:
+.L.end.94:
+  .loc 1 60
+  mov rax, r12
+  movsxd rax, eax
+  shl rax, 0
+  add rax, qword ptr [rsp-40]
+  mov rbx, rax
+  .loc 1 60
+  mov rax, r13
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 60
+  mov eax, 3
+  mov r15, rax
+  .loc 1 60
+  mov rax, r12
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.26
+.L.begin.99:
+  .loc 1 60
+  movsx eax, byte ptr [rbx]
+  add eax, 1
+  movsx eax, al
+  mov byte ptr [rbx+1], al
+  .loc 1 60
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 60
+  add rbx, 1
+  mov rax, rbx
+  .loc 1 60
+  movsx eax, byte ptr [rbx]
+  add eax, 1
+  movsx eax, al
+  mov byte ptr [rbx+1], al
+  .loc 1 60
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 60
+  add rbx, 1
+  mov rax, rbx
+  .loc 1 60
+  movsx eax, byte ptr [rbx]
+  add eax, 1
+  movsx eax, al
+  mov byte ptr [rbx+1], al
+  .loc 1 60
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 60
+  add rbx, 1
+  mov rax, rbx
+  .loc 1 60
+  movsx eax, byte ptr [rbx]
+  add eax, 1
+  movsx eax, al
+  mov byte ptr [rbx+1], al
+.L.opt.27:
+  .loc 1 60
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 60
+  add rbx, 1
+  mov rax, rbx
+.L.cond.99:
+  .loc 1 60
+  mov rax, r13
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 60
+  mov eax, 3
+  mov r15, rax
+  .loc 1 60
+  mov rax, r12
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.99
+.L.opt.26:
+  .loc 1 60
+  mov rax, r12
+  cmp eax, r13d
+  jge .L..12
+.L.begin.100:
+  .loc 1 60
+  movsx eax, byte ptr [rbx]
+  add eax, 1
+  movsx eax, al
+  mov byte ptr [rbx+1], al
+.L..13:
+  .loc 1 60
+  add r12d, 1
+  movsxd r12, r12d
+  mov rax, r12
+  .loc 1 60
+  add rbx, 1
+  mov rax, rbx
+.L.cond.100:
+  .loc 1 60
+  mov rax, r12
+  cmp eax, r13d
+  jl .L.begin.100
+.L..12:
+.L.return.shift_char:
+  mov rbx, [rsp-48]
+  mov r12, [rsp-56]
+  mov r13, [rsp-64]
+  mov r14, [rsp-72]
+  mov r15, [rsp-80]
+  ret
+  .globl or_inplace
+  .text
+or_inplace:
+  mov [rsp-72], rbx
+  mov [rsp-80], r12
+  mov [rsp-88], r13
+  mov [rsp-96], r14
+  mov [rsp-104], r15
+  mov [rsp-48], rdi
+  mov [rsp-56], rsi
+  mov [rsp-60], edx
+.L.body.or_inplace:
+  .loc 1 59
+  xor eax, eax
+  movsxd r13, eax
+  .loc 1 59
+  mov rax, r13
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 59
+  movsxd rax, dword ptr [rsp-60]
+  mov rdi, r14
+  sub rax, rdi
+  mov qword ptr [rsp-40], rax
+  .loc 1 59
+  mov eax, 3
+  cmp rax, qword ptr [rsp-40]
+  jge .L.else.101
+  .loc 1 59
+  mov rax, r13
+  movsxd rax, eax
+  shl rax, 2
+  add rax, qword ptr [rsp-48]
+  mov qword ptr [rsp-32], rax
+  .loc 1 59
+  mov rax, qword ptr [rsp-40]
+  shl rax, 2
+  mov qword ptr [rsp-24], rax
+  .loc 1 59
+  mov rax, r13
+  movsxd rax, eax
+  shl rax, 2
+  add rax, qword ptr [rsp-48]
+  mov qword ptr [rsp-16], rax
+  .loc 1 59
+  mov rax, r13
+  movsxd rax, eax
+  shl rax, 2
+  add rax, qword ptr [rsp-56]
+  mov qword ptr [rsp-8], rax
+  .loc 1 59
+  mov rax, qword ptr [rsp-32]
+  cmp rax, qword ptr [rsp-8]
+  je .L.skip.103
+  .loc 1 59
+  mov rax, qword ptr [rsp-32]
+  add rax, qword ptr [rsp-24]
+  cmp rax, qword ptr [rsp-8]
+  jle .L.skip.104
+  .loc 1 59
+  mov rax, qword ptr [rsp-8]
+  add rax, qword ptr [rsp-24]
+  cmp rax, qword ptr [rsp-32]
+  jg .L.end.101
+.L.skip.104:
+.L.skip.103:
+  .loc 1 59
+  mov rax, qword ptr [rsp-40]
+  sar rax, 2
+  mov rcx, rax
+  .loc 1 59
+  mov rax, qword ptr [rsp-16]
+  mov rsi, rax
+  .loc 1 59
+  mov rax, qword ptr [rsp-8]
+  mov rdx, rax
+  .loc 1 59
+  mov rax, qword ptr [rsp-32]
+  mov rdi, rax
+.L.vector.105:
+  movdqu xmm0, [rsi]
+  movdqu xmm3, [rdx]
+  por xmm0, xmm3
+  movdqu [rdi], xmm0
+  add rsi, 16
+  add rdx, 16
+  add rdi, 16
+  sub rcx, 1
+  jnz .L.vector.105
+  .loc 1 59
+  mov rax, -4
+  and rax, qword ptr [rsp-40]
+  add r13d, eax
+  movsxd r13, r13d
+.L.else.102:
+.L.end.102:
+.L.else.101:
+.L.end.101:
+  .loc 1 59
+  mov rax, r13
+  movsxd rax, eax
+  shl rax, 2
+  add rax, qword ptr [rsp-48]
+  mov rbx, rax
+  .loc 1 59
+  mov rax, r13
+  movsxd rax, eax
+  shl rax, 2
+  add rax, qword ptr [rsp-56]
+  mov r12, rax
+  .loc 1 59
+  movsxd rax, dword ptr [rsp-60]
+  mov r14, rax
+  .loc 1 59
+  mov eax, 3
+  mov r15, rax
+  .loc 1 59
+  mov rax, r13
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.28
+.L.begin.106:
+  .loc 1 59
+  movsxd rax, dword ptr [r12]
+  or dword ptr [rbx], eax
+  .loc 1 59
+  add r13d, 1
+  movsxd r13, r13d
+  mov rax, r13
+  .loc 1 59
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 59
+  add r12, 4
+  mov rax, r12
+  .loc 1 59
+  movsxd rax, dword ptr [r12]
+  or dword ptr [rbx], eax
+  .loc 1 59
+  add r13d, 1
+  movsxd r13, r13d
+  mov rax, r13
+  .loc 1 59
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 59
+  add r12, 4
+  mov rax, r12
+  .loc 1 59
+  movsxd rax, dword ptr [r12]
+  or dword ptr [rbx], eax
+  .loc 1 59
+  add r13d, 1
+  movsxd r13, r13d
+  mov rax, r13
+  .loc 1 59
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 59
+  add r12, 4
+  mov rax, r12
+  .loc 1 59
+  movsxd rax, dword ptr [r12]
+  or dword ptr [rbx], eax
+.L.opt.29:
+  .loc 1 59
+  add r13d, 1
+  movsxd r13, r13d
+  mov rax, r13
+  .loc 1 59
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 59
+  add r12, 4
+  mov rax, r12
+.L.cond.106:
+  .loc 1 59
+  movsxd rax, dword ptr [rsp-60]
+  mov r14, rax
+  .loc 1 59
+  mov eax, 3
+  mov r15, rax
+  .loc 1 59
+  mov rax, r13
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.106
+.L.opt.28:
+  .loc 1 59
+  mov rax, r13
+  cmp eax, dword ptr [rsp-60]
+  jge .L..10
+.L.begin.107:
+  .loc 1 59
+  movsxd rax, dword ptr [r12]
+  or dword ptr [rbx], eax
+.L..11:
+  .loc 1 59
+  add r13d, 1
+  movsxd r13, r13d
+  mov rax, r13
+  .loc 1 59
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 59
+  add r12, 4
+  mov rax, r12
+.L.cond.107:
+  .loc 1 59
+  mov rax, r13
+  cmp eax, dword ptr [rsp-60]
+  jl .L.begin.107
+.L..10:
+.L.return.or_inplace:
+  mov rbx, [rsp-72]
+  mov r12, [rsp-80]
+  mov r13, [rsp-88]
+  mov r14, [rsp-96]
+  mov r15, [rsp-104]
+  ret
+  .globl and_long
+  .text
+and_long:
+  mov [rsp-88], rbx
+  mov [rsp-96], r12
+  mov [rsp-104], r13
+  mov [rsp-112], r14
+  mov [rsp-120], r15
+  mov [rsp-56], rdi
+  mov [rsp-64], rsi
+  mov [rsp-72], rdx
+  mov [rsp-76], ecx
+.L.body.and_long:
+  .loc 1 58
+  mov dword ptr [rsp-48], 0
+  .loc 1 58
+  movsxd rax, dword ptr [rsp-76]
+  sub eax, 1
+  mov dword ptr [rsp-44], eax
+  .loc 1 58
+  mov eax, 1
+  mov r14, rax
+  .loc 1 58
+  movsxd rax, dword ptr [rsp-48]
+  mov r15, rax
+  .loc 1 58
+  movsxd rax, dword ptr [rsp-44]
+  mov rdi, r15
+  sub rax, rdi
+  mov rdi, r14
+  add rax, rdi
+  mov qword ptr [rsp-40], rax
+  .loc 1 58
+  mov eax, 1
+  cmp rax, qword ptr [rsp-40]
+  jge .L.else.108
+  .loc 1 58
+  movsxd rax, dword ptr [rsp-48]
+  shl rax, 3
+  add rax, qword ptr [rsp-56]
+  mov qword ptr [rsp-32], rax
+  .loc 1 58
+  mov rax, qword ptr [rsp-40]
+  shl rax, 3
+  mov qword ptr [rsp-24], rax
+  .loc 1 58
+  movsxd rax, dword ptr [rsp-48]
+  shl rax, 3
+  add rax, qword ptr [rsp-64]
+  mov qword ptr [rsp-16], rax
+  .loc 1 58
+  movsxd rax, dword ptr [rsp-48]
+  shl rax, 3
+  add rax, qword ptr [rsp-72]
+  mov qword ptr [rsp-8], rax
+  .loc 1 58
+  mov rax, qword ptr [rsp-32]
+  cmp rax, qword ptr [rsp-16]
+  je .L.skip.110
+  .loc 1 58
+  mov rax, qword ptr [rsp-32]
+  add rax, qword ptr [rsp-24]
+  cmp rax, qword ptr [rsp-16]
+  jle .L.skip.111
+  .loc 1 58
+  mov rax, qword ptr [rsp-16]
+  add rax, qword ptr [rsp-24]
+  cmp rax, qword ptr [rsp-32]
+  jg .L.end.108
+.L.skip.111:
+.L.skip.110:
+  .loc 1 58
+  mov rax, qword ptr [rsp-32]
+  cmp rax, qword ptr [rsp-8]
+  je .L.skip.112
+  .loc 1 58
+  mov rax, qword ptr [rsp-32]
+  add rax, qword ptr [rsp-24]
+  cmp rax, qword ptr [rsp-8]
+  jle .L.skip.113
+  .loc 1 58
+  mov rax, qword ptr [rsp-8]
+  add rax, qword ptr [rsp-24]
+  cmp rax, qword ptr [rsp-32]
+  jg .L.end.108
+.L.skip.113:
+.L.skip.112:
+  .loc 1 58
+  mov rax, qword ptr [rsp-40]
+  sar rax, 1
+  mov rcx, rax
+  .loc 1 58
+  mov rax, qword ptr [rsp-16]
+  mov rsi, rax
+  .loc 1 58
+  mov rax, qword ptr [rsp-8]
+  mov rdx, rax
+  .loc 1 58
+  mov rax, qword ptr [rsp-32]
+  mov rdi, rax
+.L.vector.114:
+  movdqu xmm0, [rsi]
+  movdqu xmm3, [rdx]
+  pand xmm0, xmm3
+  movdqu [rdi], xmm0
+  add rsi, 16
+  add rdx, 16
+  add rdi, 16
+  sub rcx, 1
+  jnz .L.vector.114
+  .loc 1 58
+  mov rax, -2
+  and rax, qword ptr [rsp-40]
+  add dword ptr [rsp-48], eax
+.L.else.109:
+.L.end.109:
+.L.else.108:
+.L.end.108:
+  .loc 1 58
+  movsxd rax, dword ptr [rsp-48]
+  shl rax, 3
+  add rax, qword ptr [rsp-56]
+  mov r13, rax
+  .loc 1 58
+  movsxd rax, dword ptr [rsp-48]
+  shl rax, 3
+  add rax, qword ptr [rsp-64]
+  mov r12, rax
+  .loc 1 58
+  movsxd rax, dword ptr [rsp-48]
+  shl rax, 3
+  add rax, qword ptr [rsp-72]
+  mov rbx, rax
+  .loc 1 58
+  movsxd rax, dword ptr [rsp-44]
+  mov r14, rax
+  .loc 1 58
+  mov eax, 3
+  mov r15, rax
+  .loc 1 58
+  movsxd rax, dword ptr [rsp-48]
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jg .L.opt.30
+.L.begin.115:
+  .loc 1 58
+  mov rax, qword ptr [r12]
+  and rax, qword ptr [rbx]
+  mov qword ptr [r13], rax
+  .loc 1 58
+  inc dword ptr [rsp-48]
+  movsxd rax, dword ptr [rsp-48]
+  .loc 1 58
+  add r13, 8
+  mov rax, r13
+  .loc 1 58
+  add r12, 8
+  mov rax, r12
+  .loc 1 58
+  add rbx, 8
+  mov rax, rbx
+  .loc 1 58
+  mov rax, qword ptr [r12]
+  and rax, qword ptr [rbx]
+  mov qword ptr [r13], rax
+  .loc 1 58
+  inc dword ptr [rsp-48]
+  movsxd rax, dword ptr [rsp-48]
+  .loc 1 58
+  add r13, 8
+  mov rax, r13
+  .loc 1 58
+  add r12, 8
+  mov rax, r12
+  .loc 1 58
+  add rbx, 8
+  mov rax, rbx
+  .loc 1 58
+  mov rax, qword ptr [r12]
+  and rax, qword ptr [rbx]
+  mov qword ptr [r13], rax
+  .loc 1 58
+  inc dword ptr [rsp-48]
+  movsxd rax, dword ptr [rsp-48]
+  .loc 1 58
+  add r13, 8
+  mov rax, r13
+  .loc 1 58
+  add r12, 8
+  mov rax, r12
+  .loc 1 58
+  add rbx, 8
+  mov rax, rbx
+  .loc 1 58
+  mov rax, qword ptr [r12]
+  and rax, qword ptr [rbx]
+  mov qword ptr [r13], rax
+.L.opt.31:
+  .loc 1 58
+  inc dword ptr [rsp-48]
+  movsxd rax, dword ptr [rsp-48]
+  .loc 1 58
+  add r13, 8
+  mov rax, r13
+  .loc 1 58
+  add r12, 8
+  mov rax, r12
+  .loc 1 58
+  add rbx, 8
+  mov rax, rbx
+.L.cond.115:
+  .loc 1 58
+  movsxd rax, dword ptr [rsp-44]
+  mov r14, rax
+  .loc 1 58
+  mov eax, 3
+  mov r15, rax
+  .loc 1 58
+  movsxd rax, dword ptr [rsp-48]
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jle .L.begin.115
+.L.opt.30:
+  .loc 1 58
+  movsxd rax, dword ptr [rsp-48]
+  cmp eax, dword ptr [rsp-44]
+  jg .L..8
+.L.begin.116:
+  .loc 1 58
+  mov rax, qword ptr [r12]
+  and rax, qword ptr [rbx]
+  mov qword ptr [r13], rax
+.L..9:
+  .loc 1 58
+  inc dword ptr [rsp-48]
+  movsxd rax, dword ptr [rsp-48]
+  .loc 1 58
+  add r13, 8
+  mov rax, r13
+  .loc 1 58
+  add r12, 8
+  mov rax, r12
+  .loc 1 58
+  add rbx, 8
+  mov rax, rbx
+.L.cond.116:
+  .loc 1 58
+  movsxd rax, dword ptr [rsp-48]
+  cmp eax, dword ptr [rsp-44]
+  jle .L.begin.116
+.L..8:
+.L.return.and_long:
+  mov rbx, [rsp-88]
+  mov r12, [rsp-96]
+  mov r13, [rsp-104]
+  mov r14, [rsp-112]
+  mov r15, [rsp-120]
+  ret
+  .globl xor_char
+  .text
+xor_char:
+  mov [rsp-64], rbx
+  mov [rsp-72], r12
+  mov [rsp-80], r13
+  mov [rsp-88], r14
+  mov [rsp-96], r15
+  mov [rsp-40], rdi
+  mov [rsp-48], rsi
+  mov [rsp-49], dl
+  mov [rsp-56], ecx
+.L.body.xor_char:
+  .loc 1 57
+  xor eax, eax
+  movsxd r13, eax
+  .loc 1 57
+  mov rax, r13
+  movsxd rax, eax
+  mov r14, rax
+  .loc 1 57
+  movsxd rax, dword ptr [rsp-56]
+  mov rdi, r14
+  sub rax, rdi
+  mov qword ptr [rsp-32], rax
+  .loc 1 57
+  mov eax, 15
+  cmp rax, qword ptr [rsp-32]
+  jge .L.else.117
+  .loc 1 57
+  mov rax, qword ptr [rsp-40]
+  add rax, r13
+  mov qword ptr [rsp-24], rax
+  .loc 1 57
+  mov rax, qword ptr [rsp-32]
+  shl rax, 0
+  mov qword ptr [rsp-16], rax
+  .loc 1 57
+  mov rax, qword ptr [rsp-48]
+  add rax, r13
+  mov qword ptr [rsp-8], rax
+  .loc 1 57
+  mov rax, qword ptr [rsp-24]
+  cmp rax, qword ptr [rsp-8]
+  je .L.skip.119
+  .loc 1 57
+  mov rax, qword ptr [rsp-24]
+  add rax, qword ptr [rsp-16]
+  cmp rax, qword ptr [rsp-8]
+  jle .L.skip.120
+  .loc 1 57
+  mov rax, qword ptr [rsp-8]
+  add rax, qword ptr [rsp-16]
+  cmp rax, qword ptr [rsp-24]
+  jg .L.end.117
+.L.skip.120:
+.L.skip.119:
+  .loc 1 57
+  mov rax, qword ptr [rsp-32]
+  sar rax, 4
+  mov rcx, rax
+  .loc 1 57
+  mov rax, qword ptr [rsp-8]
+  mov rsi, rax
+  .loc 1 57
+  movsx eax, byte ptr [rsp-49]
+  movq xmm2, rax
+  punpcklbw xmm2, xmm2
+  punpcklwd xmm2, xmm2
+  pshufd xmm2, xmm2, 0
+  .loc 1 57
+  mov rax, qword ptr [rsp-24]
+  mov rdi, rax
+.L.vector.121:
+  movdqu xmm0, [rsi]
+  pxor xmm0, xmm2
+  movdqu [rdi], xmm0
+  add rsi, 16
+  add rdi, 16
+  sub rcx, 1
+  jnz .L.vector.121
+  .loc 1 57
+  mov rax, -16
+  and rax, qword ptr [rsp-32]
+  add r13d, eax
+  movsxd r13, r13d
+.L.else.118:
+.L.end.118:
+.L.else.117:
+.L.end.117:
+  .loc 1 57
+  mov rax, r13
+  movsxd rax, eax
+  shl rax, 0
+  add rax, qword ptr [rsp-40]
+  mov r12, rax
+  .loc 1 57
+  mov rax, r13
+  movsxd rax, eax
+  shl rax, 0
+  add rax, qword ptr [rsp-48]
+  mov rbx, rax
+  .loc 1 57
+  movsxd rax, dword ptr [rsp-56]
+  mov r14, rax
+  .loc 1 57
+  mov eax, 3
+  mov r15, rax
+  .loc 1 57
+  mov rax, r13
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.32
+.L.begin.122:
+  .loc 1 57
+  movsx eax, byte ptr [rsp-49]
+  mov r14, rax
+  .loc 1 57
+  movsx eax, byte ptr [rbx]
+  mov rdi, r14
+  xor rax, rdi
+  movsx eax, al
+  mov byte ptr [r12], al
+  .loc 1 57
+  add r13d, 1
+  movsxd r13, r13d
+  mov rax, r13
+  .loc 1 57
+  add r12, 1
+  mov rax, r12
+  .loc 1 57
+  add rbx, 1
+  mov rax, rbx
+  .loc 1 57
+  movsx eax, byte ptr [rsp-49]
+  mov r14, rax
+  .loc 1 57
+  movsx eax, byte ptr [rbx]
+  mov rdi, r14
+  xor rax, rdi
+  movsx eax, al
+  mov byte ptr [r12], al
+  .loc 1 57
+  add r13d, 1
+  movsxd r13, r13d
+  mov rax, r13
+  .loc 1 57
+  add r12, 1
+  mov rax, r12
+  .loc 1 57
+  add rbx, 1
+  mov rax, rbx
+  .loc 1 57
+  movsx eax, byte ptr [rsp-49]
+  mov r14, rax
+  .loc 1 57
+  movsx eax, byte ptr [rbx]
+  mov rdi, r14
+  xor rax, rdi
+  movsx eax, al
+  mov byte ptr [r12], al
+  .loc 1 57
+  add r13d, 1
+  movsxd r13, r13d
+  mov rax, r13
+  .loc 1 57
+  add r12, 1
+  mov rax, r12
+  .loc 1 57
+  add rbx, 1
+  mov rax, rbx
+  .loc 1 57
+  movsx eax, byte ptr [rsp-49]
+  mov r14, rax
+  .loc 1 57
+  movsx eax, byte ptr [rbx]
+  mov rdi, r14
+  xor rax, rdi
+  movsx eax, al
+  mov byte ptr [r12], al
+.L.opt.33:
+  .loc 1 57
+  add r13d, 1
+  movsxd r13, r13d
+  mov rax, r13
+  .loc 1 57
+  add r12, 1
+  mov rax, r12
+  .loc 1 57
+  add rbx, 1
+  mov rax, rbx
+.L.cond.122:
+  .loc 1 57
+  movsxd rax, dword ptr [rsp-56]
+  mov r14, rax
+  .loc 1 57
+  mov eax, 3
+  mov r15, rax
+  .loc 1 57
+  mov rax, r13
+  movsxd rax, eax
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.122
+.L.opt.32:
+  .loc 1 57
+  mov rax, r13
+  cmp eax, dword ptr [rsp-56]
+  jge .L..6
+.L.begin.123:
+  .loc 1 57
+  movsx eax, byte ptr [rsp-49]
+  mov r14, rax
+  .loc 1 57
+  movsx eax, byte ptr [rbx]
+  mov rdi, r14
+  xor rax, rdi
+  movsx eax, al
+  mov byte ptr [r12], al
+.L..7:
+  .loc 1 57
+  add r13d, 1
+  movsxd r13, r13d
+  mov rax, r13
+  .loc 1 57
+  add r12, 1
+  mov rax, r12
+  .loc 1 57
+  add rbx, 1
+  mov rax, rbx
+.L.cond.123:
+  .loc 1 57
+  mov rax, r13
+  cmp eax, dword ptr [rsp-56]
+  jl .L.begin.123
+.L..6:
+.L.return.xor_char:
+  mov rbx, [rsp-64]
+  mov r12, [rsp-72]
+  mov r13, [rsp-80]
+  mov r14, [rsp-88]
+  mov r15, [rsp-96]
+  ret
+  .globl sub_short
+  .text
+sub_short:
+  mov [rsp-88], rbx
+  mov [rsp-96], r12
+  mov [rsp-104], r13
+  mov [rsp-112], r14
+  mov [rsp-120], r15
+  mov [rsp-56], rdi
+  mov [rsp-64], rsi
+  mov [rsp-72], rdx
+  mov [rsp-76], ecx
+.L.body.sub_short:
+  .loc 1 56
+  mov dword ptr [rsp-44], 0
+  .loc 1 56
+  movsxd rax, dword ptr [rsp-44]
+  mov r14, rax
+  .loc 1 56
+  movsxd rax, dword ptr [rsp-76]
+  mov rdi, r14
+  sub rax, rdi
+  mov qword ptr [rsp-40], rax
+  .loc 1 56
+  mov eax, 7
+  cmp rax, qword ptr [rsp-40]
+  jge .L.else.124
+  .loc 1 56
+  movsxd rax, dword ptr [rsp-44]
+  shl rax, 1
+  add rax, qword ptr [rsp-56]
+  mov qword ptr [rsp-32], rax
+  .loc 1 56
+  mov rax, qword ptr [rsp-40]
+  shl rax, 1
+  mov qword ptr [rsp-24], rax
+  .loc 1 56
+  movsxd rax, dword ptr [rsp-44]
+  shl rax, 1
+  add rax, qword ptr [rsp-64]
+  mov qword ptr [rsp-16], rax
+  .loc 1 56
+  movsxd rax, dword ptr [rsp-44]
+  shl rax, 1
+  add rax, qword ptr [rsp-72]
+  mov qword ptr [rsp-8], rax
+  .loc 1 56
+  mov rax, qword ptr [rsp-32]
+  cmp rax, qword ptr [rsp-16]
+  je .L.skip.126
+  .loc 1 56
+  mov rax, qword ptr [rsp-32]
+  add rax, qword ptr [rsp-24]
+  cmp rax, qword ptr [rsp-16]
+  jle .L.skip.127
+  .loc 1 56
+  mov rax, qword ptr [rsp-16]
+  add rax, qword ptr [rsp-24]
+  cmp rax, qword ptr [rsp-32]
+  jg .L.end.124
+.L.skip.127:
+.L.skip.126:
+  .loc 1 56
+  mov rax, qword ptr [rsp-32]
+  cmp rax, qword ptr [rsp-8]
+  je .L.skip.128
+  .loc 1 56
+  mov rax, qword ptr [rsp-32]
+  add rax, qword ptr [rsp-24]
+  cmp rax, qword ptr [rsp-8]
+  jle .L.skip.129
+  .loc 1 56
+  mov rax, qword ptr [rsp-8]
+  add rax, qword ptr [rsp-24]
+  cmp rax, qword ptr [rsp-32]
+  jg .L.end.124
+.L.skip.129:
+.L.skip.128:
+  .loc 1 56
+  mov rax, qword ptr [rsp-40]
+  sar rax, 3
+  mov rcx, rax
+  .loc 1 56
+  mov rax, qword ptr [rsp-16]
+  mov rsi, rax
+  .loc 1 56
+  mov rax, qword ptr [rsp-8]
+  mov rdx, rax
+  .loc 1 56
+  mov rax, qword ptr [rsp-32]
+  mov rdi, rax
+.L.vector.130:
+  movdqu xmm0, [rsi]
+  movdqu xmm3, [rdx]
+  psubw xmm0, xmm3
+  movdqu [rdi], xmm0
+  add rsi, 16
+  add rdx, 16
+  add rdi, 16
+  sub rcx, 1
+  jnz .L.vector.130
+  .loc 1 56
+  mov rax, -8
+  and rax, qword ptr [rsp-40]
+  add dword ptr [rsp-44], eax
+.L.else.125:
+.L.end.125:
+.L.else.124:
+.L.end.124:
+  .loc 1 56
+  movsxd rax, dword ptr [rsp-44]
+  shl rax, 1
+  add rax, qword ptr [rsp-56]
+  mov r13, rax
+  .loc 1 56
+  movsxd rax, dword ptr [rsp-44]
+  shl rax, 1
+  add rax, qword ptr [rsp-64]
+  mov r12, rax
+  .loc 1 56
+  movsxd rax, dword ptr [rsp-44]
+  shl rax, 1
+  add rax, qword ptr [rsp-72]
+  mov rbx, rax
+  .loc 1 56
+  movsxd rax, dword ptr [rsp-76]
+  mov r14, rax
+  .loc 1 56
+  mov eax, 3
+  mov r15, rax
+  .loc 1 56
+  movsxd rax, dword ptr [rsp-44]
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.34
+.L.begin.131:
+  .loc 1 56
+  movsx eax, word ptr [rbx]
+  mov r14, rax
+  .loc 1 56
+  movsx eax, word ptr [r12]
+  mov rdi, r14
+  sub eax, edi
+  movsx eax, ax
+  mov word ptr [r13], ax
+  .loc 1 56
+  inc dword ptr [rsp-44]
+  movsxd rax, dword ptr [rsp-44]
+  .loc 1 56
+  add r13, 2
+  mov rax, r13
+  .loc 1 56
+  add r12, 2
+  mov rax, r12
+  .loc 1 56
+  add rbx, 2
+  mov rax, rbx
+  .loc 1 56
+  movsx eax, word ptr [rbx]
+  mov r14, rax
+  .loc 1 56
+  movsx eax, word ptr [r12]
+  mov rdi, r14
+  sub eax, edi
+  movsx eax, ax
+  mov word ptr [r13], ax
+  .loc 1 56
+  inc dword ptr [rsp-44]
+  movsxd rax, dword ptr [rsp-44]
+  .loc 1 56
+  add r13, 2
+  mov rax, r13
+  .loc 1 56
+  add r12, 2
+  mov rax, r12
+  .loc 1 56
+  add rbx, 2
+  mov rax, rbx
+  .loc 1 56
+  movsx eax, word ptr [rbx]
+  mov r14, rax
+  .loc 1 56
+  movsx eax, word ptr [r12]
+  mov rdi, r14
+  sub eax, edi
+  movsx eax, ax
+  mov word ptr [r13], ax
+  .loc 1 56
+  inc dword ptr [rsp-44]
+  movsxd rax, dword ptr [rsp-44]
+  .loc 1 56
+  add r13, 2
+  mov rax, r13
+  .loc 1 56
+  add r12, 2
+  mov rax, r12
+  .loc 1 56
+  add rbx, 2
+  mov rax, rbx
+  .loc 1 56
+  movsx eax, word ptr [rbx]
+  mov r14, rax
+  .loc 1 56
+  movsx eax, word ptr [r12]
+  mov rdi, r14
+  sub eax, edi
+  movsx eax, ax
+  mov word ptr [r13], ax
+.L.opt.35:
+  .loc 1 56
+  inc dword ptr [rsp-44]
+  movsxd rax, dword ptr [rsp-44]
+  .loc 1 56
+  add r13, 2
+  mov rax, r13
+  .loc 1 56
+  add r12, 2
+  mov rax, r12
+  .loc 1 56
+  add rbx, 2
+  mov rax, rbx
+.L.cond.131:
+  .loc 1 56
+  movsxd rax, dword ptr [rsp-76]
+  mov r14, rax
+  .loc 1 56
+  mov eax, 3
+  mov r15, rax
+  .loc 1 56
+  movsxd rax, dword ptr [rsp-44]
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.131
+.L.opt.34:
+  .loc 1 56
+  movsxd rax, dword ptr [rsp-44]
+  cmp eax, dword ptr [rsp-76]
+  jge .L..4
+.L.begin.132:
+  .loc 1 56
+  movsx eax, word ptr [rbx]
+  mov r14, rax
+  .loc 1 56
+  movsx eax, word ptr [r12]
+  mov rdi, r14
+  sub eax, edi
+  movsx eax, ax
+  mov word ptr [r13], ax
+.L..5:
+  .loc 1 56
+  inc dword ptr [rsp-44]
+  movsxd rax, dword ptr [rsp-44]
+  .loc 1 56
+  add r13, 2
+  mov rax, r13
+  .loc 1 56
+  add r12, 2
+  mov rax, r12
+  .loc 1 56
+  add rbx, 2
+  mov rax, rbx
+.L.cond.132:
+  .loc 1 56
+  movsxd rax, dword ptr [rsp-44]
+  cmp eax, dword ptr [rsp-76]
+  jl .L.begin.132
+.L..4:
+.L.return.sub_short:
+  mov rbx, [rsp-88]
+  mov r12, [rsp-96]
+  mov r13, [rsp-104]
+  mov r14, [rsp-112]
+  mov r15, [rsp-120]
+  ret
+  .globl add_int
+  .text
+add_int:
+  mov [rsp-88], rbx
+  mov [rsp-96], r12
+  mov [rsp-104], r13
+  mov [rsp-112], r14
+  mov [rsp-120], r15
+  mov [rsp-56], rdi
+  mov [rsp-64], rsi
+  mov [rsp-72], rdx
+  mov [rsp-76], ecx
+.L.body.add_int:
+  .loc 1 55
+  mov dword ptr [rsp-44], 0
+  .loc 1 55
+  movsxd rax, dword ptr [rsp-44]
+  mov r14, rax
+  .loc 1 55
+  movsxd rax, dword ptr [rsp-76]
+  mov rdi, r14
+  sub rax, rdi
+  mov qword ptr [rsp-40], rax
+  .loc 1 55
+  mov eax, 3
+  cmp rax, qword ptr [rsp-40]
+  jge .L.else.133
+  .loc 1 55
+  movsxd rax, dword ptr [rsp-44]
+  shl rax, 2
+  add rax, qword ptr [rsp-56]
+  mov qword ptr [rsp-32], rax
+  .loc 1 55
+  mov rax, qword ptr [rsp-40]
+  shl rax, 2
+  mov qword ptr [rsp-24], rax
+  .loc 1 55
+  movsxd rax, dword ptr [rsp-44]
+  shl rax, 2
+  add rax, qword ptr [rsp-64]
+  mov qword ptr [rsp-16], rax
+  .loc 1 55
+  movsxd rax, dword ptr [rsp-44]
+  shl rax, 2
+  add rax, qword ptr [rsp-72]
+  mov qword ptr [rsp-8], rax
+  .loc 1 55
+  mov rax, qword ptr [rsp-32]
+  cmp rax, qword ptr [rsp-16]
+  je .L.skip.135
+  .loc 1 55
+  mov rax, qword ptr [rsp-32]
+  add rax, qword ptr [rsp-24]
+  cmp rax, qword ptr [rsp-16]
+  jle .L.skip.136
+  .loc 1 55
+  mov rax, qword ptr [rsp-16]
+  add rax, qword ptr [rsp-24]
+  cmp rax, qword ptr [rsp-32]
+  jg .L.end.133
+.L.skip.136:
+.L.skip.135:
+  .loc 1 55
+  mov rax, qword ptr [rsp-32]
+  cmp rax, qword ptr [rsp-8]
+  je .L.skip.137
+  .loc 1 55
+  mov rax, qword ptr [rsp-32]
+  add rax, qword ptr [rsp-24]
+  cmp rax, qword ptr [rsp-8]
+  jle .L.skip.138
+  .loc 1 55
+  mov rax, qword ptr [rsp-8]
+  add rax, qword ptr [rsp-24]
+  cmp rax, qword ptr [rsp-32]
+  jg .L.end.133
+.L.skip.138:
+.L.skip.137:
+  .loc 1 55
+  mov rax, qword ptr [rsp-40]
+  sar rax, 2
+  mov rcx, rax
+  .loc 1 55
+  mov rax, qword ptr [rsp-16]
+  mov rsi, rax
+  .loc 1 55
+  mov rax, qword ptr [rsp-8]
+  mov rdx, rax
+  .loc 1 55
+  mov rax, qword ptr [rsp-32]
+  mov rdi, rax
+.L.vector.139:
+  movdqu xmm0, [rsi]
+  movdqu xmm3, [rdx]
+  paddd xmm0, xmm3
+  movdqu [rdi], xmm0
+  add rsi, 16
+  add rdx, 16
+  add rdi, 16
+  sub rcx, 1
+  jnz .L.vector.139
+  .loc 1 55
+  mov rax, -4
+  and rax, qword ptr [rsp-40]
+  add dword ptr [rsp-44], eax
+.L.else.134:
+.L.end.134:
+.L.else.133:
+.L.end.133:
+  .loc 1 55
+  movsxd rax, dword ptr [rsp-44]
+  shl rax, 2
+  add rax, qword ptr [rsp-56]
+  mov r13, rax
+  .loc 1 55
+  movsxd rax, dword ptr [rsp-44]
+  shl rax, 2
+  add rax, qword ptr [rsp-64]
+  mov r12, rax
+  .loc 1 55
+  movsxd rax, dword ptr [rsp-44]
+  shl rax, 2
+  add rax, qword ptr [rsp-72]
+  mov rbx, rax
+  .loc 1 55
+  movsxd rax, dword ptr [rsp-76]
+  mov r14, rax
+  .loc 1 55
+  mov eax, 3
+  mov r15, rax
+  .loc 1 55
+  movsxd rax, dword ptr [rsp-44]
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jge .L.opt.36
+.L.begin.140:
+  .loc 1 55
+  movsxd rax, dword ptr [r12]
+  add eax, dword ptr [rbx]
+  mov dword ptr [r13], eax
+  .loc 1 55
+  inc dword ptr [rsp-44]
+  movsxd rax, dword ptr [rsp-44]
+  .loc 1 55
+  add r13, 4
+  mov rax, r13
+  .loc 1 55
+  add r12, 4
+  mov rax, r12
+  .loc 1 55
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 55
+  movsxd rax, dword ptr [r12]
+  add eax, dword ptr [rbx]
+  mov dword ptr [r13], eax
+  .loc 1 55
+  inc dword ptr [rsp-44]
+  movsxd rax, dword ptr [rsp-44]
+  .loc 1 55
+  add r13, 4
+  mov rax, r13
+  .loc 1 55
+  add r12, 4
+  mov rax, r12
+  .loc 1 55
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 55
+  movsxd rax, dword ptr [r12]
+  add eax, dword ptr [rbx]
+  mov dword ptr [r13], eax
+  .loc 1 55
+  inc dword ptr [rsp-44]
+  movsxd rax, dword ptr [rsp-44]
+  .loc 1 55
+  add r13, 4
+  mov rax, r13
+  .loc 1 55
+  add r12, 4
+  mov rax, r12
+  .loc 1 55
+  add rbx, 4
+  mov rax, rbx
+  .loc 1 55
+  movsxd rax, dword ptr [r12]
+  add eax, dword ptr [rbx]
+  mov dword ptr [r13], eax
+.L.opt.37:
+  .loc 1 55
+  inc dword ptr [rsp-44]
+  movsxd rax, dword ptr [rsp-44]
+  .loc 1 55
+  add r13, 4
+  mov rax, r13
+  .loc 1 55
+  add r12, 4
+  mov rax, r12
+  .loc 1 55
+  add rbx, 4
+  mov rax, rbx
+.L.cond.140:
+  .loc 1 55
+  movsxd rax, dword ptr [rsp-76]
+  mov r14, rax
+  .loc 1 55
+  mov eax, 3
+  mov r15, rax
+  .loc 1 55
+  movsxd rax, dword ptr [rsp-44]
+  mov rdi, r15
+  add rax, rdi
+  mov rdi, r14
+  cmp rax, rdi
+  jl .L.begin.140
+.L.opt.36:
+  .loc 1 55
+  movsxd rax, dword ptr [rsp-44]
+  cmp eax, dword ptr [rsp-76]
+  jge .L..2
+.L.begin.141:
+  .loc 1 55
+  movsxd rax, dword ptr [r12]
+  add eax, dword ptr [rbx]
+  mov dword ptr [r13], eax
+.L..3:
+  .loc 1 55
+  inc dword ptr [rsp-44]
+  movsxd rax, dword ptr [rsp-44]
+  .loc 1 55
+  add r13, 4
+  mov rax, r13
+  .loc 1 55
+  add r12, 4
+  mov rax, r12
+  .loc 1 55
+  add rbx, 4
+  mov rax, rbx
+.L.cond.141:
+  .loc 1 55
+  movsxd rax, dword ptr [rsp-44]
+  cmp eax, dword ptr [rsp-76]
+  jl .L.begin.141
+.L..2:
+.L.return.add_int:
+  mov rbx, [rsp-88]
+  mov r12, [rsp-96]
+  mov r13, [rsp-104]
+  mov r14, [rsp-112]
+  mov r15, [rsp-120]
+  ret
+  .globl fill
+  .text
+fill:
+  mov [rsp-8], rbx
+  mov [rsp-16], r12
+  mov [rsp-24], r13
+  movsxd r12, edi
+.L.body.fill:
+  .loc 1 46
+  xor eax, eax
+  movsxd rbx, eax
+  .loc 1 47
+  cmp ebx, 100
+  jge .L..0
+.L.begin.142:
+  .loc 1 48
+  mov rax, rbx
+  imul eax, r12d
+  add eax, 7
+  movsx eax, al
+  mov r13, rax
+  lea rax, c1[rip]
+  mov rdx, r13
+  mov byte ptr [rax+rbx*1], dl
+  .loc 1 48
+  mov rax, rbx
+  lea eax, [rax+rax*2]
+  mov r13, rax
+  .loc 1 48
+  mov eax, 100
+  mov rdi, r13
+  sub eax, edi
+  movsx eax, al
+  mov r13, rax
+  lea rax, c2[rip]
+  mov rdx, r13
+  mov byte ptr [rax+rbx*1], dl
+  .loc 1 48
+  lea rax, c3[rip]
+  mov byte ptr [rax+rbx*1], 0
+  .loc 1 49
+  mov rax, rbx
+  imul eax, r12d
+  imul eax, eax, 300
+  sub eax, 5000
+  movsx eax, ax
+  mov r13, rax
+  lea rax, s1[rip]
+  mov rdx, r13
+  mov word ptr [rax+rbx*2], dx
+  .loc 1 49
+  mov rax, rbx
+  imul eax, eax, 77
+  movsx eax, ax
+  mov r13, rax
+  lea rax, s2[rip]
+  mov rdx, r13
+  mov word ptr [rax+rbx*2], dx
+  .loc 1 49
+  lea rax, s3[rip]
+  mov word ptr [rax+rbx*2], 0
+  .loc 1 50
+  mov rax, rbx
+  imul eax, r12d
+  imul eax, eax, 1000003
+  sub eax, 99
+  mov r13, rax
+  lea rax, i1[rip]
+  mov rdx, r13
+  mov dword ptr [rax+rbx*4], edx
+  .loc 1 50
+  mov rax, rbx
+  imul eax, eax, -12345
+  mov r13, rax
+  lea rax, i2[rip]
+  mov rdx, r13
+  mov dword ptr [rax+rbx*4], edx
+  .loc 1 50
+  lea rax, i3[rip]
+  mov dword ptr [rax+rbx*4], 0
+  .loc 1 51
+  mov rax, 100000000007
+  mov r13, rax
+  .loc 1 51
+  mov rax, rbx
+  imul eax, r12d
+  movsxd rax, eax
+  mov rdi, r13
+  imul rax, rdi
+  mov r13, rax
+  lea rax, l1[rip]
+  mov rdx, r13
+  mov qword ptr [rax+rbx*8], rdx
+  .loc 1 51
+  mov eax, 5
+  sub eax, ebx
+  movsxd rax, eax
+  mov r13, rax
+  lea rax, l2[rip]
+  mov rdx, r13
+  mov qword ptr [rax+rbx*8], rdx
+  .loc 1 51
+  lea rax, l3[rip]
+  mov qword ptr [rax+rbx*8], 0
+  .loc 1 52
+  add ebx, 1
+  movsxd rbx, ebx
+.L..1:
+.L.cond.142:
+  cmp ebx, 100
+  jl .L.begin.142
+.L..0:
+.L.return.fill:
+  mov rbx, [rsp-8]
+  mov r12, [rsp-16]
+  mov r13, [rsp-24]
+  ret